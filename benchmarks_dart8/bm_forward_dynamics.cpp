@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// Compares the throughput of the dart8 forward dynamics with the classic
+// dart::simulation::World on equivalent serial chains of revolute joints
+
+#include <dart8/body/rigid_body.hpp>
+#include <dart8/multi_body/link.hpp>
+#include <dart8/multi_body/multi_body.hpp>
+#include <dart8/world.hpp>
+
+#include <dart/dynamics/BodyNode.hpp>
+#include <dart/dynamics/RevoluteJoint.hpp>
+#include <dart/dynamics/Skeleton.hpp>
+#include <dart/simulation/World.hpp>
+
+#include <Eigen/Geometry>
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+namespace {
+
+constexpr double kTimeStep = 0.001;
+constexpr double kLinkLength = 0.1;
+constexpr double kLinkMass = 1.0;
+
+// Alternates the joint axes so that the chain moves out of plane
+Eigen::Vector3d chainAxis(int index)
+{
+  return (index % 2 == 0) ? Eigen::Vector3d::UnitY()
+                          : Eigen::Vector3d::UnitX();
+}
+
+Eigen::Isometry3d chainJointToLink()
+{
+  Eigen::Isometry3d transform = Eigen::Isometry3d::Identity();
+  transform.translation() << 0.0, 0.0, -kLinkLength;
+  return transform;
+}
+
+Eigen::Matrix3d chainInertia()
+{
+  return 0.01 * Eigen::Matrix3d::Identity();
+}
+
+void buildChain(dart8::World& world, int numLinks)
+{
+  auto multiBody = world.addMultiBody("chain");
+  auto parent = multiBody.addLink("base");
+  for (int i = 0; i < numLinks; ++i) {
+    const std::string name = "link" + std::to_string(i);
+    parent = multiBody.addLink(
+        name,
+        {
+            .parentLink = parent,
+            .jointName = name + "_joint",
+            .jointType = dart8::comps::JointType::Revolute,
+            .axis = chainAxis(i),
+            .transformFromParentJoint = chainJointToLink(),
+            .mass = kLinkMass,
+            .inertia = chainInertia(),
+        });
+  }
+}
+
+dart::simulation::WorldPtr buildClassicChain(int numLinks)
+{
+  auto skeleton = dart::dynamics::Skeleton::create("chain");
+  dart::dynamics::BodyNode* parent = nullptr;
+  for (int i = 0; i < numLinks; ++i) {
+    dart::dynamics::RevoluteJoint::Properties properties;
+    properties.mAxis = chainAxis(i);
+    properties.mT_ChildBodyToJoint = chainJointToLink().inverse();
+    parent = skeleton
+                 ->createJointAndBodyNodePair<dart::dynamics::RevoluteJoint>(
+                     parent, properties)
+                 .second;
+    parent->setInertia(dart::dynamics::Inertia(
+        kLinkMass, Eigen::Vector3d::Zero(), chainInertia()));
+  }
+
+  auto world = dart::simulation::World::create();
+  world->setTimeStep(kTimeStep);
+  world->addSkeleton(skeleton);
+  return world;
+}
+
+} // namespace
+
+//==============================================================================
+static void BM_Dart8ChainStep(benchmark::State& state)
+{
+  const int numLinks = static_cast<int>(state.range(0));
+  dart8::World world;
+  world.setTimeStep(kTimeStep);
+  buildChain(world, numLinks);
+  world.enterSimulationMode();
+
+  for (auto _ : state) {
+    world.step();
+  }
+
+  state.SetItemsProcessed(state.iterations() * numLinks);
+}
+BENCHMARK(BM_Dart8ChainStep)->RangeMultiplier(4)->Range(1, 256);
+
+//==============================================================================
+static void BM_ClassicChainStep(benchmark::State& state)
+{
+  const int numLinks = static_cast<int>(state.range(0));
+  auto world = buildClassicChain(numLinks);
+
+  for (auto _ : state) {
+    world->step();
+  }
+
+  state.SetItemsProcessed(state.iterations() * numLinks);
+}
+BENCHMARK(BM_ClassicChainStep)->RangeMultiplier(4)->Range(1, 256);
+
+//==============================================================================
+static void BM_Dart8RigidBodyStep(benchmark::State& state)
+{
+  const int numBodies = static_cast<int>(state.range(0));
+  dart8::World world;
+  world.setTimeStep(kTimeStep);
+  for (int i = 0; i < numBodies; ++i) {
+    world.addRigidBody("body" + std::to_string(i));
+  }
+  world.enterSimulationMode();
+
+  for (auto _ : state) {
+    world.step();
+  }
+
+  state.SetItemsProcessed(state.iterations() * numBodies);
+}
+BENCHMARK(BM_Dart8RigidBodyStep)->RangeMultiplier(8)->Range(1, 4096);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <dart8/frame/free_frame.hpp>
+#include <dart8/world.hpp>
+
+#include <Eigen/Geometry>
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+namespace {
+
+// Builds `numRoots` chains of `depth` free frames each
+std::vector<dart8::FreeFrame> buildChains(
+    dart8::World& world, int numRoots, int depth)
+{
+  Eigen::Isometry3d offset = Eigen::Isometry3d::Identity();
+  offset.translation() << 0.0, 0.0, 0.1;
+  offset.rotate(Eigen::AngleAxisd(0.1, Eigen::Vector3d::UnitX()));
+
+  std::vector<dart8::FreeFrame> roots;
+  for (int i = 0; i < numRoots; ++i) {
+    auto frame = world.addFreeFrame();
+    roots.push_back(frame);
+    for (int d = 1; d < depth; ++d) {
+      frame = world.addFreeFrame("", frame);
+      frame.setLocalTransform(offset);
+    }
+  }
+  return roots;
+}
+
+} // namespace
+
+//==============================================================================
+// Every root moves, so every frame is recomputed
+static void BM_UpdateKinematicsAllDirty(benchmark::State& state)
+{
+  dart8::World world;
+  world.setNumThreads(static_cast<std::size_t>(state.range(1)));
+  auto roots = buildChains(world, static_cast<int>(state.range(0)), 8);
+  world.enterSimulationMode();
+
+  Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();
+  for (auto _ : state) {
+    pose.translation().x() += 1e-3;
+    for (auto& root : roots) {
+      root.setLocalTransform(pose);
+    }
+    world.updateKinematics();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0) * 8);
+}
+BENCHMARK(BM_UpdateKinematicsAllDirty)
+    ->ArgsProduct({{64, 1024, 8192}, {1, 4}})
+    ->UseRealTime();
+
+//==============================================================================
+// A single root moves, so only its chain is recomputed
+static void BM_UpdateKinematicsOneDirty(benchmark::State& state)
+{
+  dart8::World world;
+  auto roots = buildChains(world, static_cast<int>(state.range(0)), 8);
+  world.enterSimulationMode();
+
+  Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();
+  for (auto _ : state) {
+    pose.translation().x() += 1e-3;
+    roots.front().setLocalTransform(pose);
+    world.updateKinematics();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0) * 8);
+}
+BENCHMARK(BM_UpdateKinematicsOneDirty)->Arg(64)->Arg(1024)->Arg(8192);
+
+BENCHMARK_MAIN();
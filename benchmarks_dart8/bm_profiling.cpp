@@ -79,4 +79,88 @@ static void BM_ManualProfiling(benchmark::State& state)
 }
 BENCHMARK(BM_ManualProfiling);
 
+// The benchmarks below use the profiler directly so that they measure it
+// whether or not DART8_ENABLE_PROFILING is defined
+
+// Benchmark the cost of entering and leaving one interned zone
+static void BM_ProfileScopeOverhead(benchmark::State& state)
+{
+  static const ProfileZone zone("bm_scope");
+  if (state.thread_index() == 0) {
+    ProfileStats::reset();
+  }
+
+  for (auto _ : state) {
+    ProfileScope scope(zone);
+    benchmark::ClobberMemory();
+  }
+}
+BENCHMARK(BM_ProfileScopeOverhead)->ThreadRange(1, 8);
+
+// Benchmark nested zones, which walk the children of the current call node
+static void BM_NestedProfileScopes(benchmark::State& state)
+{
+  static const ProfileZone outer("bm_outer");
+  static const ProfileZone siblings[] = {
+      ProfileZone("bm_child_0"),
+      ProfileZone("bm_child_1"),
+      ProfileZone("bm_child_2"),
+      ProfileZone("bm_child_3")};
+  ProfileStats::reset();
+
+  for (auto _ : state) {
+    ProfileScope outerScope(outer);
+    for (const auto& sibling : siblings) {
+      ProfileScope scope(sibling);
+      benchmark::ClobberMemory();
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * 5);
+}
+BENCHMARK(BM_NestedProfileScopes);
+
+// Benchmark one zone while recording Chrome trace events
+static void BM_ProfileScopeWithTrace(benchmark::State& state)
+{
+  static const ProfileZone zone("bm_trace");
+  ProfileStats::reset();
+  ProfileStats::setTraceEnabled(true);
+
+  for (auto _ : state) {
+    ProfileScope scope(zone);
+    benchmark::ClobberMemory();
+  }
+
+  ProfileStats::setTraceEnabled(false);
+  ProfileStats::reset();
+}
+BENCHMARK(BM_ProfileScopeWithTrace);
+
+// Benchmark ScopedTimer, which interns its name on every construction
+static void BM_ScopedTimerInterning(benchmark::State& state)
+{
+  ProfileStats::reset();
+
+  for (auto _ : state) {
+    ScopedTimer timer("bm_scoped_timer");
+    benchmark::ClobberMemory();
+  }
+}
+BENCHMARK(BM_ScopedTimerInterning);
+
+// Benchmark ScopedTimer with a zone interned once, as DART8_PROFILE_SCOPE_DUAL
+// does
+static void BM_ScopedTimerStaticZone(benchmark::State& state)
+{
+  static const ProfileZone zone("bm_scoped_timer");
+  ProfileStats::reset();
+
+  for (auto _ : state) {
+    ScopedTimer timer(zone);
+    benchmark::ClobberMemory();
+  }
+}
+BENCHMARK(BM_ScopedTimerStaticZone);
+
 BENCHMARK_MAIN();
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <dart8/frame/free_frame.hpp>
+#include <dart8/io/serializer.hpp>
+#include <dart8/world.hpp>
+
+#include <Eigen/Geometry>
+#include <benchmark/benchmark.h>
+
+#include <format>
+#include <sstream>
+#include <vector>
+
+namespace {
+
+std::vector<dart8::FreeFrame> fillWorld(dart8::World& world, int numFrames)
+{
+  std::vector<dart8::FreeFrame> frames;
+  for (int i = 0; i < numFrames; ++i) {
+    frames.push_back(world.addFreeFrame(std::format("frame_{}", i)));
+    Eigen::Isometry3d T = Eigen::Isometry3d::Identity();
+    T.translate(Eigen::Vector3d::Constant(i));
+    frames.back().setLocalTransform(T);
+  }
+  return frames;
+}
+
+} // namespace
+
+//==============================================================================
+// Per-entity records with a type-name string per component
+static void BM_SaveBinary(benchmark::State& state)
+{
+  dart8::World world;
+  fillWorld(world, static_cast<int>(state.range(0)));
+
+  for (auto _ : state) {
+    std::stringstream ss;
+    world.saveBinary(ss);
+    benchmark::DoNotOptimize(ss);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SaveBinary)->Arg(64)->Arg(1024)->Arg(8192);
+
+//==============================================================================
+// One section per component type, packed columns written in bulk
+static void BM_SaveSnapshot(benchmark::State& state)
+{
+  dart8::World world;
+  fillWorld(world, static_cast<int>(state.range(0)));
+
+  for (auto _ : state) {
+    std::stringstream ss;
+    world.saveSnapshot(ss);
+    benchmark::DoNotOptimize(ss);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SaveSnapshot)->Arg(64)->Arg(1024)->Arg(8192);
+
+//==============================================================================
+static void BM_LoadBinary(benchmark::State& state)
+{
+  dart8::World world;
+  fillWorld(world, static_cast<int>(state.range(0)));
+  std::stringstream source;
+  world.saveBinary(source);
+  const std::string bytes = source.str();
+
+  dart8::World loaded;
+  for (auto _ : state) {
+    std::stringstream ss(bytes);
+    loaded.loadBinary(ss);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_LoadBinary)->Arg(64)->Arg(1024)->Arg(8192);
+
+//==============================================================================
+static void BM_LoadSnapshot(benchmark::State& state)
+{
+  dart8::World world;
+  fillWorld(world, static_cast<int>(state.range(0)));
+  std::stringstream source;
+  world.saveSnapshot(source);
+  const std::string bytes = source.str();
+
+  dart8::World loaded;
+  for (auto _ : state) {
+    std::stringstream ss(bytes);
+    loaded.loadSnapshot(ss);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_LoadSnapshot)->Arg(64)->Arg(1024)->Arg(8192);
+
+//==============================================================================
+// High-rate logging: a few frames move between consecutive deltas
+static void BM_SaveDelta(benchmark::State& state)
+{
+  dart8::World world;
+  auto frames = fillWorld(world, static_cast<int>(state.range(0)));
+
+  dart8::io::SnapshotBaseline baseline;
+  std::stringstream initial;
+  world.saveSnapshot(initial, &baseline);
+
+  std::size_t bytes = 0;
+  std::size_t step = 0;
+  for (auto _ : state) {
+    state.PauseTiming();
+    for (std::size_t i = 0; i < 8; ++i) {
+      auto& frame = frames[(step * 8 + i) % frames.size()];
+      Eigen::Isometry3d T = frame.getLocalTransform();
+      T.translation().x() += 1e-3;
+      frame.setLocalTransform(T);
+    }
+    ++step;
+    state.ResumeTiming();
+
+    std::stringstream ss;
+    world.saveDelta(ss, baseline);
+    bytes += ss.str().size();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.counters["bytes"] = benchmark::Counter(
+      static_cast<double>(bytes) / static_cast<double>(state.iterations()));
+}
+BENCHMARK(BM_SaveDelta)->Arg(64)->Arg(1024)->Arg(8192);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <dart8/space/component_mapper.hpp>
+#include <dart8/space/vector_mapper.hpp>
+
+#include <Eigen/Core>
+#include <benchmark/benchmark.h>
+#include <entt/entt.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace {
+
+struct Body
+{
+  Eigen::Vector3d position{Eigen::Vector3d::Zero()};
+  Eigen::Vector3d velocity{Eigen::Vector3d::Zero()};
+  double mass{1.0};
+};
+
+// FieldMapper that opts out of the compiled plan, as every mapper ran before
+template <typename Field>
+class VirtualFieldMapper : public dart8::FieldMapper<Body, Field>
+{
+public:
+  using dart8::FieldMapper<Body, Field>::FieldMapper;
+
+  bool compile(std::vector<dart8::ComponentCopy>& copies) const override
+  {
+    (void)copies;
+    return false;
+  }
+};
+
+template <template <typename> class Mapper>
+dart8::VectorMapper makeMapper(int numBodies)
+{
+  dart8::StateSpace space;
+  space.addVariable("positions", 3 * numBodies);
+  space.addVariable("velocities", 3 * numBodies);
+  space.addVariable("masses", numBodies);
+  space.finalize();
+
+  dart8::VectorMapper mapper(space);
+  mapper.addMapper(
+      "positions", std::make_unique<Mapper<Eigen::Vector3d>>(&Body::position));
+  mapper.addMapper(
+      "velocities",
+      std::make_unique<Mapper<Eigen::Vector3d>>(&Body::velocity));
+  mapper.addMapper("masses", std::make_unique<Mapper<double>>(&Body::mass));
+  return mapper;
+}
+
+template <typename Field>
+using CompiledFieldMapper = dart8::FieldMapper<Body, Field>;
+
+void fillRegistry(entt::registry& registry, int numBodies)
+{
+  for (int i = 0; i < numBodies; ++i) {
+    registry.emplace<Body>(
+        registry.create(),
+        Body{Eigen::Vector3d::Constant(i), Eigen::Vector3d::Constant(-i), 1.0});
+  }
+}
+
+template <template <typename> class Mapper>
+void runRoundTrip(benchmark::State& state)
+{
+  const auto numBodies = static_cast<int>(state.range(0));
+  auto mapper = makeMapper<Mapper>(numBodies);
+  entt::registry registry;
+  fillRegistry(registry, numBodies);
+
+  Eigen::VectorXd vec(mapper.getDimension());
+  for (auto _ : state) {
+    mapper.toEigen(registry, vec);
+    vec[0] += 1e-3;
+    mapper.fromEigen(registry, vec);
+    benchmark::DoNotOptimize(vec.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * numBodies);
+}
+
+} // namespace
+
+//==============================================================================
+// One virtual call per variable and a view lookup per entity, as before the
+// plan existed
+static void BM_RoundTripVirtual(benchmark::State& state)
+{
+  runRoundTrip<VirtualFieldMapper>(state);
+}
+BENCHMARK(BM_RoundTripVirtual)->Arg(64)->Arg(1024)->Arg(8192);
+
+//==============================================================================
+// Strided copies over the packed Body storage
+static void BM_RoundTripCompiled(benchmark::State& state)
+{
+  runRoundTrip<CompiledFieldMapper>(state);
+}
+BENCHMARK(BM_RoundTripCompiled)->Arg(64)->Arg(1024)->Arg(8192);
+
+//==============================================================================
+// Many small registries, e.g., the rollouts of a sampling-based optimizer
+static void BM_ToMatrix(benchmark::State& state)
+{
+  const auto numRegistries = static_cast<int>(state.range(0));
+  auto mapper = makeMapper<CompiledFieldMapper>(16);
+  std::vector<entt::registry> registries(numRegistries);
+  std::vector<const entt::registry*> pointers;
+  for (auto& registry : registries) {
+    fillRegistry(registry, 16);
+    pointers.push_back(&registry);
+  }
+
+  Eigen::MatrixXd states(mapper.getDimension(), numRegistries);
+  for (auto _ : state) {
+    mapper.toMatrix(pointers, states);
+    benchmark::DoNotOptimize(states.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * numRegistries);
+}
+BENCHMARK(BM_ToMatrix)->Arg(64)->Arg(1024);
+
+BENCHMARK_MAIN();
@@ -123,6 +123,8 @@ public:
   /// Perform collision check for a single group. If nullptr is passed to
   /// result, then the this returns only simple information whether there is a
   /// collision of not.
+  ///
+  /// \return Whether any pair of objects that is not filtered out collides
   virtual bool collide(
       CollisionGroup* group,
       const CollisionOption& option = CollisionOption(false, 1u, nullptr),
@@ -132,6 +134,8 @@ public:
   /// Perform collision check for two groups. If nullptr is passed to
   /// result, then the this returns only simple information whether there is a
   /// collision of not.
+  ///
+  /// \return Whether any pair of objects that is not filtered out collides
   virtual bool collide(
       CollisionGroup* group1,
       CollisionGroup* group2,
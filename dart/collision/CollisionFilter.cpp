@@ -134,6 +134,16 @@ bool BodyNodeCollisionFilter::ignoresCollision(
   if (!skel1->isMobile() && !skel2->isMobile())
     return true;
 
+  // Sleeping skeletons stay still until an awake skeleton touches them, so
+  // their contacts with other skeletons that can't move are not needed
+  if (skel1->isSleeping() || skel2->isSleeping()) {
+    const auto isStill = [](const dynamics::Skeleton& skel) {
+      return !skel.isMobile() || skel.isSleeping() || skel.getNumDofs() == 0u;
+    };
+    if (isStill(*skel1) && isStill(*skel2))
+      return true;
+  }
+
   if (skel1 == skel2) {
     if (!skel1->isEnabledSelfCollisionCheck())
       return true;
@@ -324,8 +324,17 @@ void CollisionGroup::removeDeletedShapeFrames()
 //==============================================================================
 void CollisionGroup::updateEngineData()
 {
-  for (const auto& info : mObjectInfoList)
+  for (const auto& info : mObjectInfoList) {
+    // Objects of sleeping skeletons don't move, so their engine data only
+    // needs to be refreshed once after the skeleton falls asleep.
+    const auto* shapeNode = info->mFrame->asShapeNode();
+    const bool asleep = shapeNode && shapeNode->getSkeleton()->isSleeping();
+    if (asleep && info->mAsleep)
+      continue;
+
     info->mObject->updateEngineData();
+    info->mAsleep = asleep;
+  }
 
   updateCollisionGroupEngineData();
 }
@@ -628,6 +637,7 @@ bool CollisionGroup::updateShapeFrame(ObjectInfo* object)
 
     object->mLastKnownShapeID = currentID;
     object->mLastKnownVersion = currentVersion;
+    object->mAsleep = false;
 
     return true;
   }
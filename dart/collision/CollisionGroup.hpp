@@ -393,6 +393,11 @@ protected:
     /// When all sources are cleared out (via unsubscribing), this object will
     /// be removed from this group.
     std::unordered_set<const void*> mSources;
+
+    /// Whether the engine data was last refreshed while the skeleton of the
+    /// shape frame was asleep, in which case it doesn't need to be refreshed
+    /// again until the skeleton wakes up
+    bool mAsleep = false;
   };
 
   using ObjectInfoList = std::vector<std::unique_ptr<ObjectInfo>>;
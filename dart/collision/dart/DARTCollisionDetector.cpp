@@ -34,15 +34,20 @@
 
 #include "dart/collision/CollisionFilter.hpp"
 #include "dart/collision/CollisionObject.hpp"
+#include "dart/collision/DistanceFilter.hpp"
 #include "dart/collision/dart/DARTCollide.hpp"
 #include "dart/collision/dart/DARTCollisionGroup.hpp"
 #include "dart/collision/dart/DARTCollisionObject.hpp"
+#include "dart/collision/dart/DARTDistance.hpp"
 #include "dart/common/Logging.hpp"
 #include "dart/dynamics/BoxShape.hpp"
 #include "dart/dynamics/EllipsoidShape.hpp"
 #include "dart/dynamics/ShapeFrame.hpp"
 #include "dart/dynamics/SphereShape.hpp"
 
+#include <algorithm>
+#include <limits>
+
 namespace dart {
 namespace collision {
 
@@ -64,6 +69,19 @@ void postProcess(
     CollisionResult& totalResult,
     const CollisionResult& pairResult);
 
+double computeAabbDistance(
+    const Eigen::Vector3d& min1,
+    const Eigen::Vector3d& max1,
+    const Eigen::Vector3d& min2,
+    const Eigen::Vector3d& max2);
+
+bool checkDistancePair(
+    CollisionObject* o1,
+    CollisionObject* o2,
+    const DistanceOption& option,
+    double& minDistance,
+    DistanceResult* result);
+
 } // anonymous namespace
 
 //==============================================================================
@@ -140,33 +158,37 @@ bool DARTCollisionDetector::collide(
     return false;
 
   auto casted = static_cast<DARTCollisionGroup*>(group);
+  casted->updateEngineData();
+
   const auto& objects = casted->mCollisionObjects;
 
   if (objects.empty()) [[unlikely]]
     return false;
 
+  // Broad-phase: only the pairs whose AABBs overlap go to the narrow-phase
+  DARTCollisionGroup::IndexPairs pairs;
+  casted->computeOverlappingPairs(pairs);
+
   auto collisionFound = false;
   const auto& filter = option.collisionFilter;
 
-  for (auto i = 0u; i < objects.size() - 1; ++i) {
-    auto* collObj1 = objects[i];
-
-    for (auto j = i + 1u; j < objects.size(); ++j) {
-      auto* collObj2 = objects[j];
+  for (const auto& pair : pairs) {
+    auto* collObj1 = objects[pair.first];
+    auto* collObj2 = objects[pair.second];
 
-      if (filter && filter->ignoresCollision(collObj1, collObj2)) [[unlikely]]
-        continue;
+    if (filter && filter->ignoresCollision(collObj1, collObj2)) [[unlikely]]
+      continue;
 
-      collisionFound = checkPair(collObj1, collObj2, option, result);
+    if (checkPair(collObj1, collObj2, option, result))
+      collisionFound = true;
 
-      if (result) {
-        if (result->getNumContacts() >= option.maxNumContacts) [[unlikely]]
-          return true;
-      } else {
-        // If no result is passed, stop checking when the first contact is found
-        if (collisionFound) [[unlikely]]
-          return true;
-      }
+    if (result) {
+      if (result->getNumContacts() >= option.maxNumContacts) [[unlikely]]
+        return true;
+    } else {
+      // If no result is passed, stop checking when the first contact is found
+      if (collisionFound) [[unlikely]]
+        return true;
     }
   }
 
@@ -199,6 +221,8 @@ bool DARTCollisionDetector::collide(
 
   auto casted1 = static_cast<DARTCollisionGroup*>(group1);
   auto casted2 = static_cast<DARTCollisionGroup*>(group2);
+  casted1->updateEngineData();
+  casted2->updateEngineData();
 
   const auto& objects1 = casted1->mCollisionObjects;
   const auto& objects2 = casted2->mCollisionObjects;
@@ -206,28 +230,30 @@ bool DARTCollisionDetector::collide(
   if (objects1.empty() || objects2.empty()) [[unlikely]]
     return false;
 
+  // Broad-phase: only the pairs whose AABBs overlap go to the narrow-phase
+  DARTCollisionGroup::IndexPairs pairs;
+  casted1->computeOverlappingPairs(*casted2, pairs);
+
   auto collisionFound = false;
   const auto& filter = option.collisionFilter;
 
-  for (auto i = 0u; i < objects1.size(); ++i) {
-    auto* collObj1 = objects1[i];
+  for (const auto& pair : pairs) {
+    auto* collObj1 = objects1[pair.first];
+    auto* collObj2 = objects2[pair.second];
 
-    for (auto j = 0u; j < objects2.size(); ++j) {
-      auto* collObj2 = objects2[j];
-
-      if (filter && filter->ignoresCollision(collObj1, collObj2))
-        continue;
+    if (filter && filter->ignoresCollision(collObj1, collObj2))
+      continue;
 
-      collisionFound = checkPair(collObj1, collObj2, option, result);
+    if (checkPair(collObj1, collObj2, option, result))
+      collisionFound = true;
 
-      if (result) {
-        if (result->getNumContacts() >= option.maxNumContacts)
-          return true;
-      } else {
-        // If no result is passed, stop checking when the first contact is found
-        if (collisionFound)
-          return true;
-      }
+    if (result) {
+      if (result->getNumContacts() >= option.maxNumContacts)
+        return true;
+    } else {
+      // If no result is passed, stop checking when the first contact is found
+      if (collisionFound)
+        return true;
     }
   }
 
@@ -237,29 +263,114 @@ bool DARTCollisionDetector::collide(
 
 //==============================================================================
 double DARTCollisionDetector::distance(
-    CollisionGroup* /*group*/,
-    const DistanceOption& /*option*/,
-    DistanceResult* /*result*/)
+    CollisionGroup* group, const DistanceOption& option, DistanceResult* result)
 {
-  DART_WARN(
-      "This collision detector does not support (signed) distance queries. "
-      "Returning 0.0.");
+  if (result)
+    result->clear();
 
-  return 0.0;
+  if (!checkGroupValidity(this, group))
+    return 0.0;
+
+  auto casted = static_cast<DARTCollisionGroup*>(group);
+  casted->updateEngineData();
+
+  const auto& objects = casted->mCollisionObjects;
+  const auto& proxies = casted->mProxies;
+
+  auto minDistance = std::numeric_limits<double>::infinity();
+
+  // The proxies are sorted by the lower bound of their AABBs along the x-axis,
+  // so the scan for the partners of a proxy stops as soon as the gap along the
+  // x-axis alone exceeds the current minimum distance.
+  for (auto i = 0u; i < proxies.size(); ++i) {
+    const auto& proxy1 = proxies[i];
+
+    for (auto j = i + 1u; j < proxies.size(); ++j) {
+      const auto& proxy2 = proxies[j];
+
+      const double gap = proxy2.min.x() - proxy1.max.x();
+      if (gap > 0.0 && gap >= minDistance)
+        break;
+
+      if (computeAabbDistance(proxy1.min, proxy1.max, proxy2.min, proxy2.max)
+          >= minDistance) {
+        continue;
+      }
+
+      checkDistancePair(
+          objects[proxy1.index],
+          objects[proxy2.index],
+          option,
+          minDistance,
+          result);
+
+      if (minDistance <= option.distanceLowerBound)
+        return option.distanceLowerBound;
+    }
+  }
+
+  if (minDistance == std::numeric_limits<double>::infinity())
+    return 0.0;
+
+  return std::max(minDistance, option.distanceLowerBound);
 }
 
 //==============================================================================
 double DARTCollisionDetector::distance(
-    CollisionGroup* /*group1*/,
-    CollisionGroup* /*group2*/,
-    const DistanceOption& /*option*/,
-    DistanceResult* /*result*/)
+    CollisionGroup* group1,
+    CollisionGroup* group2,
+    const DistanceOption& option,
+    DistanceResult* result)
 {
-  DART_WARN(
-      "This collision detector does not support (signed) distance queries. "
-      "Returning 0.0.");
+  if (result)
+    result->clear();
+
+  if (!checkGroupValidity(this, group1))
+    return 0.0;
+
+  if (!checkGroupValidity(this, group2))
+    return 0.0;
 
-  return 0.0;
+  auto casted1 = static_cast<DARTCollisionGroup*>(group1);
+  auto casted2 = static_cast<DARTCollisionGroup*>(group2);
+  casted1->updateEngineData();
+  casted2->updateEngineData();
+
+  const auto& objects1 = casted1->mCollisionObjects;
+  const auto& objects2 = casted2->mCollisionObjects;
+  const auto& proxies1 = casted1->mProxies;
+  const auto& proxies2 = casted2->mProxies;
+
+  auto minDistance = std::numeric_limits<double>::infinity();
+
+  for (const auto& proxy1 : proxies1) {
+    auto* collObj1 = objects1[proxy1.index];
+
+    for (const auto& proxy2 : proxies2) {
+      const double gap = proxy2.min.x() - proxy1.max.x();
+      if (gap > 0.0 && gap >= minDistance)
+        break;
+
+      auto* collObj2 = objects2[proxy2.index];
+      if (collObj1 == collObj2)
+        continue;
+
+      if (computeAabbDistance(proxy1.min, proxy1.max, proxy2.min, proxy2.max)
+          >= minDistance) {
+        continue;
+      }
+
+      checkDistancePair(collObj1, collObj2, option, minDistance, result);
+
+      if (minDistance <= option.distanceLowerBound)
+        return option.distanceLowerBound;
+    }
+  }
+
+  if (minDistance == std::numeric_limits<double>::infinity())
+    return 0.0;
+
+  return std::max(minDistance, option.distanceLowerBound);
 }
 
 //==============================================================================
@@ -382,6 +493,60 @@ void postProcess(
   }
 }
 
+//==============================================================================
+double computeAabbDistance(
+    const Eigen::Vector3d& min1,
+    const Eigen::Vector3d& max1,
+    const Eigen::Vector3d& min2,
+    const Eigen::Vector3d& max2)
+{
+  const Eigen::Vector3d gap = (min2 - max1).cwiseMax(min1 - max2);
+
+  // Overlapping AABBs don't bound the penetration depth
+  if ((gap.array() <= 0.0).all())
+    return -std::numeric_limits<double>::infinity();
+
+  return gap.cwiseMax(0.0).norm();
+}
+
+//==============================================================================
+bool checkDistancePair(
+    CollisionObject* o1,
+    CollisionObject* o2,
+    const DistanceOption& option,
+    double& minDistance,
+    DistanceResult* result)
+{
+  const auto& filter = option.distanceFilter;
+  if (filter && !filter->needDistance(o1, o2))
+    return false;
+
+  double distance;
+  Eigen::Vector3d point1;
+  Eigen::Vector3d point2;
+  if (!computeDistance(o1, o2, distance, point1, point2))
+    return false;
+
+  if (distance >= minDistance)
+    return false;
+
+  minDistance = distance;
+
+  if (result) {
+    result->unclampedMinDistance = distance;
+    result->minDistance = std::max(distance, option.distanceLowerBound);
+    result->shapeFrame1 = o1->getShapeFrame();
+    result->shapeFrame2 = o2->getShapeFrame();
+
+    if (option.enableNearestPoints) {
+      result->nearestPoint1 = point1;
+      result->nearestPoint2 = point2;
+    }
+  }
+
+  return true;
+}
+
 } // anonymous namespace
 
 } // namespace collision
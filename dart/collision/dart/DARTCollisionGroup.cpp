@@ -33,10 +33,28 @@
 #include "dart/collision/dart/DARTCollisionGroup.hpp"
 
 #include "dart/collision/CollisionObject.hpp"
+#include "dart/collision/dart/DARTCollisionObject.hpp"
+
+#include <algorithm>
 
 namespace dart {
 namespace collision {
 
+namespace {
+
+//==============================================================================
+bool overlapsYZ(
+    const Eigen::Vector3d& min1,
+    const Eigen::Vector3d& max1,
+    const Eigen::Vector3d& min2,
+    const Eigen::Vector3d& max2)
+{
+  return min1[1] <= max2[1] && min2[1] <= max1[1] && min1[2] <= max2[2]
+         && min2[2] <= max1[2];
+}
+
+} // anonymous namespace
+
 //==============================================================================
 DARTCollisionGroup::DARTCollisionGroup(
     const CollisionDetectorPtr& collisionDetector)
@@ -55,9 +73,14 @@ void DARTCollisionGroup::initializeEngineData()
 void DARTCollisionGroup::addCollisionObjectToEngine(CollisionObject* object)
 {
   if (std::find(mCollisionObjects.begin(), mCollisionObjects.end(), object)
-      == mCollisionObjects.end()) {
-    mCollisionObjects.push_back(object);
+      != mCollisionObjects.end()) {
+    return;
   }
+
+  auto* casted = static_cast<DARTCollisionObject*>(object);
+  mProxies.push_back(
+      {casted->getAabbMin(), casted->getAabbMax(), mCollisionObjects.size()});
+  mCollisionObjects.push_back(object);
 }
 
 //==============================================================================
@@ -72,20 +95,129 @@ void DARTCollisionGroup::addCollisionObjectsToEngine(
 void DARTCollisionGroup::removeCollisionObjectFromEngine(
     CollisionObject* object)
 {
-  mCollisionObjects.erase(
-      std::remove(mCollisionObjects.begin(), mCollisionObjects.end(), object));
+  const auto it
+      = std::find(mCollisionObjects.begin(), mCollisionObjects.end(), object);
+  if (it == mCollisionObjects.end())
+    return;
+
+  const auto index
+      = static_cast<std::size_t>(std::distance(mCollisionObjects.begin(), it));
+  mCollisionObjects.erase(it);
+
+  mProxies.erase(
+      std::remove_if(
+          mProxies.begin(),
+          mProxies.end(),
+          [index](const Proxy& proxy) { return proxy.index == index; }),
+      mProxies.end());
+
+  for (auto& proxy : mProxies) {
+    if (proxy.index > index)
+      --proxy.index;
+  }
 }
 
 //==============================================================================
 void DARTCollisionGroup::removeAllCollisionObjectsFromEngine()
 {
   mCollisionObjects.clear();
+  mProxies.clear();
 }
 
 //==============================================================================
 void DARTCollisionGroup::updateCollisionGroupEngineData()
 {
-  // Do nothing
+  // Refit the proxies to the AABBs updated by the collision objects
+  for (auto& proxy : mProxies) {
+    const auto* object = static_cast<const DARTCollisionObject*>(
+        mCollisionObjects[proxy.index]);
+    proxy.min = object->getAabbMin();
+    proxy.max = object->getAabbMax();
+  }
+
+  // Insertion sort along the x-axis. The order from the previous update is
+  // mostly preserved, so this takes close to linear time.
+  for (auto i = 1u; i < mProxies.size(); ++i) {
+    if (!(mProxies[i].min[0] < mProxies[i - 1].min[0]))
+      continue;
+
+    Proxy proxy = mProxies[i];
+    auto j = i;
+    while (j > 0u && proxy.min[0] < mProxies[j - 1].min[0]) {
+      mProxies[j] = mProxies[j - 1];
+      --j;
+    }
+    mProxies[j] = proxy;
+  }
+}
+
+//==============================================================================
+void DARTCollisionGroup::computeOverlappingPairs(IndexPairs& pairs) const
+{
+  pairs.clear();
+
+  for (auto i = 0u; i < mProxies.size(); ++i) {
+    const auto& proxy1 = mProxies[i];
+
+    for (auto j = i + 1u; j < mProxies.size(); ++j) {
+      const auto& proxy2 = mProxies[j];
+
+      // No further proxies can overlap along the sweep axis
+      if (proxy2.min[0] > proxy1.max[0])
+        break;
+
+      if (!overlapsYZ(proxy1.min, proxy1.max, proxy2.min, proxy2.max))
+        continue;
+
+      pairs.emplace_back(
+          std::min(proxy1.index, proxy2.index),
+          std::max(proxy1.index, proxy2.index));
+    }
+  }
+
+  std::sort(pairs.begin(), pairs.end());
+}
+
+//==============================================================================
+void DARTCollisionGroup::computeOverlappingPairs(
+    const DARTCollisionGroup& other, IndexPairs& pairs) const
+{
+  pairs.clear();
+
+  const auto& proxies1 = mProxies;
+  const auto& proxies2 = other.mProxies;
+
+  // Merge the two sorted lists, sweeping each proxy against the proxies of
+  // the other group that start within its extent along the x-axis.
+  auto i = 0u;
+  auto j = 0u;
+  while (i < proxies1.size() && j < proxies2.size()) {
+    if (proxies1[i].min[0] <= proxies2[j].min[0]) {
+      const auto& proxy1 = proxies1[i];
+      for (auto k = j; k < proxies2.size(); ++k) {
+        const auto& proxy2 = proxies2[k];
+        if (proxy2.min[0] > proxy1.max[0])
+          break;
+
+        if (overlapsYZ(proxy1.min, proxy1.max, proxy2.min, proxy2.max))
+          pairs.emplace_back(proxy1.index, proxy2.index);
+      }
+      ++i;
+    } else {
+      const auto& proxy2 = proxies2[j];
+      for (auto k = i; k < proxies1.size(); ++k) {
+        const auto& proxy1 = proxies1[k];
+        if (proxy1.min[0] > proxy2.max[0])
+          break;
+
+        if (overlapsYZ(proxy1.min, proxy1.max, proxy2.min, proxy2.max))
+          pairs.emplace_back(proxy1.index, proxy2.index);
+      }
+      ++j;
+    }
+  }
+
+  std::sort(pairs.begin(), pairs.end());
 }
 
 } // namespace collision
@@ -35,6 +35,11 @@
 
 #include <dart/collision/CollisionGroup.hpp>
 
+#include <Eigen/Core>
+
+#include <utility>
+#include <vector>
+
 namespace dart {
 namespace collision {
 
@@ -52,6 +57,11 @@ public:
   virtual ~DARTCollisionGroup() = default;
 
 protected:
+  using CollisionGroup::updateEngineData;
+
+  /// Pairs of indices into mCollisionObjects
+  using IndexPairs = std::vector<std::pair<std::size_t, std::size_t>>;
+
   // Documentation inherited
   void initializeEngineData() override;
 
@@ -71,9 +81,40 @@ protected:
   // Documentation inherited
   void updateCollisionGroupEngineData() override;
 
+  /// Compute the pairs of objects in this group whose AABBs overlap. The pairs
+  /// are sorted in the same order that an all-pairs loop over
+  /// mCollisionObjects would visit them so that the narrow-phase results are
+  /// independent of the broad-phase.
+  void computeOverlappingPairs(IndexPairs& pairs) const;
+
+  /// Compute the pairs of objects, one from this group and one from
+  /// \c other, whose AABBs overlap. The first index of each pair refers to
+  /// this group and the second to \c other.
+  void computeOverlappingPairs(
+      const DARTCollisionGroup& other, IndexPairs& pairs) const;
+
 protected:
+  /// Broad-phase proxy of a CollisionObject
+  struct Proxy
+  {
+    /// Lower corner of the world-space AABB
+    Eigen::Vector3d min;
+
+    /// Upper corner of the world-space AABB
+    Eigen::Vector3d max;
+
+    /// Index of the CollisionObject in mCollisionObjects
+    std::size_t index;
+  };
+
   /// CollisionObjects added to this DARTCollisionGroup
   std::vector<CollisionObject*> mCollisionObjects;
+
+  /// Sweep-and-prune proxies sorted by the lower bound of the AABBs along the
+  /// x-axis. The order is refined incrementally by insertion sort in
+  /// updateCollisionGroupEngineData(), which is nearly linear for temporally
+  /// coherent scenes.
+  std::vector<Proxy> mProxies;
 };
 
 } // namespace collision
@@ -32,6 +32,10 @@
 
 #include "dart/collision/dart/DARTCollisionObject.hpp"
 
+#include "dart/dynamics/Shape.hpp"
+
+#include <limits>
+
 namespace dart {
 namespace collision {
 
@@ -39,15 +43,56 @@ namespace collision {
 DARTCollisionObject::DARTCollisionObject(
     CollisionDetector* collisionDetector,
     const dynamics::ShapeFrame* shapeFrame)
-  : CollisionObject(collisionDetector, shapeFrame)
+  : CollisionObject(collisionDetector, shapeFrame),
+    mAabbMin(Eigen::Vector3d::Constant(
+        -std::numeric_limits<double>::infinity())),
+    mAabbMax(
+        Eigen::Vector3d::Constant(std::numeric_limits<double>::infinity()))
 {
   // Do nothing
 }
 
+//==============================================================================
+const Eigen::Vector3d& DARTCollisionObject::getAabbMin() const
+{
+  return mAabbMin;
+}
+
+//==============================================================================
+const Eigen::Vector3d& DARTCollisionObject::getAabbMax() const
+{
+  return mAabbMax;
+}
+
 //==============================================================================
 void DARTCollisionObject::updateEngineData()
 {
-  // Do nothing
+  const auto shape = getShape();
+  if (!shape) {
+    mAabbMin.setConstant(-std::numeric_limits<double>::infinity());
+    mAabbMax.setConstant(std::numeric_limits<double>::infinity());
+    return;
+  }
+
+  const auto& localBox = shape->getBoundingBox();
+  const Eigen::Vector3d& localMin = localBox.getMin();
+  const Eigen::Vector3d& localMax = localBox.getMax();
+
+  // Unbounded shapes (e.g., PlaneShape) overlap everything
+  if (!localMin.allFinite() || !localMax.allFinite()) {
+    mAabbMin.setConstant(-std::numeric_limits<double>::infinity());
+    mAabbMax.setConstant(std::numeric_limits<double>::infinity());
+    return;
+  }
+
+  // Transform the local box into an enclosing world-space box
+  const Eigen::Isometry3d& tf = getTransform();
+  const Eigen::Vector3d center = tf * (0.5 * (localMin + localMax));
+  const Eigen::Vector3d halfExtents
+      = tf.linear().cwiseAbs() * (0.5 * (localMax - localMin));
+
+  mAabbMin = center - halfExtents;
+  mAabbMax = center + halfExtents;
 }
 
 } // namespace collision
@@ -46,6 +46,15 @@ class DARTCollisionObject : public CollisionObject
 {
 public:
   friend class DARTCollisionDetector;
+  friend class DARTCollisionGroup;
+
+  /// Return the lower corner of the world-space axis-aligned bounding box
+  /// computed by the last call of updateEngineData()
+  const Eigen::Vector3d& getAabbMin() const;
+
+  /// Return the upper corner of the world-space axis-aligned bounding box
+  /// computed by the last call of updateEngineData()
+  const Eigen::Vector3d& getAabbMax() const;
 
 protected:
   /// Constructor
@@ -55,6 +64,13 @@ protected:
 
   // Documentation inherited
   void updateEngineData() override;
+
+protected:
+  /// Lower corner of the world-space AABB used by the broad-phase
+  Eigen::Vector3d mAabbMin;
+
+  /// Upper corner of the world-space AABB used by the broad-phase
+  Eigen::Vector3d mAabbMax;
 };
 
 } // namespace collision
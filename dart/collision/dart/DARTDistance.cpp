@@ -0,0 +1,819 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "dart/collision/dart/DARTDistance.hpp"
+
+#include "dart/dynamics/BoxShape.hpp"
+#include "dart/dynamics/CapsuleShape.hpp"
+#include "dart/dynamics/CylinderShape.hpp"
+#include "dart/dynamics/EllipsoidShape.hpp"
+#include "dart/dynamics/MeshShape.hpp"
+#include "dart/dynamics/PlaneShape.hpp"
+#include "dart/dynamics/SphereShape.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <cmath>
+
+namespace dart {
+namespace collision {
+
+namespace {
+
+constexpr int maxGjkIterations = 128;
+constexpr int maxEpaIterations = 128;
+
+/// Relative tolerance on the squared distance for the GJK termination
+constexpr double gjkTolerance = 1e-12;
+
+/// Relative tolerance on the penetration depth for the EPA termination
+constexpr double epaTolerance = 1e-10;
+
+/// Squared distance below which GJK reports intersecting shapes
+constexpr double intersectionTolerance = 1e-20;
+
+//==============================================================================
+/// Convex shape given by the support mapping of its core swept by a sphere of
+/// radius margin. Spheres and capsules are represented as a point and a
+/// segment with a margin so that their distances are exact.
+struct ConvexShape
+{
+  enum class Type
+  {
+    Point,
+    Segment,
+    Box,
+    Cylinder,
+    Mesh
+  };
+
+  Type type = Type::Point;
+
+  /// Half extents of the core in the local frame. The x component is the
+  /// radius for a cylinder.
+  Eigen::Vector3d halfExtents = Eigen::Vector3d::Zero();
+
+  const aiScene* mesh = nullptr;
+
+  Eigen::Vector3d scale = Eigen::Vector3d::Ones();
+
+  double margin = 0.0;
+
+  Eigen::Isometry3d transform = Eigen::Isometry3d::Identity();
+
+  /// Returns the farthest point of the core along direction in world frame
+  Eigen::Vector3d supportCore(const Eigen::Vector3d& direction) const;
+
+  /// Returns the farthest point of the shape along direction in world frame
+  Eigen::Vector3d support(const Eigen::Vector3d& direction) const;
+};
+
+//==============================================================================
+Eigen::Vector3d ConvexShape::supportCore(const Eigen::Vector3d& direction) const
+{
+  const Eigen::Vector3d d = transform.linear().transpose() * direction;
+  Eigen::Vector3d local = Eigen::Vector3d::Zero();
+
+  switch (type) {
+    case Type::Point:
+      break;
+    case Type::Segment:
+      local.z() = d.z() < 0.0 ? -halfExtents.z() : halfExtents.z();
+      break;
+    case Type::Box:
+      for (int i = 0; i < 3; ++i)
+        local[i] = d[i] < 0.0 ? -halfExtents[i] : halfExtents[i];
+      break;
+    case Type::Cylinder: {
+      const double radial = std::sqrt(d.x() * d.x() + d.y() * d.y());
+      if (radial > 0.0) {
+        local.x() = halfExtents.x() * d.x() / radial;
+        local.y() = halfExtents.x() * d.y() / radial;
+      }
+      local.z() = d.z() < 0.0 ? -halfExtents.z() : halfExtents.z();
+      break;
+    }
+    case Type::Mesh: {
+      double maxDot = -std::numeric_limits<double>::infinity();
+      for (auto i = 0u; i < mesh->mNumMeshes; ++i) {
+        const aiMesh* subMesh = mesh->mMeshes[i];
+        for (auto j = 0u; j < subMesh->mNumVertices; ++j) {
+          const aiVector3D& v = subMesh->mVertices[j];
+          const Eigen::Vector3d vertex
+              = Eigen::Vector3d(v.x, v.y, v.z).cwiseProduct(scale);
+          const double dot = vertex.dot(d);
+          if (dot > maxDot) {
+            maxDot = dot;
+            local = vertex;
+          }
+        }
+      }
+      break;
+    }
+  }
+
+  return transform * local;
+}
+
+//==============================================================================
+Eigen::Vector3d ConvexShape::support(const Eigen::Vector3d& direction) const
+{
+  Eigen::Vector3d point = supportCore(direction);
+
+  if (margin > 0.0) {
+    const double norm = direction.norm();
+    if (norm > 0.0)
+      point += (margin / norm) * direction;
+  }
+
+  return point;
+}
+
+//==============================================================================
+bool makeConvexShape(const CollisionObject* object, ConvexShape& convex)
+{
+  const auto* shape = object->getShape().get();
+  if (!shape)
+    return false;
+
+  const auto& type = shape->getType();
+
+  if (dynamics::SphereShape::getStaticType() == type) {
+    const auto* sphere = static_cast<const dynamics::SphereShape*>(shape);
+    convex.type = ConvexShape::Type::Point;
+    convex.margin = sphere->getRadius();
+  } else if (dynamics::EllipsoidShape::getStaticType() == type) {
+    const auto* ellipsoid = static_cast<const dynamics::EllipsoidShape*>(shape);
+    if (!ellipsoid->isSphere())
+      return false;
+    convex.type = ConvexShape::Type::Point;
+    convex.margin = ellipsoid->getRadii()[0];
+  } else if (dynamics::BoxShape::getStaticType() == type) {
+    const auto* box = static_cast<const dynamics::BoxShape*>(shape);
+    convex.type = ConvexShape::Type::Box;
+    convex.halfExtents = 0.5 * box->getSize();
+  } else if (dynamics::CapsuleShape::getStaticType() == type) {
+    const auto* capsule = static_cast<const dynamics::CapsuleShape*>(shape);
+    convex.type = ConvexShape::Type::Segment;
+    convex.halfExtents.z() = 0.5 * capsule->getHeight();
+    convex.margin = capsule->getRadius();
+  } else if (dynamics::CylinderShape::getStaticType() == type) {
+    const auto* cylinder = static_cast<const dynamics::CylinderShape*>(shape);
+    convex.type = ConvexShape::Type::Cylinder;
+    convex.halfExtents << cylinder->getRadius(), cylinder->getRadius(),
+        0.5 * cylinder->getHeight();
+  } else if (dynamics::MeshShape::getStaticType() == type) {
+    const auto* meshShape = static_cast<const dynamics::MeshShape*>(shape);
+    const aiScene* mesh = meshShape->getMesh();
+    if (!mesh || mesh->mNumMeshes == 0u)
+      return false;
+    convex.type = ConvexShape::Type::Mesh;
+    convex.mesh = mesh;
+    convex.scale = meshShape->getScale();
+  } else {
+    return false;
+  }
+
+  convex.transform = object->getTransform();
+
+  return true;
+}
+
+//==============================================================================
+/// Vertex of the Minkowski difference A - B with the points on A and B that
+/// generated it
+struct SupportPoint
+{
+  Eigen::Vector3d a;
+  Eigen::Vector3d b;
+  Eigen::Vector3d w;
+};
+
+//==============================================================================
+SupportPoint computeSupport(
+    const ConvexShape& shapeA,
+    const ConvexShape& shapeB,
+    const Eigen::Vector3d& direction,
+    bool withMargin)
+{
+  SupportPoint point;
+  if (withMargin) {
+    point.a = shapeA.support(direction);
+    point.b = shapeB.support(-direction);
+  } else {
+    point.a = shapeA.supportCore(direction);
+    point.b = shapeB.supportCore(-direction);
+  }
+  point.w = point.a - point.b;
+
+  return point;
+}
+
+//==============================================================================
+/// Simplex of GJK with the barycentric coordinates of its point closest to
+/// the origin
+struct Simplex
+{
+  std::array<SupportPoint, 4> points;
+  std::array<double, 4> weights;
+  int size = 0;
+
+  Eigen::Vector3d closestPoint() const
+  {
+    Eigen::Vector3d point = Eigen::Vector3d::Zero();
+    for (int i = 0; i < size; ++i)
+      point += weights[i] * points[i].w;
+    return point;
+  }
+
+  Eigen::Vector3d witnessA() const
+  {
+    Eigen::Vector3d point = Eigen::Vector3d::Zero();
+    for (int i = 0; i < size; ++i)
+      point += weights[i] * points[i].a;
+    return point;
+  }
+
+  Eigen::Vector3d witnessB() const
+  {
+    Eigen::Vector3d point = Eigen::Vector3d::Zero();
+    for (int i = 0; i < size; ++i)
+      point += weights[i] * points[i].b;
+    return point;
+  }
+};
+
+//==============================================================================
+/// Feature of a triangle, or of a segment, closest to the origin given by the
+/// indices of its vertices and their barycentric coordinates
+struct Feature
+{
+  std::array<int, 3> indices;
+  std::array<double, 3> weights;
+  int size;
+};
+
+//==============================================================================
+Feature closestOnSegment(const Eigen::Vector3d& a, const Eigen::Vector3d& b)
+{
+  const Eigen::Vector3d ab = b - a;
+  const double denom = ab.squaredNorm();
+  const double t = denom > 0.0 ? -a.dot(ab) / denom : 0.0;
+
+  if (t <= 0.0)
+    return {{0, 0, 0}, {1.0, 0.0, 0.0}, 1};
+  if (t >= 1.0)
+    return {{1, 0, 0}, {1.0, 0.0, 0.0}, 1};
+
+  return {{0, 1, 0}, {1.0 - t, t, 0.0}, 2};
+}
+
+//==============================================================================
+Feature closestOnTriangle(
+    const Eigen::Vector3d& a,
+    const Eigen::Vector3d& b,
+    const Eigen::Vector3d& c)
+{
+  // Voronoi region tests of "Real-Time Collision Detection" (Ericson, 2005),
+  // Section 5.1.5, with the query point at the origin.
+  const Eigen::Vector3d ab = b - a;
+  const Eigen::Vector3d ac = c - a;
+
+  const double d1 = -ab.dot(a);
+  const double d2 = -ac.dot(a);
+  if (d1 <= 0.0 && d2 <= 0.0)
+    return {{0, 0, 0}, {1.0, 0.0, 0.0}, 1};
+
+  const double d3 = -ab.dot(b);
+  const double d4 = -ac.dot(b);
+  if (d3 >= 0.0 && d4 <= d3)
+    return {{1, 0, 0}, {1.0, 0.0, 0.0}, 1};
+
+  const double vc = d1 * d4 - d3 * d2;
+  if (vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0) {
+    const double t = d1 / (d1 - d3);
+    return {{0, 1, 0}, {1.0 - t, t, 0.0}, 2};
+  }
+
+  const double d5 = -ab.dot(c);
+  const double d6 = -ac.dot(c);
+  if (d6 >= 0.0 && d5 <= d6)
+    return {{2, 0, 0}, {1.0, 0.0, 0.0}, 1};
+
+  const double vb = d5 * d2 - d1 * d6;
+  if (vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0) {
+    const double t = d2 / (d2 - d6);
+    return {{0, 2, 0}, {1.0 - t, t, 0.0}, 2};
+  }
+
+  const double va = d3 * d6 - d5 * d4;
+  if (va <= 0.0 && (d4 - d3) >= 0.0 && (d5 - d6) >= 0.0) {
+    const double t = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+    return {{1, 2, 0}, {1.0 - t, t, 0.0}, 2};
+  }
+
+  const double sum = va + vb + vc;
+  if (sum <= 0.0) {
+    // Degenerate triangle; fall back to the closest edge
+    Feature best = closestOnSegment(a, b);
+    double bestDistance = std::numeric_limits<double>::infinity();
+    const std::array<std::array<int, 2>, 3> edges{{{0, 1}, {1, 2}, {2, 0}}};
+    const std::array<const Eigen::Vector3d*, 3> vertices{&a, &b, &c};
+    for (const auto& edge : edges) {
+      Feature feature
+          = closestOnSegment(*vertices[edge[0]], *vertices[edge[1]]);
+      Eigen::Vector3d point = Eigen::Vector3d::Zero();
+      for (int i = 0; i < feature.size; ++i) {
+        feature.indices[i] = edge[feature.indices[i]];
+        point += feature.weights[i] * *vertices[feature.indices[i]];
+      }
+      if (point.squaredNorm() < bestDistance) {
+        bestDistance = point.squaredNorm();
+        best = feature;
+      }
+    }
+    return best;
+  }
+
+  const double v = vb / sum;
+  const double w = vc / sum;
+  return {{0, 1, 2}, {1.0 - v - w, v, w}, 3};
+}
+
+//==============================================================================
+/// Returns true if the origin and the vertex d lie on different sides of the
+/// plane through a, b, and c, or if the tetrahedron is flat
+bool isOriginOutsideFace(
+    const Eigen::Vector3d& a,
+    const Eigen::Vector3d& b,
+    const Eigen::Vector3d& c,
+    const Eigen::Vector3d& d)
+{
+  const Eigen::Vector3d normal = (b - a).cross(c - a);
+  const double signOrigin = -a.dot(normal);
+  const double signD = (d - a).dot(normal);
+
+  return signOrigin * signD <= 0.0;
+}
+
+//==============================================================================
+/// Replaces the simplex with its smallest sub-simplex containing the point
+/// closest to the origin and stores the barycentric coordinates of the point.
+/// Returns true if the simplex is a tetrahedron containing the origin.
+bool reduceSimplex(Simplex& simplex)
+{
+  const auto apply = [&](const Feature& feature,
+                         const std::array<int, 4>& map) {
+    std::array<SupportPoint, 4> points = simplex.points;
+    for (int i = 0; i < feature.size; ++i) {
+      simplex.points[i] = points[map[feature.indices[i]]];
+      simplex.weights[i] = feature.weights[i];
+    }
+    simplex.size = feature.size;
+  };
+
+  const auto& p = simplex.points;
+
+  switch (simplex.size) {
+    case 1:
+      simplex.weights[0] = 1.0;
+      return false;
+    case 2:
+      apply(closestOnSegment(p[0].w, p[1].w), {0, 1, 0, 0});
+      return false;
+    case 3:
+      apply(closestOnTriangle(p[0].w, p[1].w, p[2].w), {0, 1, 2, 0});
+      return false;
+    default:
+      break;
+  }
+
+  const std::array<std::array<int, 4>, 4> faces{
+      {{0, 1, 2, 3}, {0, 2, 3, 1}, {0, 3, 1, 2}, {1, 3, 2, 0}}};
+
+  Feature best{};
+  std::array<int, 4> bestMap{};
+  double bestDistance = std::numeric_limits<double>::infinity();
+
+  for (const auto& face : faces) {
+    if (!isOriginOutsideFace(
+            p[face[0]].w, p[face[1]].w, p[face[2]].w, p[face[3]].w)) {
+      continue;
+    }
+
+    const Feature feature
+        = closestOnTriangle(p[face[0]].w, p[face[1]].w, p[face[2]].w);
+    Eigen::Vector3d point = Eigen::Vector3d::Zero();
+    for (int i = 0; i < feature.size; ++i)
+      point += feature.weights[i] * p[face[feature.indices[i]]].w;
+
+    if (point.squaredNorm() < bestDistance) {
+      bestDistance = point.squaredNorm();
+      best = feature;
+      bestMap = face;
+    }
+  }
+
+  if (bestDistance == std::numeric_limits<double>::infinity()) {
+    // Barycentric coordinates of the origin inside the tetrahedron
+    Eigen::Matrix3d edges;
+    edges << p[0].w - p[3].w, p[1].w - p[3].w, p[2].w - p[3].w;
+    const Eigen::Vector3d weights = edges.colPivHouseholderQr().solve(-p[3].w);
+    simplex.weights = {
+        weights[0], weights[1], weights[2], 1.0 - weights.sum()};
+    return true;
+  }
+
+  apply(best, bestMap);
+  return false;
+}
+
+//==============================================================================
+/// Runs GJK on the Minkowski difference of the shapes, with or without their
+/// margins. Returns true if the shapes intersect, in which case the simplex
+/// contains the origin. Otherwise, the simplex holds the closest features.
+bool runGjk(
+    const ConvexShape& shapeA,
+    const ConvexShape& shapeB,
+    bool withMargin,
+    Simplex& simplex)
+{
+  simplex.size = 0;
+
+  Eigen::Vector3d v
+      = shapeA.transform.translation() - shapeB.transform.translation();
+  if (v.squaredNorm() <= intersectionTolerance)
+    v = Eigen::Vector3d::UnitX();
+
+  for (int i = 0; i < maxGjkIterations; ++i) {
+    const SupportPoint point = computeSupport(shapeA, shapeB, -v, withMargin);
+
+    if (simplex.size > 0) {
+      const double vv = v.squaredNorm();
+      if (vv - v.dot(point.w) <= gjkTolerance * vv)
+        return false;
+
+      for (int j = 0; j < simplex.size; ++j) {
+        if ((simplex.points[j].w - point.w).squaredNorm()
+            <= intersectionTolerance) {
+          return false;
+        }
+      }
+    }
+
+    simplex.points[simplex.size++] = point;
+
+    if (reduceSimplex(simplex))
+      return true;
+
+    v = simplex.closestPoint();
+    if (v.squaredNorm() <= intersectionTolerance)
+      return true;
+  }
+
+  return false;
+}
+
+//==============================================================================
+/// Grows a simplex containing the origin into a tetrahedron with non-zero
+/// volume by adding support points of the shapes
+bool encloseOrigin(
+    const ConvexShape& shapeA, const ConvexShape& shapeB, Simplex& simplex)
+{
+  auto& p = simplex.points;
+
+  switch (simplex.size) {
+    case 1:
+      for (int i = 0; i < 3; ++i) {
+        for (const double sign : {1.0, -1.0}) {
+          p[1] = computeSupport(
+              shapeA, shapeB, sign * Eigen::Vector3d::Unit(i), true);
+          simplex.size = 2;
+          if (encloseOrigin(shapeA, shapeB, simplex))
+            return true;
+          simplex.size = 1;
+        }
+      }
+      return false;
+    case 2: {
+      const Eigen::Vector3d direction = p[1].w - p[0].w;
+      for (int i = 0; i < 3; ++i) {
+        const Eigen::Vector3d axis = direction.cross(Eigen::Vector3d::Unit(i));
+        if (axis.squaredNorm() <= 0.0)
+          continue;
+        for (const double sign : {1.0, -1.0}) {
+          p[2] = computeSupport(shapeA, shapeB, sign * axis, true);
+          simplex.size = 3;
+          if (encloseOrigin(shapeA, shapeB, simplex))
+            return true;
+          simplex.size = 2;
+        }
+      }
+      return false;
+    }
+    case 3: {
+      const Eigen::Vector3d normal = (p[1].w - p[0].w).cross(p[2].w - p[0].w);
+      if (normal.squaredNorm() <= 0.0)
+        return false;
+      for (const double sign : {1.0, -1.0}) {
+        p[3] = computeSupport(shapeA, shapeB, sign * normal, true);
+        simplex.size = 4;
+        if (encloseOrigin(shapeA, shapeB, simplex))
+          return true;
+        simplex.size = 3;
+      }
+      return false;
+    }
+    case 4: {
+      const Eigen::Vector3d ad = p[0].w - p[3].w;
+      const Eigen::Vector3d bd = p[1].w - p[3].w;
+      const Eigen::Vector3d cd = p[2].w - p[3].w;
+      const double scale = ad.norm() * bd.norm() * cd.norm();
+      return std::abs(ad.dot(bd.cross(cd))) > 1e-12 * scale;
+    }
+    default:
+      return false;
+  }
+}
+
+//==============================================================================
+struct PolytopeFace
+{
+  std::array<int, 3> vertices;
+  Eigen::Vector3d normal;
+  double distance;
+};
+
+//==============================================================================
+/// Buffers of the EPA polytope, which are kept across queries so that their
+/// memory is reused
+struct EpaScratch
+{
+  std::vector<SupportPoint> vertices;
+  std::vector<PolytopeFace> faces;
+  std::vector<std::pair<int, int>> horizon;
+};
+
+//==============================================================================
+/// Runs EPA on a tetrahedron containing the origin to find the penetration
+/// depth of the shapes and the deepest points on them
+bool runEpa(
+    const ConvexShape& shapeA,
+    const ConvexShape& shapeB,
+    const Simplex& simplex,
+    double& depth,
+    Eigen::Vector3d& pointA,
+    Eigen::Vector3d& pointB)
+{
+  // One scratch per thread, as several threads may query distances at once
+  thread_local EpaScratch scratch;
+  std::vector<SupportPoint>& vertices = scratch.vertices;
+  std::vector<PolytopeFace>& faces = scratch.faces;
+  std::vector<std::pair<int, int>>& horizon = scratch.horizon;
+  vertices.assign(simplex.points.begin(), simplex.points.begin() + 4);
+  faces.clear();
+
+  const auto addFace = [&](int a, int b, int c) {
+    PolytopeFace face;
+    face.vertices = {a, b, c};
+    face.normal
+        = (vertices[b].w - vertices[a].w).cross(vertices[c].w - vertices[a].w);
+    const double norm = face.normal.norm();
+    if (norm > 0.0) {
+      face.normal /= norm;
+      face.distance = face.normal.dot(vertices[a].w);
+    } else {
+      // Degenerate faces are never expanded
+      face.distance = std::numeric_limits<double>::infinity();
+    }
+    faces.push_back(face);
+  };
+
+  // Orient the faces of the initial tetrahedron outward
+  const Eigen::Vector3d centroid
+      = 0.25 * (vertices[0].w + vertices[1].w + vertices[2].w + vertices[3].w);
+  const std::array<std::array<int, 3>, 4> initialFaces{
+      {{0, 1, 2}, {0, 3, 1}, {0, 2, 3}, {1, 3, 2}}};
+  for (const auto& f : initialFaces) {
+    const Eigen::Vector3d& origin = vertices[f[0]].w;
+    const Eigen::Vector3d normal
+        = (vertices[f[1]].w - origin).cross(vertices[f[2]].w - origin);
+    if (normal.dot(origin - centroid) < 0.0)
+      addFace(f[0], f[2], f[1]);
+    else
+      addFace(f[0], f[1], f[2]);
+  }
+
+  const auto findClosestFace = [&]() {
+    std::size_t closest = 0u;
+    for (std::size_t i = 1u; i < faces.size(); ++i) {
+      if (faces[i].distance < faces[closest].distance)
+        closest = i;
+    }
+    return closest;
+  };
+
+  for (int i = 0; i < maxEpaIterations; ++i) {
+    const PolytopeFace face = faces[findClosestFace()];
+    if (face.distance == std::numeric_limits<double>::infinity())
+      return false;
+
+    const SupportPoint point
+        = computeSupport(shapeA, shapeB, face.normal, true);
+    const double growth = face.normal.dot(point.w) - face.distance;
+    if (growth <= epaTolerance * std::max(1.0, std::abs(face.distance)))
+      break;
+
+    const int index = static_cast<int>(vertices.size());
+    vertices.push_back(point);
+
+    // Remove the faces visible from the new vertex and collect the edges on
+    // the boundary of the removed region
+    horizon.clear();
+    for (std::size_t j = faces.size(); j-- > 0u;) {
+      const PolytopeFace& visible = faces[j];
+      if (visible.distance == std::numeric_limits<double>::infinity()
+          || visible.normal.dot(point.w - vertices[visible.vertices[0]].w)
+                 <= 0.0) {
+        continue;
+      }
+
+      for (int k = 0; k < 3; ++k) {
+        const std::pair<int, int> edge{
+            visible.vertices[k], visible.vertices[(k + 1) % 3]};
+        const auto twin = std::find(
+            horizon.begin(),
+            horizon.end(),
+            std::make_pair(edge.second, edge.first));
+        if (twin != horizon.end())
+          horizon.erase(twin);
+        else
+          horizon.push_back(edge);
+      }
+
+      faces[j] = faces.back();
+      faces.pop_back();
+    }
+
+    for (const auto& edge : horizon)
+      addFace(edge.first, edge.second, index);
+
+    if (faces.empty())
+      return false;
+  }
+
+  const PolytopeFace& face = faces[findClosestFace()];
+  if (face.distance == std::numeric_limits<double>::infinity())
+    return false;
+
+  // Barycentric coordinates of the projection of the origin onto the face
+  const Eigen::Vector3d projection = face.distance * face.normal;
+  const auto& a = vertices[face.vertices[0]];
+  const auto& b = vertices[face.vertices[1]];
+  const auto& c = vertices[face.vertices[2]];
+  const Feature feature
+      = closestOnTriangle(a.w - projection, b.w - projection, c.w - projection);
+  const std::array<const SupportPoint*, 3> points{&a, &b, &c};
+
+  depth = face.distance;
+  pointA.setZero();
+  pointB.setZero();
+  for (int i = 0; i < feature.size; ++i) {
+    pointA += feature.weights[i] * points[feature.indices[i]]->a;
+    pointB += feature.weights[i] * points[feature.indices[i]]->b;
+  }
+
+  return true;
+}
+
+//==============================================================================
+void computePlaneDistance(
+    const dynamics::PlaneShape& plane,
+    const Eigen::Isometry3d& planeTransform,
+    const ConvexShape& convex,
+    double& distance,
+    Eigen::Vector3d& pointOnPlane,
+    Eigen::Vector3d& pointOnConvex)
+{
+  const Eigen::Vector3d normal = planeTransform.linear() * plane.getNormal();
+  const double offset
+      = plane.getOffset() + normal.dot(planeTransform.translation());
+
+  pointOnConvex = convex.support(-normal);
+  distance = normal.dot(pointOnConvex) - offset;
+  pointOnPlane = pointOnConvex - distance * normal;
+}
+
+//==============================================================================
+const dynamics::PlaneShape* asPlane(const CollisionObject* object)
+{
+  const auto* shape = object->getShape().get();
+  if (!shape || dynamics::PlaneShape::getStaticType() != shape->getType())
+    return nullptr;
+
+  return static_cast<const dynamics::PlaneShape*>(shape);
+}
+
+} // namespace
+
+//==============================================================================
+bool computeDistance(
+    const CollisionObject* o1,
+    const CollisionObject* o2,
+    double& distance,
+    Eigen::Vector3d& point1,
+    Eigen::Vector3d& point2)
+{
+  const auto* plane1 = asPlane(o1);
+  const auto* plane2 = asPlane(o2);
+
+  if (plane1 && plane2)
+    return false;
+
+  if (plane1 || plane2) {
+    ConvexShape convex;
+    if (plane1) {
+      if (!makeConvexShape(o2, convex))
+        return false;
+      computePlaneDistance(
+          *plane1, o1->getTransform(), convex, distance, point1, point2);
+    } else {
+      if (!makeConvexShape(o1, convex))
+        return false;
+      computePlaneDistance(
+          *plane2, o2->getTransform(), convex, distance, point2, point1);
+    }
+    return true;
+  }
+
+  ConvexShape shapeA;
+  ConvexShape shapeB;
+  if (!makeConvexShape(o1, shapeA) || !makeConvexShape(o2, shapeB))
+    return false;
+
+  // Distance between the cores, which is exact for separated shapes
+  Simplex simplex;
+  if (!runGjk(shapeA, shapeB, false, simplex)) {
+    const Eigen::Vector3d v = simplex.closestPoint();
+    const double coreDistance = v.norm();
+    const Eigen::Vector3d direction = -v / coreDistance;
+
+    distance = coreDistance - shapeA.margin - shapeB.margin;
+    point1 = simplex.witnessA() + shapeA.margin * direction;
+    point2 = simplex.witnessB() - shapeB.margin * direction;
+    return true;
+  }
+
+  // The cores intersect, so the shapes with margins intersect as well
+  if (shapeA.margin > 0.0 || shapeB.margin > 0.0)
+    runGjk(shapeA, shapeB, true, simplex);
+
+  double depth;
+  if (encloseOrigin(shapeA, shapeB, simplex)
+      && runEpa(shapeA, shapeB, simplex, depth, point1, point2)) {
+    distance = -depth;
+    return true;
+  }
+
+  // Touching contact for which the polytope cannot be built
+  distance = 0.0;
+  point1 = simplex.witnessA();
+  point2 = point1;
+  return true;
+}
+
+} // namespace collision
+} // namespace dart
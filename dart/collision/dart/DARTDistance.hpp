@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef DART_COLLISION_DART_DARTDISTANCE_HPP_
+#define DART_COLLISION_DART_DARTDISTANCE_HPP_
+
+#include <dart/collision/CollisionObject.hpp>
+
+#include <Eigen/Dense>
+
+namespace dart {
+namespace collision {
+
+/// Computes the signed distance between the shapes of two collision objects
+/// and the nearest points on them in world coordinates. If the shapes
+/// penetrate each other, the distance is the negative penetration depth and
+/// the points are the deepest points of each shape inside the other one.
+///
+/// Supported shapes are spheres (including spherical ellipsoids), boxes,
+/// capsules, cylinders, planes, and meshes. Planes are treated as the
+/// half-spaces below them and meshes as their convex hulls. The distance is
+/// computed with GJK, or EPA for penetrating shapes, except for the pairs
+/// involving a plane, which are computed in closed form.
+///
+/// \param[in] o1 First collision object.
+/// \param[in] o2 Second collision object.
+/// \param[out] distance Signed distance between the shapes.
+/// \param[out] point1 Nearest point on the shape of \c o1.
+/// \param[out] point2 Nearest point on the shape of \c o2.
+/// \return False if the pair of shapes is not supported, in which case the
+/// outputs are not modified.
+bool computeDistance(
+    const CollisionObject* o1,
+    const CollisionObject* o2,
+    double& distance,
+    Eigen::Vector3d& point1,
+    Eigen::Vector3d& point2);
+
+} // namespace collision
+} // namespace dart
+
+#endif // DART_COLLISION_DART_DARTDISTANCE_HPP_
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "dart/common/ThreadPool.hpp"
+
+#include <algorithm>
+
+namespace dart::common {
+
+namespace {
+
+/// The pool whose task the current thread is running, if any
+thread_local const ThreadPool* tCurrentPool = nullptr;
+
+/// The worker index of the current thread in tCurrentPool
+thread_local std::size_t tCurrentWorkerIndex = 0u;
+
+} // namespace
+
+//==============================================================================
+ThreadPool::ThreadPool(std::size_t numThreads)
+{
+  if (numThreads == 0u)
+    numThreads = getDefaultNumThreads();
+
+  mThreads.reserve(numThreads - 1u);
+  for (std::size_t i = 1u; i < numThreads; ++i)
+    mThreads.emplace_back(&ThreadPool::workerLoop, this, i);
+}
+
+//==============================================================================
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mStop = true;
+  }
+  mWorkCondition.notify_all();
+
+  for (auto& thread : mThreads)
+    thread.join();
+}
+
+//==============================================================================
+std::size_t ThreadPool::getNumThreads() const
+{
+  return mThreads.size() + 1u;
+}
+
+//==============================================================================
+void ThreadPool::parallelFor(
+    std::size_t count,
+    const std::function<void(std::size_t index, std::size_t workerIndex)>& func)
+{
+  if (count == 0u)
+    return;
+
+  // Run serially when there is nothing to share or when called from one of
+  // this pool's own tasks, which would otherwise deadlock.
+  if (mThreads.empty() || count == 1u || tCurrentPool == this) {
+    const auto workerIndex = (tCurrentPool == this) ? tCurrentWorkerIndex : 0u;
+    for (std::size_t i = 0u; i < count; ++i)
+      func(i, workerIndex);
+    return;
+  }
+
+  std::lock_guard<std::mutex> callLock(mCallMutex);
+
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mTask = &func;
+    mTaskCount = count;
+    mNextIndex.store(0u, std::memory_order_relaxed);
+    mNumActiveWorkers = mThreads.size();
+    mException = nullptr;
+    ++mGeneration;
+  }
+  mWorkCondition.notify_all();
+
+  // The calling thread works as worker 0
+  runTasks(0u);
+
+  std::exception_ptr exception;
+  {
+    std::unique_lock<std::mutex> lock(mMutex);
+    mDoneCondition.wait(lock, [this] { return mNumActiveWorkers == 0u; });
+    mTask = nullptr;
+    exception = mException;
+    mException = nullptr;
+  }
+
+  if (exception)
+    std::rethrow_exception(exception);
+}
+
+//==============================================================================
+std::size_t ThreadPool::getDefaultNumThreads()
+{
+  return std::max(1u, std::thread::hardware_concurrency());
+}
+
+//==============================================================================
+void ThreadPool::workerLoop(std::size_t workerIndex)
+{
+  std::uint64_t lastGeneration = 0u;
+
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mMutex);
+      mWorkCondition.wait(lock, [&] {
+        return mStop || mGeneration != lastGeneration;
+      });
+
+      if (mStop)
+        return;
+
+      lastGeneration = mGeneration;
+    }
+
+    runTasks(workerIndex);
+
+    {
+      std::lock_guard<std::mutex> lock(mMutex);
+      if (--mNumActiveWorkers == 0u)
+        mDoneCondition.notify_one();
+    }
+  }
+}
+
+//==============================================================================
+void ThreadPool::runTasks(std::size_t workerIndex)
+{
+  const auto* previousPool = tCurrentPool;
+  const auto previousWorkerIndex = tCurrentWorkerIndex;
+  tCurrentPool = this;
+  tCurrentWorkerIndex = workerIndex;
+
+  while (true) {
+    const auto index = mNextIndex.fetch_add(1u, std::memory_order_relaxed);
+    if (index >= mTaskCount)
+      break;
+
+    try {
+      (*mTask)(index, workerIndex);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(mMutex);
+      if (!mException)
+        mException = std::current_exception();
+
+      // Skip the remaining indices
+      mNextIndex.store(mTaskCount, std::memory_order_relaxed);
+    }
+  }
+
+  tCurrentPool = previousPool;
+  tCurrentWorkerIndex = previousWorkerIndex;
+}
+
+} // namespace dart::common
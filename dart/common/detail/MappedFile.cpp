@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "dart/common/detail/MappedFile.hpp"
+
+#if DART_OS_WINDOWS
+  #include "dart/common/IncludeWindows.hpp"
+#else
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+namespace dart::common::detail {
+
+//==============================================================================
+std::unique_ptr<MappedFile> MappedFile::open(const std::string& filename)
+{
+  std::unique_ptr<MappedFile> mappedFile(new MappedFile());
+
+#if DART_OS_WINDOWS
+  HANDLE file = CreateFileA(
+      filename.c_str(),
+      GENERIC_READ,
+      FILE_SHARE_READ | FILE_SHARE_WRITE,
+      nullptr,
+      OPEN_EXISTING,
+      FILE_ATTRIBUTE_NORMAL,
+      nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+    return nullptr;
+
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+    CloseHandle(file);
+    return nullptr;
+  }
+
+  HANDLE mapping
+      = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  CloseHandle(file);
+  if (!mapping)
+    return nullptr;
+
+  void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (!data) {
+    CloseHandle(mapping);
+    return nullptr;
+  }
+
+  mappedFile->mMapping = mapping;
+  mappedFile->mSize = static_cast<std::size_t>(size.QuadPart);
+#else
+  const int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0)
+    return nullptr;
+
+  struct stat status;
+  if (::fstat(fd, &status) != 0 || status.st_size == 0) {
+    ::close(fd);
+    return nullptr;
+  }
+
+  const auto size = static_cast<std::size_t>(status.st_size);
+  void* data = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (data == MAP_FAILED)
+    return nullptr;
+
+  mappedFile->mSize = size;
+#endif
+
+  mappedFile->mData = static_cast<const unsigned char*>(data);
+  return mappedFile;
+}
+
+//==============================================================================
+MappedFile::~MappedFile()
+{
+#if DART_OS_WINDOWS
+  UnmapViewOfFile(mData);
+  CloseHandle(mMapping);
+#else
+  ::munmap(const_cast<unsigned char*>(mData), mSize);
+#endif
+}
+
+//==============================================================================
+const unsigned char* MappedFile::getData() const
+{
+  return mData;
+}
+
+//==============================================================================
+std::size_t MappedFile::getSize() const
+{
+  return mSize;
+}
+
+} // namespace dart::common::detail
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef DART_COMMON_DETAIL_MAPPEDFILE_HPP_
+#define DART_COMMON_DETAIL_MAPPEDFILE_HPP_
+
+#include <dart/common/Platform.hpp>
+
+#include <memory>
+#include <string>
+
+#include <cstddef>
+
+namespace dart::common::detail {
+
+/// Read-only memory mapping of a whole file
+class MappedFile final
+{
+public:
+  /// Maps the file. Returns nullptr on failure.
+  static std::unique_ptr<MappedFile> open(const std::string& filename);
+
+  /// Destructor. Unmaps the file.
+  ~MappedFile();
+
+  /// Returns the mapped bytes
+  const unsigned char* getData() const;
+
+  /// Returns the number of mapped bytes
+  std::size_t getSize() const;
+
+private:
+  MappedFile() = default;
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  /// Mapped bytes
+  const unsigned char* mData{nullptr};
+
+  /// Number of mapped bytes
+  std::size_t mSize{0u};
+
+#if DART_OS_WINDOWS
+  /// File mapping object
+  void* mMapping{nullptr};
+#endif
+};
+
+} // namespace dart::common::detail
+
+#endif // DART_COMMON_DETAIL_MAPPEDFILE_HPP_
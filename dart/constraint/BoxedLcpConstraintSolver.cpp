@@ -48,12 +48,74 @@
 #include "dart/constraint/ConstraintBase.hpp"
 #include "dart/constraint/DantzigBoxedLcpSolver.hpp"
 #include "dart/constraint/PgsBoxedLcpSolver.hpp"
+#include "dart/dynamics/BodyNode.hpp"
+#include "dart/dynamics/Joint.hpp"
+#include "dart/dynamics/Skeleton.hpp"
 #include "dart/math/lcp/Dantzig/Lcp.hpp"
 #include "dart/math/lcp/Lemke.hpp"
 
 namespace dart {
 namespace constraint {
 
+namespace {
+
+//==============================================================================
+void setDantzigWarmStart(BoxedLcpSolver* solver, bool enabled)
+{
+  auto* dantzig = solver ? solver->as<DantzigBoxedLcpSolver>() : nullptr;
+  if (!dantzig)
+    return;
+
+  auto option = dantzig->getOption();
+  option.mWarmStart = enabled;
+  dantzig->setOption(option);
+}
+
+//==============================================================================
+/// Clones source into clone unless clone was already made from the same
+/// source with the same options. Returns false if source cannot be cloned.
+bool updateClone(
+    const BoxedLcpSolverPtr& source,
+    BoxedLcpSolverPtr& clone,
+    BoxedLcpSolverPtr& clonedSource,
+    std::size_t& clonedRevision)
+{
+  if (!source) {
+    clone = nullptr;
+    clonedSource = nullptr;
+    return true;
+  }
+
+  if (clone && clonedSource == source
+      && clonedRevision == source->getOptionRevision()) {
+    return true;
+  }
+
+  clone = source->clone();
+  clonedSource = source;
+  clonedRevision = source->getOptionRevision();
+
+  return clone != nullptr;
+}
+
+//==============================================================================
+bool isAnalyticAssemblySupported(const dynamics::Skeleton& skeleton)
+{
+  // The impulse response of SoftBodyNodes and kinematic joints is not captured
+  // by the mass matrix.
+  if (skeleton.getNumSoftBodyNodes() > 0)
+    return false;
+
+  for (std::size_t i = 0; i < skeleton.getNumJoints(); ++i) {
+    if (skeleton.getJoint(i)->isKinematic())
+      return false;
+  }
+
+  return true;
+}
+
+} // namespace
+
 //==============================================================================
 BoxedLcpConstraintSolver::BoxedLcpConstraintSolver()
   : BoxedLcpConstraintSolver(std::make_shared<DantzigBoxedLcpSolver>())
@@ -73,7 +135,7 @@ BoxedLcpConstraintSolver::BoxedLcpConstraintSolver(
 //==============================================================================
 BoxedLcpConstraintSolver::BoxedLcpConstraintSolver(
     BoxedLcpSolverPtr boxedLcpSolver, BoxedLcpSolverPtr secondaryBoxedLcpSolver)
-  : ConstraintSolver()
+  : ConstraintSolver(), mMatrixAssembly(MatrixAssembly::ImpulseTests)
 {
   if (boxedLcpSolver) {
     setBoxedLcpSolver(std::move(boxedLcpSolver));
@@ -101,6 +163,7 @@ void BoxedLcpConstraintSolver::setBoxedLcpSolver(BoxedLcpSolverPtr lcpSolver)
       "secondary LCP solver, which is discouraged. Ignoring this request.");
 
   mBoxedLcpSolver = std::move(lcpSolver);
+  setDantzigWarmStart(mBoxedLcpSolver.get(), isContactWarmStartingEnabled());
 }
 
 //==============================================================================
@@ -120,6 +183,8 @@ void BoxedLcpConstraintSolver::setSecondaryBoxedLcpSolver(
       "set the secondary LCP solver to nullptr.");
 
   mSecondaryBoxedLcpSolver = std::move(lcpSolver);
+  setDantzigWarmStart(
+      mSecondaryBoxedLcpSolver.get(), isContactWarmStartingEnabled());
 }
 
 //==============================================================================
@@ -129,8 +194,96 @@ ConstBoxedLcpSolverPtr BoxedLcpConstraintSolver::getSecondaryBoxedLcpSolver()
   return mSecondaryBoxedLcpSolver;
 }
 
+//==============================================================================
+void BoxedLcpConstraintSolver::setMatrixAssembly(MatrixAssembly assembly)
+{
+  mMatrixAssembly = assembly;
+}
+
+//==============================================================================
+BoxedLcpConstraintSolver::MatrixAssembly
+BoxedLcpConstraintSolver::getMatrixAssembly() const
+{
+  return mMatrixAssembly;
+}
+
+//==============================================================================
+void BoxedLcpConstraintSolver::setContactWarmStarting(bool enabled)
+{
+  ConstraintSolver::setContactWarmStarting(enabled);
+  setDantzigWarmStart(mBoxedLcpSolver.get(), enabled);
+  setDantzigWarmStart(mSecondaryBoxedLcpSolver.get(), enabled);
+}
+
+//==============================================================================
+void BoxedLcpConstraintSolver::setFromOtherConstraintSolver(
+    const ConstraintSolver& other)
+{
+  ConstraintSolver::setFromOtherConstraintSolver(other);
+
+  if (const auto* boxedLcp
+      = dynamic_cast<const BoxedLcpConstraintSolver*>(&other)) {
+    setMatrixAssembly(boxedLcp->getMatrixAssembly());
+  }
+}
+
 //==============================================================================
 void BoxedLcpConstraintSolver::solveConstrainedGroup(ConstrainedGroup& group)
+{
+  DART_ASSERT(mBoxedLcpSolver);
+  solveConstrainedGroup(
+      group, mWorkspace, *mBoxedLcpSolver, mSecondaryBoxedLcpSolver.get());
+}
+
+//==============================================================================
+bool BoxedLcpConstraintSolver::prepareWorkers(std::size_t numWorkers)
+{
+  DART_ASSERT(mBoxedLcpSolver);
+
+  // The LCP solvers may hold scratch data, so every worker gets its own clone.
+  // The clones are kept until the solvers are replaced or their options
+  // change.
+  mWorkers.resize(numWorkers);
+  for (auto& worker : mWorkers) {
+    if (!updateClone(
+            mBoxedLcpSolver,
+            worker.boxedLcpSolver,
+            worker.boxedLcpSolverSource,
+            worker.boxedLcpSolverRevision)) {
+      return false;
+    }
+
+    if (!updateClone(
+            mSecondaryBoxedLcpSolver,
+            worker.secondaryBoxedLcpSolver,
+            worker.secondaryBoxedLcpSolverSource,
+            worker.secondaryBoxedLcpSolverRevision)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+//==============================================================================
+void BoxedLcpConstraintSolver::solveConstrainedGroupOnWorker(
+    ConstrainedGroup& group, std::size_t workerIndex)
+{
+  DART_ASSERT(workerIndex < mWorkers.size());
+  auto& worker = mWorkers[workerIndex];
+  solveConstrainedGroup(
+      group,
+      worker.workspace,
+      *worker.boxedLcpSolver,
+      worker.secondaryBoxedLcpSolver.get());
+}
+
+//==============================================================================
+void BoxedLcpConstraintSolver::solveConstrainedGroup(
+    ConstrainedGroup& group,
+    LcpWorkspace& workspace,
+    BoxedLcpSolver& boxedLcpSolver,
+    BoxedLcpSolver* secondaryBoxedLcpSolver)
 {
   DART_PROFILE_SCOPED;
 
@@ -144,27 +297,26 @@ void BoxedLcpConstraintSolver::solveConstrainedGroup(ConstrainedGroup& group)
 
   const int nSkip = math::padding(n);
 #if DART_BUILD_MODE_RELEASE
-  mA.resize(n, nSkip);
+  workspace.A.resize(n, nSkip);
 #else // debug
-  mA.setZero(n, nSkip);
+  workspace.A.setZero(n, nSkip);
 #endif
-  mX.resize(n);
-  mB.resize(n);
-  mW.setZero(n); // set w to 0
-  mLo.resize(n);
-  mHi.resize(n);
-  mFIndex.setConstant(n, -1); // set findex to -1
+  workspace.x.resize(n);
+  workspace.b.resize(n);
+  workspace.w.setZero(n); // set w to 0
+  workspace.lo.resize(n);
+  workspace.hi.resize(n);
+  workspace.fIndex.setConstant(n, -1); // set findex to -1
 
   // Compute offset indices
-  mOffset.resize(numConstraints);
-  mOffset[0] = 0;
+  workspace.offset.resize(numConstraints);
+  workspace.offset[0] = 0;
   for (std::size_t i = 1; i < numConstraints; ++i) {
     const ConstraintBasePtr& constraint = group.getConstraint(i - 1);
     DART_ASSERT(constraint->getDimension() > 0);
-    mOffset[i] = mOffset[i - 1] + constraint->getDimension();
+    workspace.offset[i] = workspace.offset[i - 1] + constraint->getDimension();
   }
 
-  // For each constraint
   {
     DART_PROFILE_SCOPED_N("Construct LCP");
     ConstraintInfo constInfo;
@@ -172,12 +324,12 @@ void BoxedLcpConstraintSolver::solveConstrainedGroup(ConstrainedGroup& group)
     for (std::size_t i = 0; i < numConstraints; ++i) {
       const ConstraintBasePtr& constraint = group.getConstraint(i);
 
-      constInfo.x = mX.data() + mOffset[i];
-      constInfo.lo = mLo.data() + mOffset[i];
-      constInfo.hi = mHi.data() + mOffset[i];
-      constInfo.b = mB.data() + mOffset[i];
-      constInfo.findex = mFIndex.data() + mOffset[i];
-      constInfo.w = mW.data() + mOffset[i];
+      constInfo.x = workspace.x.data() + workspace.offset[i];
+      constInfo.lo = workspace.lo.data() + workspace.offset[i];
+      constInfo.hi = workspace.hi.data() + workspace.offset[i];
+      constInfo.b = workspace.b.data() + workspace.offset[i];
+      constInfo.findex = workspace.fIndex.data() + workspace.offset[i];
+      constInfo.w = workspace.w.data() + workspace.offset[i];
 
       // Fill vectors: lo, hi, b, w
       {
@@ -185,51 +337,29 @@ void BoxedLcpConstraintSolver::solveConstrainedGroup(ConstrainedGroup& group)
         constraint->getInformation(&constInfo);
       }
 
-      // Fill a matrix by impulse tests: A
-      {
-        DART_PROFILE_SCOPED_N("Fill A");
-        constraint->excite();
-        for (std::size_t j = 0; j < constraint->getDimension(); ++j) {
-          // Adjust findex for global index
-          if (mFIndex[mOffset[i] + j] >= 0)
-            mFIndex[mOffset[i] + j] += mOffset[i];
-
-          // Apply impulse for impulse test
-          {
-            DART_PROFILE_SCOPED_N("Unit impulse test");
-            constraint->applyUnitImpulse(j);
-          }
-
-          // Fill upper triangle blocks of A matrix
-          {
-            DART_PROFILE_SCOPED_N("Fill upper triangle of A");
-            int index = nSkip * (mOffset[i] + j) + mOffset[i];
-            constraint->getVelocityChange(mA.data() + index, true);
-            for (std::size_t k = i + 1; k < numConstraints; ++k) {
-              index = nSkip * (mOffset[i] + j) + mOffset[k];
-              group.getConstraint(k)->getVelocityChange(
-                  mA.data() + index, false);
-            }
-          }
-        }
-      }
-
-      {
-        DART_PROFILE_SCOPED_N("Unexcite");
-        constraint->unexcite();
+      // Adjust findex for global index
+      for (std::size_t j = 0; j < constraint->getDimension(); ++j) {
+        if (workspace.fIndex[workspace.offset[i] + j] >= 0)
+          workspace.fIndex[workspace.offset[i] + j] += workspace.offset[i];
       }
     }
 
+    // Fill upper triangle of A matrix
+    const bool assembled = mMatrixAssembly == MatrixAssembly::Analytic
+                           && assembleAnalytically(group, workspace);
+    if (!assembled)
+      assembleByImpulseTests(group, workspace);
+
     {
       // Fill lower triangle blocks of A matrix
       DART_PROFILE_SCOPED_N("Fill lower triangle of A");
-      mA.leftCols(n).triangularView<Eigen::Lower>()
-          = mA.leftCols(n).triangularView<Eigen::Upper>().transpose();
+      workspace.A.leftCols(n).triangularView<Eigen::Lower>()
+          = workspace.A.leftCols(n).triangularView<Eigen::Upper>().transpose();
     }
   }
 
 #if DART_BUILD_MODE_DEBUG
-  DART_ASSERT(isSymmetric(n, mA.data()));
+  DART_ASSERT(isSymmetric(n, workspace.A.data()));
 #endif
 
   // Print LCP formulation
@@ -239,57 +369,56 @@ void BoxedLcpConstraintSolver::solveConstrainedGroup(ConstrainedGroup& group)
 
   // Solve LCP using the primary solver and fallback to secondary solver when
   // the primary solver failed.
-  if (mSecondaryBoxedLcpSolver) {
+  if (secondaryBoxedLcpSolver) {
     // Make backups for the secondary LCP solver because the primary solver
     // modifies the original terms.
-    mABackup = mA;
-    mXBackup = mX;
-    mBBackup = mB;
-    mLoBackup = mLo;
-    mHiBackup = mHi;
-    mFIndexBackup = mFIndex;
+    workspace.ABackup = workspace.A;
+    workspace.xBackup = workspace.x;
+    workspace.bBackup = workspace.b;
+    workspace.loBackup = workspace.lo;
+    workspace.hiBackup = workspace.hi;
+    workspace.fIndexBackup = workspace.fIndex;
   }
-  const bool earlyTermination = (mSecondaryBoxedLcpSolver != nullptr);
-  DART_ASSERT(mBoxedLcpSolver);
-  bool success = mBoxedLcpSolver->solve(
+  const bool earlyTermination = (secondaryBoxedLcpSolver != nullptr);
+  bool success = boxedLcpSolver.solve(
       n,
-      mA.data(),
-      mX.data(),
-      mB.data(),
+      workspace.A.data(),
+      workspace.x.data(),
+      workspace.b.data(),
       0,
-      mLo.data(),
-      mHi.data(),
-      mFIndex.data(),
+      workspace.lo.data(),
+      workspace.hi.data(),
+      workspace.fIndex.data(),
       earlyTermination);
 
   // Sanity check. LCP solvers should not report success with nan values, but
   // it could happen. So we set the success to false for nan values.
-  if (success && mX.hasNaN())
+  if (success && workspace.x.hasNaN())
     success = false;
 
-  if (!success && mSecondaryBoxedLcpSolver) {
+  if (!success && secondaryBoxedLcpSolver) {
     DART_PROFILE_SCOPED_N("Secondary LCP");
-    mSecondaryBoxedLcpSolver->solve(
+    secondaryBoxedLcpSolver->solve(
         n,
-        mABackup.data(),
-        mXBackup.data(),
-        mBBackup.data(),
+        workspace.ABackup.data(),
+        workspace.xBackup.data(),
+        workspace.bBackup.data(),
         0,
-        mLoBackup.data(),
-        mHiBackup.data(),
-        mFIndexBackup.data(),
+        workspace.loBackup.data(),
+        workspace.hiBackup.data(),
+        workspace.fIndexBackup.data(),
         false);
-    mX = mXBackup;
+    workspace.x = workspace.xBackup;
   }
 
-  if (mX.hasNaN()) {
+  if (workspace.x.hasNaN()) {
     DART_ERROR(
         "[BoxedLcpConstraintSolver] The solution of LCP includes NAN values: "
         "{}. We're setting it zero for safety. Consider using more robust "
         "solver such as PGS as a secondary solver. If this happens even with "
         "PGS solver, please report this as a bug.",
-        fmt::streamed(mX.transpose()));
-    mX.setZero();
+        fmt::streamed(workspace.x.transpose()));
+    workspace.x.setZero();
   }
 
   // Print LCP formulation
@@ -302,12 +431,162 @@ void BoxedLcpConstraintSolver::solveConstrainedGroup(ConstrainedGroup& group)
     DART_PROFILE_SCOPED_N("Apply constraint impulses");
     for (std::size_t i = 0; i < numConstraints; ++i) {
       const ConstraintBasePtr& constraint = group.getConstraint(i);
-      constraint->applyImpulse(mX.data() + mOffset[i]);
+      constraint->applyImpulse(workspace.x.data() + workspace.offset[i]);
       constraint->excite();
     }
   }
 }
 
+//==============================================================================
+void BoxedLcpConstraintSolver::assembleByImpulseTests(
+    ConstrainedGroup& group, LcpWorkspace& workspace)
+{
+  DART_PROFILE_SCOPED_N("Fill A");
+
+  const std::size_t numConstraints = group.getNumConstraints();
+  const int nSkip = static_cast<int>(workspace.A.cols());
+
+  for (std::size_t i = 0; i < numConstraints; ++i) {
+    const ConstraintBasePtr& constraint = group.getConstraint(i);
+
+    constraint->excite();
+    for (std::size_t j = 0; j < constraint->getDimension(); ++j) {
+      // Apply impulse for impulse test
+      {
+        DART_PROFILE_SCOPED_N("Unit impulse test");
+        constraint->applyUnitImpulse(j);
+      }
+
+      // Fill upper triangle blocks of A matrix
+      {
+        DART_PROFILE_SCOPED_N("Fill upper triangle of A");
+        int index = nSkip * (workspace.offset[i] + j) + workspace.offset[i];
+        constraint->getVelocityChange(workspace.A.data() + index, true);
+        for (std::size_t k = i + 1; k < numConstraints; ++k) {
+          index = nSkip * (workspace.offset[i] + j) + workspace.offset[k];
+          group.getConstraint(k)->getVelocityChange(
+              workspace.A.data() + index, false);
+        }
+      }
+    }
+
+    {
+      DART_PROFILE_SCOPED_N("Unexcite");
+      constraint->unexcite();
+    }
+  }
+}
+
+//==============================================================================
+bool BoxedLcpConstraintSolver::assembleAnalytically(
+    ConstrainedGroup& group, LcpWorkspace& workspace)
+{
+  DART_PROFILE_SCOPED_N("Fill A analytically");
+
+  const std::size_t numConstraints = group.getNumConstraints();
+  const int nSkip = static_cast<int>(workspace.A.cols());
+
+  // Collect the generalized Jacobians of the constraints per skeleton
+  workspace.skeletonIndices.clear();
+  std::size_t numSkeletons = 0;
+  for (std::size_t i = 0; i < numConstraints; ++i) {
+    const ConstraintBasePtr& constraint = group.getConstraint(i);
+    if (!constraint->getBodyJacobians(workspace.bodyJacobians))
+      return false;
+
+    const auto dim = static_cast<int>(constraint->getDimension());
+    for (const ConstraintBodyJacobian& bodyJacobian : workspace.bodyJacobians) {
+      dynamics::BodyNode* bodyNode = bodyJacobian.bodyNode;
+      dynamics::Skeleton* skeleton = bodyNode->getSkeleton().get();
+
+      const auto result
+          = workspace.skeletonIndices.emplace(skeleton, numSkeletons);
+      if (result.second) {
+        if (!isAnalyticAssemblySupported(*skeleton))
+          return false;
+
+        if (workspace.skeletonJacobians.size() == numSkeletons)
+          workspace.skeletonJacobians.emplace_back();
+        workspace.skeletonJacobians[numSkeletons].skeleton = skeleton;
+        workspace.skeletonJacobians[numSkeletons].size = 0;
+        ++numSkeletons;
+      }
+
+      // Constraints are visited in order, so the Jacobian of this constraint
+      // is the last one if it exists
+      SkeletonJacobians& entries
+          = workspace.skeletonJacobians[result.first->second];
+      if (entries.size == 0
+          || entries.jacobians[entries.size - 1].constraintIndex != i) {
+        if (entries.jacobians.size() == entries.size)
+          entries.jacobians.emplace_back();
+        SkeletonJacobian& entry = entries.jacobians[entries.size++];
+        entry.constraintIndex = i;
+        entry.jacobian.setZero(
+            dim, static_cast<int>(skeleton->getNumDofs()));
+      }
+      SkeletonJacobian& entry = entries.jacobians[entries.size - 1];
+
+      // J += S^T * J_body, where J_body maps the generalized velocities of the
+      // dependent DOFs to the spatial velocity of the body
+      const math::Jacobian& bodyJac = bodyNode->getJacobian();
+      const auto& S = bodyJacobian.jacobian;
+      for (std::size_t k = 0; k < bodyNode->getNumDependentGenCoords(); ++k) {
+        entry.jacobian.col(bodyNode->getDependentGenCoordIndex(k)).noalias()
+            += S.transpose() * bodyJac.col(k);
+      }
+    }
+  }
+
+  // Compute M^-1 * J^T column by column with the factored mass matrix of each
+  // skeleton instead of forming the dense inverse
+  for (std::size_t s = 0; s < numSkeletons; ++s) {
+    SkeletonJacobians& entries = workspace.skeletonJacobians[s];
+    for (std::size_t e = 0; e < entries.size; ++e) {
+      SkeletonJacobian& entry = entries.jacobians[e];
+      entry.invMassJacobianT.resize(
+          entry.jacobian.cols(), entry.jacobian.rows());
+      for (Eigen::Index k = 0; k < entry.jacobian.rows(); ++k) {
+        workspace.jacobianRow = entry.jacobian.row(k).transpose();
+        entries.skeleton->multiplyByInvMassMatrix(
+            workspace.jacobianRow, entry.invMassJacobianT.col(k));
+      }
+    }
+  }
+
+  // Only the blocks of constraint pairs sharing a skeleton are nonzero
+  workspace.A.setZero();
+  for (std::size_t s = 0; s < numSkeletons; ++s) {
+    const SkeletonJacobians& entries = workspace.skeletonJacobians[s];
+    for (std::size_t a = 0; a < entries.size; ++a) {
+      const SkeletonJacobian& entryA = entries.jacobians[a];
+      const int row = workspace.offset[entryA.constraintIndex];
+      for (std::size_t b = a; b < entries.size; ++b) {
+        const SkeletonJacobian& entryB = entries.jacobians[b];
+        const int col = workspace.offset[entryB.constraintIndex];
+        workspace.A
+            .block(
+                row,
+                col,
+                entryA.jacobian.rows(),
+                entryB.invMassJacobianT.cols())
+            .noalias()
+            += entryA.jacobian * entryB.invMassJacobianT;
+      }
+    }
+  }
+
+  for (std::size_t i = 0; i < numConstraints; ++i) {
+    const ConstraintBasePtr& constraint = group.getConstraint(i);
+    for (std::size_t j = 0; j < constraint->getDimension(); ++j) {
+      const int index = nSkip * (workspace.offset[i] + j) + workspace.offset[i];
+      constraint->applyConstraintForceMixing(j, workspace.A.data() + index);
+    }
+  }
+
+  return true;
+}
+
 //==============================================================================
 #if DART_BUILD_MODE_DEBUG
 bool BoxedLcpConstraintSolver::isSymmetric(std::size_t n, double* A)
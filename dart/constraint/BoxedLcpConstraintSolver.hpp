@@ -33,17 +33,37 @@
 #ifndef DART_CONSTRAINT_BOXEDLCPCONSTRAINTSOLVER_HPP_
 #define DART_CONSTRAINT_BOXEDLCPCONSTRAINTSOLVER_HPP_
 
+#include <dart/constraint/ConstraintBase.hpp>
 #include <dart/constraint/ConstraintSolver.hpp>
 #include <dart/constraint/Fwd.hpp>
 
 #include <dart/Export.hpp>
 
+#include <unordered_map>
+#include <vector>
+
 namespace dart {
 namespace constraint {
 
 class DART_API BoxedLcpConstraintSolver : public ConstraintSolver
 {
 public:
+  /// Methods to assemble the matrix A of the LCP of a constrained group
+  enum class MatrixAssembly
+  {
+    /// Fill A with unit impulse tests, where each test propagates an impulse
+    /// through the constrained skeletons.
+    ImpulseTests,
+
+    /// Compute A = J * M^-1 * J^T from the constraint Jacobians and the
+    /// factored mass matrices of the skeletons. Only the blocks of constraint
+    /// pairs that share a skeleton are computed. Groups containing constraints
+    /// that do not provide Jacobians (see
+    /// ConstraintBase::getBodyJacobians()), SoftBodyNodes, or kinematic joints
+    /// fall back to impulse tests.
+    Analytic,
+  };
+
   /// Constructor
   ///
   /// Constructs with default primary and secondary LCP solvers, which are
@@ -82,10 +102,127 @@ public:
   /// failed
   ConstBoxedLcpSolverPtr getSecondaryBoxedLcpSolver() const;
 
+  /// Sets how the matrix A of the LCP is assembled. The default is
+  /// MatrixAssembly::ImpulseTests.
+  void setMatrixAssembly(MatrixAssembly assembly);
+
+  /// Returns how the matrix A of the LCP is assembled
+  MatrixAssembly getMatrixAssembly() const;
+
+  /// Sets whether contact impulses are warm started. This also sets
+  /// DantzigBoxedLcpSolver::Option::mWarmStart of the Dantzig solvers, current
+  /// and future, so that they try the active set of the warm started guess
+  /// before pivoting.
+  void setContactWarmStarting(bool enabled) override;
+
+  /// Also copies the matrix assembly of \c other if it is a
+  /// BoxedLcpConstraintSolver.
+  void setFromOtherConstraintSolver(const ConstraintSolver& other) override;
+
 protected:
+  /// Generalized Jacobian of a constraint with respect to one skeleton, used
+  /// by the analytic assembly
+  struct SkeletonJacobian
+  {
+    /// Index of the constraint in the constrained group
+    std::size_t constraintIndex;
+
+    /// (dimension of the constraint) x (DOFs of the skeleton) Jacobian J
+    Eigen::MatrixXd jacobian;
+
+    /// M^-1 * J^T
+    Eigen::MatrixXd invMassJacobianT;
+  };
+
+  /// The Jacobians of the constraints acting on one skeleton, ordered by
+  /// constraint index
+  struct SkeletonJacobians
+  {
+    /// The skeleton
+    dynamics::Skeleton* skeleton;
+
+    /// Number of valid entries in jacobians, which keeps its capacity across
+    /// time steps
+    std::size_t size;
+
+    /// The Jacobians
+    std::vector<SkeletonJacobian> jacobians;
+  };
+
+  /// Scratch data of the boxed LCP formulation of a constrained group
+  struct LcpWorkspace
+  {
+    Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> A;
+    Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>
+        ABackup;
+    Eigen::VectorXd x;
+    Eigen::VectorXd xBackup;
+    Eigen::VectorXd b;
+    Eigen::VectorXd bBackup;
+    Eigen::VectorXd w;
+    Eigen::VectorXd lo;
+    Eigen::VectorXd loBackup;
+    Eigen::VectorXd hi;
+    Eigen::VectorXd hiBackup;
+    Eigen::VectorXi fIndex;
+    Eigen::VectorXi fIndexBackup;
+    Eigen::VectorXi offset;
+
+    // Scratch data of the analytic assembly
+    std::vector<ConstraintBodyJacobian> bodyJacobians;
+    std::unordered_map<const dynamics::Skeleton*, std::size_t> skeletonIndices;
+    std::vector<SkeletonJacobians> skeletonJacobians;
+    Eigen::VectorXd jacobianRow;
+  };
+
+  /// Data owned by a worker thread when the constrained groups are solved in
+  /// parallel
+  struct Worker
+  {
+    /// Scratch data of this worker
+    LcpWorkspace workspace;
+
+    /// Clone of the primary boxed LCP solver
+    BoxedLcpSolverPtr boxedLcpSolver;
+
+    /// Clone of the secondary boxed LCP solver
+    BoxedLcpSolverPtr secondaryBoxedLcpSolver;
+
+    /// The primary solver that boxedLcpSolver was cloned from
+    BoxedLcpSolverPtr boxedLcpSolverSource;
+
+    /// The secondary solver that secondaryBoxedLcpSolver was cloned from
+    BoxedLcpSolverPtr secondaryBoxedLcpSolverSource;
+
+    /// Option revisions of the sources when they were cloned
+    std::size_t boxedLcpSolverRevision = 0;
+    std::size_t secondaryBoxedLcpSolverRevision = 0;
+  };
+
   // Documentation inherited.
   void solveConstrainedGroup(ConstrainedGroup& group) override;
 
+  // Documentation inherited.
+  bool prepareWorkers(std::size_t numWorkers) override;
+
+  // Documentation inherited.
+  void solveConstrainedGroupOnWorker(
+      ConstrainedGroup& group, std::size_t workerIndex) override;
+
+  /// Solves a constrained group using the given scratch data and LCP solvers
+  void solveConstrainedGroup(
+      ConstrainedGroup& group,
+      LcpWorkspace& workspace,
+      BoxedLcpSolver& boxedLcpSolver,
+      BoxedLcpSolver* secondaryBoxedLcpSolver);
+
+  /// Fills the upper triangle of workspace.A by unit impulse tests
+  void assembleByImpulseTests(ConstrainedGroup& group, LcpWorkspace& workspace);
+
+  /// Fills the upper triangle of workspace.A as J * M^-1 * J^T. Returns false,
+  /// without modifying A, if the group does not support analytic assembly.
+  bool assembleAnalytically(ConstrainedGroup& group, LcpWorkspace& workspace);
+
   /// Boxed LCP solver
   BoxedLcpSolverPtr mBoxedLcpSolver;
   // TODO(JS): Hold as unique_ptr because there is no reason to share. Make this
@@ -96,48 +233,15 @@ protected:
   // TODO(JS): Hold as unique_ptr because there is no reason to share. Make this
   // change in DART 7 because it's API breaking change.
 
-  /// Cache data for boxed LCP formulation
-  Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> mA;
-
-  /// Cache data for boxed LCP formulation
-  Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>
-      mABackup;
-
-  /// Cache data for boxed LCP formulation
-  Eigen::VectorXd mX;
-
-  /// Cache data for boxed LCP formulation
-  Eigen::VectorXd mXBackup;
-
-  /// Cache data for boxed LCP formulation
-  Eigen::VectorXd mB;
-
-  /// Cache data for boxed LCP formulation
-  Eigen::VectorXd mBBackup;
-
-  /// Cache data for boxed LCP formulation
-  Eigen::VectorXd mW;
-
-  /// Cache data for boxed LCP formulation
-  Eigen::VectorXd mLo;
-
-  /// Cache data for boxed LCP formulation
-  Eigen::VectorXd mLoBackup;
-
-  /// Cache data for boxed LCP formulation
-  Eigen::VectorXd mHi;
-
-  /// Cache data for boxed LCP formulation
-  Eigen::VectorXd mHiBackup;
-
-  /// Cache data for boxed LCP formulation
-  Eigen::VectorXi mFIndex;
+  /// Cache data for boxed LCP formulation used when the constrained groups are
+  /// solved serially
+  LcpWorkspace mWorkspace;
 
-  /// Cache data for boxed LCP formulation
-  Eigen::VectorXi mFIndexBackup;
+  /// Per-worker data used when the constrained groups are solved in parallel
+  std::vector<Worker> mWorkers;
 
-  /// Cache data for boxed LCP formulation
-  Eigen::VectorXi mOffset;
+  /// How the matrix A of the LCP is assembled
+  MatrixAssembly mMatrixAssembly;
 
 #if DART_BUILD_MODE_DEBUG
 private:
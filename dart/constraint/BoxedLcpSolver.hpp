@@ -39,8 +39,11 @@
 
 #include <Eigen/Core>
 
+#include <memory>
 #include <string>
 
+#include <cstddef>
+
 namespace dart {
 namespace constraint {
 
@@ -53,6 +56,23 @@ public:
   /// Returns the type
   virtual const std::string& getType() const = 0;
 
+  /// Returns a new solver of the same type and options, or nullptr if this
+  /// solver cannot be cloned. BoxedLcpConstraintSolver uses the clones to give
+  /// each worker thread its own solver when constrained groups are solved in
+  /// parallel.
+  virtual std::shared_ptr<BoxedLcpSolver> clone() const
+  {
+    return nullptr;
+  }
+
+  /// Returns a number that changes whenever the options of this solver
+  /// change. BoxedLcpConstraintSolver keeps the clones of its worker threads
+  /// until the solver instance or this number changes.
+  std::size_t getOptionRevision() const
+  {
+    return mOptionRevision;
+  }
+
   /// Solves constriant impulses for a constrained group. The LCP formulation
   /// setting that this function solve is A*x = b + w where each x[i], w[i]
   /// satisfies one of
@@ -93,6 +113,17 @@ public:
 #if DART_BUILD_MODE_DEBUG
   virtual bool canSolve(int n, const double* A) = 0;
 #endif
+
+protected:
+  /// Marks the options as changed. Solvers with options call this from their
+  /// option setters so that the clones made from them are refreshed.
+  void markOptionsChanged()
+  {
+    ++mOptionRevision;
+  }
+
+private:
+  std::size_t mOptionRevision = 0;
 };
 
 } // namespace constraint
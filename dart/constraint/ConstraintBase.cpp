@@ -66,6 +66,20 @@ std::size_t ConstraintBase::getDimension() const
   return mDim;
 }
 
+//==============================================================================
+bool ConstraintBase::getBodyJacobians(
+    std::vector<ConstraintBodyJacobian>& /*jacobians*/) const
+{
+  return false;
+}
+
+//==============================================================================
+void ConstraintBase::applyConstraintForceMixing(
+    std::size_t /*index*/, double* /*vel*/) const
+{
+  // Do nothing
+}
+
 //==============================================================================
 void ConstraintBase::uniteSkeletons()
 {
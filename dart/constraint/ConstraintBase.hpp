@@ -37,6 +37,10 @@
 
 #include <dart/Export.hpp>
 
+#include <Eigen/Core>
+
+#include <vector>
+
 #include <cstddef>
 
 namespace dart {
@@ -72,6 +76,20 @@ struct ConstraintInfo
   double invTimeStep;
 };
 
+/// Jacobian of a constraint with respect to the spatial velocity of one
+/// BodyNode. Column i is the spatial impulse, in the body frame, that a unit
+/// impulse along constraint dimension i applies to the body. Conversely, the
+/// body contributes the transpose of the Jacobian times its spatial velocity
+/// to the constraint velocity.
+struct ConstraintBodyJacobian
+{
+  /// The BodyNode the impulses are applied to
+  dynamics::BodyNode* bodyNode;
+
+  /// 6 x (dimension of the constraint) Jacobian owned by the constraint
+  Eigen::Map<const Eigen::Matrix<double, 6, Eigen::Dynamic>> jacobian;
+};
+
 /// Constraint is a base class of concrete constraints classes
 class DART_API ConstraintBase
 {
@@ -94,6 +112,26 @@ public:
   /// Get velocity change due to the uint impulse
   virtual void getVelocityChange(double* vel, bool withCfm) = 0;
 
+  /// Get the Jacobians of this constraint with respect to the BodyNodes it
+  /// applies impulses to. Only reactive BodyNodes are reported. This allows
+  /// the constraint solver to assemble the LCP matrix from the mass matrices
+  /// of the skeletons instead of impulse tests.
+  ///
+  /// \param[out] jacobians The Jacobians. Valid until the next update().
+  /// \return False if the constraint does not support this, which is the
+  /// default.
+  virtual bool getBodyJacobians(
+      std::vector<ConstraintBodyJacobian>& jacobians) const;
+
+  /// Add the constraint force mixing terms that getVelocityChange() adds when
+  /// withCfm is true.
+  ///
+  /// \param[in] index Index of the constraint dimension whose velocity change
+  /// is being computed.
+  /// \param[in,out] vel Velocity change of all the dimensions of this
+  /// constraint due to a unit impulse along the given dimension.
+  virtual void applyConstraintForceMixing(std::size_t index, double* vel) const;
+
   /// Excite the constraint
   virtual void excite() = 0;
 
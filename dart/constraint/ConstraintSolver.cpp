@@ -50,18 +50,100 @@
 #include "dart/constraint/LCPSolver.hpp"
 #include "dart/constraint/MimicMotorConstraint.hpp"
 #include "dart/constraint/SoftContactConstraint.hpp"
+#include "dart/constraint/detail/ConstraintAllocator.hpp"
 #include "dart/dynamics/BodyNode.hpp"
 #include "dart/dynamics/Joint.hpp"
 #include "dart/dynamics/Skeleton.hpp"
 #include "dart/dynamics/SoftBodyNode.hpp"
 
 #include <algorithm>
+#include <iterator>
+#include <limits>
+
+#include <cmath>
+#include <cstring>
 
 namespace dart {
 namespace constraint {
 
 using namespace dynamics;
 
+namespace {
+
+/// Maximum distance between the contact points of two consecutive time steps
+/// to be considered the same contact for warm starting
+constexpr double contactMatchingDistance = 1e-2;
+
+using CollisionObjectPair = std::
+    pair<const collision::CollisionObject*, const collision::CollisionObject*>;
+
+/// Returns the pair of collision objects of the contact ordered by address
+CollisionObjectPair makeOrderedPair(const collision::Contact& contact)
+{
+  if (contact.collisionObject2 < contact.collisionObject1)
+    return {contact.collisionObject2, contact.collisionObject1};
+  return {contact.collisionObject1, contact.collisionObject2};
+}
+
+/// Layout of a contact impulse cached for warm starting in the data written
+/// by ConstraintSolver::saveContactWarmStartData()
+struct SavedContactImpulse
+{
+  const collision::CollisionObject* object1;
+  const collision::CollisionObject* object2;
+  double localPoint[3];
+  double impulse[3];
+  int triID1;
+  int triID2;
+};
+
+/// Returns the area of the convex hull of \c points, which are reordered.
+/// \c hull is used as scratch space.
+double computeConvexHullArea(
+    std::vector<Eigen::Vector2d>& points, std::vector<Eigen::Vector2d>& hull)
+{
+  if (points.size() < 3u)
+    return 0.0;
+
+  std::sort(
+      points.begin(),
+      points.end(),
+      [](const Eigen::Vector2d& a, const Eigen::Vector2d& b) {
+        return a.x() < b.x() || (a.x() == b.x() && a.y() < b.y());
+      });
+
+  const auto cross = [](const Eigen::Vector2d& o,
+                        const Eigen::Vector2d& a,
+                        const Eigen::Vector2d& b) {
+    return (a.x() - o.x()) * (b.y() - o.y())
+           - (a.y() - o.y()) * (b.x() - o.x());
+  };
+
+  // Andrew's monotone chain; the first vertex is repeated at the end
+  const auto n = points.size();
+  hull.resize(2u * n);
+  std::size_t k = 0u;
+  for (std::size_t i = 0u; i < n; ++i) {
+    while (k >= 2u && cross(hull[k - 2u], hull[k - 1u], points[i]) <= 0.0)
+      --k;
+    hull[k++] = points[i];
+  }
+  for (std::size_t i = n - 1u, lower = k + 1u; i > 0u; --i) {
+    while (k >= lower
+           && cross(hull[k - 2u], hull[k - 1u], points[i - 1u]) <= 0.0)
+      --k;
+    hull[k++] = points[i - 1u];
+  }
+
+  double area = 0.0;
+  for (std::size_t i = 0u; i + 1u < k; ++i)
+    area += hull[i].x() * hull[i + 1u].y() - hull[i + 1u].x() * hull[i].y();
+
+  return 0.5 * std::abs(area);
+}
+
+} // namespace
+
 //==============================================================================
 ConstraintSolver::ConstraintSolver()
   : mCollisionDetector(collision::FCLCollisionDetector::create()),
@@ -69,7 +151,9 @@ ConstraintSolver::ConstraintSolver()
     mCollisionOption(collision::CollisionOption(
         true, 1000u, std::make_shared<collision::BodyNodeCollisionFilter>())),
     mTimeStep(0.001),
-    mContactSurfaceHandler(std::make_shared<DefaultContactSurfaceHandler>())
+    mMaxNumContactsPerPair(0u),
+    mContactSurfaceHandler(std::make_shared<DefaultContactSurfaceHandler>()),
+    mContactWarmStarting(false)
 {
   auto cd = std::static_pointer_cast<collision::FCLCollisionDetector>(
       mCollisionDetector);
@@ -222,6 +306,108 @@ double ConstraintSolver::getTimeStep() const
   return mTimeStep;
 }
 
+//==============================================================================
+void ConstraintSolver::setNumThreads(std::size_t numThreads)
+{
+  if (numThreads == 0u)
+    numThreads = common::ThreadPool::getDefaultNumThreads();
+
+  if (numThreads == getNumThreads())
+    return;
+
+  if (numThreads == 1u)
+    mThreadPool.reset();
+  else
+    mThreadPool = std::make_unique<common::ThreadPool>(numThreads);
+}
+
+//==============================================================================
+std::size_t ConstraintSolver::getNumThreads() const
+{
+  return mThreadPool ? mThreadPool->getNumThreads() : 1u;
+}
+
+//==============================================================================
+void ConstraintSolver::setContactWarmStarting(bool enabled)
+{
+  mContactWarmStarting = enabled;
+
+  if (!mContactWarmStarting)
+    mContactImpulseCache.clear();
+}
+
+//==============================================================================
+bool ConstraintSolver::isContactWarmStartingEnabled() const
+{
+  return mContactWarmStarting;
+}
+
+//==============================================================================
+void ConstraintSolver::setMaxNumContactsPerPair(std::size_t maxNumContacts)
+{
+  mMaxNumContactsPerPair = maxNumContacts;
+}
+
+//==============================================================================
+std::size_t ConstraintSolver::getMaxNumContactsPerPair() const
+{
+  return mMaxNumContactsPerPair;
+}
+
+//==============================================================================
+std::size_t ConstraintSolver::getContactWarmStartDataSize() const
+{
+  return mContactImpulseCache.size() * sizeof(SavedContactImpulse);
+}
+
+//==============================================================================
+void ConstraintSolver::saveContactWarmStartData(
+    std::span<std::byte> buffer) const
+{
+  DART_ASSERT(buffer.size() >= getContactWarmStartDataSize());
+
+  std::byte* out = buffer.data();
+  for (const CachedContactImpulse& cached : mContactImpulseCache) {
+    SavedContactImpulse saved;
+    saved.object1 = cached.pair.first;
+    saved.object2 = cached.pair.second;
+    Eigen::Map<Eigen::Vector3d>(saved.localPoint) = cached.localPoint;
+    Eigen::Map<Eigen::Vector3d>(saved.impulse) = cached.impulse;
+    saved.triID1 = cached.triID1;
+    saved.triID2 = cached.triID2;
+
+    std::memcpy(out, &saved, sizeof(saved));
+    out += sizeof(saved);
+  }
+}
+
+//==============================================================================
+bool ConstraintSolver::restoreContactWarmStartData(
+    std::span<const std::byte> buffer)
+{
+  if (buffer.size() % sizeof(SavedContactImpulse) != 0u)
+    return false;
+
+  // The impulses were cached sorted by pair, so they are restored as is
+  mContactImpulseCache.resize(buffer.size() / sizeof(SavedContactImpulse));
+
+  const std::byte* in = buffer.data();
+  for (CachedContactImpulse& cached : mContactImpulseCache) {
+    SavedContactImpulse saved;
+    std::memcpy(&saved, in, sizeof(saved));
+    in += sizeof(saved);
+
+    cached.pair = {saved.object1, saved.object2};
+    cached.localPoint = Eigen::Map<const Eigen::Vector3d>(saved.localPoint);
+    cached.impulse = Eigen::Map<const Eigen::Vector3d>(saved.impulse);
+    cached.triID1 = saved.triID1;
+    cached.triID2 = saved.triID2;
+    cached.used = false;
+  }
+
+  return true;
+}
+
 void ConstraintSolver::setCollisionDetector(
     const std::shared_ptr<collision::CollisionDetector>& collisionDetector)
 {
@@ -241,6 +427,9 @@ void ConstraintSolver::setCollisionDetector(
 
   for (const auto& skeleton : mSkeletons)
     mCollisionGroup->addShapeFramesOf(skeleton.get());
+
+  // The cached contacts refer to the collision objects of the old group
+  mContactImpulseCache.clear();
 }
 
 //==============================================================================
@@ -309,6 +498,10 @@ void ConstraintSolver::solve()
 
   // Solve constrained groups
   solveConstrainedGroups();
+
+  // Keep the contact impulses to warm start the next time step
+  if (mContactWarmStarting)
+    cacheContactImpulses();
 }
 
 //==============================================================================
@@ -322,6 +515,10 @@ void ConstraintSolver::setFromOtherConstraintSolver(
   mManualConstraints = other.mManualConstraints;
 
   mContactSurfaceHandler = other.mContactSurfaceHandler;
+
+  setNumThreads(other.getNumThreads());
+  setContactWarmStarting(other.isContactWarmStartingEnabled());
+  setMaxNumContactsPerPair(other.getMaxNumContactsPerPair());
 }
 
 //==============================================================================
@@ -403,35 +600,27 @@ void ConstraintSolver::updateConstraints()
 
   mCollisionGroup->collide(mCollisionOption, &mCollisionResult);
 
+  updateContactConstraints();
+
+  //----------------------------------------------------------------------------
+  // Update automatic constraints: joint constraints
+  //----------------------------------------------------------------------------
+  updateJointConstraints();
+}
+
+//==============================================================================
+void ConstraintSolver::updateContactConstraints()
+{
+  const detail::ScopedConstraintAllocator allocatorScope(mConstraintAllocator);
+
   // Destroy previous contact constraints
   mContactConstraints.clear();
 
   // Destroy previous soft contact constraints
   mSoftContactConstraints.clear();
 
-  // Create a mapping of contact pairs to the number of contacts between them
-  using ContactPair
-      = std::pair<collision::CollisionObject*, collision::CollisionObject*>;
-
-  // Compare contact pairs while ignoring their order in the pair.
-  struct ContactPairCompare
-  {
-    ContactPair getSortedPair(const ContactPair& a) const
-    {
-      if (a.first < a.second)
-        return std::make_pair(a.second, a.first);
-      return a;
-    }
-
-    bool operator()(const ContactPair& a, const ContactPair& b) const
-    {
-      // Sort each pair and then do a lexicographical comparison
-      return getSortedPair(a) < getSortedPair(b);
-    }
-  };
-
-  std::map<ContactPair, size_t, ContactPairCompare> contactPairMap;
-  std::vector<collision::Contact*> contacts;
+  mRigidContacts.clear();
+  mSortedContactPairs.clear();
 
   // Create new contact constraints
   for (auto i = 0u; i < mCollisionResult.getNumContacts(); ++i) {
@@ -452,28 +641,36 @@ void ConstraintSolver::updateConstraints()
 
     if (isSoftContact(contact)) {
       mSoftContactConstraints.push_back(
-          std::make_shared<SoftContactConstraint>(contact, mTimeStep));
+          detail::makeConstraint<SoftContactConstraint>(contact, mTimeStep));
     } else {
-      // Increment the count of contacts between the two collision objects
-      ++contactPairMap[std::make_pair(
-          contact.collisionObject1, contact.collisionObject2)];
-
-      contacts.push_back(&contact);
+      mSortedContactPairs.push_back(makeOrderedPair(contact));
+      mRigidContacts.push_back(&contact);
     }
   }
 
+  if (mMaxNumContactsPerPair > 0u)
+    reduceContactManifolds();
+
+  // Sort the pairs to count the contacts between each pair of collision
+  // objects regardless of their order in the contacts
+  std::sort(mSortedContactPairs.begin(), mSortedContactPairs.end());
+
   // Add the new contact constraints to dynamic constraint list
-  for (auto* contact : contacts) {
-    std::size_t numContacts = 1;
-    auto it = contactPairMap.find(
-        std::make_pair(contact->collisionObject1, contact->collisionObject2));
-    if (it != contactPairMap.end())
-      numContacts = it->second;
+  for (auto* contact : mRigidContacts) {
+    const auto range = std::equal_range(
+        mSortedContactPairs.begin(),
+        mSortedContactPairs.end(),
+        makeOrderedPair(*contact));
+    const auto numContacts
+        = static_cast<std::size_t>(std::distance(range.first, range.second));
 
     auto contactConstraint = mContactSurfaceHandler->createConstraint(
         *contact, numContacts, mTimeStep);
     mContactConstraints.push_back(contactConstraint);
 
+    if (mContactWarmStarting)
+      warmStartContactConstraint(*contactConstraint);
+
     contactConstraint->update();
 
     if (contactConstraint->isActive())
@@ -487,10 +684,145 @@ void ConstraintSolver::updateConstraints()
     if (softContactConstraint->isActive())
       mActiveConstraints.push_back(softContactConstraint);
   }
+}
+
+//==============================================================================
+void ConstraintSolver::reduceContactManifolds()
+{
+  const auto numContacts = mRigidContacts.size();
+
+  // Group the contacts by pair of collision objects. The index breaks ties so
+  // that the contacts of a pair stay in the order of the collision result.
+  mManifoldCandidates.clear();
+  for (auto i = 0u; i < numContacts; ++i) {
+    mManifoldCandidates.push_back(
+        {mSortedContactPairs[i], i, Eigen::Vector2d::Zero(), true});
+  }
+  std::sort(
+      mManifoldCandidates.begin(),
+      mManifoldCandidates.end(),
+      [](const ManifoldCandidate& a, const ManifoldCandidate& b) {
+        return a.pair < b.pair || (a.pair == b.pair && a.index < b.index);
+      });
+
+  bool reduced = false;
+  auto first = mManifoldCandidates.begin();
+  while (first != mManifoldCandidates.end()) {
+    const auto last = std::find_if(
+        first, mManifoldCandidates.end(), [&](const ManifoldCandidate& c) {
+          return c.pair != first->pair;
+        });
+
+    if (static_cast<std::size_t>(last - first) > mMaxNumContactsPerPair) {
+      selectManifoldContacts(std::span<ManifoldCandidate>(first, last));
+      reduced = true;
+    }
+
+    first = last;
+  }
+
+  if (!reduced)
+    return;
+
+  // Compact the kept contacts in the order of the collision result
+  std::sort(
+      mManifoldCandidates.begin(),
+      mManifoldCandidates.end(),
+      [](const ManifoldCandidate& a, const ManifoldCandidate& b) {
+        return a.index < b.index;
+      });
+
+  std::size_t numKept = 0u;
+  for (const auto& candidate : mManifoldCandidates) {
+    if (!candidate.selected)
+      continue;
+
+    mRigidContacts[numKept] = mRigidContacts[candidate.index];
+    mSortedContactPairs[numKept] = mSortedContactPairs[candidate.index];
+    ++numKept;
+  }
+  mRigidContacts.resize(numKept);
+  mSortedContactPairs.resize(numKept);
+}
+
+//==============================================================================
+void ConstraintSolver::selectManifoldContacts(
+    std::span<ManifoldCandidate> candidates)
+{
+  // Project the contact points onto the plane orthogonal to the mean normal
+  Eigen::Vector3d normal = Eigen::Vector3d::Zero();
+  for (const auto& candidate : candidates)
+    normal += mRigidContacts[candidate.index]->normal;
+  if (normal.squaredNorm() < 1e-12)
+    normal = mRigidContacts[candidates.front().index]->normal;
+  normal.normalize();
+
+  const Eigen::Vector3d u = normal.unitOrthogonal();
+  const Eigen::Vector3d v = normal.cross(u);
+  for (auto& candidate : candidates) {
+    const auto& point = mRigidContacts[candidate.index]->point;
+    candidate.point = Eigen::Vector2d(u.dot(point), v.dot(point));
+    candidate.selected = false;
+  }
+
+  // Start from the deepest contact
+  auto deepest = std::max_element(
+      candidates.begin(),
+      candidates.end(),
+      [&](const ManifoldCandidate& a, const ManifoldCandidate& b) {
+        return mRigidContacts[a.index]->penetrationDepth
+               < mRigidContacts[b.index]->penetrationDepth;
+      });
+  deepest->selected = true;
+
+  // Greedily add the contact that yields the largest convex hull. Contacts
+  // that don't change the area, such as the second one or collinear ones,
+  // are ranked by their distance to the closest selected contact.
+  constexpr double areaTolerance = 1e-12;
+  for (auto numSelected = 1u; numSelected < mMaxNumContactsPerPair;
+       ++numSelected) {
+    ManifoldCandidate* best = nullptr;
+    double bestArea = 0.0;
+    double bestDistance = 0.0;
+
+    for (auto& candidate : candidates) {
+      if (candidate.selected)
+        continue;
+
+      double distance = std::numeric_limits<double>::infinity();
+      mManifoldPoints.clear();
+      for (const auto& other : candidates) {
+        if (!other.selected)
+          continue;
+
+        distance
+            = std::min(distance, (other.point - candidate.point).squaredNorm());
+        mManifoldPoints.push_back(other.point);
+      }
+      mManifoldPoints.push_back(candidate.point);
+
+      const double area = computeConvexHullArea(mManifoldPoints, mManifoldHull);
+      if (best == nullptr || area > bestArea + areaTolerance
+          || (area > bestArea - areaTolerance && distance > bestDistance)) {
+        best = &candidate;
+        bestArea = area;
+        bestDistance = distance;
+      }
+    }
+
+    // The remaining contacts coincide with selected ones
+    if (best == nullptr || bestDistance <= 0.0)
+      break;
+
+    best->selected = true;
+  }
+}
+
+//==============================================================================
+void ConstraintSolver::updateJointConstraints()
+{
+  const detail::ScopedConstraintAllocator allocatorScope(mConstraintAllocator);
 
-  //----------------------------------------------------------------------------
-  // Update automatic constraints: joint constraints
-  //----------------------------------------------------------------------------
   // Destroy previous joint constraints
   mJointConstraints.clear();
   mMimicMotorConstraints.clear();
@@ -499,6 +831,10 @@ void ConstraintSolver::updateConstraints()
 
   // Create new joint constraints
   for (const auto& skel : mSkeletons) {
+    // Sleeping skeletons are held still, so their joints need no constraints
+    if (skel->isSleeping())
+      continue;
+
     const std::size_t numJoints = skel->getNumJoints();
     for (std::size_t i = 0; i < numJoints; i++) {
       dynamics::Joint* joint = skel->getJoint(i);
@@ -510,24 +846,26 @@ void ConstraintSolver::updateConstraints()
       for (std::size_t j = 0; j < dof; ++j) {
         if (joint->getCoulombFriction(j) != 0.0) {
           mJointCoulombFrictionConstraints.push_back(
-              std::make_shared<JointCoulombFrictionConstraint>(joint));
+              detail::makeConstraint<JointCoulombFrictionConstraint>(joint));
           break;
         }
       }
 
       if (joint->areLimitsEnforced()
           || joint->getActuatorType() == dynamics::Joint::SERVO) {
-        mJointConstraints.push_back(std::make_shared<JointConstraint>(joint));
+        mJointConstraints.push_back(
+            detail::makeConstraint<JointConstraint>(joint));
       }
 
       if (joint->getActuatorType() == dynamics::Joint::MIMIC
           && joint->getMimicJoint()) {
         if (joint->isUsingCouplerConstraint()) {
-          mCouplerConstraints.push_back(std::make_shared<CouplerConstraint>(
-              joint, joint->getMimicDofProperties()));
+          mCouplerConstraints.push_back(
+              detail::makeConstraint<CouplerConstraint>(
+                  joint, joint->getMimicDofProperties()));
         } else {
           mMimicMotorConstraints.push_back(
-              std::make_shared<MimicMotorConstraint>(
+              detail::makeConstraint<MimicMotorConstraint>(
                   joint, joint->getMimicDofProperties()));
         }
       }
@@ -569,12 +907,15 @@ void ConstraintSolver::buildConstrainedGroups()
 {
   DART_PROFILE_SCOPED;
 
-  // Clear constrained groups
-  mConstrainedGroups.clear();
-
   // Exit if there is no active constraint
-  if (mActiveConstraints.empty())
+  if (mActiveConstraints.empty()) {
+    mConstrainedGroups.clear();
     return;
+  }
+
+  // Clear constrained groups while keeping their storage to reuse it
+  for (auto& constrainedGroup : mConstrainedGroups)
+    constrainedGroup.removeAllConstraints();
 
   //----------------------------------------------------------------------------
   // Unite skeletons according to constraints's relationships
@@ -585,12 +926,13 @@ void ConstraintSolver::buildConstrainedGroups()
   //----------------------------------------------------------------------------
   // Build constraint groups
   //----------------------------------------------------------------------------
+  std::size_t numGroups = 0;
   for (const auto& activeConstraint : mActiveConstraints) {
     bool found = false;
     const auto& skel = activeConstraint->getRootSkeleton();
 
-    for (const auto& constrainedGroup : mConstrainedGroups) {
-      if (constrainedGroup.mRootSkeleton == skel) {
+    for (std::size_t i = 0; i < numGroups; ++i) {
+      if (mConstrainedGroups[i].mRootSkeleton == skel) {
         found = true;
         break;
       }
@@ -599,11 +941,13 @@ void ConstraintSolver::buildConstrainedGroups()
     if (found)
       continue;
 
-    ConstrainedGroup newConstGroup;
-    newConstGroup.mRootSkeleton = skel;
-    skel->mUnionIndex = mConstrainedGroups.size();
-    mConstrainedGroups.push_back(newConstGroup);
+    if (mConstrainedGroups.size() == numGroups)
+      mConstrainedGroups.emplace_back();
+    mConstrainedGroups[numGroups].mRootSkeleton = skel;
+    skel->mUnionIndex = numGroups;
+    ++numGroups;
   }
+  mConstrainedGroups.resize(numGroups);
 
   // Add active constraints to constrained groups
   for (const auto& activeConstraint : mActiveConstraints) {
@@ -623,11 +967,37 @@ void ConstraintSolver::solveConstrainedGroups()
 {
   DART_PROFILE_SCOPED;
 
+  if (mThreadPool && mConstrainedGroups.size() > 1u
+      && prepareWorkers(mThreadPool->getNumThreads())) {
+    // Each group only touches its own skeletons and the worker's scratch
+    // data, so the results are the same regardless of the scheduling.
+    mThreadPool->parallelFor(
+        mConstrainedGroups.size(),
+        [this](std::size_t index, std::size_t workerIndex) {
+          solveConstrainedGroupOnWorker(
+              mConstrainedGroups[index], workerIndex);
+        });
+    return;
+  }
+
   for (auto& constraintGroup : mConstrainedGroups) {
     solveConstrainedGroup(constraintGroup);
   }
 }
 
+//==============================================================================
+bool ConstraintSolver::prepareWorkers(std::size_t /*numWorkers*/)
+{
+  return false;
+}
+
+//==============================================================================
+void ConstraintSolver::solveConstrainedGroupOnWorker(
+    ConstrainedGroup& group, std::size_t /*workerIndex*/)
+{
+  solveConstrainedGroup(group);
+}
+
 //==============================================================================
 bool ConstraintSolver::isSoftContact(const collision::Contact& contact) const
 {
@@ -648,6 +1018,110 @@ bool ConstraintSolver::isSoftContact(const collision::Contact& contact) const
   return bodyNode1IsSoft || bodyNode2IsSoft;
 }
 
+//==============================================================================
+void ConstraintSolver::cacheContactImpulses()
+{
+  DART_PROFILE_SCOPED;
+
+  mContactImpulseCache.clear();
+
+  for (const auto& contactConstraint : mContactConstraints) {
+    if (!contactConstraint->isActive())
+      continue;
+
+    const collision::Contact& contact = contactConstraint->getContact();
+
+    CachedContactImpulse cached;
+    cached.pair = makeOrderedPair(contact);
+    cached.triID1 = contact.triID1;
+    cached.triID2 = contact.triID2;
+    cached.impulse = contact.force * mTimeStep;
+    cached.used = false;
+
+    // Order the pair by address so that the same pair reported in the
+    // opposite order maps to the same entry
+    if (cached.pair.first != contact.collisionObject1) {
+      std::swap(cached.triID1, cached.triID2);
+      cached.impulse = -cached.impulse;
+    }
+
+    cached.localPoint
+        = cached.pair.first->getTransform().inverse() * contact.point;
+
+    mContactImpulseCache.push_back(cached);
+  }
+
+  std::sort(
+      mContactImpulseCache.begin(),
+      mContactImpulseCache.end(),
+      [](const CachedContactImpulse& a, const CachedContactImpulse& b) {
+        return a.pair < b.pair;
+      });
+}
+
+//==============================================================================
+void ConstraintSolver::warmStartContactConstraint(
+    ContactConstraint& constraint)
+{
+  const collision::Contact& contact = constraint.getContact();
+
+  const CollisionObjectPair pair = makeOrderedPair(contact);
+  int triID1 = contact.triID1;
+  int triID2 = contact.triID2;
+  const bool swapped = pair.first != contact.collisionObject1;
+  if (swapped)
+    std::swap(triID1, triID2);
+
+  struct PairCompare
+  {
+    bool operator()(
+        const CachedContactImpulse& cached,
+        const CollisionObjectPair& pair) const
+    {
+      return cached.pair < pair;
+    }
+
+    bool operator()(
+        const CollisionObjectPair& pair,
+        const CachedContactImpulse& cached) const
+    {
+      return pair < cached.pair;
+    }
+  };
+
+  const auto range = std::equal_range(
+      mContactImpulseCache.begin(),
+      mContactImpulseCache.end(),
+      pair,
+      PairCompare());
+  if (range.first == range.second)
+    return;
+
+  const Eigen::Vector3d localPoint
+      = pair.first->getTransform().inverse() * contact.point;
+
+  // Pick the closest unused contact of the previous time step
+  CachedContactImpulse* match = nullptr;
+  double minDistance = contactMatchingDistance;
+  for (auto it = range.first; it != range.second; ++it) {
+    CachedContactImpulse& cached = *it;
+    if (cached.used || cached.triID1 != triID1 || cached.triID2 != triID2)
+      continue;
+
+    const double distance = (cached.localPoint - localPoint).norm();
+    if (distance < minDistance) {
+      minDistance = distance;
+      match = &cached;
+    }
+  }
+
+  if (!match)
+    return;
+
+  match->used = true;
+  constraint.setInitialImpulse(swapped ? -match->impulse : match->impulse);
+}
+
 //==============================================================================
 ContactSurfaceHandlerPtr ConstraintSolver::getLastContactSurfaceHandler() const
 {
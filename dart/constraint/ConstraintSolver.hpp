@@ -40,14 +40,19 @@
 #include <dart/collision/CollisionDetector.hpp>
 
 #include <dart/common/Deprecated.hpp>
+#include <dart/common/PoolAllocator.hpp>
+#include <dart/common/ThreadPool.hpp>
 
 #include <dart/Export.hpp>
 
 #include <Eigen/Dense>
 
 #include <span>
+#include <utility>
 #include <vector>
 
+#include <cstddef>
+
 namespace dart {
 
 namespace dynamics {
@@ -146,6 +151,67 @@ public:
   /// Get time step
   double getTimeStep() const;
 
+  /// Sets the number of threads used to solve the constrained groups.
+  ///
+  /// Constrained groups are independent islands of skeletons, so they can be
+  /// solved concurrently. The results do not depend on the number of threads.
+  /// Pass 1 (default) to solve the groups serially on the calling thread, or 0
+  /// to use the number of hardware threads.
+  void setNumThreads(std::size_t numThreads);
+
+  /// Returns the number of threads used to solve the constrained groups.
+  std::size_t getNumThreads() const;
+
+  /// Sets whether the contact impulses of the previous time step are used as
+  /// the initial guess of the LCP (warm starting).
+  ///
+  /// Contacts are matched across time steps by their pair of collision
+  /// objects, their triangle IDs, and their contact point expressed in the
+  /// frame of the first collision object. Persisting contacts, such as the
+  /// ones of a resting stack, then start from nearly converged impulses.
+  /// Warm starting is disabled by default.
+  virtual void setContactWarmStarting(bool enabled);
+
+  /// Returns whether contact impulses are warm started.
+  bool isContactWarmStartingEnabled() const;
+
+  /// Sets the maximum number of contact constraints created per pair of
+  /// collision objects, or 0 to create one for every contact.
+  ///
+  /// Mesh pairs can report dozens of contacts that each add three rows to
+  /// the LCP. When a pair has more contacts than this, the solver keeps the
+  /// deepest contact and then greedily adds the contacts that enlarge the
+  /// area they span in the contact plane the most. The deepest contact counts
+  /// toward the limit, so at most \c maxNumContacts contacts are kept rather
+  /// than the deepest one plus \c maxNumContacts hull points. The reduction
+  /// is applied to the collision result of any collision detector and is
+  /// disabled by default.
+  void setMaxNumContactsPerPair(std::size_t maxNumContacts);
+
+  /// Returns the maximum number of contact constraints per pair of collision
+  /// objects, where 0 means there is no limit.
+  std::size_t getMaxNumContactsPerPair() const;
+
+  /// Returns the number of bytes saveContactWarmStartData() needs for the
+  /// contact impulses currently cached for warm starting.
+  std::size_t getContactWarmStartDataSize() const;
+
+  /// Copies the contact impulses cached for warm starting into \c buffer,
+  /// which must hold getContactWarmStartDataSize() bytes.
+  void saveContactWarmStartData(std::span<std::byte> buffer) const;
+
+  /// Replaces the contact impulses cached for warm starting with the ones
+  /// copied by saveContactWarmStartData().
+  ///
+  /// The cached impulses refer to the collision objects by address, so they
+  /// can only be restored into the solver they were saved from, as long as
+  /// its collision group was not changed since then. The cache only
+  /// allocates when more impulses are restored than it held before.
+  ///
+  /// \return False if the size of \c buffer is not a valid size of saved
+  /// data, in which case the cache is left unchanged.
+  bool restoreContactWarmStartData(std::span<const std::byte> buffer);
+
   /// Set collision detector
   void setCollisionDetector(
       const std::shared_ptr<collision::CollisionDetector>& collisionDetector);
@@ -207,6 +273,20 @@ protected:
   // TODO(JS): Docstring
   virtual void solveConstrainedGroup(ConstrainedGroup& group) = 0;
 
+  /// Prepares the per-worker data needed to call
+  /// solveConstrainedGroupOnWorker() concurrently from \c numWorkers threads.
+  ///
+  /// Returns false if the groups cannot be solved concurrently, in which case
+  /// they are solved serially by solveConstrainedGroup(). The default
+  /// implementation returns false.
+  virtual bool prepareWorkers(std::size_t numWorkers);
+
+  /// Solves a constrained group using the data of the given worker. This is
+  /// called concurrently for different groups and different workers once
+  /// prepareWorkers() returned true.
+  virtual void solveConstrainedGroupOnWorker(
+      ConstrainedGroup& group, std::size_t workerIndex);
+
   /// Checks if the skeleton is contained in this solver
   bool hasSkeleton(const dynamics::ConstSkeletonPtr& skeleton) const;
 
@@ -222,6 +302,12 @@ protected:
   /// Update constraints
   void updateConstraints();
 
+  /// Recreates the contact constraints from the last collision result
+  void updateContactConstraints();
+
+  /// Recreates the joint constraints of the skeletons
+  void updateJointConstraints();
+
   /// Build constrained groupsContact
   void buildConstrainedGroups();
 
@@ -231,6 +317,14 @@ protected:
   /// Return true if at least one of colliding body is soft body
   bool isSoftContact(const collision::Contact& contact) const;
 
+  /// Stores the impulses applied by the contact constraints in this time step
+  /// to warm start the contact constraints of the next time step
+  void cacheContactImpulses();
+
+  /// Sets the initial impulse of the contact constraint from the impulse
+  /// applied at the matching contact in the previous time step, if any
+  void warmStartContactConstraint(ContactConstraint& constraint);
+
   using CollisionDetector = collision::CollisionDetector;
 
   /// Collision detector
@@ -251,6 +345,11 @@ protected:
   /// Skeleton list
   std::vector<dynamics::SkeletonPtr> mSkeletons;
 
+  /// Allocator of the constraints that are recreated every time step. Their
+  /// memory is recycled across time steps instead of being returned to the
+  /// heap. Declared before the constraints so that it outlives them.
+  common::PoolAllocator mConstraintAllocator;
+
   /// Contact constraints those are automatically created
   std::vector<ContactConstraintPtr> mContactConstraints;
 
@@ -279,8 +378,92 @@ protected:
   /// Constraint group list
   std::vector<ConstrainedGroup> mConstrainedGroups;
 
+  using CollisionObjectPair = std::pair<
+      const collision::CollisionObject*,
+      const collision::CollisionObject*>;
+
+  /// Rigid contacts of the last collision result that become contact
+  /// constraints. Kept as a member to reuse its storage.
+  std::vector<collision::Contact*> mRigidContacts;
+
+  /// Collision object pairs of mRigidContacts ordered by address and sorted,
+  /// used to count the contacts per pair. Kept as a member to reuse its
+  /// storage.
+  std::vector<CollisionObjectPair> mSortedContactPairs;
+
+  /// Rigid contact considered by the per-pair manifold reduction
+  struct ManifoldCandidate
+  {
+    /// Pair of collision objects ordered by address
+    CollisionObjectPair pair;
+
+    /// Index of the contact in mRigidContacts
+    std::size_t index;
+
+    /// Contact point projected onto the contact plane of its pair
+    Eigen::Vector2d point;
+
+    /// Whether the contact is kept
+    bool selected;
+  };
+
+  /// Drops contacts of mRigidContacts (and mSortedContactPairs, which must
+  /// still be in the same order) so that no pair of collision objects has
+  /// more than mMaxNumContactsPerPair contacts
+  void reduceContactManifolds();
+
+  /// Marks up to mMaxNumContactsPerPair of the contacts of a single pair as
+  /// selected: the deepest contact, then the contacts that enlarge the convex
+  /// hull of the selected points the most
+  void selectManifoldContacts(std::span<ManifoldCandidate> candidates);
+
+  /// Maximum number of contacts per pair of collision objects, or 0 for no
+  /// limit
+  std::size_t mMaxNumContactsPerPair;
+
+  /// Candidates of reduceContactManifolds(). Kept as a member to reuse its
+  /// storage.
+  std::vector<ManifoldCandidate> mManifoldCandidates;
+
+  /// Scratch points of the convex hulls evaluated by selectManifoldContacts()
+  std::vector<Eigen::Vector2d> mManifoldPoints;
+  std::vector<Eigen::Vector2d> mManifoldHull;
+
   /// Factory for ContactSurfaceParams for each contact
   ContactSurfaceHandlerPtr mContactSurfaceHandler;
+
+  /// Thread pool to solve constrained groups concurrently. nullptr when the
+  /// groups are solved serially.
+  std::unique_ptr<common::ThreadPool> mThreadPool;
+
+  /// Contact impulse cached for warm starting
+  struct CachedContactImpulse
+  {
+    /// Pair of collision objects ordered by address
+    CollisionObjectPair pair;
+
+    /// Contact point w.r.t. the frame of the first collision object
+    Eigen::Vector3d localPoint;
+
+    /// Triangle ID of the first collision object
+    int triID1;
+
+    /// Triangle ID of the second collision object
+    int triID2;
+
+    /// Impulse applied to the first collision object w.r.t. world frame
+    Eigen::Vector3d impulse;
+
+    /// Whether this impulse is already used for a contact of this time step
+    bool used;
+  };
+
+  /// Whether contact impulses are warm started
+  bool mContactWarmStarting;
+
+  /// Contact impulses of the previous time step sorted by the pair of
+  /// collision objects
+  std::vector<CachedContactImpulse> mContactImpulseCache;
 };
 
 } // namespace constraint
@@ -41,6 +41,7 @@
 #include "dart/math/Helpers.hpp"
 #include "dart/math/lcp/Dantzig/Lcp.hpp"
 
+#include <algorithm>
 #include <iostream>
 
 namespace dart {
@@ -83,6 +84,7 @@ ContactConstraint::ContactConstraint(
     mFirstFrictionalDirection(DART_DEFAULT_FRICTION_DIR),
     mPrimarySlipCompliance(DART_DEFAULT_SLIP_COMPLIANCE),
     mSecondarySlipCompliance(DART_DEFAULT_SLIP_COMPLIANCE),
+    mInitialImpulse(Eigen::Vector3d::Zero()),
     mIsFrictionOn(true),
     mAppliedImpulseIndex(dynamics::INVALID_INDEX),
     mIsBounceOn(false),
@@ -411,11 +413,11 @@ void ContactConstraint::getInformation(ConstraintInfo* info)
     info->b[1] += mContactSurfaceMotionVelocity.y();
     info->b[2] += mContactSurfaceMotionVelocity.z();
 
-    // TODO(JS): Initial guess
-    // x
-    info->x[0] = 0.0;
-    info->x[1] = 0.0;
-    info->x[2] = 0.0;
+    // Initial guess: project the warm-start impulse onto the contact basis
+    const TangentBasisMatrix D = getTangentBasisMatrixODE(mContact.normal);
+    info->x[0] = std::max(mContact.normal.dot(mInitialImpulse), 0.0);
+    info->x[1] = D.col(0).dot(mInitialImpulse);
+    info->x[2] = D.col(1).dot(mInitialImpulse);
   }
   //----------------------------------------------------------------------------
   // Frictionless case
@@ -460,9 +462,8 @@ void ContactConstraint::getInformation(ConstraintInfo* info)
     info->b[0] += bouncingVelocity;
     info->b[0] += mContactSurfaceMotionVelocity.x();
 
-    // TODO(JS): Initial guess
-    // x
-    info->x[0] = 0.0;
+    // Initial guess: project the warm-start impulse onto the contact normal
+    info->x[0] = std::max(mContact.normal.dot(mInitialImpulse), 0.0);
   }
 }
 
@@ -539,21 +540,43 @@ void ContactConstraint::getVelocityChange(double* vel, bool withCfm)
   if (mBodyNodeB->getSkeleton()->isImpulseApplied() && mBodyNodeB->isReactive())
     velMap += mSpatialNormalB.transpose() * mBodyNodeB->getBodyVelocityChange();
 
+  if (withCfm)
+    applyConstraintForceMixing(mAppliedImpulseIndex, vel);
+}
+
+//==============================================================================
+bool ContactConstraint::getBodyJacobians(
+    std::vector<ConstraintBodyJacobian>& jacobians) const
+{
+  jacobians.clear();
+
+  if (mBodyNodeA->isReactive())
+    jacobians.push_back(
+        {mBodyNodeA, {mSpatialNormalA.data(), 6, mSpatialNormalA.cols()}});
+
+  if (mBodyNodeB->isReactive())
+    jacobians.push_back(
+        {mBodyNodeB, {mSpatialNormalB.data(), 6, mSpatialNormalB.cols()}});
+
+  return true;
+}
+
+//==============================================================================
+void ContactConstraint::applyConstraintForceMixing(
+    std::size_t index, double* vel) const
+{
   // Add small values to the diagnal to keep it away from singular, similar to
   // cfm variable in ODE
-  if (withCfm) {
-    vel[mAppliedImpulseIndex]
-        += vel[mAppliedImpulseIndex] * mConstraintForceMixing;
-    switch (mAppliedImpulseIndex) {
-      case 1:
-        vel[1] += (mPrimarySlipCompliance / mTimeStep);
-        break;
-      case 2:
-        vel[2] += (mSecondarySlipCompliance / mTimeStep);
-        break;
-      default:
-        break;
-    }
+  vel[index] += vel[index] * mConstraintForceMixing;
+  switch (index) {
+    case 1:
+      vel[1] += (mPrimarySlipCompliance / mTimeStep);
+      break;
+    case 2:
+      vel[2] += (mSecondarySlipCompliance / mTimeStep);
+      break;
+    default:
+      break;
   }
 }
 
@@ -598,7 +621,7 @@ void ContactConstraint::applyImpulse(double* lambda)
       mBodyNodeB->addConstraintImpulse(mSpatialNormalB.col(0) * lambda[0]);
 
     // Add contact impulse (force) toward the tangential w.r.t. world frame
-    const Eigen::MatrixXd D = getTangentBasisMatrixODE(mContact.normal);
+    const TangentBasisMatrix D = getTangentBasisMatrixODE(mContact.normal);
     mContact.force += D.col(0) * lambda[1] / mTimeStep;
 
     // Tangential direction-1 impulsive force
@@ -788,5 +811,11 @@ const collision::Contact& ContactConstraint::getContact() const
   return mContact;
 }
 
+//==============================================================================
+void ContactConstraint::setInitialImpulse(const Eigen::Vector3d& impulse)
+{
+  mInitialImpulse = impulse;
+}
+
 } // namespace constraint
 } // namespace dart
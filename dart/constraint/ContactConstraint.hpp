@@ -127,6 +127,14 @@ protected:
   // Documentation inherited
   void getVelocityChange(double* vel, bool withCfm) override;
 
+  // Documentation inherited
+  bool getBodyJacobians(
+      std::vector<ConstraintBodyJacobian>& jacobians) const override;
+
+  // Documentation inherited
+  void applyConstraintForceMixing(
+      std::size_t index, double* vel) const override;
+
   // Documentation inherited
   void excite() override;
 
@@ -148,6 +156,11 @@ protected:
 private:
   using TangentBasisMatrix = Eigen::Matrix<double, 3, 2>;
 
+  /// Body Jacobian with one column per constraint dimension. The storage is
+  /// fixed since there are at most three dimensions.
+  using SpatialNormalMatrix
+      = Eigen::Matrix<double, 6, Eigen::Dynamic, Eigen::ColMajor, 6, 3>;
+
   /// Get change in relative velocity at contact point due to external impulse
   /// \param[out] relVel Change in relative velocity at contact point of the
   /// two colliding bodies.
@@ -179,6 +192,11 @@ private:
   /// Get contact object associated witht this constraint
   const collision::Contact& getContact() const;
 
+  /// Set the contact impulse, expressed in the world frame, that is used as
+  /// the initial guess of the LCP. This is typically the impulse applied at
+  /// the same contact point in the previous time step.
+  void setInitialImpulse(const Eigen::Vector3d& impulse);
+
 private:
   /// Time step
   double mTimeStep;
@@ -219,11 +237,14 @@ private:
   /// Whether this contact is self-collision.
   bool mIsSelfCollision;
 
+  /// Initial guess of the contact impulse w.r.t. world frame
+  Eigen::Vector3d mInitialImpulse;
+
   /// Local body jacobians for mBodyNode1
-  Eigen::Matrix<double, 6, Eigen::Dynamic> mSpatialNormalA;
+  SpatialNormalMatrix mSpatialNormalA;
 
   /// Local body jacobians for mBodyNode2
-  Eigen::Matrix<double, 6, Eigen::Dynamic> mSpatialNormalB;
+  SpatialNormalMatrix mSpatialNormalB;
 
   ///
   bool mIsFrictionOn;
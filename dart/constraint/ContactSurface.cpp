@@ -37,6 +37,7 @@
 #include "dart/common/Macros.hpp"
 #include "dart/constraint/ContactConstraint.hpp"
 #include "dart/constraint/ContactSurface.hpp"
+#include "dart/constraint/detail/ConstraintAllocator.hpp"
 
 #include <fmt/ostream.h>
 
@@ -84,7 +85,7 @@ ContactConstraintPtr ContactSurfaceHandler::createConstraint(
     const double timeStep) const
 {
   auto params = createParams(contact, numContactsOnCollisionObject);
-  return std::make_shared<ContactConstraint>(contact, timeStep, params);
+  return detail::makeConstraint<ContactConstraint>(contact, timeStep, params);
 }
 
 //==============================================================================
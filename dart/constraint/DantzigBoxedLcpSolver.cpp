@@ -33,11 +33,38 @@
 #include "dart/constraint/DantzigBoxedLcpSolver.hpp"
 
 #include "dart/common/Profile.hpp"
+#include "dart/math/lcp/Dantzig/Common.hpp"
 #include "dart/math/lcp/Dantzig/Lcp.hpp"
+#include "dart/math/lcp/Dantzig/Matrix.hpp"
+
+#include <Eigen/Core>
+
+#include <algorithm>
+
+#include <cmath>
 
 namespace dart {
 namespace constraint {
 
+namespace {
+
+/// States of the variables in the active set of an initial guess
+enum GuessState : int
+{
+  Free,
+  AtLower,
+  AtUpper,
+  Fixed,
+};
+
+} // namespace
+
+//==============================================================================
+DantzigBoxedLcpSolver::Option::Option(bool warmStart) : mWarmStart(warmStart)
+{
+  // Do nothing
+}
+
 //==============================================================================
 const std::string& DantzigBoxedLcpSolver::getType() const
 {
@@ -51,6 +78,14 @@ const std::string& DantzigBoxedLcpSolver::getStaticType()
   return type;
 }
 
+//==============================================================================
+std::shared_ptr<BoxedLcpSolver> DantzigBoxedLcpSolver::clone() const
+{
+  auto solver = std::make_shared<DantzigBoxedLcpSolver>();
+  solver->setOption(mOption);
+  return solver;
+}
+
 //==============================================================================
 bool DantzigBoxedLcpSolver::solve(
     int n,
@@ -65,15 +100,162 @@ bool DantzigBoxedLcpSolver::solve(
 {
   DART_PROFILE_SCOPED;
 
-  // Allocate w vector for LCP solver
-  double* w = new double[n];
-  std::memset(w, 0, n * sizeof(double));
+  // Reuse the active set of the initial guess if it is still valid
+  if (mOption.mWarmStart && solveFromInitialGuess(n, A, x, b, lo, hi, findex))
+    return true;
+
+  // The w vector for LCP solver is kept across calls
+  mCacheW.assign(n, 0.0);
 
-  bool result = math::SolveLCP<double>(
-      n, A, x, b, w, nub, lo, hi, findex, earlyTermination);
+  return math::SolveLCP<double>(
+      n, A, x, b, mCacheW.data(), nub, lo, hi, findex, earlyTermination);
+}
 
-  delete[] w;
-  return result;
+//==============================================================================
+void DantzigBoxedLcpSolver::setOption(const Option& option)
+{
+  mOption = option;
+  markOptionsChanged();
+}
+
+//==============================================================================
+const DantzigBoxedLcpSolver::Option& DantzigBoxedLcpSolver::getOption() const
+{
+  return mOption;
+}
+
+//==============================================================================
+bool DantzigBoxedLcpSolver::solveFromInitialGuess(
+    int n,
+    const double* A,
+    double* x,
+    const double* b,
+    const double* lo,
+    const double* hi,
+    const int* findex)
+{
+  // The variables at their bounds are fixed, and the remaining ones are solved
+  // from the linear system A_FF * x_F = b_F - A_FC * x_C. Friction variables
+  // at the boundary of the friction cone make the bounds depend on the
+  // solution, so such guesses are rejected.
+  Eigen::Map<Eigen::VectorXd> xMap(x, n);
+  if (xMap.isZero(0.0))
+    return false;
+
+  const int nskip = math::padding(n);
+
+  mCacheStates.assign(n, Free);
+  mCacheGuess.assign(x, x + n);
+  auto& states = mCacheStates;
+  auto& guess = mCacheGuess;
+
+  // Classify the variables with constant bounds first because the bounds of
+  // the friction variables depend on them
+  for (int i = 0; i < n; ++i) {
+    if (findex && findex[i] >= 0)
+      continue;
+
+    if (guess[i] <= lo[i]) {
+      guess[i] = lo[i];
+      states[i] = AtLower;
+    } else if (guess[i] >= hi[i]) {
+      guess[i] = hi[i];
+      states[i] = AtUpper;
+    }
+  }
+
+  for (int i = 0; findex && i < n; ++i) {
+    if (findex[i] < 0)
+      continue;
+
+    const double bound = std::abs(hi[i] * guess[findex[i]]);
+    if (states[findex[i]] != Free && bound == 0.0) {
+      // No friction without normal impulse
+      guess[i] = 0.0;
+      states[i] = Fixed;
+    } else if (std::abs(guess[i]) >= bound) {
+      return false;
+    }
+  }
+
+  mCacheFreeIndices.clear();
+  for (int i = 0; i < n; ++i) {
+    if (states[i] == Free)
+      mCacheFreeIndices.push_back(i);
+  }
+
+  const int numFree = static_cast<int>(mCacheFreeIndices.size());
+  if (numFree > 0) {
+    const int freeSkip = math::padding(numFree);
+    mCacheAFF.resize(static_cast<std::size_t>(numFree) * freeSkip);
+    mCacheD.resize(numFree);
+    mCacheRhs.resize(numFree);
+    for (int r = 0; r < numFree; ++r) {
+      const int i = mCacheFreeIndices[r];
+      const double* ARow = A + static_cast<std::size_t>(nskip) * i;
+      double rhs = b[i];
+      for (int j = 0; j < n; ++j) {
+        if (states[j] != Free)
+          rhs -= ARow[j] * guess[j];
+      }
+      mCacheRhs[r] = rhs;
+      for (int c = 0; c < numFree; ++c)
+        mCacheAFF[static_cast<std::size_t>(r) * freeSkip + c]
+            = ARow[mCacheFreeIndices[c]];
+    }
+
+    math::dFactorLDLT(mCacheAFF.data(), mCacheD.data(), numFree, freeSkip);
+    for (int r = 0; r < numFree; ++r) {
+      // d holds the reciprocals of the pivots, which must be positive
+      if (!std::isfinite(mCacheD[r]) || mCacheD[r] <= 0.0)
+        return false;
+    }
+    math::dSolveLDLT(
+        mCacheAFF.data(), mCacheD.data(), mCacheRhs.data(), numFree, freeSkip);
+
+    for (int r = 0; r < numFree; ++r)
+      guess[mCacheFreeIndices[r]] = mCacheRhs[r];
+  }
+
+  // Check the bounds and the complementarity conditions of w = A * x - b
+  double bNorm = 0.0;
+  for (int i = 0; i < n; ++i)
+    bNorm = std::max(bNorm, std::abs(b[i]));
+  const double tol = 1e-9 * (1.0 + bNorm);
+  for (int i = 0; i < n; ++i) {
+    const double* ARow = A + static_cast<std::size_t>(nskip) * i;
+    double w = -b[i];
+    for (int j = 0; j < n; ++j)
+      w += ARow[j] * guess[j];
+
+    switch (states[i]) {
+      case Free: {
+        double lower = lo[i];
+        double upper = hi[i];
+        if (findex && findex[i] >= 0) {
+          upper = std::abs(hi[i] * guess[findex[i]]);
+          lower = -upper;
+        }
+        if (!std::isfinite(guess[i]) || guess[i] < lower - tol
+            || guess[i] > upper + tol || std::abs(w) > tol)
+          return false;
+        break;
+      }
+      case AtLower:
+        if (w < -tol)
+          return false;
+        break;
+      case AtUpper:
+        if (w > tol)
+          return false;
+        break;
+      default:
+        break;
+    }
+  }
+
+  std::copy(guess.begin(), guess.end(), x);
+  return true;
 }
 
 #if DART_BUILD_MODE_DEBUG
@@ -37,18 +37,33 @@
 
 #include <dart/Export.hpp>
 
+#include <vector>
+
 namespace dart {
 namespace constraint {
 
 class DART_API DantzigBoxedLcpSolver : public BoxedLcpSolver
 {
 public:
+  struct DART_API Option
+  {
+    /// Whether solve() first tries the active set implied by the initial
+    /// guess in x before pivoting from scratch. ConstraintSolver turns this on
+    /// for its Dantzig solvers when contact warm starting is enabled.
+    bool mWarmStart;
+
+    Option(bool warmStart = false);
+  };
+
   // Documentation inherited.
   const std::string& getType() const override;
 
   /// Returns type for this class
   static const std::string& getStaticType();
 
+  // Documentation inherited.
+  std::shared_ptr<BoxedLcpSolver> clone() const override;
+
   // Documentation inherited.
   bool solve(
       int n,
@@ -65,6 +80,35 @@ public:
   // Documentation inherited.
   bool canSolve(int n, const double* A) override;
 #endif
+
+  /// Sets options
+  void setOption(const Option& option);
+
+  /// Returns options.
+  const Option& getOption() const;
+
+protected:
+  /// Tries to solve the LCP with the active set implied by the initial guess
+  /// in x. Returns true, with the solution in x, if that active set yields a
+  /// solution satisfying the bounds and the complementarity conditions.
+  bool solveFromInitialGuess(
+      int n,
+      const double* A,
+      double* x,
+      const double* b,
+      const double* lo,
+      const double* hi,
+      const int* findex);
+
+  Option mOption;
+
+  std::vector<int> mCacheStates;
+  std::vector<int> mCacheFreeIndices;
+  std::vector<double> mCacheGuess;
+  std::vector<double> mCacheAFF;
+  std::vector<double> mCacheD;
+  std::vector<double> mCacheRhs;
+  std::vector<double> mCacheW;
 };
 
 } // namespace constraint
@@ -46,18 +46,33 @@
 namespace dart {
 namespace constraint {
 
+namespace {
+
+//==============================================================================
+/// Advances the linear congruential generator of math::dRand() and returns a
+/// random integer in [0, n)
+int randomInt(unsigned long& state, int n)
+{
+  state = (state * 1103515245 + 12345) & 0xffffffff;
+  return static_cast<int>((state * static_cast<unsigned long long>(n)) >> 32);
+}
+
+} // namespace
+
 //==============================================================================
 PgsBoxedLcpSolver::Option::Option(
     int maxIteration,
     double deltaXTolerance,
     double relativeDeltaXTolerance,
     double epsilonForDivision,
-    bool randomizeConstraintOrder)
+    bool randomizeConstraintOrder,
+    unsigned long randomSeed)
   : mMaxIteration(maxIteration),
     mDeltaXThreshold(deltaXTolerance),
     mRelativeDeltaXTolerance(relativeDeltaXTolerance),
     mEpsilonForDivision(epsilonForDivision),
-    mRandomizeConstraintOrder(randomizeConstraintOrder)
+    mRandomizeConstraintOrder(randomizeConstraintOrder),
+    mRandomSeed(randomSeed)
 {
   // Do nothing
 }
@@ -75,6 +90,14 @@ const std::string& PgsBoxedLcpSolver::getStaticType()
   return type;
 }
 
+//==============================================================================
+std::shared_ptr<BoxedLcpSolver> PgsBoxedLcpSolver::clone() const
+{
+  auto solver = std::make_shared<PgsBoxedLcpSolver>();
+  solver->setOption(mOption);
+  return solver;
+}
+
 //==============================================================================
 bool PgsBoxedLcpSolver::solve(
     int n,
@@ -173,7 +196,7 @@ bool PgsBoxedLcpSolver::solve(
       if ((iter & 7) == 0) {
         for (std::size_t i = 1; i < mCacheOrder.size(); ++i) {
           const int tmp = mCacheOrder[i];
-          const int swapi = math::dRandInt(i + 1);
+          const int swapi = randomInt(mRandomState, i + 1);
           mCacheOrder[i] = mCacheOrder[swapi];
           mCacheOrder[swapi] = tmp;
         }
@@ -253,6 +276,8 @@ bool PgsBoxedLcpSolver::canSolve(int n, const double* A)
 void PgsBoxedLcpSolver::setOption(const PgsBoxedLcpSolver::Option& option)
 {
   mOption = option;
+  mRandomState = mOption.mRandomSeed;
+  markOptionsChanged();
 }
 
 //==============================================================================
@@ -261,5 +286,13 @@ const PgsBoxedLcpSolver::Option& PgsBoxedLcpSolver::getOption() const
   return mOption;
 }
 
+//==============================================================================
+void PgsBoxedLcpSolver::setRandomSeed(unsigned long seed)
+{
+  mOption.mRandomSeed = seed;
+  mRandomState = seed;
+  markOptionsChanged();
+}
+
 } // namespace constraint
 } // namespace dart
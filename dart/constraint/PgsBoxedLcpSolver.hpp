@@ -54,12 +54,21 @@ public:
     double mEpsilonForDivision;
     bool mRandomizeConstraintOrder;
 
+    /// Seed of the random number generator that shuffles the constraint order
+    /// when mRandomizeConstraintOrder is set. Each solver owns its generator,
+    /// which is seeded by setOption() and setRandomSeed() and then advances
+    /// across solve() calls. Clones start from the seed, so the worker clones
+    /// of a multithreaded ConstraintSolver shuffle differently than a single
+    /// solver would.
+    unsigned long mRandomSeed;
+
     Option(
         int maxIteration = 30,
         double deltaXTolerance = 1e-6,
         double relativeDeltaXTolerance = 1e-3,
         double epsilonForDivision = 1e-9,
-        bool randomizeConstraintOrder = false);
+        bool randomizeConstraintOrder = false,
+        unsigned long randomSeed = 0);
   };
 
   // Documentation inherited.
@@ -68,6 +77,9 @@ public:
   /// Returns type for this class
   static const std::string& getStaticType();
 
+  // Documentation inherited.
+  std::shared_ptr<BoxedLcpSolver> clone() const override;
+
   // Documentation inherited.
   bool solve(
       int n,
@@ -91,6 +103,9 @@ public:
   /// Returns options.
   const Option& getOption() const;
 
+  /// Sets Option::mRandomSeed and reseeds the random number generator
+  void setRandomSeed(unsigned long seed);
+
 protected:
   Option mOption;
 
@@ -100,6 +115,9 @@ protected:
   mutable Eigen::MatrixXd mCachedNormalizedB;
   mutable Eigen::VectorXd mCacheZ;
   mutable Eigen::VectorXd mCacheOldX;
+
+  /// State of the random number generator of this solver
+  unsigned long mRandomState = 0;
 };
 
 } // namespace constraint
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef DART_CONSTRAINT_DETAIL_CONSTRAINTALLOCATOR_HPP_
+#define DART_CONSTRAINT_DETAIL_CONSTRAINTALLOCATOR_HPP_
+
+#include <dart/common/MemoryAllocator.hpp>
+#include <dart/common/StlAllocator.hpp>
+
+#include <dart/Export.hpp>
+
+#include <memory>
+#include <utility>
+
+namespace dart::constraint::detail {
+
+/// Returns the allocator that the constraints created by the calling thread
+/// are allocated from, or nullptr if they are allocated from the heap.
+DART_API common::MemoryAllocator* getConstraintAllocator();
+
+/// Sets the constraint allocator of the calling thread for the lifetime of
+/// this object. ConstraintSolver uses this to allocate the constraints that
+/// it recreates every time step from its own pool, including the ones created
+/// by ContactSurfaceHandler.
+class DART_API ScopedConstraintAllocator final
+{
+public:
+  /// Constructor
+  explicit ScopedConstraintAllocator(common::MemoryAllocator& allocator);
+
+  /// Destructor. Restores the previous allocator.
+  ~ScopedConstraintAllocator();
+
+  ScopedConstraintAllocator(const ScopedConstraintAllocator&) = delete;
+  ScopedConstraintAllocator& operator=(const ScopedConstraintAllocator&)
+      = delete;
+
+private:
+  common::MemoryAllocator* mPrevious;
+};
+
+/// Creates a constraint with the constraint allocator of the calling thread.
+/// The allocator must outlive the returned constraint.
+template <typename T, typename... Args>
+std::shared_ptr<T> makeConstraint(Args&&... args)
+{
+  if (common::MemoryAllocator* allocator = getConstraintAllocator()) {
+    return std::allocate_shared<T>(
+        common::StlAllocator<T>(*allocator), std::forward<Args>(args)...);
+  }
+
+  return std::make_shared<T>(std::forward<Args>(args)...);
+}
+
+} // namespace dart::constraint::detail
+
+#endif // DART_CONSTRAINT_DETAIL_CONSTRAINTALLOCATOR_HPP_
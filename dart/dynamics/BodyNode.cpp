@@ -1976,7 +1976,8 @@ Eigen::Vector3d BodyNode::getAngularMomentum(const Eigen::Vector3d& _pivot)
 bool BodyNode::isReactive() const
 {
   const ConstSkeletonPtr& skel = getSkeleton();
-  if (skel && skel->isMobile() && getNumDependentGenCoords() > 0) {
+  if (skel && skel->isMobile() && !skel->isSleeping()
+      && getNumDependentGenCoords() > 0) {
     // Check if all the ancestor joints are motion prescribed.
     const BodyNode* body = this;
     while (body != nullptr) {
@@ -782,8 +782,9 @@ public:
 
   /// Return true if the body can react to force or constraint impulse.
   ///
-  /// A body node is reactive if the skeleton is mobile and the number of
-  /// dependent generalized coordinates is non zero.
+  /// A body node is reactive if the skeleton is mobile and awake (see
+  /// Skeleton::isSleeping()) and the number of dependent generalized
+  /// coordinates is non zero.
   bool isReactive() const;
 
   /// Set constraint impulse
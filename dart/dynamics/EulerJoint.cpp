@@ -274,6 +274,112 @@ Eigen::Matrix<double, 6, 3> EulerJoint::getRelativeJacobianStatic(
   return J;
 }
 
+//==============================================================================
+math::Jacobian EulerJoint::getRelativeJacobianDerivative(
+    std::size_t index) const
+{
+  DART_ASSERT(index < 3);
+
+  const Eigen::Vector3d& positions = getPositionsStatic();
+  const double c1 = std::cos(positions[1]);
+  const double c2 = std::cos(positions[2]);
+  const double s1 = std::sin(positions[1]);
+  const double s2 = std::sin(positions[2]);
+
+  // Derivatives of the columns of S before the transform to the child body
+  // frame. Only the first two columns depend on the last two coordinates.
+  Eigen::Vector6d dJ0 = Eigen::Vector6d::Zero();
+  Eigen::Vector6d dJ1 = Eigen::Vector6d::Zero();
+
+  switch (getAxisOrder()) {
+    case AxisOrder::XYZ: {
+      if (index == 1) {
+        dJ0.head<3>() << -s1 * c2, s1 * s2, c1;
+      } else if (index == 2) {
+        dJ0.head<3>() << -c1 * s2, -c1 * c2, 0.0;
+        dJ1.head<3>() << c2, -s2, 0.0;
+      }
+      break;
+    }
+    case AxisOrder::ZYX: {
+      if (index == 1) {
+        dJ0.head<3>() << -c1, -s2 * s1, -s1 * c2;
+      } else if (index == 2) {
+        dJ0.head<3>() << 0.0, c2 * c1, -c1 * s2;
+        dJ1.head<3>() << 0.0, -s2, -c2;
+      }
+      break;
+    }
+    default: {
+      DART_ERROR("Undefined Euler axis order");
+      break;
+    }
+  }
+
+  math::Jacobian dJ = math::Jacobian::Zero(6, 3);
+  dJ.col(0) = math::AdT(Joint::mAspectProperties.mT_ChildBodyToJoint, dJ0);
+  dJ.col(1) = math::AdT(Joint::mAspectProperties.mT_ChildBodyToJoint, dJ1);
+
+  return dJ;
+}
+
+//==============================================================================
+math::Jacobian EulerJoint::getRelativeJacobianTimeDerivDerivative(
+    std::size_t index) const
+{
+  DART_ASSERT(index < 3);
+
+  const Eigen::Vector3d& positions = getPositionsStatic();
+  const double c1 = std::cos(positions[1]);
+  const double c2 = std::cos(positions[2]);
+  const double s1 = std::sin(positions[1]);
+  const double s2 = std::sin(positions[2]);
+
+  const Eigen::Vector3d& velocities = getVelocitiesStatic();
+  const double dq1 = velocities[1];
+  const double dq2 = velocities[2];
+
+  // Sums of the second derivatives of the columns of S with respect to the
+  // coordinate at index and each coordinate, weighted by its velocity
+  Eigen::Vector6d dJ0 = Eigen::Vector6d::Zero();
+  Eigen::Vector6d dJ1 = Eigen::Vector6d::Zero();
+
+  switch (getAxisOrder()) {
+    case AxisOrder::XYZ: {
+      if (index == 1) {
+        dJ0.head<3>() << -dq1 * c1 * c2 + dq2 * s1 * s2,
+            dq1 * c1 * s2 + dq2 * s1 * c2, -dq1 * s1;
+      } else if (index == 2) {
+        dJ0.head<3>() << dq1 * s1 * s2 - dq2 * c1 * c2,
+            dq1 * s1 * c2 + dq2 * c1 * s2, 0.0;
+        dJ1.head<3>() << -dq2 * s2, -dq2 * c2, 0.0;
+      }
+      break;
+    }
+    case AxisOrder::ZYX: {
+      if (index == 1) {
+        dJ0.head<3>() << dq1 * s1, -dq1 * s2 * c1 - dq2 * c2 * s1,
+            -dq1 * c1 * c2 + dq2 * s1 * s2;
+      } else if (index == 2) {
+        dJ0.head<3>() << 0.0, -dq1 * c2 * s1 - dq2 * s2 * c1,
+            dq1 * s1 * s2 - dq2 * c1 * c2;
+        dJ1.head<3>() << 0.0, -dq2 * c2, dq2 * s2;
+      }
+      break;
+    }
+    default: {
+      DART_ERROR("Undefined Euler axis order");
+      break;
+    }
+  }
+
+  math::Jacobian dJ = math::Jacobian::Zero(6, 3);
+  dJ.col(0) = math::AdT(Joint::mAspectProperties.mT_ChildBodyToJoint, dJ0);
+  dJ.col(1) = math::AdT(Joint::mAspectProperties.mT_ChildBodyToJoint, dJ1);
+
+  return dJ;
+}
+
 //==============================================================================
 EulerJoint::EulerJoint(const Properties& properties)
   : detail::EulerJointBase(properties)
@@ -35,9 +35,20 @@
 #include "dart/common/Macros.hpp"
 #include "dart/dynamics/BodyNode.hpp"
 #include "dart/dynamics/DegreeOfFreedom.hpp"
+#include "dart/dynamics/EndEffector.hpp"
 #include "dart/dynamics/SimpleFrame.hpp"
+#include "dart/dynamics/Skeleton.hpp"
+#include "dart/math/Constants.hpp"
+#include "dart/math/Random.hpp"
 #include "dart/math/optimization/GradientDescentSolver.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <limits>
+
+#include <cmath>
+#include <cstdint>
+
 namespace dart {
 namespace dynamics {
 
@@ -125,6 +136,320 @@ bool InverseKinematics::solveAndApply(
   return wasSolved;
 }
 
+//==============================================================================
+namespace {
+
+struct SeedResult
+{
+  Eigen::VectorXd mPositions;
+  bool mSolved = false;
+  bool mSkipped = true;
+  double mObjective = std::numeric_limits<double>::infinity();
+  double mViolation = std::numeric_limits<double>::infinity();
+};
+
+//==============================================================================
+void solveFromSeed(
+    InverseKinematics& ik,
+    std::size_t index,
+    const Eigen::VectorXd& seed,
+    SeedResult& result)
+{
+  // Reseed randomized solvers so that the result of a seed does not depend on
+  // the seeds solved before it by the same worker
+  auto* descent = dynamic_cast<math::GradientDescentSolver*>(
+      ik.getSolver().get());
+  if (descent)
+    descent->setRandomSeed(static_cast<std::uint_fast32_t>(index));
+
+  ik.setPositions(seed);
+  result.mSolved = ik.findSolution(result.mPositions);
+  result.mSkipped = false;
+
+  const auto& objective = ik.getProblem()->getObjective();
+  result.mObjective = objective ? objective->eval(result.mPositions) : 0.0;
+  result.mViolation
+      = ik.getErrorMethod().evalError(result.mPositions).norm();
+}
+
+//==============================================================================
+/// Returns the node of \c clone that corresponds to \c node, or nullptr if
+/// the type of the node is not supported.
+JacobianNode* findClonedNode(JacobianNode* node, Skeleton* clone)
+{
+  if (auto* bodyNode = dynamic_cast<BodyNode*>(node))
+    return clone->getBodyNode(bodyNode->getIndexInSkeleton());
+
+  if (auto* endEffector = dynamic_cast<EndEffector*>(node))
+    return clone->getEndEffector(endEffector->getIndexInSkeleton());
+
+  return nullptr;
+}
+
+} // namespace
+
+//==============================================================================
+bool InverseKinematics::findSolution(
+    const MultiSeedOptions& options, Eigen::VectorXd& positions)
+{
+  if (nullptr == mSolver || nullptr == mProblem)
+    return findSolution(positions);
+
+  const SkeletonPtr& skel = getNode()->getSkeleton();
+  const std::size_t numDofs = mDofs.size();
+  const Eigen::VectorXd originalPositions = getPositions();
+
+  std::vector<Eigen::VectorXd> seeds;
+  seeds.reserve(1u + options.mSeeds.size() + options.mNumRandomSeeds);
+  seeds.push_back(originalPositions);
+
+  for (const Eigen::VectorXd& seed : options.mSeeds) {
+    if (static_cast<std::size_t>(seed.size()) != numDofs) {
+      DART_WARN(
+          "Ignoring an IK seed of size [{}] for [{}], which has [{}] DOFs.",
+          seed.size(),
+          mNode->getName(),
+          numDofs);
+      continue;
+    }
+    seeds.push_back(seed);
+  }
+
+  // Sample the random seeds up front because math::Random is not thread-safe
+  // and so that the seeds do not depend on the number of threads
+  for (std::size_t n = 0; n < options.mNumRandomSeeds; ++n) {
+    Eigen::VectorXd seed(numDofs);
+    for (std::size_t i = 0; i < numDofs; ++i) {
+      const DegreeOfFreedom* dof = skel->getDof(mDofs[i]);
+      double lower = dof->getPositionLowerLimit();
+      double upper = dof->getPositionUpperLimit();
+      if (!std::isfinite(lower))
+        lower = originalPositions[i] - math::pi;
+      if (!std::isfinite(upper))
+        upper = originalPositions[i] + math::pi;
+      seed[i] = math::Random::uniform<double>(lower, upper);
+    }
+    seeds.push_back(std::move(seed));
+  }
+
+  std::vector<SeedResult> results(seeds.size());
+
+  // Index of the first seed that converged. Seeds after it are not started
+  // when stopping at the first solution.
+  std::atomic<std::size_t> firstSolved{seeds.size()};
+  const auto shouldSkip = [&](std::size_t index) {
+    return options.mStopAtFirstSolution
+           && index > firstSolved.load(std::memory_order_acquire);
+  };
+  const auto recordSolved = [&](std::size_t index) {
+    std::size_t current = firstSolved.load(std::memory_order_relaxed);
+    while (index < current
+           && !firstSolved.compare_exchange_weak(
+               current, index, std::memory_order_acq_rel)) {
+      // Retry with the updated value
+    }
+  };
+
+  const std::size_t numWorkers = std::min(getNumThreads(), seeds.size());
+  JacobianNode* node = getNode();
+  bool parallel = numWorkers > 1u;
+  if (parallel && findClonedNode(node, skel.get()) == nullptr) {
+    DART_WARN(
+        "Multi-seed IK for [{}] is solved serially because only BodyNodes and "
+        "EndEffectors can be mapped onto Skeleton clones.",
+        node->getName());
+    parallel = false;
+  }
+
+  if (!parallel) {
+    // Solve with a copy of a randomized solver because every seed reseeds it,
+    // which would otherwise reset the random number generator of mSolver
+    const std::shared_ptr<math::Solver> solver = mSolver;
+    if (dynamic_cast<math::GradientDescentSolver*>(solver.get()))
+      setSolver(solver->clone());
+
+    for (std::size_t i = 0; i < seeds.size(); ++i) {
+      if (shouldSkip(i))
+        break;
+
+      solveFromSeed(*this, i, seeds[i], results[i]);
+      if (results[i].mSolved)
+        recordSolved(i);
+    }
+
+    setSolver(solver);
+    setPositions(originalPositions);
+  } else {
+    // Make sure that the lazily evaluated transform of the target is up to
+    // date before it is read concurrently
+    mTarget->getTransform();
+
+    // Clone on the calling thread because cloning connects to the signals of
+    // the shared target frame
+    prepareWorkerClones(numWorkers);
+
+    mThreadPool->parallelFor(
+        seeds.size(), [&](std::size_t index, std::size_t workerIndex) {
+          if (shouldSkip(index))
+            return;
+
+          solveFromSeed(
+              *mWorkerIKs[workerIndex], index, seeds[index], results[index]);
+          if (results[index].mSolved)
+            recordSolved(index);
+        });
+  }
+
+  // Pick the first converged seed, the converged seed with the lowest
+  // objective, or the seed with the smallest constraint violation
+  std::size_t best = 0u;
+  for (std::size_t i = 1; i < results.size(); ++i) {
+    const SeedResult& candidate = results[i];
+    const SeedResult& incumbent = results[best];
+    if (candidate.mSkipped)
+      continue;
+
+    if (incumbent.mSolved) {
+      if (candidate.mSolved && !options.mStopAtFirstSolution
+          && candidate.mObjective < incumbent.mObjective)
+        best = i;
+    } else if (candidate.mSolved) {
+      best = i;
+    } else if (candidate.mViolation < incumbent.mViolation) {
+      best = i;
+    }
+  }
+
+  positions = std::move(results[best].mPositions);
+  return results[best].mSolved;
+}
+
+//==============================================================================
+void InverseKinematics::setNumThreads(std::size_t numThreads)
+{
+  if (numThreads == 0u)
+    numThreads = common::ThreadPool::getDefaultNumThreads();
+
+  if (numThreads == getNumThreads())
+    return;
+
+  if (numThreads == 1u)
+    mThreadPool.reset();
+  else
+    mThreadPool = std::make_unique<common::ThreadPool>(numThreads);
+}
+
+//==============================================================================
+std::size_t InverseKinematics::getNumThreads() const
+{
+  return mThreadPool ? mThreadPool->getNumThreads() : 1u;
+}
+
+//==============================================================================
+InverseKinematics::WorkerCloneSource InverseKinematics::getWorkerCloneSource()
+    const
+{
+  WorkerCloneSource source;
+  source.mComponents
+      = {mNode.get(),
+         mTarget.get(),
+         mObjective.get(),
+         mNullSpaceObjective.get(),
+         mErrorMethod.get(),
+         mGradientMethod.get(),
+         mSolver.get(),
+         mProblem->getObjective().get()};
+  for (std::size_t i = 0; i < mProblem->getNumEqConstraints(); ++i)
+    source.mComponents.push_back(mProblem->getEqConstraint(i).get());
+  source.mComponents.push_back(nullptr);
+  for (std::size_t i = 0; i < mProblem->getNumIneqConstraints(); ++i)
+    source.mComponents.push_back(mProblem->getIneqConstraint(i).get());
+
+  source.mDofs = mDofs;
+  source.mOffset = mOffset;
+  source.mHierarchyLevel = mHierarchyLevel;
+
+  return source;
+}
+
+//==============================================================================
+void InverseKinematics::prepareWorkerClones(std::size_t numWorkers)
+{
+  const SkeletonPtr& skel = getNode()->getSkeleton();
+
+  // Clone the Skeleton again only if its structure or properties changed
+  if (mWorkerSkeletonSource.lock() != skel
+      || mWorkerSkeletonVersion != skel->getVersion()) {
+    mWorkerIKs.clear();
+    mWorkerSkeletons.clear();
+    mWorkerSkeletonSource = skel;
+    mWorkerSkeletonVersion = skel->getVersion();
+  }
+
+  // Clone this module again only if one of its components was replaced
+  WorkerCloneSource source = getWorkerCloneSource();
+  if (source.mComponents != mWorkerIKSource.mComponents
+      || source.mDofs != mWorkerIKSource.mDofs
+      || source.mOffset != mWorkerIKSource.mOffset
+      || source.mHierarchyLevel != mWorkerIKSource.mHierarchyLevel) {
+    mWorkerIKs.clear();
+    mWorkerIKSource = std::move(source);
+  }
+
+  // Clones are only added, so fewer seeds on a later call reuse them
+  while (mWorkerSkeletons.size() < numWorkers)
+    mWorkerSkeletons.push_back(skel->cloneSkeleton());
+  while (mWorkerIKs.size() < numWorkers) {
+    Skeleton* clone = mWorkerSkeletons[mWorkerIKs.size()].get();
+    mWorkerIKs.push_back(this->clone(findClonedNode(getNode(), clone)));
+  }
+
+  // Copy the state and the settings that are commonly changed in place
+  const Eigen::VectorXd positions = skel->getPositions();
+  const ErrorMethod::Properties errorProperties
+      = mErrorMethod->getErrorMethodProperties();
+  const GradientMethod::Properties gradientProperties
+      = mGradientMethod->getGradientMethodProperties();
+  const auto* descent
+      = dynamic_cast<const math::GradientDescentSolver*>(mSolver.get());
+
+  for (std::size_t i = 0; i < numWorkers; ++i) {
+    // Joint transforms can change without changing the Skeleton version
+    Skeleton& clone = *mWorkerSkeletons[i];
+    for (std::size_t j = 0; j < skel->getNumJoints(); ++j) {
+      const Joint* joint = skel->getJoint(j);
+      Joint* cloneJoint = clone.getJoint(j);
+      cloneJoint->setTransformFromParentBodyNode(
+          joint->getTransformFromParentBodyNode());
+      cloneJoint->setTransformFromChildBodyNode(
+          joint->getTransformFromChildBodyNode());
+    }
+    clone.setPositions(positions);
+
+    InverseKinematics& ik = *mWorkerIKs[i];
+    ErrorMethod& errorMethod = ik.getErrorMethod();
+    errorMethod.setBounds(errorProperties.mBounds);
+    errorMethod.setErrorLengthClamp(errorProperties.mErrorLengthClamp);
+    errorMethod.setErrorWeights(errorProperties.mErrorWeights);
+
+    GradientMethod& gradientMethod = ik.getGradientMethod();
+    gradientMethod.setComponentWiseClamp(
+        gradientProperties.mComponentWiseClamp);
+    gradientMethod.setComponentWeights(gradientProperties.mComponentWeights);
+
+    const std::shared_ptr<math::Solver>& solver = ik.getSolver();
+    solver->setTolerance(mSolver->getTolerance());
+    solver->setNumMaxIterations(mSolver->getNumMaxIterations());
+    if (descent) {
+      static_cast<math::GradientDescentSolver&>(*solver).setProperties(
+          static_cast<const math::GradientDescentSolver::UniqueProperties&>(
+              descent->getGradientDescentProperties()));
+    }
+
+    ik.getProblem()->getSeeds() = mProblem->getSeeds();
+  }
+}
+
 //==============================================================================
 static std::shared_ptr<math::Function> cloneIkFunc(
     const std::shared_ptr<math::Function>& _function, InverseKinematics* _ik)
@@ -707,7 +1032,9 @@ void InverseKinematics::GradientMethod::convertJacobianMethodOutputToGradient(
     Eigen::VectorXd& grad, const std::vector<std::size_t>& dofs)
 {
   const SkeletonPtr& skel = mIK->getNode()->getSkeleton();
-  mInitialPositionsCache = skel->getPositions(dofs);
+  mInitialPositionsCache.resize(dofs.size());
+  for (std::size_t i = 0; i < dofs.size(); ++i)
+    mInitialPositionsCache[i] = skel->getDof(dofs[i])->getPosition();
 
   for (std::size_t i = 0; i < dofs.size(); ++i)
     skel->getDof(dofs[i])->setVelocity(grad[i]);
@@ -723,8 +1050,8 @@ void InverseKinematics::GradientMethod::convertJacobianMethodOutputToGradient(
       joint->setVelocity(j, 0.0);
   }
 
-  grad = skel->getPositions(dofs);
-  grad -= mInitialPositionsCache;
+  for (std::size_t i = 0; i < dofs.size(); ++i)
+    grad[i] = skel->getDof(dofs[i])->getPosition() - mInitialPositionsCache[i];
 }
 
 //==============================================================================
@@ -756,8 +1083,8 @@ const InverseKinematics* InverseKinematics::GradientMethod::getIK() const
 
 //==============================================================================
 InverseKinematics::JacobianDLS::UniqueProperties::UniqueProperties(
-    double damping)
-  : mDamping(damping)
+    double damping, Decomposition decomposition)
+  : mDamping(damping), mDecomposition(decomposition)
 {
   // Do nothing
 }
@@ -793,19 +1120,49 @@ void InverseKinematics::JacobianDLS::computeGradient(
 {
   const math::Jacobian& J = mIK->computeJacobian();
 
-  const double& damping = mDLSProperties.mDamping;
-  int rows = J.rows(), cols = J.cols();
-  if (rows <= cols) {
-    _grad = J.transpose()
-            * (pow(damping, 2) * Eigen::MatrixXd::Identity(rows, rows)
-               + J * J.transpose())
-                  .inverse()
-            * _error;
+  const int rows = J.rows(), cols = J.cols();
+  _grad.resize(cols);
+  if (cols == 0)
+    return;
+
+  // The workspace members keep their storage between calls, so none of the
+  // branches below allocates once the number of DOFs stays the same
+  const double damping2 = mDLSProperties.mDamping * mDLSProperties.mDamping;
+  if (mDLSProperties.mDecomposition == Decomposition::Svd) {
+    // The damped pseudoinverse is V * diag(s / (s^2 + damping^2)) * U^T, so
+    // the decomposition does not depend on the damping and can be reused
+    // until the Jacobian changes
+    if (!mSvd.computeV() || mSvdJacobian.cols() != cols || mSvdJacobian != J) {
+      mSvd.compute(J, Eigen::ComputeThinU | Eigen::ComputeThinV);
+      mSvdJacobian = J;
+    }
+
+    const auto& singularValues = mSvd.singularValues();
+    mSystemVector.noalias() = mSvd.matrixU().transpose() * _error;
+    for (int i = 0; i < singularValues.size(); ++i) {
+      const double s = singularValues[i];
+      const double denominator = s * s + damping2;
+      mSystemVector[i] = denominator > 0.0
+                             ? mSystemVector[i] * s / denominator
+                             : 0.0;
+    }
+    _grad.noalias() = mSvd.matrixV() * mSystemVector;
+  } else if (rows <= cols) {
+    // J^T * (damping^2 * I + J * J^T)^-1 * error
+    mSystem.noalias() = J.lazyProduct(J.transpose());
+    mSystem.diagonal().array() += damping2;
+    mLdlt.compute(mSystem);
+    mSystemVector = _error;
+    mLdlt.solveInPlace(mSystemVector);
+    _grad.noalias() = J.transpose() * mSystemVector;
   } else {
-    _grad = (pow(damping, 2) * Eigen::MatrixXd::Identity(cols, cols)
-             + J.transpose() * J)
-                .inverse()
-            * J.transpose() * _error;
+    // (damping^2 * I + J^T * J)^-1 * J^T * error
+    mSystem.noalias() = J.transpose().lazyProduct(J);
+    mSystem.diagonal().array() += damping2;
+    mLdlt.compute(mSystem);
+    mSystemVector.noalias() = J.transpose() * _error;
+    mLdlt.solveInPlace(mSystemVector);
+    _grad = mSystemVector;
   }
 
   convertJacobianMethodOutputToGradient(_grad, mIK->getDofs());
@@ -825,6 +1182,20 @@ double InverseKinematics::JacobianDLS::getDampingCoefficient() const
   return mDLSProperties.mDamping;
 }
 
+//==============================================================================
+void InverseKinematics::JacobianDLS::setDecomposition(
+    Decomposition decomposition)
+{
+  mDLSProperties.mDecomposition = decomposition;
+}
+
+//==============================================================================
+InverseKinematics::JacobianDLS::Decomposition
+InverseKinematics::JacobianDLS::getDecomposition() const
+{
+  return mDLSProperties.mDecomposition;
+}
+
 //==============================================================================
 InverseKinematics::JacobianDLS::Properties
 InverseKinematics::JacobianDLS::getJacobianDLSProperties() const
@@ -1564,19 +1935,21 @@ const JacobianNode* InverseKinematics::getAffiliation() const
 //==============================================================================
 const math::Jacobian& InverseKinematics::computeJacobian() const
 {
-  // TODO(MXG): Test whether we can safely use a const reference here instead of
-  // just a regular const
-  const math::Jacobian fullJacobian = hasOffset()
-                                          ? getNode()->getWorldJacobian(mOffset)
-                                          : getNode()->getWorldJacobian();
+  const auto gather = [this](const math::Jacobian& fullJacobian) {
+    mJacobian.setZero(6, getDofs().size());
 
-  mJacobian.setZero(6, getDofs().size());
+    for (int i = 0; i < static_cast<int>(getDofMap().size()); ++i) {
+      int j = getDofMap()[i];
+      if (j >= 0)
+        mJacobian.block<6, 1>(0, j) = fullJacobian.block<6, 1>(0, i);
+    }
+  };
 
-  for (int i = 0; i < static_cast<int>(getDofMap().size()); ++i) {
-    int j = getDofMap()[i];
-    if (j >= 0)
-      mJacobian.block<6, 1>(0, j) = fullJacobian.block<6, 1>(0, i);
-  }
+  // Read the cached Jacobian of the node in place instead of copying it
+  if (hasOffset())
+    gather(getNode()->getWorldJacobian(mOffset));
+  else
+    gather(getNode()->getWorldJacobian());
 
   return mJacobian;
 }
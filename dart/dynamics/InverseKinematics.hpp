@@ -43,15 +43,18 @@
 
 #include <dart/common/Signal.hpp>
 #include <dart/common/Subject.hpp>
+#include <dart/common/ThreadPool.hpp>
 #include <dart/common/sub_ptr.hpp>
 
 #include <dart/Export.hpp>
 
+#include <Eigen/Cholesky>
 #include <Eigen/SVD>
 
 #include <functional>
 #include <memory>
 #include <span>
+#include <vector>
 
 namespace dart {
 namespace dynamics {
@@ -210,6 +213,68 @@ public:
   bool solveAndApply(
       Eigen::VectorXd& positions, bool allowIncompleteResult = true);
 
+  /// Options of the multi-seed variant of findSolution()
+  struct MultiSeedOptions
+  {
+    /// Initial guesses that are tried after the current positions. Each seed
+    /// must have one entry per DOF of this module; seeds of another size are
+    /// ignored.
+    std::vector<Eigen::VectorXd> mSeeds;
+
+    /// Number of additional initial guesses that are sampled uniformly within
+    /// the position limits of the DOFs. Unbounded DOFs are sampled within
+    /// [-pi, pi] around their current position.
+    std::size_t mNumRandomSeeds = 0u;
+
+    /// If true, the solution of the first seed (in the order above) that
+    /// converges is returned and the seeds after it are not started.
+    /// Otherwise every seed is solved and the converged solution with the
+    /// lowest objective value is returned.
+    bool mStopAtFirstSolution = true;
+  };
+
+  /// Finds a solution of the IK problem from several initial guesses without
+  /// applying it. The first guess is always the current positions, followed by
+  /// the seeds described by \c options.
+  ///
+  /// When this module uses more than one thread (see setNumThreads()), the
+  /// guesses are solved concurrently on clones of the Skeleton, one per
+  /// thread, so the Skeleton of this module is never modified. The target
+  /// frame and any math::Function of the Problem that does not inherit
+  /// InverseKinematics::Function are shared by the clones and must be safe to
+  /// evaluate concurrently.
+  ///
+  /// The clones are kept for later calls. The Skeleton is cloned again when
+  /// its version changes, and this module when one of its components, such as
+  /// the Solver or the ErrorMethod, is replaced. Otherwise only the following
+  /// are copied to the clones on every call: the positions and joint
+  /// transforms of the Skeleton, the bounds, clamps, and weights of the
+  /// ErrorMethod and GradientMethod, the tolerance and iteration limit of the
+  /// Solver along with the properties of a math::GradientDescentSolver, and
+  /// the seeds of the Problem. Other changes made in place to the Solver or
+  /// the Problem are not seen by existing clones.
+  ///
+  /// A math::GradientDescentSolver is reseeded from the index of each guess
+  /// before solving it, so the result does not depend on the number of
+  /// threads even when the solver randomizes configurations.
+  ///
+  /// \param[in] options The initial guesses and the selection policy.
+  /// \param[out] positions The selected solution. If no guess converged, this
+  /// is the result with the smallest constraint violation.
+  /// \return True if at least one guess converged.
+  bool findSolution(
+      const MultiSeedOptions& options, Eigen::VectorXd& positions);
+
+  /// Sets the number of threads used by the multi-seed variant of
+  /// findSolution(). Pass 1 (default) to solve the seeds serially on the
+  /// calling thread, or 0 to use the number of hardware threads. The number of
+  /// threads is not copied by clone().
+  void setNumThreads(std::size_t numThreads);
+
+  /// Returns the number of threads used by the multi-seed variant of
+  /// findSolution().
+  std::size_t getNumThreads() const;
+
   /// Clone this IK module, but targeted at a new Node. Any Functions in the
   /// Problem that inherit InverseKinematics::Function will be adapted to the
   /// new IK module. Any generic math::Function will just be copied over
@@ -521,6 +586,42 @@ protected:
 
   /// Jacobian cache for the IK module
   mutable math::Jacobian mJacobian;
+
+  /// Thread pool used by the multi-seed variant of findSolution(). This is
+  /// nullptr when the seeds are solved serially.
+  std::unique_ptr<common::ThreadPool> mThreadPool;
+
+  /// Components of this module that mWorkerIKs were cloned from
+  struct WorkerCloneSource
+  {
+    std::vector<const void*> mComponents;
+    std::vector<std::size_t> mDofs;
+    Eigen::Vector3d mOffset = Eigen::Vector3d::Zero();
+    std::size_t mHierarchyLevel = 0u;
+  };
+
+  /// Returns the components of this module that are copied by clone()
+  WorkerCloneSource getWorkerCloneSource() const;
+
+  /// Makes the first numWorkers clones of mWorkerSkeletons and mWorkerIKs up
+  /// to date, cloning only what changed since the last call
+  void prepareWorkerClones(std::size_t numWorkers);
+
+  /// Skeleton clones used by the multi-seed variant of findSolution(), one
+  /// per worker of mThreadPool that has been used so far
+  std::vector<SkeletonPtr> mWorkerSkeletons;
+
+  /// Clones of this module on the nodes of mWorkerSkeletons
+  std::vector<InverseKinematicsPtr> mWorkerIKs;
+
+  /// Skeleton that mWorkerSkeletons were cloned from
+  std::weak_ptr<const Skeleton> mWorkerSkeletonSource;
+
+  /// Version of the Skeleton when mWorkerSkeletons were cloned
+  std::size_t mWorkerSkeletonVersion = 0u;
+
+  /// Components of this module when mWorkerIKs were cloned
+  WorkerCloneSource mWorkerIKSource;
 };
 
 typedef InverseKinematics IK;
@@ -952,13 +1053,31 @@ private:
 class DART_API InverseKinematics::JacobianDLS : public GradientMethod
 {
 public:
+  /// The decomposition used to apply the damped pseudoinverse
+  enum class Decomposition
+  {
+    /// Solve the damped normal equations with an LDLT factorization of the
+    /// (at most 6x6) system matrix. This is the fastest option.
+    Ldlt,
+
+    /// Apply the damping to the singular values of the Jacobian. This is more
+    /// robust near singularities, and the decomposition is reused as long as
+    /// the Jacobian does not change.
+    Svd
+  };
+
   struct UniqueProperties
   {
     /// Damping coefficient
     double mDamping;
 
+    /// Decomposition used to compute the gradient
+    Decomposition mDecomposition;
+
     /// Default constructor
-    UniqueProperties(double damping = DefaultIKDLSCoefficient);
+    UniqueProperties(
+        double damping = DefaultIKDLSCoefficient,
+        Decomposition decomposition = Decomposition::Ldlt);
   };
 
   struct DART_API Properties : GradientMethod::Properties, UniqueProperties
@@ -993,12 +1112,43 @@ public:
   /// Get the damping coefficient.
   double getDampingCoefficient() const;
 
+  /// Set the decomposition used to compute the gradient.
+  void setDecomposition(Decomposition decomposition);
+
+  /// Get the decomposition used to compute the gradient.
+  Decomposition getDecomposition() const;
+
   /// Get the Properties of this JacobianDLS
   Properties getJacobianDLSProperties() const;
 
 protected:
+  /// Matrix type of the damped system, whose size is the smaller dimension of
+  /// the Jacobian. The storage is fixed so that no heap allocation is needed.
+  using SystemMatrix
+      = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, 0, 6, 6>;
+
+  /// Vector type of the damped system
+  using SystemVector = Eigen::Matrix<double, Eigen::Dynamic, 1, 0, 6, 1>;
+
   /// Properties of this Damped Least Squares method
   UniqueProperties mDLSProperties;
+
+  /// Damped system matrix, reused across iterations
+  SystemMatrix mSystem;
+
+  /// Factorization of mSystem, reused across iterations
+  Eigen::LDLT<SystemMatrix> mLdlt;
+
+  /// Right-hand side and solution of the damped system
+  SystemVector mSystemVector;
+
+  /// Singular value decomposition of the Jacobian for Decomposition::Svd. A
+  /// dynamic-size matrix type is used because Eigen cannot compute the thin U
+  /// of a fixed-row Jacobian with fewer than six columns.
+  Eigen::JacobiSVD<Eigen::MatrixXd> mSvd;
+
+  /// The Jacobian that mSvd decomposes
+  math::Jacobian mSvdJacobian;
 };
 
 //==============================================================================
@@ -415,6 +415,23 @@ const Eigen::Vector6d& Joint::getRelativePrimaryAcceleration() const
   return mPrimaryAcceleration;
 }
 
+//==============================================================================
+math::Jacobian Joint::getRelativeJacobianDerivative(std::size_t index) const
+{
+  DART_ASSERT(index < getNumDofs());
+  DART_UNUSED(index);
+  return math::Jacobian::Zero(6, getNumDofs());
+}
+
+//==============================================================================
+math::Jacobian Joint::getRelativeJacobianTimeDerivDerivative(
+    std::size_t index) const
+{
+  DART_ASSERT(index < getNumDofs());
+  DART_UNUSED(index);
+  return math::Jacobian::Zero(6, getNumDofs());
+}
+
 //==============================================================================
 Eigen::Vector6d Joint::getWrenchToChildBodyNode(
     const Frame* withRespectTo) const
@@ -691,6 +691,22 @@ public:
   /// the parent BodyNode expressed in the child BodyNode frame
   virtual const math::Jacobian getRelativeJacobianTimeDeriv() const = 0;
 
+  /// Get the partial derivative of getRelativeJacobian() with respect to the
+  /// generalized coordinate of this Joint at \c index.
+  ///
+  /// For joints whose positions are not integrated additively, such as
+  /// BallJoint and FreeJoint, the derivative is taken along the perturbation
+  /// that integratePositions() applies. The default implementation returns
+  /// zero, which holds for joints whose relative Jacobian does not depend on
+  /// their positions. Other joints override it.
+  virtual math::Jacobian getRelativeJacobianDerivative(std::size_t index) const;
+
+  /// Get the partial derivative of getRelativeJacobianTimeDeriv() with respect
+  /// to the generalized coordinate of this Joint at \c index, in the sense of
+  /// getRelativeJacobianDerivative().
+  virtual math::Jacobian getRelativeJacobianTimeDerivDerivative(
+      std::size_t index) const;
+
   /// Get constraint wrench expressed in body node frame
   virtual Eigen::Vector6d getBodyConstraintWrench() const = 0;
   // TODO: Need more informative name.
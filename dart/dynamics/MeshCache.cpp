@@ -0,0 +1,771 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "dart/dynamics/MeshCache.hpp"
+
+#include "dart/common/LocalResourceRetriever.hpp"
+#include "dart/common/Logging.hpp"
+#include "dart/common/Resource.hpp"
+#include "dart/common/detail/MappedFile.hpp"
+#include "dart/dynamics/MeshShape.hpp"
+
+#include <assimp/cimport.h>
+
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include <cstdint>
+#include <cstring>
+
+namespace dart {
+namespace dynamics {
+
+namespace {
+
+// A mesh cache file stores the post-processed meshes of a scene as follows,
+// where every field is a 4-byte unsigned integer or float in the byte order
+// of the writing machine, and byte strings are padded to 4 bytes:
+//
+//   header:    magic "DARTMSH\0", version, key length, key, number of
+//              materials, number of meshes, transform of the root node
+//              (row-major 4x4), number of meshes of the root node, their
+//              indices
+//   materials: [number of properties, [key length, key, semantic, index,
+//              type, data length, data] per property] per material
+//   meshes:    [primitive types, material index, number of vertices, number
+//              of faces, number of indices, attribute flags, number of UV
+//              components per texture coordinate set, vertices, normals,
+//              tangents, bitangents, colors per color set, texture coordinates
+//              per set, number of indices per face, indices] per mesh
+//
+// The attribute flags tell which of the optional vertex attributes are
+// stored. The node hierarchy is not stored because MeshShape::loadMesh()
+// pre-transforms the vertices, which attaches all the meshes to the root node.
+
+constexpr char fileMagic[8] = {'D', 'A', 'R', 'T', 'M', 'S', 'H', '\0'};
+constexpr std::uint32_t fileVersion = 1u;
+
+constexpr std::uint32_t hasNormals = 1u << 0;
+constexpr std::uint32_t hasTangents = 1u << 1;
+constexpr std::uint32_t colorSetsShift = 8u;
+constexpr std::uint32_t textureCoordsShift = 16u;
+
+static_assert(AI_MAX_NUMBER_OF_COLOR_SETS <= 8, "Too many color sets");
+static_assert(AI_MAX_NUMBER_OF_TEXTURECOORDS <= 8, "Too many UV sets");
+
+//==============================================================================
+std::uint64_t hashBytes(const void* data, std::size_t size)
+{
+  std::uint64_t hash = 1469598103934665603ULL; // FNV-1a offset basis
+  const auto* bytes = static_cast<const unsigned char*>(data);
+  for (std::size_t i = 0u; i < size; ++i) {
+    hash ^= bytes[i];
+    hash *= 1099511628211ULL; // FNV-1a prime
+  }
+  return hash;
+}
+
+//==============================================================================
+std::string toHex(std::uint64_t value)
+{
+  constexpr char digits[] = "0123456789abcdef";
+  std::string hex(16u, '0');
+  for (int i = 15; i >= 0; --i) {
+    hex[i] = digits[value & 0xfu];
+    value >>= 4;
+  }
+  return hex;
+}
+
+//==============================================================================
+class FileWriter
+{
+public:
+  void writeUint(std::uint32_t value)
+  {
+    append(&value, sizeof(value));
+  }
+
+  void writeFloat(float value)
+  {
+    append(&value, sizeof(value));
+  }
+
+  void writeBytes(const void* data, std::size_t size)
+  {
+    writeUint(static_cast<std::uint32_t>(size));
+    append(data, size);
+    mBuffer.resize((mBuffer.size() + 3u) & ~std::size_t{3u}, 0u);
+  }
+
+  void writeVectors(const aiVector3D* vectors, unsigned int count)
+  {
+    for (auto i = 0u; i < count; ++i) {
+      writeFloat(static_cast<float>(vectors[i].x));
+      writeFloat(static_cast<float>(vectors[i].y));
+      writeFloat(static_cast<float>(vectors[i].z));
+    }
+  }
+
+  void writeColors(const aiColor4D* colors, unsigned int count)
+  {
+    for (auto i = 0u; i < count; ++i) {
+      writeFloat(static_cast<float>(colors[i].r));
+      writeFloat(static_cast<float>(colors[i].g));
+      writeFloat(static_cast<float>(colors[i].b));
+      writeFloat(static_cast<float>(colors[i].a));
+    }
+  }
+
+  const std::vector<char>& getBuffer() const
+  {
+    return mBuffer;
+  }
+
+private:
+  void append(const void* data, std::size_t size)
+  {
+    const auto* bytes = static_cast<const char*>(data);
+    mBuffer.insert(mBuffer.end(), bytes, bytes + size);
+  }
+
+  std::vector<char> mBuffer;
+};
+
+//==============================================================================
+/// Reads the fields of a mesh cache file with bounds checking
+class FileReader
+{
+public:
+  FileReader(const unsigned char* data, std::size_t size)
+    : mData(data), mSize(size), mOffset(0u)
+  {
+  }
+
+  bool readUint(std::uint32_t& value)
+  {
+    return read(&value, sizeof(value));
+  }
+
+  bool readFloat(float& value)
+  {
+    return read(&value, sizeof(value));
+  }
+
+  /// Returns a pointer to the next size bytes, or nullptr if the file is
+  /// too short
+  const unsigned char* readBytes(std::uint32_t& size)
+  {
+    if (!readUint(size) || mSize - mOffset < size)
+      return nullptr;
+
+    const unsigned char* bytes = mData + mOffset;
+    mOffset = std::min(mSize, mOffset + ((size + 3u) & ~std::size_t{3u}));
+    return bytes;
+  }
+
+  bool readVectors(aiVector3D* vectors, unsigned int count)
+  {
+    float xyz[3];
+    for (auto i = 0u; i < count; ++i) {
+      if (!read(xyz, sizeof(xyz)))
+        return false;
+      vectors[i] = aiVector3D(xyz[0], xyz[1], xyz[2]);
+    }
+    return true;
+  }
+
+  bool readColors(aiColor4D* colors, unsigned int count)
+  {
+    float rgba[4];
+    for (auto i = 0u; i < count; ++i) {
+      if (!read(rgba, sizeof(rgba)))
+        return false;
+      colors[i] = aiColor4D(rgba[0], rgba[1], rgba[2], rgba[3]);
+    }
+    return true;
+  }
+
+  bool readUints(unsigned int* values, std::uint32_t count)
+  {
+    return read(values, count * sizeof(std::uint32_t));
+  }
+
+  bool isAtEnd() const
+  {
+    return mOffset == mSize;
+  }
+
+private:
+  bool read(void* value, std::size_t size)
+  {
+    if (mSize - mOffset < size)
+      return false;
+
+    std::memcpy(value, mData + mOffset, size);
+    mOffset += size;
+    return true;
+  }
+
+  const unsigned char* mData;
+  std::size_t mSize;
+  std::size_t mOffset;
+};
+
+static_assert(sizeof(unsigned int) == sizeof(std::uint32_t));
+
+//==============================================================================
+/// Serializes a scene loaded by MeshShape::loadMesh(). Returns false if the
+/// scene has data that the file format doesn't support.
+bool writeScene(const aiScene& scene, const std::string& key, FileWriter& out)
+{
+  // Embedded textures and node hierarchies aren't supported
+  if (scene.mNumTextures > 0u || !scene.mRootNode)
+    return false;
+
+  for (auto i = 0u; i < scene.mRootNode->mNumChildren; ++i) {
+    if (scene.mRootNode->mChildren[i]->mNumMeshes > 0u
+        || scene.mRootNode->mChildren[i]->mNumChildren > 0u) {
+      return false;
+    }
+  }
+
+  out.writeBytes(fileMagic, sizeof(fileMagic));
+  out.writeUint(fileVersion);
+  out.writeBytes(key.data(), key.size());
+  out.writeUint(scene.mNumMaterials);
+  out.writeUint(scene.mNumMeshes);
+
+  const aiMatrix4x4& transform = scene.mRootNode->mTransformation;
+  for (auto row = 0u; row < 4u; ++row) {
+    for (auto col = 0u; col < 4u; ++col)
+      out.writeFloat(static_cast<float>(transform[row][col]));
+  }
+
+  out.writeUint(scene.mRootNode->mNumMeshes);
+  for (auto i = 0u; i < scene.mRootNode->mNumMeshes; ++i)
+    out.writeUint(scene.mRootNode->mMeshes[i]);
+
+  for (auto i = 0u; i < scene.mNumMaterials; ++i) {
+    const aiMaterial* material = scene.mMaterials[i];
+    out.writeUint(material->mNumProperties);
+    for (auto j = 0u; j < material->mNumProperties; ++j) {
+      const aiMaterialProperty* property = material->mProperties[j];
+      out.writeBytes(property->mKey.data, property->mKey.length);
+      out.writeUint(property->mSemantic);
+      out.writeUint(property->mIndex);
+      out.writeUint(static_cast<std::uint32_t>(property->mType));
+      out.writeBytes(property->mData, property->mDataLength);
+    }
+  }
+
+  for (auto i = 0u; i < scene.mNumMeshes; ++i) {
+    const aiMesh* mesh = scene.mMeshes[i];
+
+    std::uint32_t numIndices = 0u;
+    for (auto j = 0u; j < mesh->mNumFaces; ++j)
+      numIndices += mesh->mFaces[j].mNumIndices;
+
+    std::uint32_t flags = 0u;
+    if (mesh->mNormals)
+      flags |= hasNormals;
+    if (mesh->mTangents && mesh->mBitangents)
+      flags |= hasTangents;
+    for (auto j = 0u; j < AI_MAX_NUMBER_OF_COLOR_SETS; ++j) {
+      if (mesh->mColors[j])
+        flags |= 1u << (colorSetsShift + j);
+    }
+    for (auto j = 0u; j < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++j) {
+      if (mesh->mTextureCoords[j])
+        flags |= 1u << (textureCoordsShift + j);
+    }
+
+    out.writeUint(mesh->mPrimitiveTypes);
+    out.writeUint(mesh->mMaterialIndex);
+    out.writeUint(mesh->mNumVertices);
+    out.writeUint(mesh->mNumFaces);
+    out.writeUint(numIndices);
+    out.writeUint(flags);
+    for (auto j = 0u; j < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++j)
+      out.writeUint(mesh->mNumUVComponents[j]);
+
+    out.writeVectors(mesh->mVertices, mesh->mNumVertices);
+    if (flags & hasNormals)
+      out.writeVectors(mesh->mNormals, mesh->mNumVertices);
+    if (flags & hasTangents) {
+      out.writeVectors(mesh->mTangents, mesh->mNumVertices);
+      out.writeVectors(mesh->mBitangents, mesh->mNumVertices);
+    }
+    for (auto j = 0u; j < AI_MAX_NUMBER_OF_COLOR_SETS; ++j) {
+      if (flags & (1u << (colorSetsShift + j)))
+        out.writeColors(mesh->mColors[j], mesh->mNumVertices);
+    }
+    for (auto j = 0u; j < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++j) {
+      if (flags & (1u << (textureCoordsShift + j)))
+        out.writeVectors(mesh->mTextureCoords[j], mesh->mNumVertices);
+    }
+
+    for (auto j = 0u; j < mesh->mNumFaces; ++j)
+      out.writeUint(mesh->mFaces[j].mNumIndices);
+    for (auto j = 0u; j < mesh->mNumFaces; ++j) {
+      const aiFace& face = mesh->mFaces[j];
+      for (auto k = 0u; k < face.mNumIndices; ++k)
+        out.writeUint(face.mIndices[k]);
+    }
+  }
+
+  return true;
+}
+
+//==============================================================================
+/// Creates a scene with the given numbers of materials and meshes whose
+/// pointers are initialized to nullptr
+aiScene* createScene(unsigned int numMaterials, unsigned int numMeshes)
+{
+  aiScene* scene = new aiScene();
+  scene->mFlags = 0u;
+  scene->mRootNode = nullptr;
+  scene->mNumAnimations = 0u;
+  scene->mAnimations = nullptr;
+  scene->mNumCameras = 0u;
+  scene->mCameras = nullptr;
+  scene->mNumLights = 0u;
+  scene->mLights = nullptr;
+  scene->mNumTextures = 0u;
+  scene->mTextures = nullptr;
+
+  scene->mNumMaterials = numMaterials;
+  scene->mMaterials = new aiMaterial*[numMaterials]();
+  scene->mNumMeshes = numMeshes;
+  scene->mMeshes = new aiMesh*[numMeshes]();
+
+  return scene;
+}
+
+//==============================================================================
+bool readMaterial(FileReader& in, aiMaterial& material)
+{
+  std::uint32_t numProperties;
+  if (!in.readUint(numProperties) || numProperties > (1u << 16))
+    return false;
+
+  delete[] material.mProperties;
+  material.mProperties = new aiMaterialProperty*[numProperties]();
+  material.mNumAllocated = numProperties;
+  material.mNumProperties = 0u;
+
+  for (auto i = 0u; i < numProperties; ++i) {
+    std::uint32_t keyLength;
+    const unsigned char* key = in.readBytes(keyLength);
+    if (!key || keyLength >= sizeof(aiString::data))
+      return false;
+
+    auto* property = new aiMaterialProperty();
+    material.mProperties[material.mNumProperties++] = property;
+    property->mKey.Set(
+        std::string(reinterpret_cast<const char*>(key), keyLength));
+
+    std::uint32_t type;
+    if (!in.readUint(property->mSemantic) || !in.readUint(property->mIndex)
+        || !in.readUint(type)) {
+      return false;
+    }
+    property->mType = static_cast<aiPropertyTypeInfo>(type);
+
+    std::uint32_t dataLength;
+    const unsigned char* data = in.readBytes(dataLength);
+    if (!data)
+      return false;
+    property->mDataLength = dataLength;
+    property->mData = new char[dataLength];
+    std::memcpy(property->mData, data, dataLength);
+  }
+
+  return true;
+}
+
+//==============================================================================
+bool readMesh(FileReader& in, unsigned int numMaterials, aiMesh& mesh)
+{
+  std::uint32_t numIndices;
+  std::uint32_t flags;
+  if (!in.readUint(mesh.mPrimitiveTypes) || !in.readUint(mesh.mMaterialIndex)
+      || !in.readUint(mesh.mNumVertices) || !in.readUint(mesh.mNumFaces)
+      || !in.readUint(numIndices) || !in.readUint(flags)
+      || !in.readUints(mesh.mNumUVComponents, AI_MAX_NUMBER_OF_TEXTURECOORDS)) {
+    return false;
+  }
+
+  if (mesh.mMaterialIndex >= numMaterials && numMaterials > 0u)
+    return false;
+
+  // Guard against allocating huge arrays for a corrupted file
+  if (mesh.mNumVertices > (1u << 28) || mesh.mNumFaces > (1u << 28)
+      || numIndices > (1u << 30)) {
+    return false;
+  }
+
+  const unsigned int numVertices = mesh.mNumVertices;
+
+  mesh.mVertices = new aiVector3D[numVertices];
+  if (!in.readVectors(mesh.mVertices, numVertices))
+    return false;
+
+  if (flags & hasNormals) {
+    mesh.mNormals = new aiVector3D[numVertices];
+    if (!in.readVectors(mesh.mNormals, numVertices))
+      return false;
+  }
+
+  if (flags & hasTangents) {
+    mesh.mTangents = new aiVector3D[numVertices];
+    mesh.mBitangents = new aiVector3D[numVertices];
+    if (!in.readVectors(mesh.mTangents, numVertices)
+        || !in.readVectors(mesh.mBitangents, numVertices)) {
+      return false;
+    }
+  }
+
+  for (auto i = 0u; i < AI_MAX_NUMBER_OF_COLOR_SETS; ++i) {
+    if (flags & (1u << (colorSetsShift + i))) {
+      mesh.mColors[i] = new aiColor4D[numVertices];
+      if (!in.readColors(mesh.mColors[i], numVertices))
+        return false;
+    }
+  }
+
+  for (auto i = 0u; i < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++i) {
+    if (flags & (1u << (textureCoordsShift + i))) {
+      mesh.mTextureCoords[i] = new aiVector3D[numVertices];
+      if (!in.readVectors(mesh.mTextureCoords[i], numVertices))
+        return false;
+    }
+  }
+
+  std::vector<unsigned int> faceSizes(mesh.mNumFaces);
+  if (!in.readUints(faceSizes.data(), mesh.mNumFaces))
+    return false;
+
+  std::uint64_t totalIndices = 0u;
+  for (const auto faceSize : faceSizes)
+    totalIndices += faceSize;
+  if (totalIndices != numIndices)
+    return false;
+
+  mesh.mFaces = new aiFace[mesh.mNumFaces];
+  for (auto i = 0u; i < mesh.mNumFaces; ++i) {
+    aiFace& face = mesh.mFaces[i];
+    face.mNumIndices = faceSizes[i];
+    face.mIndices = new unsigned int[face.mNumIndices];
+    if (!in.readUints(face.mIndices, face.mNumIndices))
+      return false;
+
+    for (auto j = 0u; j < face.mNumIndices; ++j) {
+      if (face.mIndices[j] >= numVertices)
+        return false;
+    }
+  }
+
+  return true;
+}
+
+//==============================================================================
+/// Deserializes a scene from a mesh cache file. Returns nullptr if the file is
+/// not a valid mesh cache file for the key.
+aiScene* readScene(FileReader& in, const std::string& key)
+{
+  std::uint32_t size;
+  const unsigned char* magic = in.readBytes(size);
+  if (!magic || size != sizeof(fileMagic)
+      || std::memcmp(magic, fileMagic, sizeof(fileMagic)) != 0) {
+    return nullptr;
+  }
+
+  std::uint32_t version;
+  if (!in.readUint(version) || version != fileVersion)
+    return nullptr;
+
+  const unsigned char* fileKey = in.readBytes(size);
+  if (!fileKey || size != key.size()
+      || std::memcmp(fileKey, key.data(), size) != 0) {
+    return nullptr;
+  }
+
+  std::uint32_t numMaterials;
+  std::uint32_t numMeshes;
+  if (!in.readUint(numMaterials) || !in.readUint(numMeshes)
+      || numMaterials > (1u << 16) || numMeshes > (1u << 16)) {
+    return nullptr;
+  }
+
+  std::unique_ptr<aiScene> scene(createScene(numMaterials, numMeshes));
+
+  scene->mRootNode = new aiNode();
+  aiNode* root = scene->mRootNode;
+  float transform[16];
+  for (auto& value : transform) {
+    if (!in.readFloat(value))
+      return nullptr;
+  }
+  root->mTransformation = aiMatrix4x4(
+      transform[0],
+      transform[1],
+      transform[2],
+      transform[3],
+      transform[4],
+      transform[5],
+      transform[6],
+      transform[7],
+      transform[8],
+      transform[9],
+      transform[10],
+      transform[11],
+      transform[12],
+      transform[13],
+      transform[14],
+      transform[15]);
+
+  std::uint32_t numRootMeshes;
+  if (!in.readUint(numRootMeshes) || numRootMeshes > numMeshes)
+    return nullptr;
+  root->mMeshes = new unsigned int[numRootMeshes];
+  root->mNumMeshes = numRootMeshes;
+  if (!in.readUints(root->mMeshes, numRootMeshes))
+    return nullptr;
+  for (auto i = 0u; i < numRootMeshes; ++i) {
+    if (root->mMeshes[i] >= numMeshes)
+      return nullptr;
+  }
+
+  for (auto i = 0u; i < numMaterials; ++i) {
+    scene->mMaterials[i] = new aiMaterial();
+    if (!readMaterial(in, *scene->mMaterials[i]))
+      return nullptr;
+  }
+
+  for (auto i = 0u; i < numMeshes; ++i) {
+    scene->mMeshes[i] = new aiMesh();
+    if (!readMesh(in, numMaterials, *scene->mMeshes[i]))
+      return nullptr;
+  }
+
+  if (!in.isAtEnd())
+    return nullptr;
+
+  return scene.release();
+}
+
+//==============================================================================
+std::shared_ptr<const aiScene> readCacheFile(
+    const std::filesystem::path& path, const std::string& key)
+{
+  std::error_code error;
+  if (!std::filesystem::exists(path, error))
+    return nullptr;
+
+  const auto file = common::detail::MappedFile::open(path.string());
+  if (!file)
+    return nullptr;
+
+  FileReader in(file->getData(), file->getSize());
+  aiScene* scene = readScene(in, key);
+  if (!scene) {
+    DART_WARN("Ignoring invalid mesh cache file [{}].", path.string());
+    return nullptr;
+  }
+
+  return std::shared_ptr<const aiScene>(scene);
+}
+
+//==============================================================================
+void writeCacheFile(
+    const std::filesystem::path& path,
+    const std::string& key,
+    const aiScene& scene)
+{
+  FileWriter out;
+  if (!writeScene(scene, key, out))
+    return;
+
+  // Write to a temporary file first so that concurrent readers never see a
+  // partially written file
+  std::filesystem::path temporaryPath = path;
+  const auto threadHash
+      = std::hash<std::thread::id>()(std::this_thread::get_id());
+  temporaryPath += "." + toHex(threadHash) + ".tmp";
+
+  {
+    std::ofstream file(temporaryPath, std::ios::binary);
+    const auto& buffer = out.getBuffer();
+    file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    if (!file) {
+      DART_WARN("Failed writing mesh cache file [{}].", temporaryPath.string());
+      file.close();
+      std::error_code error;
+      std::filesystem::remove(temporaryPath, error);
+      return;
+    }
+  }
+
+  std::error_code error;
+  std::filesystem::rename(temporaryPath, path, error);
+  if (error) {
+    DART_WARN(
+        "Failed writing mesh cache file [{}]: {}",
+        path.string(),
+        error.message());
+    std::filesystem::remove(temporaryPath, error);
+  }
+}
+
+} // namespace
+
+//==============================================================================
+MeshCache& MeshCache::GetDefault()
+{
+  static MeshCache defaultMeshCache;
+  return defaultMeshCache;
+}
+
+//==============================================================================
+std::shared_ptr<const aiScene> MeshCache::load(
+    const common::Uri& uri, const common::ResourceRetrieverPtr& retriever)
+{
+  const common::ResourceRetrieverPtr resolvedRetriever
+      = retriever ? retriever
+                  : std::make_shared<common::LocalResourceRetriever>();
+
+  const std::string uriString = uri.toString();
+  const auto resource = resolvedRetriever->retrieve(uri);
+  if (!resource) {
+    DART_WARN("Failed retrieving mesh '{}'.", uriString);
+    return nullptr;
+  }
+
+  const std::string content = resource->readAll();
+  const std::string key
+      = uriString + '#' + toHex(hashBytes(content.data(), content.size()));
+
+  std::filesystem::path cachePath;
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    const auto it = mMeshes.find(key);
+    if (it != mMeshes.end()) {
+      if (auto mesh = it->second.lock())
+        return mesh;
+      mMeshes.erase(it);
+    }
+
+    if (!mCacheDirectory.empty()) {
+      cachePath = std::filesystem::path(mCacheDirectory)
+                  / (toHex(hashBytes(key.data(), key.size())) + ".dartmesh");
+    }
+  }
+
+  std::shared_ptr<const aiScene> mesh;
+  if (!cachePath.empty())
+    mesh = readCacheFile(cachePath, key);
+
+  if (!mesh) {
+    const aiScene* scene = MeshShape::loadMesh(uriString, resolvedRetriever);
+    if (!scene)
+      return nullptr;
+
+    mesh = std::shared_ptr<const aiScene>(
+        scene, [](const aiScene* released) { aiReleaseImport(released); });
+
+    if (!cachePath.empty())
+      writeCacheFile(cachePath, key, *mesh);
+  }
+
+  std::lock_guard<std::mutex> lock(mMutex);
+
+  // Another thread may have loaded the same mesh in the meantime
+  auto& cached = mMeshes[key];
+  if (auto existing = cached.lock())
+    return existing;
+
+  cached = mesh;
+  return mesh;
+}
+
+//==============================================================================
+void MeshCache::setCacheDirectory(const std::string& directory)
+{
+  if (!directory.empty()) {
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    if (error) {
+      DART_WARN(
+          "Failed creating mesh cache directory [{}]: {}",
+          directory,
+          error.message());
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(mMutex);
+  mCacheDirectory = directory;
+}
+
+//==============================================================================
+std::string MeshCache::getCacheDirectory() const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  return mCacheDirectory;
+}
+
+//==============================================================================
+std::size_t MeshCache::getNumMeshes() const
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+
+  std::size_t numMeshes = 0u;
+  for (const auto& entry : mMeshes) {
+    if (!entry.second.expired())
+      ++numMeshes;
+  }
+  return numMeshes;
+}
+
+//==============================================================================
+void MeshCache::clear()
+{
+  std::lock_guard<std::mutex> lock(mMutex);
+  mMeshes.clear();
+}
+
+} // namespace dynamics
+} // namespace dart
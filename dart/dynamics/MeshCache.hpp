@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef DART_DYNAMICS_MESHCACHE_HPP_
+#define DART_DYNAMICS_MESHCACHE_HPP_
+
+#include <dart/common/ResourceRetriever.hpp>
+#include <dart/common/Uri.hpp>
+
+#include <dart/Export.hpp>
+
+#include <assimp/scene.h>
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace dart {
+namespace dynamics {
+
+/// MeshCache shares the meshes loaded by MeshShape::loadMesh() between the
+/// shapes that reference the same mesh resource.
+///
+/// Meshes are keyed by their URI and a hash of the resource content, so a
+/// modified file is loaded again. The cache holds the meshes weakly: a mesh
+/// is released once no shape uses it anymore.
+///
+/// Optionally, the post-processed meshes are also stored in a cache directory
+/// in a compact binary format, which is memory-mapped and converted without
+/// running Assimp when the same resource is loaded again, for example, by
+/// another process.
+class DART_API MeshCache
+{
+public:
+  /// Returns the process-wide cache used by the model parsers
+  static MeshCache& GetDefault();
+
+  /// Constructor
+  MeshCache() = default;
+
+  /// Returns the mesh of the resource at \c uri, loading it on a miss.
+  /// Returns nullptr if the resource can't be retrieved or loaded.
+  ///
+  /// The returned mesh is shared and must not be modified.
+  std::shared_ptr<const aiScene> load(
+      const common::Uri& uri, const common::ResourceRetrieverPtr& retriever);
+
+  /// Sets the directory where the post-processed meshes are stored. The
+  /// directory is created if it doesn't exist. An empty string disables the
+  /// on-disk cache, which is the default.
+  void setCacheDirectory(const std::string& directory);
+
+  /// Returns the directory of the on-disk cache; empty if it is disabled.
+  std::string getCacheDirectory() const;
+
+  /// Returns the number of cached meshes that are still in use
+  std::size_t getNumMeshes() const;
+
+  /// Forgets all the cached meshes. The meshes are kept alive by the shapes
+  /// that use them. The on-disk cache is not modified.
+  void clear();
+
+private:
+  /// Protects the members below
+  mutable std::mutex mMutex;
+
+  /// Cached meshes keyed by URI and content hash
+  std::unordered_map<std::string, std::weak_ptr<const aiScene>> mMeshes;
+
+  /// Directory of the on-disk cache
+  std::string mCacheDirectory;
+};
+
+} // namespace dynamics
+} // namespace dart
+
+#endif // DART_DYNAMICS_MESHCACHE_HPP_
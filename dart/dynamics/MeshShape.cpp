@@ -146,10 +146,27 @@ MeshShape::MeshShape(
   setScale(scale);
 }
 
+//==============================================================================
+MeshShape::MeshShape(
+    const Eigen::Vector3d& scale,
+    std::shared_ptr<const aiScene> mesh,
+    const common::Uri& path,
+    common::ResourceRetrieverPtr resourceRetriever)
+  : Shape(MESH),
+    mDisplayList(0),
+    mColorMode(MATERIAL_COLOR),
+    mAlphaMode(BLEND),
+    mColorIndex(0)
+{
+  setMesh(std::move(mesh), path, std::move(resourceRetriever));
+  setScale(scale);
+}
+
 //==============================================================================
 MeshShape::~MeshShape()
 {
-  aiReleaseImport(mMesh);
+  if (!mSharedMesh)
+    aiReleaseImport(mMesh);
 }
 
 //==============================================================================
@@ -217,6 +234,7 @@ void MeshShape::setMesh(
     common::ResourceRetrieverPtr resourceRetriever)
 {
   mMesh = mesh;
+  mSharedMesh = nullptr;
 
   if (!mMesh) {
     mMeshUri.clear();
@@ -242,6 +260,18 @@ void MeshShape::setMesh(
   incrementVersion();
 }
 
+//==============================================================================
+void MeshShape::setMesh(
+    std::shared_ptr<const aiScene> mesh,
+    const common::Uri& uri,
+    common::ResourceRetrieverPtr resourceRetriever)
+{
+  setMesh(mesh.get(), uri, std::move(resourceRetriever));
+
+  if (mMesh)
+    mSharedMesh = std::move(mesh);
+}
+
 //==============================================================================
 void MeshShape::setScale(const Eigen::Vector3d& scale)
 {
@@ -322,10 +352,16 @@ Eigen::Matrix3d MeshShape::computeInertia(double _mass) const
 //==============================================================================
 ShapePtr MeshShape::clone() const
 {
-  aiScene* new_scene = cloneMesh();
-
-  auto new_shape = std::make_shared<MeshShape>(
-      mScale, new_scene, mMeshUri, mResourceRetriever);
+  std::shared_ptr<MeshShape> new_shape;
+  if (mSharedMesh) {
+    // Shared meshes are immutable, so the clone can share it as well
+    new_shape = std::make_shared<MeshShape>(
+        mScale, mSharedMesh, mMeshUri, mResourceRetriever);
+  } else {
+    aiScene* new_scene = cloneMesh();
+    new_shape = std::make_shared<MeshShape>(
+        mScale, new_scene, mMeshUri, mResourceRetriever);
+  }
   new_shape->mMeshPath = mMeshPath;
   new_shape->mDisplayList = mDisplayList;
   new_shape->mColorMode = mColorMode;
@@ -39,6 +39,7 @@
 
 #include <assimp/scene.h>
 
+#include <memory>
 #include <string>
 
 namespace dart {
@@ -84,6 +85,14 @@ public:
       const common::Uri& uri = "",
       common::ResourceRetrieverPtr resourceRetriever = nullptr);
 
+  /// Constructor for a mesh that may be shared with other shapes, such as a
+  /// mesh from MeshCache. The mesh must not be modified while it is shared.
+  MeshShape(
+      const Eigen::Vector3d& scale,
+      std::shared_ptr<const aiScene> mesh,
+      const common::Uri& uri = "",
+      common::ResourceRetrieverPtr resourceRetriever = nullptr);
+
   /// Destructor.
   ~MeshShape() override;
 
@@ -111,6 +120,14 @@ public:
       const common::Uri& path,
       common::ResourceRetrieverPtr resourceRetriever = nullptr);
 
+  /// Sets a mesh that may be shared with other shapes. Unlike the overloads
+  /// taking a raw pointer, this shape doesn't take the ownership of the mesh
+  /// but keeps it alive.
+  void setMesh(
+      std::shared_ptr<const aiScene> mesh,
+      const common::Uri& path,
+      common::ResourceRetrieverPtr resourceRetriever = nullptr);
+
   /// Returns URI to the mesh as std::string; an empty string if unavailable.
   std::string getMeshUri() const;
   // TODO(DART 7): Replace with getMeshUri2().
@@ -194,6 +211,10 @@ protected:
 
   const aiScene* mMesh;
 
+  /// Keeps mMesh alive when it is shared with other shapes. This shape owns
+  /// mMesh if this is nullptr.
+  std::shared_ptr<const aiScene> mSharedMesh;
+
   /// URI the mesh, if available).
   common::Uri mMeshUri;
 
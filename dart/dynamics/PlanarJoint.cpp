@@ -210,6 +210,41 @@ Eigen::Matrix<double, 6, 3> PlanarJoint::getRelativeJacobianStatic(
   return J;
 }
 
+//==============================================================================
+math::Jacobian PlanarJoint::getRelativeJacobianDerivative(
+    std::size_t index) const
+{
+  DART_ASSERT(index < 3);
+
+  // Only the translational columns depend on the rotational coordinate:
+  // dSi/dq2 = -ad(S2, Si)
+  const Eigen::Matrix<double, 6, 3>& J = getRelativeJacobianStatic();
+  math::Jacobian dJ = math::Jacobian::Zero(6, 3);
+  if (index == 2) {
+    dJ.col(0) = -math::ad(J.col(2), J.col(0));
+    dJ.col(1) = -math::ad(J.col(2), J.col(1));
+  }
+
+  return dJ;
+}
+
+//==============================================================================
+math::Jacobian PlanarJoint::getRelativeJacobianTimeDerivDerivative(
+    std::size_t index) const
+{
+  DART_ASSERT(index < 3);
+
+  const Eigen::Matrix<double, 6, 3>& J = getRelativeJacobianStatic();
+  math::Jacobian dJ = math::Jacobian::Zero(6, 3);
+  if (index == 2) {
+    const double dq2 = getVelocitiesStatic()[2];
+    dJ.col(0) = math::ad(J.col(2), math::ad(J.col(2), J.col(0))) * dq2;
+    dJ.col(1) = math::ad(J.col(2), math::ad(J.col(2), J.col(1))) * dq2;
+  }
+
+  return dJ;
+}
+
 //==============================================================================
 PlanarJoint::PlanarJoint(const Properties& properties)
   : detail::PlanarJointBase(properties)
@@ -134,6 +134,14 @@ public:
   Eigen::Matrix<double, 6, 3> getRelativeJacobianStatic(
       const Eigen::Vector3d& _positions) const override;
 
+  // Documentation inherited
+  math::Jacobian getRelativeJacobianDerivative(
+      std::size_t index) const override;
+
+  // Documentation inherited
+  math::Jacobian getRelativeJacobianTimeDerivDerivative(
+      std::size_t index) const override;
+
 protected:
   /// Constructor called by Skeleton class
   PlanarJoint(const Properties& properties);
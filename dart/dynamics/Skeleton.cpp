@@ -48,6 +48,7 @@
 #include "dart/math/Helpers.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <queue>
 #include <string>
 #include <vector>
@@ -306,6 +307,101 @@ BodyNodePropertiesVector getAllJointProperties(const Skeleton* skel)
 
 } // namespace detail
 
+namespace {
+
+//==============================================================================
+bool containsSoftBodyNode(const std::vector<BodyNode*>& bodyNodes)
+{
+  return std::any_of(
+      bodyNodes.begin(), bodyNodes.end(), [](const BodyNode* bodyNode) {
+        return bodyNode->asSoftBodyNode() != nullptr;
+      });
+}
+
+//==============================================================================
+/// Compute the index of the DOF that each DOF of a tree directly depends on,
+/// which is the previous DOF of the same joint or the last DOF of the closest
+/// ancestor joint that has any DOFs. DOFs are ordered parent-first, so the
+/// parent index is always less than the DOF index.
+void computeDofParents(
+    const std::vector<BodyNode*>& bodyNodes, std::vector<std::size_t>& parents)
+{
+  for (const BodyNode* bodyNode : bodyNodes) {
+    const Joint* joint = bodyNode->getParentJoint();
+    const std::size_t numDofs = joint->getNumDofs();
+    if (numDofs == 0)
+      continue;
+
+    const std::size_t iStart = joint->getIndexInTree(0);
+
+    std::size_t parent = INVALID_INDEX;
+    for (const BodyNode* ancestor = bodyNode->getParentBodyNode(); ancestor;
+         ancestor = ancestor->getParentBodyNode()) {
+      const Joint* ancestorJoint = ancestor->getParentJoint();
+      const std::size_t ancestorDofs = ancestorJoint->getNumDofs();
+      if (ancestorDofs > 0) {
+        parent = ancestorJoint->getIndexInTree(ancestorDofs - 1);
+        break;
+      }
+    }
+
+    parents[iStart] = parent;
+    for (std::size_t i = 1; i < numDofs; ++i)
+      parents[iStart + i] = iStart + i - 1;
+  }
+}
+
+//==============================================================================
+/// In-place LTL factorization H = L^T L that only touches the nonzero entries
+/// induced by the branches of the kinematic tree (Featherstone, "Rigid Body
+/// Dynamics Algorithms", Sec. 6.5). Only the lower triangle of H is read and
+/// overwritten by L. Returns false if H is not positive definite.
+bool factorizeLtl(Eigen::MatrixXd& H, const std::vector<std::size_t>& parents)
+{
+  for (std::size_t k = parents.size(); k-- > 0;) {
+    if (!(H(k, k) > 0.0))
+      return false;
+
+    H(k, k) = std::sqrt(H(k, k));
+
+    for (std::size_t i = parents[k]; i != INVALID_INDEX; i = parents[i])
+      H(k, i) /= H(k, k);
+
+    for (std::size_t i = parents[k]; i != INVALID_INDEX; i = parents[i]) {
+      for (std::size_t j = i; j != INVALID_INDEX; j = parents[j])
+        H(i, j) -= H(k, i) * H(k, j);
+    }
+  }
+
+  return true;
+}
+
+//==============================================================================
+/// Overwrite x with H^{-1} x where L is the factor computed by factorizeLtl()
+void solveLtl(
+    const Eigen::MatrixXd& L,
+    const std::vector<std::size_t>& parents,
+    Eigen::Ref<Eigen::VectorXd> x)
+{
+  const std::size_t n = parents.size();
+
+  // Solve L^T y = x
+  for (std::size_t i = n; i-- > 0;) {
+    x[i] /= L(i, i);
+    for (std::size_t j = parents[i]; j != INVALID_INDEX; j = parents[j])
+      x[j] -= L(i, j) * x[i];
+  }
+
+  // Solve L z = y
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t j = parents[i]; j != INVALID_INDEX; j = parents[j])
+      x[i] -= L(i, j) * x[j];
+    x[i] /= L(i, i);
+  }
+}
+
+} // namespace
+
 //==============================================================================
 Skeleton::Configuration::Configuration(
     const Eigen::VectorXd& positions,
@@ -781,6 +877,18 @@ bool Skeleton::isMobile() const noexcept
   return mAspectProperties.mIsMobile;
 }
 
+//==============================================================================
+void Skeleton::setSleeping(bool sleeping)
+{
+  mIsSleeping = sleeping;
+}
+
+//==============================================================================
+bool Skeleton::isSleeping() const noexcept
+{
+  return mIsSleeping;
+}
+
 //==============================================================================
 void Skeleton::setTimeStep(double _timeStep)
 {
@@ -2016,6 +2124,56 @@ const Eigen::MatrixXd& Skeleton::getInvAugMassMatrix() const
   return mSkelCache.mInvAugM;
 }
 
+//==============================================================================
+Eigen::VectorXd Skeleton::multiplyByInvMassMatrix(
+    std::size_t _treeIdx, const Eigen::VectorXd& _x) const
+{
+  Eigen::VectorXd result = _x;
+  applyInvMassMatrix(_treeIdx, result, false);
+  return result;
+}
+
+//==============================================================================
+Eigen::VectorXd Skeleton::multiplyByInvMassMatrix(
+    const Eigen::VectorXd& _x) const
+{
+  Eigen::VectorXd result(_x.size());
+  applyInvMassMatrix(_x, result, false);
+  return result;
+}
+
+//==============================================================================
+void Skeleton::multiplyByInvMassMatrix(
+    const Eigen::VectorXd& _x, Eigen::Ref<Eigen::VectorXd> _result) const
+{
+  applyInvMassMatrix(_x, _result, false);
+}
+
+//==============================================================================
+Eigen::VectorXd Skeleton::multiplyByInvAugMassMatrix(
+    std::size_t _treeIdx, const Eigen::VectorXd& _x) const
+{
+  Eigen::VectorXd result = _x;
+  applyInvMassMatrix(_treeIdx, result, true);
+  return result;
+}
+
+//==============================================================================
+Eigen::VectorXd Skeleton::multiplyByInvAugMassMatrix(
+    const Eigen::VectorXd& _x) const
+{
+  Eigen::VectorXd result(_x.size());
+  applyInvMassMatrix(_x, result, true);
+  return result;
+}
+
+//==============================================================================
+void Skeleton::multiplyByInvAugMassMatrix(
+    const Eigen::VectorXd& _x, Eigen::Ref<Eigen::VectorXd> _result) const
+{
+  applyInvMassMatrix(_x, _result, true);
+}
+
 //==============================================================================
 const Eigen::VectorXd& Skeleton::getCoriolisForces(std::size_t _treeIdx) const
 {
@@ -2110,7 +2268,10 @@ const Eigen::VectorXd& Skeleton::getConstraintForces() const
 
 //==============================================================================
 Skeleton::Skeleton(const AspectPropertiesData& properties)
-  : mTotalMass(0.0), mIsImpulseApplied(false), mUnionSize(1)
+  : mTotalMass(0.0),
+    mIsImpulseApplied(false),
+    mIsSleeping(false),
+    mUnionSize(1)
 {
   createAspect<Aspect>(properties);
   createAspect<detail::BodyNodeVectorProxyAspect>();
@@ -2807,6 +2968,70 @@ void Skeleton::updateMassMatrix(std::size_t _treeIdx) const
 
   cache.mM.setZero();
 
+  if (mSoftBodyNodes.empty() || !containsSoftBodyNode(cache.mBodyNodes)) {
+    // Composite rigid body algorithm: accumulate the spatial inertia of every
+    // subtree in a single backward pass and project it onto the joints on the
+    // path to the root. SoftBodyNodes have point mass dynamics that this does
+    // not capture, so trees containing them use the unit acceleration passes
+    // below.
+    const std::size_t numBodyNodes = cache.mBodyNodes.size();
+    cache.mCompositeInertias.resize(numBodyNodes);
+    cache.mRelativeJacobians.resize(numBodyNodes);
+    for (std::size_t i = 0; i < numBodyNodes; ++i) {
+      const BodyNode* bodyNode = cache.mBodyNodes[i];
+      cache.mCompositeInertias[i] = bodyNode->getInertia().getSpatialTensor();
+      cache.mRelativeJacobians[i]
+          = bodyNode->mParentJoint->getRelativeJacobian();
+    }
+
+    Eigen::Matrix<double, 6, Eigen::Dynamic> F;
+    for (std::size_t i = numBodyNodes; i-- > 0;) {
+      const BodyNode* bodyNode = cache.mBodyNodes[i];
+      const Joint* joint = bodyNode->mParentJoint;
+      const Eigen::Matrix6d& Ic = cache.mCompositeInertias[i];
+
+      // Children come after their parent, so Ic is complete at this point
+      if (bodyNode->mParentBodyNode) {
+        cache.mCompositeInertias[bodyNode->mParentBodyNode->mIndexInTree]
+            += math::transformInertia(
+                joint->getRelativeTransform().inverse(), Ic);
+      }
+
+      const std::size_t localDof = joint->getNumDofs();
+      if (localDof == 0)
+        continue;
+
+      const std::size_t iStart = joint->getIndexInTree(0);
+      const math::Jacobian& S = cache.mRelativeJacobians[i];
+      F.noalias() = Ic * S;
+      cache.mM.block(iStart, iStart, localDof, localDof).noalias()
+          = S.transpose() * F;
+
+      // Transform the composite forces to each ancestor in turn
+      const BodyNode* child = bodyNode;
+      for (const BodyNode* ancestor = bodyNode->mParentBodyNode; ancestor;
+           ancestor = ancestor->mParentBodyNode) {
+        const Eigen::Isometry3d& T
+            = child->mParentJoint->getRelativeTransform();
+        for (std::size_t k = 0; k < localDof; ++k)
+          F.col(k) = math::dAdInvT(T, F.col(k));
+        child = ancestor;
+
+        const std::size_t ancestorDof = ancestor->mParentJoint->getNumDofs();
+        if (ancestorDof == 0)
+          continue;
+
+        const std::size_t jStart = ancestor->mParentJoint->getIndexInTree(0);
+        cache.mM.block(jStart, iStart, ancestorDof, localDof).noalias()
+            = cache.mRelativeJacobians[ancestor->mIndexInTree].transpose() * F;
+      }
+    }
+    cache.mM.triangularView<Eigen::StrictlyLower>() = cache.mM.transpose();
+
+    cache.mDirty.mMassMatrix = false;
+    return;
+  }
+
   // Backup the original internal force
   Eigen::VectorXd originalGenAcceleration = getAccelerations();
 
@@ -2896,6 +3121,20 @@ void Skeleton::updateAugMassMatrix(std::size_t _treeIdx) const
     return;
   }
 
+  if (mSoftBodyNodes.empty() || !containsSoftBodyNode(cache.mBodyNodes)) {
+    // The implicit joint damping and spring forces only add to the diagonal
+    cache.mAugM = getMassMatrix(_treeIdx);
+    const double dt = mAspectProperties.mTimeStep;
+    for (std::size_t i = 0; i < dof; ++i) {
+      const DegreeOfFreedom* genCoord = cache.mDofs[i];
+      cache.mAugM(i, i) += dt * genCoord->getDampingCoefficient()
+                           + dt * dt * genCoord->getSpringStiffness();
+    }
+
+    cache.mDirty.mAugMassMatrix = false;
+    return;
+  }
+
   cache.mAugM.setZero();
 
   // Backup the origianl internal force
@@ -2988,6 +3227,17 @@ void Skeleton::updateInvMassMatrix(std::size_t _treeIdx) const
     return;
   }
 
+  if (const Eigen::MatrixXd* L = getMassMatrixFactor(_treeIdx, false)) {
+    cache.mInvM.setIdentity();
+    for (std::size_t j = 0; j < dof; ++j)
+      solveLtl(*L, cache.mDofParents, cache.mInvM.col(j));
+    cache.mInvM.triangularView<Eigen::StrictlyUpper>()
+        = cache.mInvM.transpose();
+
+    cache.mDirty.mInvMassMatrix = false;
+    return;
+  }
+
   // We don't need to set mInvM as zero matrix as long as the below is correct
   // cache.mInvM.setZero();
 
@@ -3080,6 +3330,17 @@ void Skeleton::updateInvAugMassMatrix(std::size_t _treeIdx) const
     return;
   }
 
+  if (const Eigen::MatrixXd* L = getMassMatrixFactor(_treeIdx, true)) {
+    cache.mInvAugM.setIdentity();
+    for (std::size_t j = 0; j < dof; ++j)
+      solveLtl(*L, cache.mDofParents, cache.mInvAugM.col(j));
+    cache.mInvAugM.triangularView<Eigen::StrictlyUpper>()
+        = cache.mInvAugM.transpose();
+
+    cache.mDirty.mInvAugMassMatrix = false;
+    return;
+  }
+
   // We don't need to set mInvM as zero matrix as long as the below is correct
   // mInvM.setZero();
 
@@ -3161,6 +3422,81 @@ void Skeleton::updateInvAugMassMatrix() const
   mSkelCache.mDirty.mInvAugMassMatrix = false;
 }
 
+//==============================================================================
+const Eigen::MatrixXd* Skeleton::getMassMatrixFactor(
+    std::size_t _treeIdx, bool _augmented) const
+{
+  DataCache& cache = mTreeCache[_treeIdx];
+  bool& dirty = _augmented ? cache.mDirty.mAugMassMatrixFactor
+                           : cache.mDirty.mMassMatrixFactor;
+  bool& valid
+      = _augmented ? cache.mHasAugMassMatrixFactor : cache.mHasMassMatrixFactor;
+  Eigen::MatrixXd& L
+      = _augmented ? cache.mAugMassMatrixFactor : cache.mMassMatrixFactor;
+
+  if (dirty) {
+    valid = false;
+    if (mSoftBodyNodes.empty() || !containsSoftBodyNode(cache.mBodyNodes)) {
+      cache.mDofParents.resize(cache.mDofs.size());
+      computeDofParents(cache.mBodyNodes, cache.mDofParents);
+
+      L = _augmented ? getAugMassMatrix(_treeIdx) : getMassMatrix(_treeIdx);
+      valid = factorizeLtl(L, cache.mDofParents);
+    }
+    dirty = false;
+  }
+
+  return valid ? &L : nullptr;
+}
+
+//==============================================================================
+void Skeleton::applyInvMassMatrix(
+    std::size_t _treeIdx, Eigen::Ref<Eigen::VectorXd> _x, bool _augmented) const
+{
+  DART_ASSERT(
+      static_cast<std::size_t>(_x.size())
+      == mTreeCache[_treeIdx].mDofs.size());
+
+  if (const Eigen::MatrixXd* L = getMassMatrixFactor(_treeIdx, _augmented)) {
+    solveLtl(*L, mTreeCache[_treeIdx].mDofParents, _x);
+    return;
+  }
+
+  if (_augmented)
+    _x = getInvAugMassMatrix(_treeIdx) * _x.eval();
+  else
+    _x = getInvMassMatrix(_treeIdx) * _x.eval();
+}
+
+//==============================================================================
+void Skeleton::applyInvMassMatrix(
+    const Eigen::VectorXd& _x,
+    Eigen::Ref<Eigen::VectorXd> _result,
+    bool _augmented) const
+{
+  DART_ASSERT(static_cast<std::size_t>(_x.size()) == getNumDofs());
+  DART_ASSERT(_result.size() == _x.size());
+
+  // The trees own disjoint DOFs, so each tree is read from _x before any of
+  // its entries in _result are written, which makes aliasing safe
+  for (std::size_t tree = 0; tree < mTreeCache.size(); ++tree) {
+    const std::vector<DegreeOfFreedom*>& treeDofs = mTreeCache[tree].mDofs;
+    const std::size_t nTreeDofs = treeDofs.size();
+    if (nTreeDofs == 0)
+      continue;
+
+    Eigen::VectorXd& treeX = mTreeCache[tree].mInvMassProduct;
+    treeX.resize(nTreeDofs);
+    for (std::size_t i = 0; i < nTreeDofs; ++i)
+      treeX[i] = _x[treeDofs[i]->getIndexInSkeleton()];
+
+    applyInvMassMatrix(tree, treeX, _augmented);
+
+    for (std::size_t i = 0; i < nTreeDofs; ++i)
+      _result[treeDofs[i]->getIndexInSkeleton()] = treeX[i];
+  }
+}
+
 //==============================================================================
 void Skeleton::updateCoriolisForces(std::size_t _treeIdx) const
 {
@@ -3662,6 +3998,227 @@ void Skeleton::computeInverseDynamics(
   }
 }
 
+//==============================================================================
+void Skeleton::computeInverseDynamicsDerivatives(
+    Eigen::MatrixXd& forcesWrtPositions,
+    Eigen::MatrixXd& forcesWrtVelocities,
+    bool withExternalForces,
+    bool withDampingForces,
+    bool withSpringForces) const
+{
+  const std::size_t numDofs = getNumDofs();
+  forcesWrtPositions.setZero(numDofs, numDofs);
+  forcesWrtVelocities.setZero(numDofs, numDofs);
+
+  // Skip immobile or 0-dof skeleton
+  if (numDofs == 0)
+    return;
+
+  DART_WARN_IF(
+      getNumSoftBodyNodes() > 0,
+      "Skeleton [{}] contains soft bodies, whose point masses are ignored by "
+      "the inverse dynamics derivatives.",
+      getName());
+
+  const std::vector<BodyNode*>& bodyNodes = mSkelCache.mBodyNodes;
+  const std::size_t numBodies = bodyNodes.size();
+
+  // Nominal pass of the recursive Newton-Euler algorithm. The spatial
+  // velocities and accelerations are already up to date in the body nodes,
+  // but the gravity accelerations and the body forces are recomputed here so
+  // that the external forces are taken into account only when requested.
+  std::vector<int> parents(numBodies, -1);
+  std::vector<math::Jacobian> J(numBodies);
+  std::vector<math::Jacobian> dJdt(numBodies);
+  std::vector<Eigen::VectorXd> dq(numBodies);
+  std::vector<Eigen::VectorXd> ddq(numBodies);
+  common::aligned_vector<Eigen::Matrix6d> I(numBodies);
+  common::aligned_vector<Eigen::Vector6d> V(numBodies);
+  common::aligned_vector<Eigen::Vector6d> A(numBodies);
+  common::aligned_vector<Eigen::Vector6d> G(numBodies);
+  common::aligned_vector<Eigen::Vector6d> F(numBodies);
+  common::aligned_vector<Eigen::Vector6d> Jdq(numBodies);
+
+  Eigen::Vector6d gravity = Eigen::Vector6d::Zero();
+  gravity.tail<3>() = mAspectProperties.mGravity;
+
+  for (std::size_t i = 0; i < numBodies; ++i) {
+    const BodyNode* bodyNode = bodyNodes[i];
+    const Joint* joint = bodyNode->getParentJoint();
+    const BodyNode* parent = bodyNode->getParentBodyNode();
+    if (parent)
+      parents[i] = static_cast<int>(parent->getIndexInSkeleton());
+
+    J[i] = joint->getRelativeJacobian();
+    dJdt[i] = joint->getRelativeJacobianTimeDeriv();
+    dq[i] = joint->getVelocities();
+    ddq[i] = joint->getAccelerations();
+    I[i] = bodyNode->getInertia().getSpatialTensor();
+    V[i] = bodyNode->getSpatialVelocity();
+    A[i] = bodyNode->getSpatialAcceleration();
+    G[i] = math::AdInvT(
+        joint->getRelativeTransform(),
+        parents[i] < 0 ? gravity : G[parents[i]]);
+    Jdq[i] = J[i] * dq[i];
+  }
+
+  std::fill(F.begin(), F.end(), Eigen::Vector6d::Zero());
+  for (std::size_t i = numBodies; i-- > 0;) {
+    const BodyNode* bodyNode = bodyNodes[i];
+    F[i] += I[i] * A[i] - math::dad(V[i], I[i] * V[i]);
+    if (bodyNode->getGravityMode())
+      F[i] -= I[i] * G[i];
+    if (withExternalForces)
+      F[i] -= bodyNode->getExternalForceLocal();
+    if (parents[i] >= 0) {
+      F[parents[i]] += math::dAdInvT(
+          bodyNode->getParentJoint()->getRelativeTransform(), F[i]);
+    }
+  }
+
+  // Tangent pass along each DOF. Only the DOF's own joint depends on it
+  // directly; the descendants see it through the velocities, accelerations
+  // and gravity accelerations of their parents, and the ancestors through
+  // the forces transmitted by their children.
+  common::aligned_vector<Eigen::Vector6d> dV(numBodies);
+  common::aligned_vector<Eigen::Vector6d> dA(numBodies);
+  common::aligned_vector<Eigen::Vector6d> dG(numBodies);
+  common::aligned_vector<Eigen::Vector6d> dF(numBodies);
+
+  for (std::size_t b = 0; b < numBodies; ++b) {
+    const Joint* joint = bodyNodes[b]->getParentJoint();
+    const Eigen::Isometry3d& T = joint->getRelativeTransform();
+
+    for (std::size_t l = 0; l < joint->getNumDofs(); ++l) {
+      const std::size_t column = joint->getIndexInSkeleton(l);
+      const math::Jacobian dJ = joint->getRelativeJacobianDerivative(l);
+      const Eigen::Vector6d& s = J[b].col(l);
+
+      for (const bool wrtPositions : {true, false}) {
+        std::fill(dV.begin(), dV.begin() + b, Eigen::Vector6d::Zero());
+        std::fill(dA.begin(), dA.begin() + b, Eigen::Vector6d::Zero());
+        std::fill(dG.begin(), dG.begin() + b, Eigen::Vector6d::Zero());
+
+        // Forward recursion over the bodies that can depend on the DOF
+        for (std::size_t i = b; i < numBodies; ++i) {
+          const int p = parents[i];
+          const Eigen::Isometry3d& Ti
+              = bodyNodes[i]->getParentJoint()->getRelativeTransform();
+          if (i == b || p < 0 || static_cast<std::size_t>(p) < b) {
+            dV[i].setZero();
+            dA[i].setZero();
+            dG[i].setZero();
+          } else {
+            dV[i] = math::AdInvT(Ti, dV[p]);
+            dA[i] = math::AdInvT(Ti, dA[p]);
+            dG[i] = math::AdInvT(Ti, dG[p]);
+          }
+
+          if (i == b) {
+            if (wrtPositions) {
+              const Eigen::Vector6d dJdq = dJ * dq[b];
+              if (p >= 0) {
+                dV[b] -= math::ad(s, math::AdInvT(T, V[p]));
+                dA[b] -= math::ad(s, math::AdInvT(T, A[p]));
+              }
+              dG[b] -= math::ad(s, G[b]);
+              dV[b] += dJdq;
+              dA[b] += dJ * ddq[b]
+                       + joint->getRelativeJacobianTimeDerivDerivative(l)
+                             * dq[b]
+                       + math::ad(V[b], dJdq);
+            } else {
+              dV[b] += s;
+              dA[b] += math::ad(V[b], s) + dJ * dq[b] + dJdt[b].col(l);
+            }
+          }
+
+          dA[i] += math::ad(dV[i], Jdq[i]);
+        }
+
+        // Backward recursion over all the bodies
+        Eigen::MatrixXd& result
+            = wrtPositions ? forcesWrtPositions : forcesWrtVelocities;
+        std::fill(dF.begin(), dF.end(), Eigen::Vector6d::Zero());
+        for (std::size_t i = numBodies; i-- > 0;) {
+          const BodyNode* bodyNode = bodyNodes[i];
+          const Joint* childJoint = bodyNode->getParentJoint();
+          if (i >= b) {
+            dF[i] += I[i] * dA[i] - math::dad(dV[i], I[i] * V[i])
+                     - math::dad(V[i], I[i] * dV[i]);
+            if (bodyNode->getGravityMode())
+              dF[i] -= I[i] * dG[i];
+          }
+
+          if (childJoint->getNumDofs() > 0) {
+            const Eigen::VectorXd dtau = J[i].transpose() * dF[i];
+            for (std::size_t k = 0; k < childJoint->getNumDofs(); ++k)
+              result(childJoint->getIndexInSkeleton(k), column) += dtau[k];
+          }
+
+          if (parents[i] < 0)
+            continue;
+
+          const Eigen::Isometry3d& Ti = childJoint->getRelativeTransform();
+          dF[parents[i]] += math::dAdInvT(Ti, dF[i]);
+          if (i == b && wrtPositions)
+            dF[parents[i]] -= math::dAdInvT(Ti, math::dad(s, F[i]));
+        }
+
+        if (wrtPositions) {
+          const Eigen::VectorXd dtau = dJ.transpose() * F[b];
+          for (std::size_t k = 0; k < joint->getNumDofs(); ++k)
+            result(joint->getIndexInSkeleton(k), column) += dtau[k];
+        }
+      }
+
+      // Implicit damping and spring forces of the DOF itself
+      const double h = mAspectProperties.mTimeStep;
+      const double damping = joint->getDampingCoefficient(l);
+      const double stiffness = joint->getSpringStiffness(l);
+      if (withDampingForces)
+        forcesWrtVelocities(column, column) += damping;
+      if (withSpringForces) {
+        forcesWrtPositions(column, column) += stiffness;
+        forcesWrtVelocities(column, column) += h * stiffness;
+      }
+    }
+  }
+}
+
+//==============================================================================
+void Skeleton::computeForwardDynamicsDerivatives(
+    Eigen::MatrixXd& accelerationsWrtPositions,
+    Eigen::MatrixXd& accelerationsWrtVelocities,
+    Eigen::MatrixXd& accelerationsWrtForces)
+{
+  for (const BodyNode* bodyNode : mSkelCache.mBodyNodes) {
+    DART_WARN_IF(
+        bodyNode->getParentJoint()->isKinematic(),
+        "Joint [{}] of Skeleton [{}] is not force driven, so the forward "
+        "dynamics derivatives do not account for its prescribed motion.",
+        bodyNode->getParentJoint()->getName(),
+        getName());
+  }
+
+  computeForwardDynamics();
+
+  // Differentiating tau = ID(q, dq, ddq(q, dq, tau)) gives
+  // d(ddq)/d(q, dq) = -M^-1 d(ID)/d(q, dq) and d(ddq)/d(tau) = M^-1, where M
+  // is the augmented mass matrix that includes the implicit damping and
+  // spring forces of the next time step.
+  Eigen::MatrixXd forcesWrtPositions;
+  Eigen::MatrixXd forcesWrtVelocities;
+  computeInverseDynamicsDerivatives(
+      forcesWrtPositions, forcesWrtVelocities, true, true, true);
+
+  accelerationsWrtForces = getInvAugMassMatrix();
+  accelerationsWrtPositions.noalias()
+      = -accelerationsWrtForces * forcesWrtPositions;
+  accelerationsWrtVelocities.noalias()
+      = -accelerationsWrtForces * forcesWrtVelocities;
+}
+
 //==============================================================================
 void Skeleton::clearExternalForces()
 {
@@ -3684,6 +4241,8 @@ void Skeleton::dirtyArticulatedInertia(std::size_t _treeIdx)
   SET_FLAG(_treeIdx, mAugMassMatrix);
   SET_FLAG(_treeIdx, mInvMassMatrix);
   SET_FLAG(_treeIdx, mInvAugMassMatrix);
+  SET_FLAG(_treeIdx, mMassMatrixFactor);
+  SET_FLAG(_treeIdx, mAugMassMatrixFactor);
   SET_FLAG(_treeIdx, mCoriolisForces);
   SET_FLAG(_treeIdx, mGravityForces);
   SET_FLAG(_treeIdx, mCoriolisAndGravityForces);
@@ -4086,6 +4645,8 @@ Skeleton::DirtyFlags::DirtyFlags()
     mAugMassMatrix(true),
     mInvMassMatrix(true),
     mInvAugMassMatrix(true),
+    mMassMatrixFactor(true),
+    mAugMassMatrixFactor(true),
     mGravityForces(true),
     mCoriolisForces(true),
     mCoriolisAndGravityForces(true),
@@ -282,6 +282,19 @@ public:
   /// \return True if this skeleton is mobile.
   bool isMobile() const noexcept;
 
+  /// Set whether this skeleton is asleep.
+  ///
+  /// A sleeping skeleton is skipped by simulation::World::step() and is
+  /// treated like an immobile skeleton by the collision filter and the
+  /// constraint solver until it is woken up. Worlds with sleeping enabled (see
+  /// simulation::World::setSleepingEnabled()) put resting skeletons to sleep
+  /// and wake them up automatically. Unlike setMobile(), this is runtime state
+  /// that is neither cloned nor stored in the skeleton's properties.
+  void setSleeping(bool sleeping);
+
+  /// Get whether this skeleton is asleep.
+  bool isSleeping() const noexcept;
+
   /// Set time step. This timestep is used for implicit joint damping
   /// force.
   void setTimeStep(double _timeStep);
@@ -669,6 +682,56 @@ public:
       bool _withDampingForces = false,
       bool _withSpringForces = false);
 
+  /// Computes the partial derivatives of the generalized forces of
+  /// computeInverseDynamics() with respect to the generalized positions and
+  /// velocities, at the current positions, velocities and accelerations.
+  ///
+  /// The recursive Newton-Euler algorithm is differentiated analytically
+  /// along each DOF, which costs O(n^2) for n DOFs. The derivative with
+  /// respect to the accelerations is the mass matrix, or the augmented mass
+  /// matrix when the damping and spring forces are taken into account.
+  ///
+  /// The derivatives with respect to the positions of joints that are not
+  /// integrated additively, such as BallJoint and FreeJoint, are taken along
+  /// the perturbation that Joint::integratePositions() applies. Soft bodies
+  /// are not supported.
+  ///
+  /// \param[out] forcesWrtPositions Derivative of the generalized forces with
+  /// respect to the generalized positions.
+  /// \param[out] forcesWrtVelocities Derivative of the generalized forces with
+  /// respect to the generalized velocities.
+  /// \param[in] withExternalForces Same as for computeInverseDynamics().
+  /// \param[in] withDampingForces Same as for computeInverseDynamics().
+  /// \param[in] withSpringForces Same as for computeInverseDynamics().
+  void computeInverseDynamicsDerivatives(
+      Eigen::MatrixXd& forcesWrtPositions,
+      Eigen::MatrixXd& forcesWrtVelocities,
+      bool withExternalForces = false,
+      bool withDampingForces = false,
+      bool withSpringForces = false) const;
+
+  /// Computes forward dynamics like computeForwardDynamics(), and the partial
+  /// derivatives of the resulting generalized accelerations with respect to
+  /// the generalized positions, velocities and forces.
+  ///
+  /// Differentiating the inverse dynamics at the computed accelerations gives
+  /// the derivatives with respect to the forces as the inverse augmented mass
+  /// matrix, and the other derivatives as the product of its negation and
+  /// the derivatives of computeInverseDynamicsDerivatives() with all the
+  /// forces taken into account. All joints must be force driven, and
+  /// constraints such as joint limits are not taken into account.
+  ///
+  /// \param[out] accelerationsWrtPositions Derivative of the generalized
+  /// accelerations with respect to the generalized positions.
+  /// \param[out] accelerationsWrtVelocities Derivative of the generalized
+  /// accelerations with respect to the generalized velocities.
+  /// \param[out] accelerationsWrtForces Derivative of the generalized
+  /// accelerations with respect to the generalized forces.
+  void computeForwardDynamicsDerivatives(
+      Eigen::MatrixXd& accelerationsWrtPositions,
+      Eigen::MatrixXd& accelerationsWrtVelocities,
+      Eigen::MatrixXd& accelerationsWrtForces);
+
   //----------------------------------------------------------------------------
   // Impulse-based dynamics algorithms
   //----------------------------------------------------------------------------
@@ -848,6 +911,34 @@ public:
   // Documentation inherited
   const Eigen::MatrixXd& getInvAugMassMatrix() const override;
 
+  /// Compute M^{-1} * _x for a tree without forming the inverse mass matrix.
+  /// This reuses the sparse LTL factorization of the tree's mass matrix.
+  Eigen::VectorXd multiplyByInvMassMatrix(
+      std::size_t _treeIdx, const Eigen::VectorXd& _x) const;
+
+  /// Compute M^{-1} * _x without forming the inverse mass matrix
+  Eigen::VectorXd multiplyByInvMassMatrix(const Eigen::VectorXd& _x) const;
+
+  /// Write M^{-1} * _x into _result without forming the inverse mass matrix.
+  /// Unlike the overload returning a vector, this does not allocate once the
+  /// mass matrix factors are up to date. _result may alias _x.
+  void multiplyByInvMassMatrix(
+      const Eigen::VectorXd& _x, Eigen::Ref<Eigen::VectorXd> _result) const;
+
+  /// Compute the product of the inverse augmented mass matrix of a tree and
+  /// _x without forming the inverse
+  Eigen::VectorXd multiplyByInvAugMassMatrix(
+      std::size_t _treeIdx, const Eigen::VectorXd& _x) const;
+
+  /// Compute the product of the inverse augmented mass matrix and _x without
+  /// forming the inverse
+  Eigen::VectorXd multiplyByInvAugMassMatrix(const Eigen::VectorXd& _x) const;
+
+  /// Write the product of the inverse augmented mass matrix and _x into
+  /// _result without forming the inverse. _result may alias _x.
+  void multiplyByInvAugMassMatrix(
+      const Eigen::VectorXd& _x, Eigen::Ref<Eigen::VectorXd> _result) const;
+
   /// Get the Coriolis force vector of a tree in this Skeleton
   const Eigen::VectorXd& getCoriolisForces(std::size_t _treeIdx) const;
 
@@ -1105,6 +1196,26 @@ protected:
   /// Update inverse of augmented mass matrix of the skeleton.
   void updateInvAugMassMatrix() const;
 
+  /// Get the sparse LTL factor of the (augmented) mass matrix of a tree,
+  /// updating it if needed. Returns nullptr if the tree cannot be factorized
+  /// this way, i.e., it contains SoftBodyNodes or its mass matrix is not
+  /// positive definite.
+  const Eigen::MatrixXd* getMassMatrixFactor(
+      std::size_t _treeIdx, bool _augmented) const;
+
+  /// Overwrite _x with the product of the inverse (augmented) mass matrix of a
+  /// tree and _x
+  void applyInvMassMatrix(
+      std::size_t _treeIdx,
+      Eigen::Ref<Eigen::VectorXd> _x,
+      bool _augmented) const;
+
+  /// Skeleton-level version of applyInvMassMatrix()
+  void applyInvMassMatrix(
+      const Eigen::VectorXd& _x,
+      Eigen::Ref<Eigen::VectorXd> _result,
+      bool _augmented) const;
+
   /// Update Coriolis force vector for a tree in the Skeleton
   void updateCoriolisForces(std::size_t _treeIdx) const;
 
@@ -1190,6 +1301,12 @@ protected:
     /// Dirty flag for the inverse of augmented mass matrix.
     bool mInvAugMassMatrix;
 
+    /// Dirty flag for the LTL factorization of the mass matrix.
+    bool mMassMatrixFactor;
+
+    /// Dirty flag for the LTL factorization of the augmented mass matrix.
+    bool mAugMassMatrixFactor;
+
     /// Dirty flag for the gravity force vector.
     bool mGravityForces;
 
@@ -1241,6 +1358,34 @@ protected:
     /// Inverse of augmented mass matrix for the skeleton.
     Eigen::MatrixXd mInvAugM;
 
+    /// Index of the DOF that each DOF directly depends on in the kinematic
+    /// tree, or INVALID_INDEX for DOFs that do not depend on any other DOF.
+    /// This is the branch-induced sparsity pattern of the mass matrix.
+    std::vector<std::size_t> mDofParents;
+
+    /// Composite rigid body inertias used while computing the mass matrix
+    common::aligned_vector<Eigen::Matrix6d> mCompositeInertias;
+
+    /// Relative Jacobians of the parent joints used while computing the mass
+    /// matrix
+    std::vector<math::Jacobian> mRelativeJacobians;
+
+    /// Sparse LTL factor (lower triangle) of the mass matrix
+    Eigen::MatrixXd mMassMatrixFactor;
+
+    /// Sparse LTL factor (lower triangle) of the augmented mass matrix
+    Eigen::MatrixXd mAugMassMatrixFactor;
+
+    /// Whether mMassMatrixFactor holds a valid factorization
+    bool mHasMassMatrixFactor = false;
+
+    /// Whether mAugMassMatrixFactor holds a valid factorization
+    bool mHasAugMassMatrixFactor = false;
+
+    /// Scratch vector holding the DOFs of the tree while applying the inverse
+    /// mass matrix of a whole skeleton
+    Eigen::VectorXd mInvMassProduct;
+
     /// Coriolis vector for the skeleton which is C(q,dq)*dq.
     Eigen::VectorXd mCvec;
 
@@ -1294,6 +1439,9 @@ protected:
   /// Flag for status of impulse testing.
   bool mIsImpulseApplied;
 
+  /// Whether this skeleton is asleep. See setSleeping().
+  bool mIsSleeping;
+
   mutable std::mutex mMutex;
 
 public:
@@ -161,6 +161,38 @@ Eigen::Matrix<double, 6, 2> UniversalJoint::getRelativeJacobianStatic(
   return J;
 }
 
+//==============================================================================
+math::Jacobian UniversalJoint::getRelativeJacobianDerivative(
+    std::size_t index) const
+{
+  DART_ASSERT(index < 2);
+
+  // Only the first column depends on the second coordinate:
+  // dS0/dq1 = -ad(S1, S0)
+  const Eigen::Matrix<double, 6, 2>& J = getRelativeJacobianStatic();
+  math::Jacobian dJ = math::Jacobian::Zero(6, 2);
+  if (index == 1)
+    dJ.col(0) = -math::ad(J.col(1), J.col(0));
+
+  return dJ;
+}
+
+//==============================================================================
+math::Jacobian UniversalJoint::getRelativeJacobianTimeDerivDerivative(
+    std::size_t index) const
+{
+  DART_ASSERT(index < 2);
+
+  const Eigen::Matrix<double, 6, 2>& J = getRelativeJacobianStatic();
+  math::Jacobian dJ = math::Jacobian::Zero(6, 2);
+  if (index == 1) {
+    dJ.col(0) = math::ad(J.col(1), math::ad(J.col(1), J.col(0)))
+                * getVelocitiesStatic()[1];
+  }
+
+  return dJ;
+}
+
 //==============================================================================
 UniversalJoint::UniversalJoint(const Properties& properties)
   : detail::UniversalJointBase(properties)
@@ -102,6 +102,14 @@ public:
   Eigen::Matrix<double, 6, 2> getRelativeJacobianStatic(
       const Eigen::Vector2d& _positions) const override;
 
+  // Documentation inherited
+  math::Jacobian getRelativeJacobianDerivative(
+      std::size_t index) const override;
+
+  // Documentation inherited
+  math::Jacobian getRelativeJacobianTimeDerivDerivative(
+      std::size_t index) const override;
+
 protected:
   /// Constructor called by Skeleton class
   UniversalJoint(const Properties& properties);
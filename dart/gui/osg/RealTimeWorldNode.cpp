@@ -106,18 +106,24 @@ double RealTimeWorldNode::getHighestRealTimeFactor() const
 //==============================================================================
 void RealTimeWorldNode::refresh()
 {
+  // The background simulation thread paces the World to real time by itself
+  if (isSimulationThreaded() && mSimulating) {
+    WorldNode::refresh();
+    return;
+  }
+
   customPreRefresh();
   clearChildUtilizationFlags();
 
-  if (mNumStepsPerCycle != 1) {
+  if (getNumStepsPerCycle() != 1) {
     DART_WARN(
         "[RealTimeWorldNode] The number of steps per cycle has been set to "
         "[{}], but this value is ignored by the RealTimeWorldNode::refresh() "
         "function. Use the function "
         "RealTimeWorldNode::setTargetRealTimeFactor(double) to change the "
         "simulation speed.",
-        mNumStepsPerCycle);
-    mNumStepsPerCycle = 1;
+        getNumStepsPerCycle());
+    setNumStepsPerCycle(1);
   }
 
   if (mWorld && mSimulating) {
@@ -77,7 +77,9 @@ public:
   /// Get the target refresh rate frequency
   double getTargetFrequency() const;
 
-  /// Set the target real time factor
+  /// Set the target real time factor. It is ignored while the World is
+  /// stepped on a background thread (see setSimulationThreaded()), which
+  /// always runs at real time.
   void setTargetRealTimeFactor(double targetRTF);
 
   /// Get the target real time factor
@@ -77,6 +77,7 @@
 #endif
 #include "dart/dynamics/HeightmapShape.hpp"
 #include "dart/dynamics/SimpleFrame.hpp"
+#include "dart/simulation/WorldSnapshot.hpp"
 
 namespace dart {
 namespace gui {
@@ -88,12 +89,31 @@ ShapeFrameNode::ShapeFrameNode(
   : mShapeFrame(_frame),
     mWorldNode(_worldNode),
     mRenderShapeNode(nullptr),
-    mUtilized(false)
+    mUtilized(false),
+    mVersion(_frame->getVersion())
 {
   refresh();
   setName(_frame->getName() + " [frame]");
 }
 
+//==============================================================================
+ShapeFrameNode::ShapeFrameNode(
+    const dart::simulation::ShapeFrameSnapshot& snapshot, WorldNode* worldNode)
+  : mShapeFrame(snapshot.mShapeFrame),
+    mWorldNode(worldNode),
+    mRenderShapeNode(nullptr),
+    mUtilized(true),
+    mVersion(snapshot.mVersion)
+{
+  setMatrix(eigToOsgMatrix(snapshot.mWorldTransform));
+
+  auto shape = mShapeFrame->getShape();
+  if (shape && mShapeFrame->getVisualAspect())
+    createShapeNode(shape);
+
+  setName(mShapeFrame->getName() + " [frame]");
+}
+
 //==============================================================================
 dart::dynamics::ShapeFrame* ShapeFrameNode::getShapeFrame(bool checkUtilization)
 {
@@ -138,6 +158,7 @@ void ShapeFrameNode::refresh(bool shortCircuitIfUtilized)
     return;
 
   mUtilized = true;
+  mVersion = mShapeFrame->getVersion();
 
   auto shape = mShapeFrame->getShape();
 
@@ -153,6 +174,35 @@ void ShapeFrameNode::refresh(bool shortCircuitIfUtilized)
   }
 }
 
+//==============================================================================
+void ShapeFrameNode::refresh(
+    const dart::simulation::ShapeFrameSnapshot& snapshot)
+{
+  mUtilized = true;
+
+  setMatrix(eigToOsgMatrix(snapshot.mWorldTransform));
+
+  if (!isOutdated(snapshot))
+    return;
+
+  mVersion = snapshot.mVersion;
+
+  auto shape = mShapeFrame->getShape();
+  if (shape && mShapeFrame->getVisualAspect()) {
+    refreshShapeNode(shape);
+  } else if (mRenderShapeNode) {
+    removeChild(mRenderShapeNode->getNode());
+    mRenderShapeNode = nullptr;
+  }
+}
+
+//==============================================================================
+bool ShapeFrameNode::isOutdated(
+    const dart::simulation::ShapeFrameSnapshot& snapshot) const
+{
+  return snapshot.mVersion != mVersion;
+}
+
 //==============================================================================
 bool ShapeFrameNode::wasUtilized() const
 {
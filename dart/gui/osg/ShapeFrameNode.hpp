@@ -51,6 +51,10 @@ class Entity;
 class Shape;
 } // namespace dynamics
 
+namespace simulation {
+struct ShapeFrameSnapshot;
+} // namespace simulation
+
 namespace gui {
 namespace osg {
 
@@ -67,6 +71,12 @@ public:
   /// nodes for all child Entities and child Frames
   ShapeFrameNode(dart::dynamics::ShapeFrame* frame, WorldNode* worldNode);
 
+  /// Create a ShapeFrameNode whose transform is taken from \c snapshot
+  /// instead of being read from the ShapeFrame
+  ShapeFrameNode(
+      const dart::simulation::ShapeFrameSnapshot& snapshot,
+      WorldNode* worldNode);
+
   /// Pointer to the ShapeFrame associated with this ShapeFrameNode
   dart::dynamics::ShapeFrame* getShapeFrame(bool checkUtilization = false);
 
@@ -85,6 +95,15 @@ public:
   /// this function if short circuiting is going to be used.
   void refresh(bool shortCircuitIfUtilized = false);
 
+  /// Update the transform of this ShapeFrameNode from \c snapshot. The
+  /// rendering data of the Shape is only refreshed if the version of the
+  /// ShapeFrame changed since the last refresh, which is the only case in
+  /// which the ShapeFrame is accessed.
+  void refresh(const dart::simulation::ShapeFrameSnapshot& snapshot);
+
+  /// Returns true if refresh(snapshot) needs to access the ShapeFrame
+  bool isOutdated(const dart::simulation::ShapeFrameSnapshot& snapshot) const;
+
   /// True iff this ShapeFrameNode has been utilized on the latest update
   bool wasUtilized() const;
 
@@ -110,6 +129,9 @@ protected:
   /// If it has not, that is an indication that it is no longer being
   /// used and should be deleted.
   bool mUtilized;
+
+  /// Version of the ShapeFrame when the rendering data was last refreshed
+  std::size_t mVersion;
 };
 
 } // namespace osg
@@ -43,6 +43,8 @@
 #include <osgShadow/ShadowMap>
 #include <osgShadow/ShadowedScene>
 
+#include <algorithm>
+#include <chrono>
 #include <deque>
 
 namespace dart {
@@ -63,6 +65,27 @@ public:
   }
 };
 
+/// Stops the background simulation thread of a WorldNode when its reference
+/// count drops to zero. OSG notifies the observers before deleting the node,
+/// so the thread is stopped while the derived classes, whose customPreStep()
+/// and customPostStep() it calls, are still intact.
+class WorldNodeSimulationThreadStopper : public ::osg::Observer
+{
+public:
+  explicit WorldNodeSimulationThreadStopper(WorldNode* node) : mNode(node)
+  {
+    // Do nothing
+  }
+
+  void objectDeleted(void* /*object*/) override
+  {
+    mNode->stopSimulationThread();
+  }
+
+private:
+  WorldNode* mNode;
+};
+
 //==============================================================================
 WorldNode::WorldNode(
     std::shared_ptr<dart::simulation::World> world,
@@ -71,7 +94,10 @@ WorldNode::WorldNode(
     mSimulating(false),
     mNumStepsPerCycle(1),
     mViewer(nullptr),
-    mNormalGroup(new ::osg::Group)
+    mNormalGroup(new ::osg::Group),
+    mSimulationThreaded(false),
+    mStopSimulationThread(false),
+    mSimulationThreadStopper(new WorldNodeSimulationThreadStopper(this))
 {
   // Flags for shadowing; maybe this needs to be global?
   constexpr int ReceivesShadowTraversalMask = 0x2;
@@ -95,12 +121,16 @@ WorldNode::WorldNode(
   setShadowTechnique(shadowTechnique);
 
   setUpdateCallback(new WorldNodeCallback);
+
+  addObserver(mSimulationThreadStopper.get());
 }
 
 //==============================================================================
 void WorldNode::setWorld(std::shared_ptr<dart::simulation::World> newWorld)
 {
+  stopSimulationThread();
   mWorld = newWorld;
+  startSimulationThread();
 }
 
 //==============================================================================
@@ -112,12 +142,26 @@ std::shared_ptr<dart::simulation::World> WorldNode::getWorld() const
 //==============================================================================
 void WorldNode::refresh()
 {
-  customPreRefresh();
+  if (mSimulationThread.joinable()) {
+    // The World is stepped by the background thread, so only apply the latest
+    // snapshot that it published. The hooks read the snapshot instead of the
+    // World, so nothing here waits for the current batch of steps.
+    if (const simulation::WorldSnapshot* snapshot = mSnapshots.fetchLatest()) {
+      customPreSnapshotRefresh(*snapshot);
+      clearChildUtilizationFlags();
+      refreshFromSnapshot(*snapshot);
+      clearUnusedNodes();
+      customPostSnapshotRefresh(*snapshot);
+    }
+    return;
+  }
 
+  customPreRefresh();
   clearChildUtilizationFlags();
 
   if (mSimulating) {
-    for (std::size_t i = 0; i < mNumStepsPerCycle; ++i) {
+    const std::size_t numSteps = getNumStepsPerCycle();
+    for (std::size_t i = 0; i < numSteps; ++i) {
       customPreStep();
       mWorld->step();
       customPostStep();
@@ -144,6 +188,20 @@ void WorldNode::customPostRefresh()
   // Do nothing
 }
 
+//==============================================================================
+void WorldNode::customPreSnapshotRefresh(
+    const simulation::WorldSnapshot& /*snapshot*/)
+{
+  // Do nothing
+}
+
+//==============================================================================
+void WorldNode::customPostSnapshotRefresh(
+    const simulation::WorldSnapshot& /*snapshot*/)
+{
+  // Do nothing
+}
+
 //==============================================================================
 void WorldNode::customPreStep()
 {
@@ -166,24 +224,55 @@ bool WorldNode::isSimulating() const
 void WorldNode::simulate(bool on)
 {
   mSimulating = on;
+
+  if (mSimulating)
+    startSimulationThread();
+  else
+    stopSimulationThread();
 }
 
 //==============================================================================
 void WorldNode::setNumStepsPerCycle(std::size_t steps)
 {
-  mNumStepsPerCycle = steps;
+  mNumStepsPerCycle.store(steps, std::memory_order_relaxed);
 }
 
 //==============================================================================
 std::size_t WorldNode::getNumStepsPerCycle() const
 {
-  return mNumStepsPerCycle;
+  return mNumStepsPerCycle.load(std::memory_order_relaxed);
+}
+
+//==============================================================================
+void WorldNode::setSimulationThreaded(bool threaded)
+{
+  if (threaded == mSimulationThreaded)
+    return;
+
+  stopSimulationThread();
+  mSimulationThreaded = threaded;
+  startSimulationThread();
+}
+
+//==============================================================================
+bool WorldNode::isSimulationThreaded() const
+{
+  return mSimulationThreaded;
+}
+
+//==============================================================================
+std::mutex& WorldNode::getWorldMutex()
+{
+  return mWorldMutex;
 }
 
 //==============================================================================
 WorldNode::~WorldNode()
 {
-  // Do nothing
+  // Only reached without the observer being notified if the WorldNode is
+  // deleted directly rather than through its reference count
+  stopSimulationThread();
+  removeObserver(mSimulationThreadStopper.get());
 }
 
 //==============================================================================
@@ -283,18 +372,7 @@ void WorldNode::refreshShapeFrameNode(dart::dynamics::Frame* frame)
     node->refresh(true);
 
     // update the group that ShapeFrameNode should be
-    if ((!node->getShapeFrame()->hasVisualAspect()
-         || !node->getShapeFrame()->getVisualAspect(true)->getShadowed())
-        && node->getParent(0) != mNormalGroup) {
-      mShadowedGroup->removeChild(node);
-      mNormalGroup->addChild(node);
-    } else if (
-        node->getShapeFrame()->hasVisualAspect()
-        && node->getShapeFrame()->getVisualAspect(true)->getShadowed()
-        && node->getParent(0) != mShadowedGroup) {
-      mNormalGroup->removeChild(node);
-      mShadowedGroup->addChild(node);
-    }
+    refreshShapeFrameNodeGroup(node);
 
     return;
   }
@@ -318,6 +396,146 @@ void WorldNode::refreshShapeFrameNode(dart::dynamics::Frame* frame)
     mShadowedGroup->addChild(node);
 }
 
+//==============================================================================
+void WorldNode::refreshFromSnapshot(const simulation::WorldSnapshot& snapshot)
+{
+  // Updating the transforms does not touch the World, but reading the Shapes
+  // of new or modified ShapeFrames must not race with the simulation thread
+  bool accessesWorld = false;
+  for (const simulation::ShapeFrameSnapshot& frame :
+       snapshot.getShapeFrames()) {
+    const NodeMap::const_iterator it = mFrameToNode.find(frame.mShapeFrame);
+    if (it == mFrameToNode.end()
+        || (it->second && it->second->isOutdated(frame))) {
+      accessesWorld = true;
+      break;
+    }
+  }
+
+  std::unique_lock<std::mutex> lock(mWorldMutex, std::defer_lock);
+  if (accessesWorld)
+    lock.lock();
+
+  for (const simulation::ShapeFrameSnapshot& frame : snapshot.getShapeFrames())
+    refreshShapeFrameNode(frame);
+}
+
+//==============================================================================
+void WorldNode::refreshShapeFrameNode(
+    const simulation::ShapeFrameSnapshot& snapshot)
+{
+  std::pair<NodeMap::iterator, bool> insertion
+      = mFrameToNode.insert(std::make_pair(snapshot.mShapeFrame, nullptr));
+  NodeMap::iterator it = insertion.first;
+
+  if (!insertion.second) {
+    ShapeFrameNode* node = it->second;
+    if (!node)
+      return;
+
+    const bool outdated = node->isOutdated(snapshot);
+    node->refresh(snapshot);
+    if (outdated)
+      refreshShapeFrameNodeGroup(node);
+
+    return;
+  }
+
+  ::osg::ref_ptr<ShapeFrameNode> node = new ShapeFrameNode(snapshot, this);
+  it->second = node;
+  if (!node->getShapeFrame()->hasVisualAspect()
+      || !node->getShapeFrame()->getVisualAspect(true)->getShadowed()) {
+    mNormalGroup->addChild(node);
+  } else
+    mShadowedGroup->addChild(node);
+}
+
+//==============================================================================
+void WorldNode::refreshShapeFrameNodeGroup(ShapeFrameNode* node)
+{
+  if ((!node->getShapeFrame()->hasVisualAspect()
+       || !node->getShapeFrame()->getVisualAspect(true)->getShadowed())
+      && node->getParent(0) != mNormalGroup) {
+    mShadowedGroup->removeChild(node);
+    mNormalGroup->addChild(node);
+  } else if (
+      node->getShapeFrame()->hasVisualAspect()
+      && node->getShapeFrame()->getVisualAspect(true)->getShadowed()
+      && node->getParent(0) != mShadowedGroup) {
+    mNormalGroup->removeChild(node);
+    mShadowedGroup->addChild(node);
+  }
+}
+
+//==============================================================================
+void WorldNode::startSimulationThread()
+{
+  if (!mSimulationThreaded || !mSimulating || !mWorld
+      || mSimulationThread.joinable())
+    return;
+
+  mSnapshots.reset();
+  mStopSimulationThread.store(false, std::memory_order_release);
+  mSimulationThread = std::thread(&WorldNode::runSimulationThread, this);
+}
+
+//==============================================================================
+void WorldNode::stopSimulationThread()
+{
+  if (!mSimulationThread.joinable())
+    return;
+
+  mStopSimulationThread.store(true, std::memory_order_release);
+  mSimulationThread.join();
+}
+
+//==============================================================================
+void WorldNode::runSimulationThread()
+{
+  using Clock = std::chrono::steady_clock;
+
+  double startSimTime = 0.0;
+  {
+    std::lock_guard<std::mutex> lock(mWorldMutex);
+    mSnapshots.getWriteSnapshot().capture(*mWorld);
+    startSimTime = mWorld->getTime();
+  }
+  mSnapshots.publish();
+
+  Clock::time_point startRealTime = Clock::now();
+  while (!mStopSimulationThread.load(std::memory_order_acquire)) {
+    double simTime = 0.0;
+    {
+      std::lock_guard<std::mutex> lock(mWorldMutex);
+      const std::size_t numSteps
+          = std::max<std::size_t>(getNumStepsPerCycle(), 1);
+      for (std::size_t i = 0; i < numSteps; ++i) {
+        customPreStep();
+        mWorld->step();
+        customPostStep();
+      }
+
+      mSnapshots.getWriteSnapshot().capture(*mWorld);
+      simTime = mWorld->getTime();
+    }
+    mSnapshots.publish();
+
+    // Pace the simulation to real time. If it falls behind, continue from the
+    // current time instead of trying to catch up.
+    const Clock::time_point target
+        = startRealTime
+          + std::chrono::duration_cast<Clock::duration>(
+              std::chrono::duration<double>(simTime - startSimTime));
+    const Clock::time_point now = Clock::now();
+    if (now < target) {
+      std::this_thread::sleep_until(target);
+    } else if (now - target > std::chrono::milliseconds(100)) {
+      startRealTime = now;
+      startSimTime = simTime;
+    }
+  }
+}
+
 //==============================================================================
 bool WorldNode::isShadowed() const
 {
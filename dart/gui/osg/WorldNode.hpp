@@ -36,11 +36,17 @@
 #include <dart/gui/osg/Export.hpp>
 #include <dart/gui/osg/ShapeFrameNode.hpp>
 
+#include <dart/simulation/WorldSnapshot.hpp>
+
 #include <osg/Group>
+#include <osg/Observer>
 #include <osgShadow/ShadowTechnique>
 #include <osgShadow/ShadowedScene>
 
+#include <atomic>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
 
 namespace dart {
@@ -68,6 +74,7 @@ class DART_GUI_API WorldNode : public ::osg::Group
 {
 public:
   friend class Viewer;
+  friend class WorldNodeSimulationThreadStopper;
 
   /// Default constructor
   /// Shadows are disabled by default
@@ -106,6 +113,21 @@ public:
   /// operation.
   virtual void customPostRefresh();
 
+  /// Called instead of customPreRefresh() at the beginning of each rendering
+  /// cycle while the World is stepped on the background thread, before the
+  /// rendering data is refreshed from \c snapshot. It runs without
+  /// getWorldMutex(), so the simulation keeps stepping meanwhile. Read the
+  /// state from \c snapshot, or lock getWorldMutex() to access the World.
+  virtual void customPreSnapshotRefresh(
+      const simulation::WorldSnapshot& snapshot);
+
+  /// Called instead of customPostRefresh() at the end of each rendering cycle
+  /// while the World is stepped on the background thread, after the rendering
+  /// data is refreshed from \c snapshot. Like customPreSnapshotRefresh(), it
+  /// runs without getWorldMutex().
+  virtual void customPostSnapshotRefresh(
+      const simulation::WorldSnapshot& snapshot);
+
   /// If update() is not overloaded, this function will be called at the
   /// beginning of each simulation step. This function can be overloaded to
   /// customize the behavior of each step. The default behavior is to do
@@ -128,13 +150,46 @@ public:
   void simulate(bool on);
 
   /// Set the number of steps to take between each render cycle (only if the
-  /// simulation is not paused)
+  /// simulation is not paused). This does not wait for the background
+  /// simulation thread; it uses the new value from its next batch of steps.
   void setNumStepsPerCycle(std::size_t steps);
 
   /// Get the number of steps that will be taken between each render cycle (only
   /// if the simulation is not paused)
   std::size_t getNumStepsPerCycle() const;
 
+  /// Pass in true to step the World on a background thread while it is being
+  /// simulated instead of stepping it at the beginning of each render cycle.
+  ///
+  /// The background thread takes getNumStepsPerCycle() steps at a time, paced
+  /// to real time, and publishes a simulation::WorldSnapshot of the
+  /// ShapeFrames after each batch. refresh() then only applies the latest
+  /// snapshot, so a slow step does not stall the viewer and a slow frame does
+  /// not stall the simulation. The World is only accessed by the render
+  /// thread, under getWorldMutex(), when a ShapeFrame is added or its version
+  /// changes.
+  ///
+  /// While the background thread runs, customPreStep() and customPostStep()
+  /// are called on it. The render thread calls customPreSnapshotRefresh() and
+  /// customPostSnapshotRefresh() with the applied snapshot instead of
+  /// customPreRefresh() and customPostRefresh(), without locking
+  /// getWorldMutex(), so they never wait for a batch of steps unless they
+  /// lock it themselves. Any other code that accesses the World must lock
+  /// getWorldMutex(). Adding or removing frames while the World is simulated
+  /// in the background is not supported; pause the simulation first.
+  ///
+  /// The background thread is stopped when the last ::osg::ref_ptr to this
+  /// WorldNode is released, before the destructors of derived classes run.
+  void setSimulationThreaded(bool threaded);
+
+  /// Returns true if the World is stepped on a background thread while it is
+  /// being simulated
+  bool isSimulationThreaded() const;
+
+  /// Returns the mutex that the background thread holds while it steps the
+  /// World
+  std::mutex& getWorldMutex();
+
   /// Get whether the WorldNode is casting shadows
   bool isShadowed() const;
 
@@ -178,6 +233,26 @@ protected:
 
   void refreshShapeFrameNode(dart::dynamics::Frame* frame);
 
+  /// Refresh the rendering data from a snapshot published by the background
+  /// simulation thread
+  void refreshFromSnapshot(const simulation::WorldSnapshot& snapshot);
+
+  /// Refresh the node of a ShapeFrame from a snapshot
+  void refreshShapeFrameNode(const simulation::ShapeFrameSnapshot& snapshot);
+
+  /// Move the node of a ShapeFrame to the group that matches its shadowing
+  void refreshShapeFrameNodeGroup(ShapeFrameNode* node);
+
+  /// Start the background simulation thread if the World is simulated in the
+  /// background
+  void startSimulationThread();
+
+  /// Stop the background simulation thread, if it is running
+  void stopSimulationThread();
+
+  /// Main loop of the background simulation thread
+  void runSimulationThread();
+
   using NodeMap = std::
       unordered_map<dart::dynamics::Frame*, ::osg::ref_ptr<ShapeFrameNode>>;
 
@@ -190,8 +265,9 @@ protected:
   /// True iff simulation is active
   bool mSimulating;
 
-  /// Number of steps to take between rendering cycles
-  std::size_t mNumStepsPerCycle;
+  /// Number of steps to take between rendering cycles, which the background
+  /// simulation thread reads without locking
+  std::atomic<std::size_t> mNumStepsPerCycle;
 
   /// Viewer that this WorldNode is inside of
   Viewer* mViewer;
@@ -204,6 +280,25 @@ protected:
 
   /// Whether the shadows are enabled
   bool mShadowed;
+
+  /// Whether the World is stepped on a background thread
+  bool mSimulationThreaded;
+
+  /// Background simulation thread
+  std::thread mSimulationThread;
+
+  /// Asks the background simulation thread to exit
+  std::atomic<bool> mStopSimulationThread;
+
+  /// Held by the background simulation thread while it steps the World
+  std::mutex mWorldMutex;
+
+  /// Snapshots published by the background simulation thread
+  simulation::WorldSnapshotBuffer mSnapshots;
+
+  /// Stops the background simulation thread when this WorldNode is about to
+  /// be deleted
+  std::unique_ptr<::osg::Observer> mSimulationThreadStopper;
 };
 
 } // namespace osg
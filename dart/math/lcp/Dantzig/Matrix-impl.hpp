@@ -58,6 +58,8 @@
 #include "dart/common/Macros.hpp"
 #include "dart/math/lcp/Dantzig/Common.hpp"
 
+#include <algorithm>
+
 namespace dart::math::lcp {
 
 template <typename Scalar>
@@ -229,15 +231,17 @@ void dLDLTAddTL(
     const Scalar* a,
     int n,
     int nskip,
-    void* tmpbuf /*[2*nskip]*/)
+    void* tmpbuf /*[4*nskip]*/)
 {
   DART_ASSERT(L && d && a && n > 0 && nskip >= n);
 
   if (n < 2)
     return;
   Scalar* W1 = tmpbuf ? (Scalar*)tmpbuf
-                      : (Scalar*)ALLOCA((2 * nskip) * sizeof(Scalar));
+                      : (Scalar*)ALLOCA((4 * nskip) * sizeof(Scalar));
   Scalar* W2 = W1 + nskip;
+  Scalar* G1 = W2 + nskip;
+  Scalar* G2 = G1 + nskip;
 
   W1[0] = static_cast<Scalar>(0.0);
   W2[0] = static_cast<Scalar>(0.0);
@@ -252,6 +256,8 @@ void dLDLTAddTL(
   Scalar alpha1 = static_cast<Scalar>(1.0);
   Scalar alpha2 = static_cast<Scalar>(1.0);
 
+  Scalar k1;
+  Scalar k2;
   {
     Scalar dee = d[0];
     Scalar alphanew = alpha1 + (W11 * W11) * dee;
@@ -263,47 +269,51 @@ void dLDLTAddTL(
     alphanew = alpha2 - (W21 * W21) * dee;
     dee /= alphanew;
     alpha2 = alphanew;
-    Scalar k1 = static_cast<Scalar>(1.0) - W21 * gamma1;
-    Scalar k2 = W21 * gamma1 * W11 - W21;
-    Scalar* ll = L + nskip;
-    for (int p = 1; p < n; ll += nskip, ++p) {
-      Scalar Wp = W1[p];
-      Scalar ell = *ll;
-      W1[p] = Wp - W11 * ell;
-      W2[p] = k1 * Wp + k2 * ell;
-    }
+    k1 = static_cast<Scalar>(1.0) - W21 * gamma1;
+    k2 = W21 * gamma1 * W11 - W21;
   }
 
-  Scalar* ll = L + (nskip + 1);
-  for (int j = 1; j < n; ll += nskip + 1, ++j) {
-    Scalar k1 = W1[j];
-    Scalar k2 = W2[j];
+  // The rank-2 update of column j needs W1[j] and W2[j] after the updates of
+  // all the columns left of it, so the columns must be processed in order.
+  // Walking L row by row instead of column by column applies the same
+  // operations to every element in the same order while reading the rows of
+  // L contiguously: once row p has been updated by the columns left of it,
+  // W1[p] and W2[p] are final and yield the coefficients of column p.
+  Scalar* ll = L + nskip;
+  for (int p = 1; p < n; ll += nskip, ++p) {
+    Scalar Wp1 = W1[p];
+    Scalar Wp2;
+    {
+      const Scalar ell = ll[0];
+      Wp2 = k1 * Wp1 + k2 * ell;
+      Wp1 -= W11 * ell;
+    }
+
+    for (int j = 1; j < p; ++j) {
+      Scalar ell = ll[j];
+      Wp1 -= W1[j] * ell;
+      ell += G1[j] * Wp1;
+      Wp2 -= W2[j] * ell;
+      ell -= G2[j] * Wp2;
+      ll[j] = ell;
+    }
+
+    W1[p] = Wp1;
+    W2[p] = Wp2;
 
-    Scalar dee = d[j];
-    Scalar alphanew = alpha1 + (k1 * k1) * dee;
+    Scalar dee = d[p];
+    Scalar alphanew = alpha1 + (Wp1 * Wp1) * dee;
     DART_ASSERT(alphanew != Scalar(0.0));
     dee /= alphanew;
-    Scalar gamma1 = k1 * dee;
+    G1[p] = Wp1 * dee;
     dee *= alpha1;
     alpha1 = alphanew;
-    alphanew = alpha2 - (k2 * k2) * dee;
+    alphanew = alpha2 - (Wp2 * Wp2) * dee;
     dee /= alphanew;
-    Scalar gamma2 = k2 * dee;
+    G2[p] = Wp2 * dee;
     dee *= alpha2;
-    d[j] = dee;
+    d[p] = dee;
     alpha2 = alphanew;
-
-    Scalar* l = ll + nskip;
-    for (int p = j + 1; p < n; l += nskip, ++p) {
-      Scalar ell = *l;
-      Scalar Wp = W1[p] - k1 * ell;
-      ell += gamma1 * Wp;
-      W1[p] = Wp;
-      Wp = W2[p] - k2 * ell;
-      ell -= gamma2 * Wp;
-      W2[p] = Wp;
-      *l = ell;
-    }
   }
 }
 
@@ -1180,6 +1190,115 @@ void _dSolveL1T(const Scalar* L, Scalar* B, int n, int lskip1)
   }
 }
 
+//==============================================================================
+// Cache-blocked LDLT factorization and triangular solvers
+//==============================================================================
+// The hand-unrolled ODE kernels above stream the whole factor for every row,
+// which falls out of L1 once the active set grows past a few dozen contacts.
+// The blocked variants below split the matrix into LDLT_BLOCK_SIZE panels:
+// the off-diagonal work becomes Eigen GEMV/TRSM/dot calls (vectorized with
+// whatever SIMD the build enables, e.g. AVX2 or NEON), and the small diagonal
+// blocks are still handled by the ODE kernels. Results agree with the scalar
+// kernels up to floating-point summation order.
+//==============================================================================
+
+// Panel width of the blocked kernels
+constexpr int LDLT_BLOCK_SIZE = 32;
+
+// Dimension from which the blocked kernels are used. Below this the unrolled
+// ODE kernels are faster since the panels are too short to amortize Eigen's
+// setup cost.
+constexpr int LDLT_BLOCKED_THRESHOLD = 64;
+
+// Blocked LDLT factorization (same storage convention as _dFactorLDLT: L in
+// the strict lower triangle of A, d holds the reciprocals of D)
+template <typename Scalar>
+void _dFactorLDLTBlocked(Scalar* A, Scalar* d, int n, int nskip1)
+{
+  using Matrix
+      = Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+  using MatrixMap = Eigen::Map<Matrix, 0, Eigen::OuterStride<>>;
+  using ConstMatrixMap = Eigen::Map<const Matrix, 0, Eigen::OuterStride<>>;
+  using RowVector = Eigen::Matrix<Scalar, 1, Eigen::Dynamic>;
+
+  for (int k = 0; k < n; k += LDLT_BLOCK_SIZE) {
+    const int bs = std::min(LDLT_BLOCK_SIZE, n - k);
+    Scalar* Akk = A + k * nskip1 + k;
+
+    if (k > 0) {
+      const ConstMatrixMap L11(A, k, k, Eigen::OuterStride<>(nskip1));
+      MatrixMap panel(A + k * nskip1, bs, k, Eigen::OuterStride<>(nskip1));
+      const Eigen::Map<const RowVector> dinv(d, k);
+
+      // Z = A21 * L11^-T, i.e. Z = L21 * D11
+      L11.transpose()
+          .template triangularView<Eigen::UnitUpper>()
+          .template solveInPlace<Eigen::OnTheRight>(panel);
+
+      // A22 -= L21 * D11 * L21^T = L21 * Z^T (lower triangle only). Rows are
+      // visited bottom-up so that row c < r still holds Z when row r, already
+      // scaled to L21, is dotted against it.
+      for (int r = bs - 1; r >= 0; --r) {
+        auto row = panel.row(r);
+        Akk[r * nskip1 + r] -= row.cwiseProduct(dinv).dot(row);
+        row.array() *= dinv.array();
+        for (int c = 0; c < r; ++c) {
+          Akk[r * nskip1 + c] -= row.dot(panel.row(c));
+        }
+      }
+    }
+
+    _dFactorLDLT(Akk, d + k, bs, nskip1);
+  }
+}
+
+// Blocked solve of L * X = B (L unit lower triangular)
+template <typename Scalar>
+void _dSolveL1Blocked(const Scalar* L, Scalar* B, int n, int lskip1)
+{
+  using Matrix
+      = Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+  using ConstMatrixMap = Eigen::Map<const Matrix, 0, Eigen::OuterStride<>>;
+  using Vector = Eigen::Matrix<Scalar, Eigen::Dynamic, 1>;
+
+  for (int k = 0; k < n; k += LDLT_BLOCK_SIZE) {
+    const int bs = std::min(LDLT_BLOCK_SIZE, n - k);
+    if (k > 0) {
+      const ConstMatrixMap panel(
+          L + k * lskip1, bs, k, Eigen::OuterStride<>(lskip1));
+      Eigen::Map<Vector>(B + k, bs).noalias()
+          -= panel * Eigen::Map<const Vector>(B, k);
+    }
+    _dSolveL1(L + k * lskip1 + k, B + k, bs, lskip1);
+  }
+}
+
+// Blocked solve of L^T * X = B (L unit lower triangular)
+template <typename Scalar>
+void _dSolveL1TBlocked(const Scalar* L, Scalar* B, int n, int lskip1)
+{
+  using Matrix
+      = Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+  using ConstMatrixMap = Eigen::Map<const Matrix, 0, Eigen::OuterStride<>>;
+  using Vector = Eigen::Matrix<Scalar, Eigen::Dynamic, 1>;
+
+  if (n < 1)
+    return;
+
+  for (int k = ((n - 1) / LDLT_BLOCK_SIZE) * LDLT_BLOCK_SIZE; k >= 0;
+       k -= LDLT_BLOCK_SIZE) {
+    const int bs = std::min(LDLT_BLOCK_SIZE, n - k);
+    const int tail = n - k - bs;
+    if (tail > 0) {
+      const ConstMatrixMap panel(
+          L + (k + bs) * lskip1 + k, tail, bs, Eigen::OuterStride<>(lskip1));
+      Eigen::Map<Vector>(B + k, bs).noalias()
+          -= panel.transpose() * Eigen::Map<const Vector>(B + k + bs, tail);
+    }
+    _dSolveL1T(L + k * lskip1 + k, B + k, bs, lskip1);
+  }
+}
+
 //==============================================================================
 // Non-template wrappers for backward compatibility
 //==============================================================================
@@ -1187,19 +1306,31 @@ void _dSolveL1T(const Scalar* L, Scalar* B, int n, int lskip1)
 template <typename Scalar>
 void dFactorLDLT(Scalar* A, Scalar* d, int n, int nskip)
 {
-  _dFactorLDLT(A, d, n, nskip);
+  if (n >= LDLT_BLOCKED_THRESHOLD) {
+    _dFactorLDLTBlocked(A, d, n, nskip);
+  } else {
+    _dFactorLDLT(A, d, n, nskip);
+  }
 }
 
 template <typename Scalar>
 void dSolveL1(const Scalar* L, Scalar* b, int n, int nskip)
 {
-  _dSolveL1(L, b, n, nskip);
+  if (n >= LDLT_BLOCKED_THRESHOLD) {
+    _dSolveL1Blocked(L, b, n, nskip);
+  } else {
+    _dSolveL1(L, b, n, nskip);
+  }
 }
 
 template <typename Scalar>
 void dSolveL1T(const Scalar* L, Scalar* b, int n, int nskip)
 {
-  _dSolveL1T(L, b, n, nskip);
+  if (n >= LDLT_BLOCKED_THRESHOLD) {
+    _dSolveL1TBlocked(L, b, n, nskip);
+  } else {
+    _dSolveL1T(L, b, n, nskip);
+  }
 }
 
 //==============================================================================
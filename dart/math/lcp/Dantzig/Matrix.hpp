@@ -282,7 +282,7 @@ inline constexpr size_t dEstimateIsPositiveDefiniteTmpbufSize(int n)
 template <typename Scalar>
 inline constexpr size_t dEstimateLDLTAddTLTmpbufSize(int nskip)
 {
-  return nskip * 2 * sizeof(Scalar);
+  return nskip * 4 * sizeof(Scalar);
 }
 
 template <typename Scalar>
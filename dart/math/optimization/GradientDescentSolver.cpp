@@ -473,5 +473,11 @@ std::size_t GradientDescentSolver::getLastNumIterations() const
   return mLastNumIterations;
 }
 
+//==============================================================================
+void GradientDescentSolver::setRandomSeed(std::uint_fast32_t _seed)
+{
+  mMT.seed(_seed);
+}
+
 } // namespace math
 } // namespace dart
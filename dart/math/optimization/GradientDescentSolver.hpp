@@ -39,6 +39,8 @@
 
 #include <random>
 
+#include <cstdint>
+
 namespace dart {
 namespace math {
 
@@ -210,6 +212,10 @@ public:
   /// Get the number of iterations used in the last attempt to solve the problem
   std::size_t getLastNumIterations() const;
 
+  /// Reseed the random number generator used to randomize and perturb
+  /// configurations, which is seeded from std::random_device by default
+  void setRandomSeed(std::uint_fast32_t _seed);
+
 protected:
   /// GradientDescentSolver properties
   UniqueProperties mGradientP;
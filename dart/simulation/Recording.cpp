@@ -38,7 +38,10 @@
 
 #include "dart/simulation/Recording.hpp"
 
+#include "dart/common/Logging.hpp"
+#include "dart/common/Macros.hpp"
 #include "dart/dynamics/Skeleton.hpp"
+#include "dart/simulation/detail/RecordingFile.hpp"
 
 #include <iostream>
 
@@ -47,6 +50,7 @@ namespace simulation {
 
 //==============================================================================
 Recording::Recording(const std::vector<dynamics::SkeletonPtr>& _skeletons)
+  : mFramesEnd(0u), mIsLoaded(false)
 {
   for (std::size_t i = 0; i < _skeletons.size(); i++)
     mNumGenCoordsForSkeletons.push_back(_skeletons[i]->getNumDofs());
@@ -54,18 +58,23 @@ Recording::Recording(const std::vector<dynamics::SkeletonPtr>& _skeletons)
 
 //==============================================================================
 Recording::Recording(const std::vector<int>& _skelDofs)
+  : mFramesEnd(0u), mIsLoaded(false)
 {
   for (std::size_t i = 0; i < _skelDofs.size(); i++)
     mNumGenCoordsForSkeletons.push_back(_skelDofs[i]);
 }
 
 //==============================================================================
-Recording::~Recording() {}
+Recording::~Recording()
+{
+  if (mFileWriter)
+    closeFile();
+}
 
 //==============================================================================
 int Recording::getNumFrames() const
 {
-  return mBakedStates.size();
+  return static_cast<int>(mFrameOffsets.size() + mBakedStates.size());
 }
 
 //==============================================================================
@@ -83,57 +92,118 @@ int Recording::getNumDofs(int _skelIdx) const
 //==============================================================================
 int Recording::getNumContacts(int _frameIdx) const
 {
-  int totalDofs = 0;
-  for (std::size_t i = 0; i < mNumGenCoordsForSkeletons.size(); i++)
-    totalDofs += mNumGenCoordsForSkeletons[i];
-  return (mBakedStates[_frameIdx].size() - totalDofs) / 6;
+  const int numValues = getFrame(_frameIdx).size();
+  if (numValues < getTotalNumDofs())
+    return 0;
+
+  return (numValues - getTotalNumDofs()) / 6;
 }
 
 //==============================================================================
 Eigen::VectorXd Recording::getConfig(int _frameIdx, int _skelIdx) const
 {
+  if (_skelIdx < 0 || _skelIdx >= getNumSkeletons()) {
+    DART_WARN(
+        "Skeleton index [{}] is out of range [0, {}). Returning an empty "
+        "configuration.",
+        _skelIdx,
+        getNumSkeletons());
+    return Eigen::VectorXd();
+  }
+
   int index = 0;
   for (int i = 0; i < _skelIdx; i++)
     index += mNumGenCoordsForSkeletons[i];
-  return mBakedStates[_frameIdx].segment(index, getNumDofs(_skelIdx));
+
+  const int numDofs = getNumDofs(_skelIdx);
+  const auto config = getFrameSegment(_frameIdx, index, numDofs);
+  if (config.size() != numDofs)
+    return Eigen::VectorXd::Zero(numDofs);
+
+  return config;
 }
 
 //==============================================================================
 double Recording::getGenCoord(int _frameIdx, int _skelIdx, int _dofIdx) const
 {
+  if (_skelIdx < 0 || _skelIdx >= getNumSkeletons() || _dofIdx < 0
+      || _dofIdx >= getNumDofs(_skelIdx)) {
+    DART_WARN(
+        "Invalid skeleton index [{}] or DOF index [{}]. Returning 0.",
+        _skelIdx,
+        _dofIdx);
+    return 0.0;
+  }
+
   int index = 0;
   for (int i = 0; i < _skelIdx; i++)
     index += mNumGenCoordsForSkeletons[i];
-  return mBakedStates[_frameIdx][index + _dofIdx];
+
+  const auto genCoord = getFrameSegment(_frameIdx, index + _dofIdx, 1);
+  return genCoord.size() == 1 ? genCoord[0] : 0.0;
 }
 
 //==============================================================================
 Eigen::Vector3d Recording::getContactPoint(int _frameIdx, int _contactIdx) const
 {
-  int totalDofs = 0;
-  for (std::size_t i = 0; i < mNumGenCoordsForSkeletons.size(); i++)
-    totalDofs += mNumGenCoordsForSkeletons[i];
-  return mBakedStates[_frameIdx].segment(totalDofs + _contactIdx * 6, 3);
+  if (_contactIdx < 0 || _contactIdx >= getNumContacts(_frameIdx)) {
+    DART_WARN(
+        "Contact index [{}] is out of range for frame [{}]. Returning zero.",
+        _contactIdx,
+        _frameIdx);
+    return Eigen::Vector3d::Zero();
+  }
+
+  return getFrameSegment(_frameIdx, getTotalNumDofs() + _contactIdx * 6, 3);
 }
 
 //==============================================================================
 Eigen::Vector3d Recording::getContactForce(int _frameIdx, int _contactIdx) const
 {
-  int totalDofs = 0;
-  for (std::size_t i = 0; i < mNumGenCoordsForSkeletons.size(); i++)
-    totalDofs += mNumGenCoordsForSkeletons[i];
-  return mBakedStates[_frameIdx].segment(totalDofs + _contactIdx * 6 + 3, 3);
+  if (_contactIdx < 0 || _contactIdx >= getNumContacts(_frameIdx)) {
+    DART_WARN(
+        "Contact index [{}] is out of range for frame [{}]. Returning zero.",
+        _contactIdx,
+        _frameIdx);
+    return Eigen::Vector3d::Zero();
+  }
+
+  return getFrameSegment(
+      _frameIdx, getTotalNumDofs() + _contactIdx * 6 + 3, 3);
 }
 
 //==============================================================================
 void Recording::clear()
 {
   mBakedStates.clear();
+  mMappedFile.reset();
+  mFrameOffsets.clear();
+  mFramesEnd = 0u;
+  mIsLoaded = false;
+
+  // Restart the file
+  if (mFileWriter) {
+    mFileWriter.reset();
+    openFile(mFilename);
+  }
 }
 
 //==============================================================================
 void Recording::addState(const Eigen::VectorXd& _state)
 {
+  if (mIsLoaded) {
+    DART_WARN("Attempting to add a frame to a loaded recording. Ignoring.");
+    return;
+  }
+
+  if (mFileWriter) {
+    const auto numContacts = (_state.size() - getTotalNumDofs()) / 6;
+    const std::uint64_t offset = mFileWriter->write(_state, numContacts);
+    mFrameOffsets.push_back(offset);
+    mFramesEnd = offset + sizeof(double) * (_state.size() + 1);
+    return;
+  }
+
   mBakedStates.push_back(_state);
 }
 
@@ -146,5 +216,174 @@ void Recording::updateNumGenCoords(
     mNumGenCoordsForSkeletons.push_back(_skeletons[i]->getNumDofs());
 }
 
+//==============================================================================
+bool Recording::openFile(const std::string& _filename)
+{
+  if (mIsLoaded) {
+    DART_WARN("Attempting to stream a loaded recording to [{}]. Ignoring.",
+        _filename);
+    return false;
+  }
+
+  if (mFileWriter)
+    closeFile();
+
+  // Copy the frames of a closed file back to memory, as the new file may
+  // replace it
+  if (!mFrameOffsets.empty()) {
+    std::vector<Eigen::VectorXd> states;
+    states.reserve(getNumFrames());
+    for (int i = 0; i < getNumFrames(); ++i)
+      states.emplace_back(getFrame(i));
+    mBakedStates = std::move(states);
+    mMappedFile.reset();
+    mFrameOffsets.clear();
+  }
+
+  mFileWriter = detail::RecordingFileWriter::create(_filename);
+  if (!mFileWriter)
+    return false;
+
+  mFilename = _filename;
+
+  // Move the frames recorded in memory to the file
+  for (const auto& state : mBakedStates)
+    addState(state);
+  mBakedStates.clear();
+
+  return true;
+}
+
+//==============================================================================
+bool Recording::closeFile()
+{
+  if (!mFileWriter)
+    return false;
+
+  mMappedFile.reset();
+  const bool success
+      = mFileWriter->close(mNumGenCoordsForSkeletons, mFrameOffsets);
+  mFileWriter.reset();
+
+  // Keep the written frames accessible through a mapping of the closed file
+  if (success)
+    mMappedFile = common::detail::MappedFile::open(mFilename);
+  else
+    DART_WARN("Failed to write recording file [{}].", mFilename);
+
+  if (!mMappedFile || mMappedFile->getSize() < mFramesEnd) {
+    DART_WARN(
+        "Dropping the frames of recording file [{}], which can't be read back.",
+        mFilename);
+    mMappedFile.reset();
+    mFrameOffsets.clear();
+  }
+
+  return success;
+}
+
+//==============================================================================
+bool Recording::isFileOpen() const
+{
+  return mFileWriter != nullptr;
+}
+
+//==============================================================================
+std::unique_ptr<Recording> Recording::loadFile(const std::string& _filename)
+{
+  auto mappedFile = common::detail::MappedFile::open(_filename);
+  detail::RecordingFileIndex index;
+  if (!mappedFile || !detail::readRecordingFileIndex(*mappedFile, index)) {
+    DART_WARN("Failed to load recording file [{}].", _filename);
+    return nullptr;
+  }
+
+  auto recording = std::make_unique<Recording>(index.numDofs);
+  recording->mFilename = _filename;
+  recording->mMappedFile = std::move(mappedFile);
+  recording->mFrameOffsets = std::move(index.frameOffsets);
+  recording->mFramesEnd = index.framesEnd;
+  recording->mIsLoaded = true;
+
+  return recording;
+}
+
+//==============================================================================
+Eigen::Map<const Eigen::VectorXd> Recording::getFrame(int _frameIdx) const
+{
+  if (_frameIdx < 0 || _frameIdx >= getNumFrames()) {
+    DART_WARN(
+        "Frame index [{}] is out of range [0, {}).",
+        _frameIdx,
+        getNumFrames());
+    return Eigen::Map<const Eigen::VectorXd>(nullptr, 0);
+  }
+
+  const auto index = static_cast<std::size_t>(_frameIdx);
+
+  // The frames added after closing a file are kept in memory
+  if (index >= mFrameOffsets.size()) {
+    const Eigen::VectorXd& state = mBakedStates[index - mFrameOffsets.size()];
+    return Eigen::Map<const Eigen::VectorXd>(state.data(), state.size());
+  }
+
+  // A frame ends where the next one begins. The first word holds the number
+  // of contacts, which the frame size already accounts for.
+  const std::uint64_t begin = mFrameOffsets[index];
+  const std::uint64_t end = index + 1 < mFrameOffsets.size()
+                                ? mFrameOffsets[index + 1]
+                                : mFramesEnd;
+
+  // Map the frames written since the last mapping
+  if (mFileWriter && (!mMappedFile || mMappedFile->getSize() < end)) {
+    mMappedFile.reset();
+    mFileWriter->flush();
+    mMappedFile = common::detail::MappedFile::open(mFilename);
+  }
+
+  if (!mMappedFile || mMappedFile->getSize() < end) {
+    DART_WARN(
+        "Failed to read frame [{}] from recording file [{}].",
+        _frameIdx,
+        mFilename);
+    return Eigen::Map<const Eigen::VectorXd>(nullptr, 0);
+  }
+
+  return Eigen::Map<const Eigen::VectorXd>(
+      reinterpret_cast<const double*>(mMappedFile->getData() + begin) + 1,
+      static_cast<Eigen::Index>((end - begin) / sizeof(double) - 1));
+}
+
+//==============================================================================
+Eigen::Map<const Eigen::VectorXd> Recording::getFrameSegment(
+    int _frameIdx, int _start, int _size) const
+{
+  const auto frame = getFrame(_frameIdx);
+  if (_start < 0 || _start + _size > frame.size()) {
+    // getFrame() has already warned if the frame itself could not be read
+    if (frame.size() > 0) {
+      DART_WARN(
+          "Entries [{}, {}) are out of range of frame [{}], which has [{}] "
+          "entries.",
+          _start,
+          _start + _size,
+          _frameIdx,
+          frame.size());
+    }
+    return Eigen::Map<const Eigen::VectorXd>(nullptr, 0);
+  }
+
+  return Eigen::Map<const Eigen::VectorXd>(frame.data() + _start, _size);
+}
+
+//==============================================================================
+int Recording::getTotalNumDofs() const
+{
+  int totalDofs = 0;
+  for (std::size_t i = 0; i < mNumGenCoordsForSkeletons.size(); i++)
+    totalDofs += mNumGenCoordsForSkeletons[i];
+  return totalDofs;
+}
+
 } // namespace simulation
 } // namespace dart
@@ -45,16 +45,28 @@
 
 #include <Eigen/Dense>
 
+#include <memory>
+#include <string>
 #include <vector>
 
+#include <cstdint>
+
 namespace dart {
 
+namespace common::detail {
+class MappedFile;
+} // namespace common::detail
+
 namespace dynamics {
 class Skeleton;
 } // namespace dynamics
 
 namespace simulation {
 
+namespace detail {
+class RecordingFileWriter;
+} // namespace detail
+
 /// \brief class Recording
 class DART_API Recording
 {
@@ -97,7 +109,8 @@ public:
   /// _frameIdx
   Eigen::Vector3d getContactForce(int _frameIdx, int _contactIdx) const;
 
-  /// \brief Clear the saved histories
+  /// \brief Clear the saved histories. The file is truncated if the frames
+  /// are streamed to a file.
   void clear();
 
   /// \brief Add state
@@ -106,12 +119,78 @@ public:
   /// \brief Update list for number of generalized coordinates
   void updateNumGenCoords(const std::vector<dynamics::SkeletonPtr>& _skeletons);
 
+  /// \brief Streams the frames to a file instead of keeping them in memory
+  ///
+  /// The frames recorded so far and the ones added later are written by a
+  /// background thread, so addState() only copies the frame into a queue.
+  /// The frames remain accessible through the getters, which read them from
+  /// a memory mapping of the file. See closeFile() for finalizing the file.
+  ///
+  /// \return False if the file cannot be created
+  bool openFile(const std::string& _filename);
+
+  /// \brief Writes the remaining frames and the frame index, and closes the
+  /// file opened by openFile()
+  ///
+  /// The written frames remain accessible through a memory mapping of the
+  /// closed file, and the frames added afterwards are kept in memory. A later
+  /// openFile() copies the mapped frames back to memory before creating the
+  /// new file, which may replace the closed one.
+  ///
+  /// \return False if writing the file failed
+  bool closeFile();
+
+  /// \brief Returns true if the frames are streamed to a file
+  bool isFileOpen() const;
+
+  /// \brief Loads the frames of a file written by openFile()
+  ///
+  /// The file is memory-mapped, so the frames are read on demand instead of
+  /// being copied into memory. New frames can't be added to the returned
+  /// Recording.
+  ///
+  /// \return nullptr if the file is not a complete recording file
+  static std::unique_ptr<Recording> loadFile(const std::string& _filename);
+
 private:
+  /// \brief Returns the frame at _frameIdx, which consists of the generalized
+  /// coordinates followed by the contact points and forces
+  Eigen::Map<const Eigen::VectorXd> getFrame(int _frameIdx) const;
+
+  /// \brief Returns _size entries of the frame at _frameIdx starting at
+  /// _start, or an empty map with a warning if the frame cannot be read or is
+  /// too short
+  Eigen::Map<const Eigen::VectorXd> getFrameSegment(
+      int _frameIdx, int _start, int _size) const;
+
+  /// \brief Returns the sum of the number of generalized coordinates
+  int getTotalNumDofs() const;
+
   /// \brief Baked states
   std::vector<Eigen::VectorXd> mBakedStates;
 
   /// \brief Number of generalized coordinates for skeletons
   std::vector<int> mNumGenCoordsForSkeletons;
+
+  /// \brief Name of the file that holds the frames
+  std::string mFilename;
+
+  /// \brief Writer of the file. nullptr if the frames are not streamed.
+  std::unique_ptr<detail::RecordingFileWriter> mFileWriter;
+
+  /// \brief Memory mapping of the file. Remapped when frames beyond the
+  /// mapped range are accessed while streaming.
+  mutable std::unique_ptr<common::detail::MappedFile> mMappedFile;
+
+  /// \brief Byte offsets of the frames in the file. The frames in
+  /// mBakedStates follow them.
+  std::vector<std::uint64_t> mFrameOffsets;
+
+  /// \brief Byte offset of the end of the last frame in the file
+  std::uint64_t mFramesEnd;
+
+  /// \brief Whether the frames are read from a file loaded by loadFile()
+  bool mIsLoaded;
 };
 
 } // namespace simulation
@@ -40,6 +40,8 @@
 
 #include "dart/collision/CollisionDetector.hpp"
 #include "dart/collision/CollisionGroup.hpp"
+#include "dart/collision/CollisionObject.hpp"
+#include "dart/collision/CollisionResult.hpp"
 #include "dart/collision/fcl/FCLCollisionDetector.hpp"
 #include "dart/common/Logging.hpp"
 #include "dart/common/Macros.hpp"
@@ -47,13 +49,19 @@
 #include "dart/common/String.hpp"
 #include "dart/constraint/BoxedLcpConstraintSolver.hpp"
 #include "dart/constraint/ConstrainedGroup.hpp"
+#include "dart/dynamics/BodyNode.hpp"
+#include "dart/dynamics/DegreeOfFreedom.hpp"
+#include "dart/dynamics/ShapeNode.hpp"
 #include "dart/dynamics/Skeleton.hpp"
 
 #include <iostream>
+#include <numeric>
 #include <string>
 #include <vector>
 
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 
 namespace dart {
 namespace simulation {
@@ -152,6 +160,97 @@ CollisionDetectorPtr resolveCollisionDetector(const WorldConfig& config)
   return nullptr;
 }
 
+/// Version of the layout of the buffers written by World::saveCheckpoint()
+constexpr std::uint64_t checkpointVersion = 1u;
+
+/// Leading record of a checkpoint
+struct CheckpointHeader
+{
+  std::uint64_t version;
+  std::uint64_t numSkeletons;
+  std::uint64_t warmStartDataSize;
+  double time;
+  std::int64_t frame;
+};
+
+/// Record of a skeleton in a checkpoint. The records of all the skeletons
+/// follow the header, then the values of each skeleton, then the warm start
+/// data of the constraint solver.
+struct CheckpointSkeleton
+{
+  std::uint64_t numDofs;
+  std::uint64_t numBodyNodes;
+  std::uint64_t restingSteps;
+  std::uint32_t sleeping;
+  std::uint32_t asleep;
+};
+
+/// Returns the record of \c skel. \c asleep tells whether the World put the
+/// skeleton to sleep, and \c hasSnapshot whether the state remembered then
+/// still matches its structure.
+CheckpointSkeleton makeCheckpointSkeleton(
+    const dynamics::Skeleton& skel,
+    std::size_t restingSteps,
+    bool asleep,
+    bool hasSnapshot)
+{
+  CheckpointSkeleton record;
+  record.numDofs = skel.getNumDofs();
+  record.numBodyNodes = skel.getNumBodyNodes();
+
+  if (asleep && !hasSnapshot) {
+    // Restructured while asleep, so saved as woken up like the next step
+    // would do
+    record.restingSteps = 0u;
+    record.sleeping = false;
+    record.asleep = false;
+  } else {
+    record.restingSteps = restingSteps;
+    record.sleeping = skel.isSleeping();
+    record.asleep = asleep;
+  }
+
+  return record;
+}
+
+/// Returns the number of values of a skeleton in a checkpoint: the position,
+/// velocity, acceleration, force and command of each DOF and the external
+/// force of each BodyNode, followed by the state remembered when the
+/// skeleton was put to sleep, if it is asleep
+std::size_t getNumCheckpointValues(const CheckpointSkeleton& record)
+{
+  std::size_t numValues = 5u * record.numDofs + 6u * record.numBodyNodes;
+  if (record.asleep)
+    numValues += 3u * record.numDofs + 6u * record.numBodyNodes;
+  return numValues;
+}
+
+template <typename T>
+void writeCheckpoint(std::byte*& out, const T& value)
+{
+  std::memcpy(out, &value, sizeof(T));
+  out += sizeof(T);
+}
+
+template <typename T>
+void readCheckpoint(const std::byte*& in, T& value)
+{
+  std::memcpy(&value, in, sizeof(T));
+  in += sizeof(T);
+}
+
+void writeCheckpoint(std::byte*& out, const double* values, std::size_t count)
+{
+  std::memcpy(out, values, sizeof(double) * count);
+  out += sizeof(double) * count;
+}
+
+void readCheckpoint(const std::byte*& in, double* values, std::size_t count)
+{
+  std::memcpy(values, in, sizeof(double) * count);
+  in += sizeof(double) * count;
+}
+
 } // namespace
 
 //==============================================================================
@@ -178,6 +277,9 @@ World::World(const WorldConfig& config)
     mTimeStep(0.001),
     mTime(0.0),
     mFrame(0),
+    mSleepingEnabled(false),
+    mSleepEnergyThreshold(1e-4),
+    mSleepStepCount(60u),
     mRecording(new Recording(mSkeletons)),
     onNameChanged(mNameChangedSignal)
 {
@@ -193,6 +295,13 @@ World::World(const WorldConfig& config)
 //==============================================================================
 World::~World()
 {
+  // Sleeping skeletons would otherwise stay frozen once detached from this
+  // World
+  for (std::size_t i = 0; i < mSkeletons.size(); ++i) {
+    if (mSleepStates[i].mAsleep)
+      wakeUpSkeleton(i);
+  }
+
   delete mRecording;
 
   for (common::Connection& connection : mNameConnectionsForSkeletons)
@@ -209,12 +318,23 @@ WorldPtr World::clone() const
 
   worldClone->setGravity(mGravity);
   worldClone->setTimeStep(mTimeStep);
+  worldClone->setSleepingEnabled(mSleepingEnabled);
+  worldClone->setSleepEnergyThreshold(mSleepEnergyThreshold);
+  worldClone->setSleepStepCount(mSleepStepCount);
+  worldClone->setNumThreads(getNumThreads());
 
   auto cd = getConstraintSolver()->getCollisionDetector();
   if (cd) {
     worldClone->setCollisionDetector(cd->cloneWithoutCollisionObjects());
   }
 
+  // Copy the settings of the constraint solver, but not the skeletons and
+  // constraints of this World, which the clone replaces with its own
+  constraint::ConstraintSolver* solver = worldClone->getConstraintSolver();
+  solver->setFromOtherConstraintSolver(*mConstraintSolver);
+  solver->removeAllSkeletons();
+  solver->removeAllConstraints();
+
   // Clone and add each Skeleton
   for (std::size_t i = 0; i < mSkeletons.size(); ++i) {
     worldClone->addSkeleton(mSkeletons[i]->cloneSkeleton());
@@ -281,16 +401,19 @@ void World::step(bool _resetCommand)
 {
   DART_PROFILE_FRAME;
 
+  if (mSleepingEnabled)
+    wakeUpChangedSkeletons();
+
   // Integrate velocity for unconstrained skeletons
   {
     DART_PROFILE_SCOPED_N("World::step - Integrate velocity");
-    for (auto& skel : mSkeletons) {
-      if (!skel->isMobile())
-        continue;
+    processSkeletons([this](dynamics::Skeleton& skel) {
+      if (!skel.isMobile() || skel.isSleeping())
+        return;
 
-      skel->computeForwardDynamics();
-      skel->integrateVelocities(mTimeStep);
-    }
+      skel.computeForwardDynamics();
+      skel.integrateVelocities(mTimeStep);
+    });
   }
 
   // Detect activated constraints and compute constraint impulses
@@ -300,22 +423,37 @@ void World::step(bool _resetCommand)
   }
 
   // Compute velocity changes given constraint impulses
-  for (auto& skel : mSkeletons) {
-    if (!skel->isMobile())
-      continue;
-
-    if (skel->isImpulseApplied()) {
-      skel->computeImpulseForwardDynamics();
-      skel->setImpulseApplied(false);
-    }
-
-    skel->integratePositions(mTimeStep);
+  {
+    DART_PROFILE_SCOPED_N("World::step - Integrate position");
+    processSkeletons([this, _resetCommand](dynamics::Skeleton& skel) {
+      if (!skel.isMobile())
+        return;
+
+      if (skel.isSleeping()) {
+        // Sleeping skeletons act as immobile ones for the constraint solver,
+        // so no impulse is meant for them
+        skel.setImpulseApplied(false);
+        return;
+      }
+
+      if (skel.isImpulseApplied()) {
+        skel.computeImpulseForwardDynamics();
+        skel.setImpulseApplied(false);
+      }
+
+      skel.integratePositions(mTimeStep);
+
+      if (_resetCommand) {
+        skel.clearInternalForces();
+        skel.clearExternalForces();
+        skel.resetCommands();
+      }
+    });
+  }
 
-    if (_resetCommand) {
-      skel->clearInternalForces();
-      skel->clearExternalForces();
-      skel->resetCommands();
-    }
+  if (mSleepingEnabled) {
+    DART_PROFILE_SCOPED_N("World::step - Update sleeping skeletons");
+    updateSleepingSkeletons();
   }
 
   mTime += mTimeStep;
@@ -340,6 +478,266 @@ int World::getSimFrames() const
   return mFrame;
 }
 
+//==============================================================================
+void World::setNumThreads(std::size_t numThreads)
+{
+  if (numThreads == 0u)
+    numThreads = common::ThreadPool::getDefaultNumThreads();
+
+  if (numThreads == getNumThreads())
+    return;
+
+  if (numThreads == 1u)
+    mThreadPool.reset();
+  else
+    mThreadPool = std::make_unique<common::ThreadPool>(numThreads);
+}
+
+//==============================================================================
+std::size_t World::getNumThreads() const
+{
+  return mThreadPool ? mThreadPool->getNumThreads() : 1u;
+}
+
+//==============================================================================
+void World::setSleepingEnabled(bool enabled)
+{
+  if (enabled == mSleepingEnabled)
+    return;
+
+  mSleepingEnabled = enabled;
+
+  for (std::size_t i = 0; i < mSkeletons.size(); ++i) {
+    if (mSleepStates[i].mAsleep)
+      wakeUpSkeleton(i);
+    mSleepStates[i].mRestingSteps = 0u;
+  }
+}
+
+//==============================================================================
+bool World::isSleepingEnabled() const
+{
+  return mSleepingEnabled;
+}
+
+//==============================================================================
+void World::setSleepEnergyThreshold(double threshold)
+{
+  if (!std::isfinite(threshold) || threshold < 0.0) {
+    DART_WARN(
+        "[World] Attempting to set an invalid sleep energy threshold ({}). "
+        "Ignoring this request.",
+        threshold);
+    return;
+  }
+
+  mSleepEnergyThreshold = threshold;
+}
+
+//==============================================================================
+double World::getSleepEnergyThreshold() const
+{
+  return mSleepEnergyThreshold;
+}
+
+//==============================================================================
+void World::setSleepStepCount(std::size_t numSteps)
+{
+  mSleepStepCount = numSteps;
+}
+
+//==============================================================================
+std::size_t World::getSleepStepCount() const
+{
+  return mSleepStepCount;
+}
+
+//==============================================================================
+std::size_t World::getCheckpointSize() const
+{
+  std::size_t size = sizeof(CheckpointHeader)
+                     + mSkeletons.size() * sizeof(CheckpointSkeleton)
+                     + mConstraintSolver->getContactWarmStartDataSize();
+
+  for (std::size_t i = 0; i < mSkeletons.size(); ++i) {
+    const SleepState& state = mSleepStates[i];
+    size += sizeof(double)
+            * getNumCheckpointValues(makeCheckpointSkeleton(
+                *mSkeletons[i],
+                state.mRestingSteps,
+                state.mAsleep,
+                hasSleepSnapshot(i)));
+  }
+
+  return size;
+}
+
+//==============================================================================
+std::size_t World::saveCheckpoint(std::span<std::byte> buffer) const
+{
+  const std::size_t size = getCheckpointSize();
+  if (buffer.size() < size) {
+    DART_WARN(
+        "The checkpoint of World [{}] needs {} bytes, but the buffer only "
+        "holds {} bytes.",
+        mName,
+        size,
+        buffer.size());
+    return 0u;
+  }
+
+  const std::size_t warmStartDataSize
+      = mConstraintSolver->getContactWarmStartDataSize();
+
+  std::byte* out = buffer.data();
+
+  CheckpointHeader header;
+  header.version = checkpointVersion;
+  header.numSkeletons = mSkeletons.size();
+  header.warmStartDataSize = warmStartDataSize;
+  header.time = mTime;
+  header.frame = mFrame;
+  writeCheckpoint(out, header);
+
+  for (std::size_t i = 0; i < mSkeletons.size(); ++i) {
+    const SleepState& state = mSleepStates[i];
+    writeCheckpoint(
+        out,
+        makeCheckpointSkeleton(
+            *mSkeletons[i],
+            state.mRestingSteps,
+            state.mAsleep,
+            hasSleepSnapshot(i)));
+  }
+
+  for (std::size_t i = 0; i < mSkeletons.size(); ++i) {
+    const dynamics::Skeleton& skel = *mSkeletons[i];
+
+    for (std::size_t j = 0; j < skel.getNumDofs(); ++j) {
+      const dynamics::DegreeOfFreedom* dof = skel.getDof(j);
+      writeCheckpoint(out, dof->getPosition());
+      writeCheckpoint(out, dof->getVelocity());
+      writeCheckpoint(out, dof->getAcceleration());
+      writeCheckpoint(out, dof->getForce());
+      writeCheckpoint(out, dof->getCommand());
+    }
+
+    for (std::size_t j = 0; j < skel.getNumBodyNodes(); ++j) {
+      const Eigen::Vector6d& force
+          = skel.getBodyNode(j)->getExternalForceLocal();
+      writeCheckpoint(out, force.data(), 6u);
+    }
+
+    if (!hasSleepSnapshot(i))
+      continue;
+
+    const SleepState& state = mSleepStates[i];
+    writeCheckpoint(out, state.mPositions.data(), state.mPositions.size());
+    writeCheckpoint(out, state.mForces.data(), state.mForces.size());
+    writeCheckpoint(out, state.mCommands.data(), state.mCommands.size());
+    writeCheckpoint(
+        out, state.mExternalForces.data(), state.mExternalForces.size());
+  }
+
+  mConstraintSolver->saveContactWarmStartData(
+      std::span<std::byte>(out, warmStartDataSize));
+
+  return size;
+}
+
+//==============================================================================
+bool World::restoreCheckpoint(std::span<const std::byte> buffer)
+{
+  const std::byte* in = buffer.data();
+
+  // Validate the layout before changing anything
+  CheckpointHeader header;
+  std::size_t size = sizeof(header);
+  bool valid = buffer.size() >= size;
+  if (valid) {
+    readCheckpoint(in, header);
+    size += mSkeletons.size() * sizeof(CheckpointSkeleton);
+    valid = header.version == checkpointVersion
+            && header.numSkeletons == mSkeletons.size()
+            && buffer.size() >= size;
+  }
+
+  const std::byte* records = in;
+  for (std::size_t i = 0; valid && i < mSkeletons.size(); ++i) {
+    CheckpointSkeleton record;
+    readCheckpoint(in, record);
+    valid = record.numDofs == mSkeletons[i]->getNumDofs()
+            && record.numBodyNodes == mSkeletons[i]->getNumBodyNodes();
+    size += sizeof(double) * getNumCheckpointValues(record);
+  }
+
+  if (valid) {
+    // Trailing bytes past the recorded warm start data are ignored, so a
+    // buffer sized for a larger checkpoint can be restored from
+    valid = buffer.size() >= size
+            && header.warmStartDataSize <= buffer.size() - size
+            && mConstraintSolver->restoreContactWarmStartData(
+                buffer.subspan(size, header.warmStartDataSize));
+  }
+
+  if (!valid) {
+    DART_WARN(
+        "The checkpoint does not match the skeletons of World [{}]. Ignoring.",
+        mName);
+    return false;
+  }
+
+  mTime = header.time;
+  mFrame = static_cast<int>(header.frame);
+
+  for (std::size_t i = 0; i < mSkeletons.size(); ++i) {
+    dynamics::Skeleton& skel = *mSkeletons[i];
+    SleepState& state = mSleepStates[i];
+
+    CheckpointSkeleton record;
+    readCheckpoint(records, record);
+
+    for (std::size_t j = 0; j < skel.getNumDofs(); ++j) {
+      dynamics::DegreeOfFreedom* dof = skel.getDof(j);
+      double value;
+      readCheckpoint(in, value);
+      dof->setPosition(value);
+      readCheckpoint(in, value);
+      dof->setVelocity(value);
+      readCheckpoint(in, value);
+      dof->setAcceleration(value);
+      readCheckpoint(in, value);
+      dof->setForce(value);
+      readCheckpoint(in, value);
+      dof->setCommand(value);
+    }
+
+    for (std::size_t j = 0; j < skel.getNumBodyNodes(); ++j) {
+      dynamics::BodyNode::AspectState bodyState;
+      readCheckpoint(in, bodyState.mFext.data(), 6u);
+      skel.getBodyNode(j)->setAspectState(bodyState);
+    }
+
+    if (record.asleep) {
+      state.mPositions.resize(record.numDofs);
+      state.mForces.resize(record.numDofs);
+      state.mCommands.resize(record.numDofs);
+      state.mExternalForces.resize(6 * record.numBodyNodes);
+      readCheckpoint(in, state.mPositions.data(), record.numDofs);
+      readCheckpoint(in, state.mForces.data(), record.numDofs);
+      readCheckpoint(in, state.mCommands.data(), record.numDofs);
+      readCheckpoint(
+          in, state.mExternalForces.data(), 6u * record.numBodyNodes);
+    }
+
+    state.mRestingSteps = record.restingSteps;
+    state.mAsleep = record.asleep;
+    skel.setSleeping(record.sleeping);
+  }
+
+  return true;
+}
+
 //==============================================================================
 const std::string& World::setName(const std::string& _newName)
 {
@@ -425,6 +823,7 @@ std::string World::addSkeleton(const dynamics::SkeletonPtr& _skeleton)
 
   mSkeletons.push_back(_skeleton);
   mMapForSkeletons[_skeleton] = _skeleton;
+  mSleepStates.emplace_back();
 
   mNameConnectionsForSkeletons.push_back(_skeleton->onNameChanged.connect(
       [this](
@@ -481,6 +880,11 @@ void World::removeSkeleton(const dynamics::SkeletonPtr& _skeleton)
   // Remove _skeleton from constraint handler.
   mConstraintSolver->removeSkeleton(_skeleton);
 
+  // Wake up _skeleton so that it doesn't stay frozen outside of this world
+  if (mSleepStates[index].mAsleep)
+    wakeUpSkeleton(index);
+  mSleepStates.erase(mSleepStates.begin() + index);
+
   // Remove _skeleton from mSkeletons
   mSkeletons.erase(
       remove(mSkeletons.begin(), mSkeletons.end(), _skeleton),
@@ -849,5 +1253,198 @@ void World::handleSimpleFrameNameChange(const dynamics::Entity* _entity)
   }
 }
 
+//==============================================================================
+void World::processSkeletons(
+    const std::function<void(dynamics::Skeleton&)>& func)
+{
+  if (!mThreadPool || mSkeletons.size() < 2u) {
+    for (auto& skel : mSkeletons)
+      func(*skel);
+    return;
+  }
+
+  mThreadPool->parallelFor(
+      mSkeletons.size(), [&](std::size_t index, std::size_t /*workerIndex*/) {
+        func(*mSkeletons[index]);
+      });
+}
+
+//==============================================================================
+void World::wakeUpChangedSkeletons()
+{
+  for (std::size_t i = 0; i < mSkeletons.size(); ++i) {
+    const SleepState& state = mSleepStates[i];
+    if (!state.mAsleep)
+      continue;
+
+    const dynamics::Skeleton& skel = *mSkeletons[i];
+    const std::size_t numDofs = skel.getNumDofs();
+    const std::size_t numBodyNodes = skel.getNumBodyNodes();
+
+    // Woken up or made immobile by the user, or restructured
+    bool changed = !skel.isSleeping() || !skel.isMobile()
+                   || static_cast<std::size_t>(state.mPositions.size())
+                          != numDofs
+                   || static_cast<std::size_t>(state.mExternalForces.size())
+                          != 6u * numBodyNodes;
+
+    for (std::size_t j = 0; !changed && j < numDofs; ++j) {
+      const dynamics::DegreeOfFreedom* dof = skel.getDof(j);
+      changed = dof->getPosition() != state.mPositions[j]
+                || dof->getVelocity() != 0.0
+                || dof->getForce() != state.mForces[j]
+                || dof->getCommand() != state.mCommands[j];
+    }
+
+    for (std::size_t j = 0; !changed && j < numBodyNodes; ++j) {
+      changed = skel.getBodyNode(j)->getExternalForceLocal()
+                != state.mExternalForces.segment<6>(6 * j);
+    }
+
+    if (changed)
+      wakeUpSkeleton(i);
+  }
+}
+
+//==============================================================================
+void World::updateSleepingSkeletons()
+{
+  const std::size_t numSkeletons = mSkeletons.size();
+
+  // Skeletons without dofs, such as the ground, never move and must not join
+  // the islands of the skeletons resting on them
+  const auto canSleep = [](const dynamics::Skeleton& skel) {
+    return skel.isMobile() && skel.getNumDofs() > 0u;
+  };
+
+  // Count the resting steps of the awake skeletons
+  for (std::size_t i = 0; i < numSkeletons; ++i) {
+    SleepState& state = mSleepStates[i];
+    const dynamics::Skeleton& skel = *mSkeletons[i];
+    if (state.mAsleep || !canSleep(skel))
+      continue;
+
+    if (skel.computeKineticEnergy() < mSleepEnergyThreshold)
+      ++state.mRestingSteps;
+    else
+      state.mRestingSteps = 0u;
+  }
+
+  // Unite the mobile skeletons that touch each other into islands
+  mSleepSkeletonIndices.clear();
+  for (std::size_t i = 0; i < numSkeletons; ++i)
+    mSleepSkeletonIndices[mSkeletons[i].get()] = i;
+
+  mSleepIslands.resize(numSkeletons);
+  std::iota(mSleepIslands.begin(), mSleepIslands.end(), 0u);
+
+  const auto findIsland = [this](std::size_t index) {
+    while (mSleepIslands[index] != index) {
+      mSleepIslands[index] = mSleepIslands[mSleepIslands[index]];
+      index = mSleepIslands[index];
+    }
+    return index;
+  };
+
+  // Returns numSkeletons for objects that are not attached to a moving body
+  // of a skeleton of this World that can sleep
+  const auto findMobileSkeleton
+      = [&](const collision::CollisionObject* object) {
+          const auto* shapeNode = object->getShapeFrame()->asShapeNode();
+          if (!shapeNode
+              || shapeNode->getBodyNodePtr()->getNumDependentGenCoords() == 0u)
+            return numSkeletons;
+
+          const auto skel = shapeNode->getSkeleton();
+          const auto it = mSleepSkeletonIndices.find(skel.get());
+          if (it == mSleepSkeletonIndices.end() || !canSleep(*skel))
+            return numSkeletons;
+
+          return it->second;
+        };
+
+  const auto& collisionResult = mConstraintSolver->getLastCollisionResult();
+  for (const auto& contact : collisionResult.getContacts()) {
+    const std::size_t index1 = findMobileSkeleton(contact.collisionObject1);
+    const std::size_t index2 = findMobileSkeleton(contact.collisionObject2);
+    if (index1 == numSkeletons || index2 == numSkeletons)
+      continue;
+
+    mSleepIslands[findIsland(index1)] = findIsland(index2);
+  }
+
+  // An island falls asleep once all its awake skeletons are at rest, and a
+  // moving skeleton wakes up the whole island
+  constexpr unsigned char hasAwake = 0x1;
+  constexpr unsigned char hasMoving = 0x2;
+
+  mSleepIslandFlags.assign(numSkeletons, 0u);
+  for (std::size_t i = 0; i < numSkeletons; ++i) {
+    const SleepState& state = mSleepStates[i];
+    if (state.mAsleep || !canSleep(*mSkeletons[i]))
+      continue;
+
+    unsigned char& flags = mSleepIslandFlags[findIsland(i)];
+    flags |= hasAwake;
+    if (state.mRestingSteps < mSleepStepCount)
+      flags |= hasMoving;
+  }
+
+  for (std::size_t i = 0; i < numSkeletons; ++i) {
+    if (!canSleep(*mSkeletons[i]))
+      continue;
+
+    const unsigned char flags = mSleepIslandFlags[findIsland(i)];
+    const bool asleep = mSleepStates[i].mAsleep;
+    if ((flags & hasMoving) && asleep)
+      wakeUpSkeleton(i);
+    else if (!(flags & hasMoving) && (flags & hasAwake) && !asleep)
+      putSkeletonToSleep(i);
+  }
+}
+
+//==============================================================================
+void World::putSkeletonToSleep(std::size_t index)
+{
+  dynamics::Skeleton& skel = *mSkeletons[index];
+  SleepState& state = mSleepStates[index];
+
+  skel.resetVelocities();
+  skel.resetAccelerations();
+
+  state.mPositions = skel.getPositions();
+  state.mForces = skel.getForces();
+  state.mCommands = skel.getCommands();
+  state.mExternalForces.resize(6 * skel.getNumBodyNodes());
+  for (std::size_t i = 0; i < skel.getNumBodyNodes(); ++i) {
+    state.mExternalForces.segment<6>(6 * i)
+        = skel.getBodyNode(i)->getExternalForceLocal();
+  }
+
+  skel.setSleeping(true);
+  state.mAsleep = true;
+}
+
+//==============================================================================
+bool World::hasSleepSnapshot(std::size_t index) const
+{
+  const dynamics::Skeleton& skel = *mSkeletons[index];
+  const SleepState& state = mSleepStates[index];
+
+  return state.mAsleep
+         && static_cast<std::size_t>(state.mPositions.size())
+                == skel.getNumDofs()
+         && static_cast<std::size_t>(state.mExternalForces.size())
+                == 6u * skel.getNumBodyNodes();
+}
+
+//==============================================================================
+void World::wakeUpSkeleton(std::size_t index)
+{
+  mSkeletons[index]->setSleeping(false);
+  mSleepStates[index].mAsleep = false;
+  mSleepStates[index].mRestingSteps = 0u;
+}
+
 } // namespace simulation
 } // namespace dart
@@ -54,16 +54,23 @@
 #include <dart/common/NameManager.hpp>
 #include <dart/common/SmartPointer.hpp>
 #include <dart/common/Subject.hpp>
+#include <dart/common/ThreadPool.hpp>
 
 #include <dart/Export.hpp>
 
 #include <Eigen/Dense>
 
+#include <functional>
+#include <memory>
 #include <set>
+#include <span>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include <cstddef>
+
 namespace dart {
 namespace simulation {
 
@@ -259,6 +266,109 @@ public:
   /// getSimpleFrame()
   int getSimFrames() const;
 
+  /// Sets the number of threads used by step() to compute the forward
+  /// dynamics and to integrate the states of the skeletons.
+  ///
+  /// These phases are independent per skeleton, so the skeletons are processed
+  /// concurrently on a thread pool owned by this World. The results do not
+  /// depend on the number of threads. Pass 1 (default) to process the
+  /// skeletons serially on the calling thread, or 0 to use the number of
+  /// hardware threads. The constraint solver is configured separately with
+  /// constraint::ConstraintSolver::setNumThreads(). clone() keeps this
+  /// setting.
+  ///
+  /// Callbacks connected to the skeletons, such as the transform updated
+  /// signals of their frames, may be invoked concurrently.
+  void setNumThreads(std::size_t numThreads);
+
+  /// Returns the number of threads used by step() to process the skeletons.
+  std::size_t getNumThreads() const;
+
+  /// Sets whether step() puts skeletons that come to rest to sleep.
+  ///
+  /// A mobile skeleton is at rest once its kinetic energy stays below the
+  /// sleep energy threshold for the sleep step count of consecutive steps.
+  /// Skeletons touching each other form an island that falls asleep only
+  /// when all of its skeletons are at rest. Sleeping skeletons have zero
+  /// velocities. They are skipped by the forward dynamics, the integration
+  /// and the broadphase updates, and act like immobile skeletons in the
+  /// constraint solver. See dynamics::Skeleton::setSleeping().
+  ///
+  /// A sleeping skeleton wakes up in either of these cases:
+  /// - a mobile skeleton that is not at rest touches its island;
+  /// - its positions, velocities, forces, commands or external forces were
+  ///   changed since the previous step.
+  ///
+  /// Immobile skeletons never wake up sleeping ones. Disabling sleeping wakes
+  /// up all skeletons. Sleeping is disabled by default.
+  void setSleepingEnabled(bool enabled);
+
+  /// Returns whether step() puts skeletons that come to rest to sleep.
+  bool isSleepingEnabled() const;
+
+  /// Sets the kinetic energy below which a skeleton is considered at rest.
+  /// Default is 1e-4.
+  void setSleepEnergyThreshold(double threshold);
+
+  /// Returns the kinetic energy below which a skeleton is considered at rest.
+  double getSleepEnergyThreshold() const;
+
+  /// Sets the number of consecutive steps a skeleton needs to stay below the
+  /// sleep energy threshold before it can be put to sleep. Default is 60.
+  void setSleepStepCount(std::size_t numSteps);
+
+  /// Returns the number of consecutive resting steps before a skeleton can be
+  /// put to sleep.
+  std::size_t getSleepStepCount() const;
+
+  //--------------------------------------------------------------------------
+  // Checkpoint
+  //--------------------------------------------------------------------------
+
+  /// Returns the number of bytes saveCheckpoint() needs for the current
+  /// state.
+  ///
+  /// The size grows with the DOFs and BodyNodes of the skeletons, the
+  /// sleeping skeletons, and the contact impulses cached for warm starting,
+  /// so it may change across steps. A buffer sized for the largest expected
+  /// checkpoint can be reused for every checkpoint.
+  std::size_t getCheckpointSize() const;
+
+  /// Saves the simulation state of this World into \c buffer without
+  /// allocating memory.
+  ///
+  /// The checkpoint holds the time, the frame counter, the generalized
+  /// positions, velocities, accelerations, forces and commands, the external
+  /// forces of the BodyNodes, the sleeping bookkeeping, and the contact
+  /// impulses cached for warm starting. Restoring it makes the following
+  /// steps repeat the steps taken after saving, e.g., to roll out several
+  /// control sequences from the same state, as long as the collision
+  /// detector reports the contacts in the same order. The joint constraints,
+  /// such as joint limits, are rebuilt every step without warm starting, so
+  /// they hold no state to save. Properties, such as masses or joint limits,
+  /// and the recording are not saved.
+  ///
+  /// \return The number of bytes written, or 0 if \c buffer is smaller than
+  /// getCheckpointSize().
+  std::size_t saveCheckpoint(std::span<std::byte> buffer) const;
+
+  /// Restores a checkpoint written by saveCheckpoint() of this World.
+  ///
+  /// The cached contact impulses refer to the collision objects of this
+  /// World, so a checkpoint can only be restored into the World it was saved
+  /// from, as long as its skeletons were not added, removed or restructured
+  /// since then. No memory is allocated unless the checkpoint holds more
+  /// cached contact impulses than this World cached before, or puts a
+  /// skeleton to sleep that never slept in this World.
+  ///
+  /// \c buffer may be larger than the checkpoint, e.g., a buffer sized for
+  /// the largest expected checkpoint; the bytes past the checkpoint are
+  /// ignored.
+  ///
+  /// \return False if \c buffer does not match the skeletons of this World,
+  /// in which case nothing is restored.
+  bool restoreCheckpoint(std::span<const std::byte> buffer);
+
   //--------------------------------------------------------------------------
   // Constraint
   //--------------------------------------------------------------------------
@@ -353,6 +463,47 @@ protected:
   /// Register when a SimpleFrame's name is changed
   void handleSimpleFrameNameChange(const dynamics::Entity* _entity);
 
+  /// Calls \c func for every skeleton, concurrently if this World has a
+  /// thread pool
+  void processSkeletons(const std::function<void(dynamics::Skeleton&)>& func);
+
+  /// Wakes up the sleeping skeletons whose state was changed since the
+  /// previous step
+  void wakeUpChangedSkeletons();
+
+  /// Counts the resting steps of the awake skeletons, then puts the islands
+  /// that came to rest to sleep and wakes up the sleeping skeletons that are
+  /// touched by a moving one
+  void updateSleepingSkeletons();
+
+  /// Puts mSkeletons[index] to sleep and remembers its state
+  void putSkeletonToSleep(std::size_t index);
+
+  /// Wakes up mSkeletons[index]
+  void wakeUpSkeleton(std::size_t index);
+
+  /// Returns whether mSkeletons[index] was put to sleep by this World and its
+  /// state remembered then still matches its structure
+  bool hasSleepSnapshot(std::size_t index) const;
+
+  /// Sleeping bookkeeping of a skeleton
+  struct SleepState
+  {
+    /// Number of consecutive steps the kinetic energy stayed below the sleep
+    /// energy threshold
+    std::size_t mRestingSteps = 0u;
+
+    /// Whether this World put the skeleton to sleep
+    bool mAsleep = false;
+
+    /// Positions, forces, commands and stacked external forces of the
+    /// skeleton when it was put to sleep
+    Eigen::VectorXd mPositions;
+    Eigen::VectorXd mForces;
+    Eigen::VectorXd mCommands;
+    Eigen::VectorXd mExternalForces;
+  };
+
   /// Name of this World
   std::string mName;
 
@@ -404,6 +555,35 @@ protected:
   /// Constraint solver
   std::unique_ptr<constraint::ConstraintSolver> mConstraintSolver;
 
+  /// Thread pool to process the skeletons concurrently in step(). nullptr
+  /// when the skeletons are processed serially.
+  std::unique_ptr<common::ThreadPool> mThreadPool;
+
+  /// Whether step() puts skeletons that come to rest to sleep
+  bool mSleepingEnabled;
+
+  /// Kinetic energy below which a skeleton is considered at rest
+  double mSleepEnergyThreshold;
+
+  /// Number of consecutive resting steps before a skeleton can sleep
+  std::size_t mSleepStepCount;
+
+  /// Sleeping bookkeeping of each skeleton in mSkeletons
+  std::vector<SleepState> mSleepStates;
+
+  /// Union-find parents of the skeletons used to build the islands of
+  /// touching skeletons. Reused across steps.
+  std::vector<std::size_t> mSleepIslands;
+
+  /// Flags of the islands built in updateSleepingSkeletons(). Reused across
+  /// steps.
+  std::vector<unsigned char> mSleepIslandFlags;
+
+  /// Map from the skeletons to their indices in mSkeletons. Reused across
+  /// steps.
+  std::unordered_map<const dynamics::Skeleton*, std::size_t>
+      mSleepSkeletonIndices;
+
   ///
   Recording* mRecording;
 
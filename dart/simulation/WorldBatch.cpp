@@ -0,0 +1,303 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "dart/simulation/WorldBatch.hpp"
+
+#include "dart/common/Macros.hpp"
+#include "dart/common/Profile.hpp"
+#include "dart/constraint/ConstraintSolver.hpp"
+#include "dart/dynamics/Shape.hpp"
+#include "dart/dynamics/ShapeNode.hpp"
+#include "dart/dynamics/Skeleton.hpp"
+#include "dart/simulation/World.hpp"
+
+namespace dart {
+namespace simulation {
+
+//==============================================================================
+WorldBatch::WorldBatch(
+    const WorldPtr& world, std::size_t numWorlds, std::size_t numThreads)
+  : mNumDofs(0u), mInitialTime(0.0)
+{
+  DART_ASSERT(world && "Null pointer world is not allowed.");
+
+  mWorlds.reserve(numWorlds);
+  for (std::size_t i = 0; i < numWorlds; ++i) {
+    mWorlds.push_back(world->clone());
+
+    // The worlds are already stepped concurrently, and a clone keeps the
+    // number of threads of the world and of its constraint solver
+    mWorlds.back()->setNumThreads(1u);
+    mWorlds.back()->getConstraintSolver()->setNumThreads(1u);
+  }
+
+  // The clones share the shapes, so compute their lazily evaluated data
+  // before the shapes are accessed concurrently
+  for (std::size_t i = 0; i < world->getNumSkeletons(); ++i) {
+    const auto skeleton = world->getSkeleton(i);
+    for (std::size_t j = 0; j < skeleton->getNumShapeNodes(); ++j) {
+      const auto shape = skeleton->getShapeNode(j)->getShape();
+      if (!shape)
+        continue;
+
+      shape->getBoundingBox();
+      shape->getVolume();
+    }
+  }
+
+  for (std::size_t i = 0; i < world->getNumSkeletons(); ++i)
+    mNumDofs += world->getSkeleton(i)->getNumDofs();
+
+  mInitialPositions.resize(static_cast<Eigen::Index>(mNumDofs));
+  mInitialVelocities.resize(static_cast<Eigen::Index>(mNumDofs));
+  Eigen::Index offset = 0;
+  for (std::size_t i = 0; i < world->getNumSkeletons(); ++i) {
+    const auto skeleton = world->getSkeleton(i);
+    const auto numDofs = static_cast<Eigen::Index>(skeleton->getNumDofs());
+    mInitialPositions.segment(offset, numDofs) = skeleton->getPositions();
+    mInitialVelocities.segment(offset, numDofs) = skeleton->getVelocities();
+    offset += numDofs;
+  }
+  mInitialTime = world->getTime();
+
+  const auto rows = static_cast<Eigen::Index>(numWorlds);
+  const auto cols = static_cast<Eigen::Index>(mNumDofs);
+  mPositions.resize(rows, cols);
+  mVelocities.resize(rows, cols);
+  mForces.resize(rows, cols);
+
+  setNumThreads(numThreads);
+  reset();
+}
+
+//==============================================================================
+WorldBatch::~WorldBatch() = default;
+
+//==============================================================================
+std::size_t WorldBatch::getNumWorlds() const
+{
+  return mWorlds.size();
+}
+
+//==============================================================================
+std::size_t WorldBatch::getNumDofs() const
+{
+  return mNumDofs;
+}
+
+//==============================================================================
+WorldPtr WorldBatch::getWorld(std::size_t index) const
+{
+  DART_ASSERT(index < mWorlds.size());
+  return mWorlds[index];
+}
+
+//==============================================================================
+void WorldBatch::setNumThreads(std::size_t numThreads)
+{
+  if (numThreads == 0u)
+    numThreads = common::ThreadPool::getDefaultNumThreads();
+
+  if (numThreads == getNumThreads())
+    return;
+
+  if (numThreads == 1u)
+    mThreadPool.reset();
+  else
+    mThreadPool = std::make_unique<common::ThreadPool>(numThreads);
+}
+
+//==============================================================================
+std::size_t WorldBatch::getNumThreads() const
+{
+  return mThreadPool ? mThreadPool->getNumThreads() : 1u;
+}
+
+//==============================================================================
+WorldBatch::StateMatrix& WorldBatch::getPositions()
+{
+  return mPositions;
+}
+
+//==============================================================================
+const WorldBatch::StateMatrix& WorldBatch::getPositions() const
+{
+  return mPositions;
+}
+
+//==============================================================================
+WorldBatch::StateMatrix& WorldBatch::getVelocities()
+{
+  return mVelocities;
+}
+
+//==============================================================================
+const WorldBatch::StateMatrix& WorldBatch::getVelocities() const
+{
+  return mVelocities;
+}
+
+//==============================================================================
+WorldBatch::StateMatrix& WorldBatch::getForces()
+{
+  return mForces;
+}
+
+//==============================================================================
+const WorldBatch::StateMatrix& WorldBatch::getForces() const
+{
+  return mForces;
+}
+
+//==============================================================================
+void WorldBatch::step(std::size_t numSteps)
+{
+  DART_PROFILE_SCOPED_N("WorldBatch::step");
+
+  parallelFor(mWorlds.size(), [&](std::size_t index) {
+    pushState(index);
+
+    for (std::size_t i = 0; i < numSteps; ++i) {
+      // World::step() clears the forces, so apply them again
+      if (i > 0u)
+        pushForces(index);
+
+      mWorlds[index]->step();
+    }
+
+    pullState(index);
+  });
+}
+
+//==============================================================================
+void WorldBatch::reset()
+{
+  parallelFor(mWorlds.size(), [&](std::size_t index) { resetWorld(index); });
+}
+
+//==============================================================================
+void WorldBatch::reset(const std::vector<std::size_t>& indices)
+{
+  parallelFor(indices.size(), [&](std::size_t i) {
+    DART_ASSERT(indices[i] < mWorlds.size());
+    resetWorld(indices[i]);
+  });
+}
+
+//==============================================================================
+void WorldBatch::pushState(std::size_t index)
+{
+  const auto& world = mWorlds[index];
+  Eigen::Index offset = 0;
+  for (std::size_t i = 0; i < world->getNumSkeletons(); ++i) {
+    const auto skeleton = world->getSkeleton(i);
+    const auto numDofs = static_cast<Eigen::Index>(skeleton->getNumDofs());
+    if (numDofs == 0)
+      continue;
+
+    skeleton->setPositions(
+        mPositions.row(index).segment(offset, numDofs).transpose());
+    skeleton->setVelocities(
+        mVelocities.row(index).segment(offset, numDofs).transpose());
+    offset += numDofs;
+  }
+
+  pushForces(index);
+}
+
+//==============================================================================
+void WorldBatch::pushForces(std::size_t index)
+{
+  const auto& world = mWorlds[index];
+  Eigen::Index offset = 0;
+  for (std::size_t i = 0; i < world->getNumSkeletons(); ++i) {
+    const auto skeleton = world->getSkeleton(i);
+    const auto numDofs = static_cast<Eigen::Index>(skeleton->getNumDofs());
+    if (numDofs == 0)
+      continue;
+
+    skeleton->setForces(
+        mForces.row(index).segment(offset, numDofs).transpose());
+    offset += numDofs;
+  }
+}
+
+//==============================================================================
+void WorldBatch::pullState(std::size_t index)
+{
+  const auto& world = mWorlds[index];
+  Eigen::Index offset = 0;
+  for (std::size_t i = 0; i < world->getNumSkeletons(); ++i) {
+    const auto skeleton = world->getSkeleton(i);
+    const auto numDofs = static_cast<Eigen::Index>(skeleton->getNumDofs());
+    if (numDofs == 0)
+      continue;
+
+    mPositions.row(index).segment(offset, numDofs)
+        = skeleton->getPositions().transpose();
+    mVelocities.row(index).segment(offset, numDofs)
+        = skeleton->getVelocities().transpose();
+    offset += numDofs;
+  }
+}
+
+//==============================================================================
+void WorldBatch::resetWorld(std::size_t index)
+{
+  mPositions.row(index) = mInitialPositions.transpose();
+  mVelocities.row(index) = mInitialVelocities.transpose();
+  mForces.row(index).setZero();
+
+  const auto& world = mWorlds[index];
+  world->reset();
+  world->setTime(mInitialTime);
+  pushState(index);
+}
+
+//==============================================================================
+void WorldBatch::parallelFor(
+    std::size_t count, const std::function<void(std::size_t)>& func)
+{
+  if (!mThreadPool) {
+    for (std::size_t i = 0; i < count; ++i)
+      func(i);
+    return;
+  }
+
+  mThreadPool->parallelFor(
+      count, [&](std::size_t index, std::size_t /*workerIndex*/) {
+        func(index);
+      });
+}
+
+} // namespace simulation
+} // namespace dart
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef DART_SIMULATION_WORLDBATCH_HPP_
+#define DART_SIMULATION_WORLDBATCH_HPP_
+
+#include <dart/simulation/Fwd.hpp>
+
+#include <dart/common/ThreadPool.hpp>
+
+#include <dart/Export.hpp>
+
+#include <Eigen/Core>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <cstddef>
+
+namespace dart {
+namespace simulation {
+
+/// WorldBatch steps many structurally identical copies of a World, e.g., for
+/// reinforcement-learning rollouts.
+///
+/// The generalized positions, velocities, and forces of all the worlds are
+/// held in contiguous row-major matrices with one row per world and one
+/// column per degree of freedom, where the columns follow the order of the
+/// skeletons in the world and the order of the DOFs within each skeleton.
+/// The rows can be read and written in place, and step() pushes them into
+/// the worlds and pulls the new state back on the thread that steps each
+/// world.
+///
+/// \code
+/// WorldBatch batch(world, 1024);
+/// for (;;) {
+///   batch.getForces() = policy(batch.getPositions(), batch.getVelocities());
+///   batch.step();
+/// }
+/// \endcode
+///
+/// The worlds are clones of the given world, so they share Shape instances.
+/// Shapes must not be modified while the batch is stepping.
+class DART_API WorldBatch
+{
+public:
+  /// Row-major matrix with one row per world and one column per DOF
+  using StateMatrix
+      = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+  /// Constructor
+  ///
+  /// \param[in] world: The world to clone. Its current state becomes the
+  /// initial state of every world in the batch.
+  /// \param[in] numWorlds: Number of worlds in the batch.
+  /// \param[in] numThreads: Number of threads to step the worlds. Pass 0 to
+  /// use the number of hardware threads.
+  WorldBatch(
+      const WorldPtr& world, std::size_t numWorlds, std::size_t numThreads = 0);
+
+  /// Destructor
+  ~WorldBatch();
+
+  /// Returns the number of worlds
+  std::size_t getNumWorlds() const;
+
+  /// Returns the number of DOFs of each world
+  std::size_t getNumDofs() const;
+
+  /// Returns a world of the batch
+  WorldPtr getWorld(std::size_t index) const;
+
+  /// Sets the number of threads to step the worlds. Pass 0 to use the number
+  /// of hardware threads.
+  void setNumThreads(std::size_t numThreads);
+
+  /// Returns the number of threads to step the worlds
+  std::size_t getNumThreads() const;
+
+  /// Returns the generalized positions of all the worlds
+  StateMatrix& getPositions();
+
+  /// Returns the generalized positions of all the worlds
+  const StateMatrix& getPositions() const;
+
+  /// Returns the generalized velocities of all the worlds
+  StateMatrix& getVelocities();
+
+  /// Returns the generalized velocities of all the worlds
+  const StateMatrix& getVelocities() const;
+
+  /// Returns the generalized forces of all the worlds. The forces are kept
+  /// across steps, so they act as commands until they are changed.
+  StateMatrix& getForces();
+
+  /// Returns the generalized forces of all the worlds
+  const StateMatrix& getForces() const;
+
+  /// Steps every world by \c numSteps time steps with the current rows of
+  /// the position, velocity, and force matrices.
+  void step(std::size_t numSteps = 1u);
+
+  /// Resets every world to the initial state and zeroes its forces
+  void reset();
+
+  /// Resets the given worlds to the initial state and zeroes their forces,
+  /// e.g., at the end of their episodes
+  void reset(const std::vector<std::size_t>& indices);
+
+private:
+  /// Writes the rows of the state matrices into the world
+  void pushState(std::size_t index);
+
+  /// Writes the rows of the force matrix into the world
+  void pushForces(std::size_t index);
+
+  /// Reads the state of the world into the rows of the state matrices
+  void pullState(std::size_t index);
+
+  /// Resets the world to the initial state
+  void resetWorld(std::size_t index);
+
+  /// Calls \c func(index) for every index in [0, count) on the thread pool
+  void parallelFor(
+      std::size_t count, const std::function<void(std::size_t)>& func);
+
+  /// Worlds of the batch
+  std::vector<WorldPtr> mWorlds;
+
+  /// Number of DOFs of each world
+  std::size_t mNumDofs;
+
+  /// Thread pool to step the worlds concurrently. nullptr when the worlds are
+  /// stepped serially.
+  std::unique_ptr<common::ThreadPool> mThreadPool;
+
+  /// Generalized positions of all the worlds
+  StateMatrix mPositions;
+
+  /// Generalized velocities of all the worlds
+  StateMatrix mVelocities;
+
+  /// Generalized forces of all the worlds
+  StateMatrix mForces;
+
+  /// Initial generalized positions
+  Eigen::VectorXd mInitialPositions;
+
+  /// Initial generalized velocities
+  Eigen::VectorXd mInitialVelocities;
+
+  /// Initial simulation time
+  double mInitialTime;
+};
+
+} // namespace simulation
+} // namespace dart
+
+#endif // DART_SIMULATION_WORLDBATCH_HPP_
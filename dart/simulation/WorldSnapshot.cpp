@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "dart/simulation/WorldSnapshot.hpp"
+
+#include "dart/dynamics/BodyNode.hpp"
+#include "dart/dynamics/ShapeFrame.hpp"
+#include "dart/dynamics/SimpleFrame.hpp"
+#include "dart/dynamics/Skeleton.hpp"
+#include "dart/simulation/World.hpp"
+
+namespace dart {
+namespace simulation {
+
+//==============================================================================
+void WorldSnapshot::capture(const World& world)
+{
+  mTime = world.getTime();
+  mSimFrames = world.getSimFrames();
+  mShapeFrames.clear();
+
+  mFrameStack.clear();
+  for (std::size_t i = 0; i < world.getNumSkeletons(); ++i) {
+    const dynamics::SkeletonPtr skeleton = world.getSkeleton(i);
+    for (std::size_t j = 0; j < skeleton->getNumTrees(); ++j)
+      mFrameStack.push_back(skeleton->getRootBodyNode(j));
+  }
+  for (std::size_t i = 0; i < world.getNumSimpleFrames(); ++i)
+    mFrameStack.push_back(world.getSimpleFrame(i).get());
+
+  while (!mFrameStack.empty()) {
+    dynamics::Frame* frame = mFrameStack.back();
+    mFrameStack.pop_back();
+
+    if (frame->isShapeFrame()) {
+      dynamics::ShapeFrame* shapeFrame = frame->asShapeFrame();
+
+      ShapeFrameSnapshot& snapshot = mShapeFrames.emplace_back();
+      snapshot.mShapeFrame = shapeFrame;
+      snapshot.mVersion = shapeFrame->getVersion();
+      snapshot.mWorldTransform = frame->getWorldTransform();
+    }
+
+    for (dynamics::Frame* child : frame->getChildFrames())
+      mFrameStack.push_back(child);
+  }
+}
+
+//==============================================================================
+double WorldSnapshot::getTime() const
+{
+  return mTime;
+}
+
+//==============================================================================
+int WorldSnapshot::getSimFrames() const
+{
+  return mSimFrames;
+}
+
+//==============================================================================
+const std::vector<ShapeFrameSnapshot>& WorldSnapshot::getShapeFrames() const
+{
+  return mShapeFrames;
+}
+
+//==============================================================================
+WorldSnapshotBuffer::WorldSnapshotBuffer()
+  : mMiddleIndex(1u), mWriteIndex(0u), mReadIndex(2u), mHasFetched(false)
+{
+  // Do nothing
+}
+
+//==============================================================================
+WorldSnapshot& WorldSnapshotBuffer::getWriteSnapshot()
+{
+  return mSnapshots[mWriteIndex];
+}
+
+//==============================================================================
+void WorldSnapshotBuffer::publish()
+{
+  // Release the written snapshot to the consumer and take over the previous
+  // middle snapshot, which the consumer is not reading
+  const unsigned int previous = mMiddleIndex.exchange(
+      mWriteIndex | NewBit, std::memory_order_acq_rel);
+  mWriteIndex = previous & IndexMask;
+}
+
+//==============================================================================
+bool WorldSnapshotBuffer::hasNewSnapshot() const
+{
+  return (mMiddleIndex.load(std::memory_order_acquire) & NewBit) != 0u;
+}
+
+//==============================================================================
+const WorldSnapshot* WorldSnapshotBuffer::fetchLatest()
+{
+  if (hasNewSnapshot()) {
+    const unsigned int previous
+        = mMiddleIndex.exchange(mReadIndex, std::memory_order_acq_rel);
+    mReadIndex = previous & IndexMask;
+    mHasFetched = true;
+  }
+
+  return mHasFetched ? &mSnapshots[mReadIndex] : nullptr;
+}
+
+//==============================================================================
+void WorldSnapshotBuffer::reset()
+{
+  mMiddleIndex.store(
+      mMiddleIndex.load(std::memory_order_relaxed) & IndexMask,
+      std::memory_order_release);
+  mHasFetched = false;
+}
+
+} // namespace simulation
+} // namespace dart
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef DART_SIMULATION_WORLDSNAPSHOT_HPP_
+#define DART_SIMULATION_WORLDSNAPSHOT_HPP_
+
+#include <dart/simulation/Fwd.hpp>
+
+#include <dart/Export.hpp>
+
+#include <Eigen/Geometry>
+
+#include <array>
+#include <atomic>
+#include <vector>
+
+#include <cstddef>
+
+namespace dart {
+
+namespace dynamics {
+class Frame;
+class ShapeFrame;
+} // namespace dynamics
+
+namespace simulation {
+
+/// The state of a ShapeFrame when a WorldSnapshot was captured
+struct ShapeFrameSnapshot
+{
+  /// The ShapeFrame. It must only be dereferenced while the World is not being
+  /// stepped.
+  dynamics::ShapeFrame* mShapeFrame;
+
+  /// The version of the ShapeFrame, which changes whenever its Shape or its
+  /// aspects are modified
+  std::size_t mVersion;
+
+  /// The world transform of the ShapeFrame
+  Eigen::Isometry3d mWorldTransform;
+};
+
+/// WorldSnapshot holds the world transforms and the versions of all the
+/// ShapeFrames of a World at some instant, so that they can be read by another
+/// thread (e.g., a renderer) while the World keeps being stepped.
+///
+/// The ShapeFrames are collected from the BodyNodes of every Skeleton and from
+/// the SimpleFrames of the World, including the child frames of both.
+class DART_API WorldSnapshot
+{
+public:
+  /// Captures the current state of \c world. The storage of the previous
+  /// capture is reused.
+  void capture(const World& world);
+
+  /// Returns the time of the World when the snapshot was captured
+  double getTime() const;
+
+  /// Returns the number of simulated frames of the World when the snapshot
+  /// was captured
+  int getSimFrames() const;
+
+  /// Returns the captured ShapeFrames
+  const std::vector<ShapeFrameSnapshot>& getShapeFrames() const;
+
+private:
+  /// Time of the World
+  double mTime{0.0};
+
+  /// Number of simulated frames of the World
+  int mSimFrames{0};
+
+  /// Captured ShapeFrames
+  std::vector<ShapeFrameSnapshot> mShapeFrames;
+
+  /// Frames that remain to be visited by capture()
+  std::vector<dynamics::Frame*> mFrameStack;
+};
+
+/// WorldSnapshotBuffer passes WorldSnapshots from one producer thread to one
+/// consumer thread without locks.
+///
+/// The buffer holds three snapshots: the producer fills one while the consumer
+/// reads another, and the third holds the latest published snapshot. Neither
+/// thread ever waits for the other, and the consumer always gets the most
+/// recently published snapshot; intermediate snapshots that the consumer did
+/// not fetch in time are dropped.
+///
+/// \code
+/// // Producer thread
+/// WorldSnapshot& snapshot = buffer.getWriteSnapshot();
+/// snapshot.capture(*world);
+/// buffer.publish();
+///
+/// // Consumer thread
+/// if (const WorldSnapshot* snapshot = buffer.fetchLatest())
+///   draw(*snapshot);
+/// \endcode
+class DART_API WorldSnapshotBuffer
+{
+public:
+  /// Constructor
+  WorldSnapshotBuffer();
+
+  /// Returns the snapshot that the producer may fill. Must only be called by
+  /// the producer thread.
+  WorldSnapshot& getWriteSnapshot();
+
+  /// Publishes the snapshot returned by getWriteSnapshot() and hands the
+  /// producer another one to fill. Must only be called by the producer thread.
+  void publish();
+
+  /// Returns true if a snapshot has been published since the last call of
+  /// fetchLatest().
+  bool hasNewSnapshot() const;
+
+  /// Returns the most recently published snapshot, or nullptr if nothing has
+  /// been published yet. The snapshot remains valid until the next call of
+  /// fetchLatest(). Must only be called by the consumer thread.
+  const WorldSnapshot* fetchLatest();
+
+  /// Drops all published snapshots so that fetchLatest() returns nullptr until
+  /// the next publish(). Must not be called concurrently with the other
+  /// functions.
+  void reset();
+
+private:
+  /// Bit of mMiddleIndex that is set when the middle snapshot has not been
+  /// fetched yet
+  static constexpr unsigned int NewBit = 0x4u;
+
+  /// Bits of mMiddleIndex that hold the snapshot index
+  static constexpr unsigned int IndexMask = 0x3u;
+
+  /// The snapshots
+  std::array<WorldSnapshot, 3> mSnapshots;
+
+  /// Index of the latest published snapshot, combined with NewBit
+  std::atomic<unsigned int> mMiddleIndex;
+
+  /// Index of the snapshot that the producer fills
+  unsigned int mWriteIndex;
+
+  /// Index of the snapshot that the consumer reads
+  unsigned int mReadIndex;
+
+  /// Whether the consumer has fetched a snapshot since the last reset()
+  bool mHasFetched;
+};
+
+} // namespace simulation
+} // namespace dart
+
+#endif // DART_SIMULATION_WORLDSNAPSHOT_HPP_
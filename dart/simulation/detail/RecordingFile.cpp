@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "dart/simulation/detail/RecordingFile.hpp"
+
+#include "dart/common/Logging.hpp"
+#include "dart/common/Macros.hpp"
+
+#include <limits>
+
+#include <cstring>
+
+namespace dart::simulation::detail {
+
+namespace {
+
+constexpr char headerMagic[8] = {'D', 'A', 'R', 'T', 'R', 'E', 'C', '\0'};
+constexpr char indexMagic[8] = {'D', 'A', 'R', 'T', 'I', 'D', 'X', '\0'};
+
+//==============================================================================
+bool writeWords(std::FILE* file, const void* data, std::size_t numWords)
+{
+  return std::fwrite(data, 8u, numWords, file) == numWords;
+}
+
+//==============================================================================
+bool writeWord(std::FILE* file, std::uint64_t word)
+{
+  return writeWords(file, &word, 1u);
+}
+
+} // namespace
+
+//==============================================================================
+std::unique_ptr<RecordingFileWriter> RecordingFileWriter::create(
+    const std::string& filename)
+{
+  std::FILE* file = std::fopen(filename.c_str(), "wb");
+  if (!file) {
+    DART_WARN("Failed to open recording file [{}] for writing.", filename);
+    return nullptr;
+  }
+
+  if (!writeWords(file, headerMagic, 1u)
+      || !writeWord(file, recordingFileVersion)) {
+    DART_WARN("Failed to write the header of recording file [{}].", filename);
+    std::fclose(file);
+    return nullptr;
+  }
+
+  return std::unique_ptr<RecordingFileWriter>(new RecordingFileWriter(file));
+}
+
+//==============================================================================
+RecordingFileWriter::RecordingFileWriter(std::FILE* file)
+  : mFile(file),
+    mIsWriting(false),
+    mSize(recordingFileHeaderSize),
+    mFailed(false),
+    mStop(false)
+{
+  mThread = std::thread(&RecordingFileWriter::run, this);
+}
+
+//==============================================================================
+RecordingFileWriter::~RecordingFileWriter()
+{
+  stop();
+
+  if (mFile)
+    std::fclose(mFile);
+}
+
+//==============================================================================
+std::uint64_t RecordingFileWriter::write(
+    const Eigen::VectorXd& state, std::size_t numContacts)
+{
+  const std::size_t frameSize = static_cast<std::size_t>(state.size()) + 1u;
+
+  std::uint64_t offset;
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    offset = mSize;
+    mSize += frameSize * sizeof(double);
+
+    // The first word holds the number of contacts
+    const std::size_t begin = mQueue.size();
+    mQueue.resize(begin + frameSize);
+    const std::uint64_t count = numContacts;
+    std::memcpy(mQueue.data() + begin, &count, sizeof(count));
+    std::memcpy(
+        mQueue.data() + begin + 1u,
+        state.data(),
+        state.size() * sizeof(double));
+  }
+  mQueueCondition.notify_one();
+
+  return offset;
+}
+
+//==============================================================================
+void RecordingFileWriter::flush()
+{
+  std::unique_lock<std::mutex> lock(mMutex);
+  mWrittenCondition.wait(
+      lock, [this] { return mQueue.empty() && !mIsWriting; });
+  std::fflush(mFile);
+}
+
+//==============================================================================
+bool RecordingFileWriter::close(
+    const std::vector<int>& numDofs,
+    const std::vector<std::uint64_t>& frameOffsets)
+{
+  stop();
+
+  std::uint64_t indexOffset;
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    indexOffset = mSize;
+  }
+
+  bool success = !mFailed && writeWord(mFile, numDofs.size());
+  for (const int dofs : numDofs)
+    success = success && writeWord(mFile, static_cast<std::uint64_t>(dofs));
+  success = success && writeWord(mFile, frameOffsets.size());
+  success = success
+            && writeWords(mFile, frameOffsets.data(), frameOffsets.size());
+  success = success && writeWord(mFile, indexOffset);
+  success = success && writeWords(mFile, indexMagic, 1u);
+
+  success = (std::fclose(mFile) == 0) && success;
+  mFile = nullptr;
+
+  return success;
+}
+
+//==============================================================================
+void RecordingFileWriter::run()
+{
+  std::unique_lock<std::mutex> lock(mMutex);
+  while (true) {
+    mQueueCondition.wait(lock, [this] { return mStop || !mQueue.empty(); });
+
+    if (mQueue.empty()) {
+      DART_ASSERT(mStop);
+      return;
+    }
+
+    // Write the queued frames as one chunk without holding the lock
+    mWriting.swap(mQueue);
+    mIsWriting = true;
+    lock.unlock();
+
+    const bool failed = !writeWords(mFile, mWriting.data(), mWriting.size());
+    mWriting.clear();
+
+    lock.lock();
+    mFailed = mFailed || failed;
+    mIsWriting = false;
+    mWrittenCondition.notify_all();
+  }
+}
+
+//==============================================================================
+void RecordingFileWriter::stop()
+{
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (mStop)
+      return;
+    mStop = true;
+  }
+  mQueueCondition.notify_one();
+  mThread.join();
+}
+
+//==============================================================================
+bool readRecordingFileIndex(
+    const common::detail::MappedFile& file, RecordingFileIndex& index)
+{
+  const std::uint64_t size = file.getSize();
+  if (size < recordingFileHeaderSize + 32u || size % 8u != 0u)
+    return false;
+
+  const unsigned char* data = file.getData();
+  const auto readWord = [data](std::uint64_t offset) {
+    std::uint64_t word;
+    std::memcpy(&word, data + offset, sizeof(word));
+    return word;
+  };
+
+  if (std::memcmp(data, headerMagic, 8u) != 0
+      || readWord(8u) != recordingFileVersion
+      || std::memcmp(data + size - 8u, indexMagic, 8u) != 0)
+    return false;
+
+  // The counts below are compared against the number of words left in the
+  // index instead of being multiplied, so corrupt values can't overflow.
+  const std::uint64_t indexOffset = readWord(size - 16u);
+  if (indexOffset < recordingFileHeaderSize || indexOffset % 8u != 0u
+      || indexOffset > size - 32u)
+    return false;
+
+  std::uint64_t offset = indexOffset;
+  std::uint64_t numWords = (size - 16u - indexOffset) / 8u;
+
+  const std::uint64_t numSkeletons = readWord(offset);
+  offset += 8u;
+  --numWords;
+  if (numSkeletons >= numWords)
+    return false;
+
+  constexpr auto maxDofs
+      = static_cast<std::uint64_t>(std::numeric_limits<int>::max());
+  std::uint64_t totalDofs = 0u;
+  index.numDofs.resize(numSkeletons);
+  for (auto& dofs : index.numDofs) {
+    const std::uint64_t word = readWord(offset);
+    offset += 8u;
+    totalDofs += word;
+    if (word > maxDofs || totalDofs > maxDofs)
+      return false;
+    dofs = static_cast<int>(word);
+  }
+  numWords -= numSkeletons;
+
+  const std::uint64_t numFrames = readWord(offset);
+  offset += 8u;
+  --numWords;
+  if (numFrames != numWords)
+    return false;
+
+  index.frameOffsets.resize(numFrames);
+  std::memcpy(index.frameOffsets.data(), data + offset, 8u * numFrames);
+
+  // Every frame must end where the next one begins and hold its number of
+  // contacts, the generalized coordinates, and 6 values per contact
+  for (std::size_t i = 0u; i < numFrames; ++i) {
+    const std::uint64_t begin = index.frameOffsets[i];
+    const std::uint64_t end
+        = i + 1u < numFrames ? index.frameOffsets[i + 1u] : indexOffset;
+    if (begin < recordingFileHeaderSize || begin % 8u != 0u || end <= begin
+        || end > indexOffset)
+      return false;
+
+    const std::uint64_t numValues = (end - begin) / 8u - 1u;
+    if (numValues < totalDofs || (numValues - totalDofs) % 6u != 0u
+        || (numValues - totalDofs) / 6u != readWord(begin))
+      return false;
+  }
+
+  index.framesEnd = indexOffset;
+
+  return true;
+}
+
+} // namespace dart::simulation::detail
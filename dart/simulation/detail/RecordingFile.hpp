@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef DART_SIMULATION_DETAIL_RECORDINGFILE_HPP_
+#define DART_SIMULATION_DETAIL_RECORDINGFILE_HPP_
+
+#include <dart/common/detail/MappedFile.hpp>
+
+#include <Eigen/Core>
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+namespace dart::simulation::detail {
+
+// A recording file stores the frames of a Recording as follows, where every
+// field is 8 bytes wide and uses the byte order of the writing machine:
+//
+//   header: magic "DARTREC\0", version
+//   frames: [number of contacts, generalized coordinates of all skeletons,
+//            6 * number of contacts contact points and forces] per frame
+//   index:  number of skeletons, number of DOFs per skeleton, number of
+//           frames, byte offset per frame, byte offset of the index,
+//           magic "DARTIDX\0"
+//
+// The index is written when the file is closed, so the frames can be streamed
+// without knowing their number in advance.
+
+/// Version of the recording file format
+inline constexpr std::uint64_t recordingFileVersion = 1u;
+
+/// Size of the recording file header in bytes
+inline constexpr std::uint64_t recordingFileHeaderSize = 16u;
+
+/// Writes the frames of a recording file on a background thread
+class RecordingFileWriter final
+{
+public:
+  /// Creates the file and writes its header. Returns nullptr on failure.
+  static std::unique_ptr<RecordingFileWriter> create(
+      const std::string& filename);
+
+  /// Destructor. Writes the queued frames and closes the file without
+  /// writing the index.
+  ~RecordingFileWriter();
+
+  /// Queues a frame, which consists of the generalized coordinates followed
+  /// by the contact points and forces, and returns its byte offset in the
+  /// file
+  std::uint64_t write(const Eigen::VectorXd& state, std::size_t numContacts);
+
+  /// Blocks until all the queued frames are written to the file
+  void flush();
+
+  /// Writes the queued frames and the index, and closes the file. Returns
+  /// false if writing fails.
+  bool close(
+      const std::vector<int>& numDofs,
+      const std::vector<std::uint64_t>& frameOffsets);
+
+private:
+  explicit RecordingFileWriter(std::FILE* file);
+
+  /// Main loop of the writer thread
+  void run();
+
+  /// Stops the writer thread after all the queued frames are written
+  void stop();
+
+  /// File being written
+  std::FILE* mFile;
+
+  /// Protects the members below
+  std::mutex mMutex;
+
+  /// Signals the writer thread that frames are queued or it should stop
+  std::condition_variable mQueueCondition;
+
+  /// Signals flush() that the queued frames are written
+  std::condition_variable mWrittenCondition;
+
+  /// Frames waiting to be written, each preceded by its number of contacts
+  std::vector<double> mQueue;
+
+  /// Frames being written by the writer thread. Swapped with mQueue, so both
+  /// buffers keep their capacity and queuing a frame doesn't allocate.
+  std::vector<double> mWriting;
+
+  /// Whether the writer thread is writing frames
+  bool mIsWriting;
+
+  /// Size of the file once all the queued frames are written
+  std::uint64_t mSize;
+
+  /// Whether a write failed
+  bool mFailed;
+
+  /// Whether the writer thread should exit
+  bool mStop;
+
+  /// Writer thread
+  std::thread mThread;
+};
+
+/// Index of a recording file
+struct RecordingFileIndex
+{
+  /// Number of DOFs per skeleton
+  std::vector<int> numDofs;
+
+  /// Byte offset per frame
+  std::vector<std::uint64_t> frameOffsets;
+
+  /// Byte offset of the end of the last frame, where the index begins
+  std::uint64_t framesEnd = 0u;
+};
+
+/// Reads the index of a recording file. Returns false if the file is not a
+/// closed recording file or if the index doesn't match the frames, so the
+/// frames of a returned index can be read without further checks.
+bool readRecordingFileIndex(
+    const common::detail::MappedFile& file, RecordingFileIndex& index);
+
+} // namespace dart::simulation::detail
+
+#endif // DART_SIMULATION_DETAIL_RECORDINGFILE_HPP_
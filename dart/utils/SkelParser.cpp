@@ -50,6 +50,7 @@
 #include "dart/dynamics/FreeJoint.hpp"
 #include "dart/dynamics/Joint.hpp"
 #include "dart/dynamics/Marker.hpp"
+#include "dart/dynamics/MeshCache.hpp"
 #include "dart/dynamics/MeshShape.hpp"
 #include "dart/dynamics/MultiSphereConvexHullShape.hpp"
 #include "dart/dynamics/PlanarJoint.hpp"
@@ -1379,7 +1380,7 @@ dynamics::ShapePtr readShape(
 
     const common::Uri meshUri
         = common::Uri::createFromRelativeUri(baseUri, filename);
-    const aiScene* model = dynamics::MeshShape::loadMesh(meshUri, retriever);
+    auto model = dynamics::MeshCache::GetDefault().load(meshUri, retriever);
     if (model) {
       newShape = std::make_shared<dynamics::MeshShape>(
           scale, model, meshUri, retriever);
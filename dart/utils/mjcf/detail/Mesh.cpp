@@ -32,6 +32,7 @@
 
 #include "dart/utils/mjcf/detail/Mesh.hpp"
 
+#include "dart/dynamics/MeshCache.hpp"
 #include "dart/dynamics/MeshShape.hpp"
 #include "dart/utils/XmlHelpers.hpp"
 #include "dart/utils/mjcf/detail/Utils.hpp"
@@ -114,7 +115,7 @@ Errors Mesh::postprocess(const Compiler& /*compiler*/)
 //==============================================================================
 dynamics::MeshShapePtr Mesh::createMeshShape() const
 {
-  const aiScene* model = dynamics::MeshShape::loadMesh(mMeshUri, mRetriever);
+  auto model = dynamics::MeshCache::GetDefault().load(mMeshUri, mRetriever);
   if (model == nullptr) {
     return nullptr;
   }
@@ -36,6 +36,7 @@
 
 #include <dart/dynamics/BoxShape.hpp>
 #include <dart/dynamics/CylinderShape.hpp>
+#include <dart/dynamics/MeshCache.hpp>
 #include <dart/dynamics/MeshShape.hpp>
 #include <dart/dynamics/SphereShape.hpp>
 
@@ -85,7 +86,7 @@ dynamics::ShapePtr readMeshShape(
                                     : Eigen::Vector3d::Ones();
   const std::string meshUri = common::Uri::getRelativeUri(baseUri, uri);
 
-  const aiScene* model = dynamics::MeshShape::loadMesh(meshUri, retriever);
+  auto model = dynamics::MeshCache::GetDefault().load(meshUri, retriever);
   if (!model) {
     DART_WARN("Failed to load mesh model [{}].", meshUri);
     return nullptr;
@@ -38,6 +38,7 @@
 #include "dart/dynamics/CylinderShape.hpp"
 #include "dart/dynamics/FreeJoint.hpp"
 #include "dart/dynamics/Joint.hpp"
+#include "dart/dynamics/MeshCache.hpp"
 #include "dart/dynamics/MeshShape.hpp"
 #include "dart/dynamics/PlanarJoint.hpp"
 #include "dart/dynamics/PrismaticJoint.hpp"
@@ -697,8 +698,8 @@ dynamics::ShapePtr DartLoader::createShape(
 
     // Load the mesh.
     const std::string resolvedUri = absoluteUri.toString();
-    const aiScene* scene
-        = dynamics::MeshShape::loadMesh(resolvedUri, _resourceRetriever);
+    auto scene = dynamics::MeshCache::GetDefault().load(
+        absoluteUri, _resourceRetriever);
     if (!scene)
       return nullptr;
 
@@ -53,6 +53,62 @@ std::string RigidBody::getName() const
   return "";
 }
 
+//==============================================================================
+double RigidBody::getMass() const
+{
+  return getWorld()
+      ->getRegistry()
+      .get<comps::MassProperties>(getEntity())
+      .mass;
+}
+
+//==============================================================================
+const Eigen::Matrix3d& RigidBody::getInertia() const
+{
+  return getWorld()
+      ->getRegistry()
+      .get<comps::MassProperties>(getEntity())
+      .inertia;
+}
+
+//==============================================================================
+const Eigen::Vector3d& RigidBody::getLinearVelocity() const
+{
+  return getWorld()->getRegistry().get<comps::Velocity>(getEntity()).linear;
+}
+
+//==============================================================================
+void RigidBody::setLinearVelocity(const Eigen::Vector3d& velocity)
+{
+  getWorld()->getRegistry().get<comps::Velocity>(getEntity()).linear
+      = velocity;
+}
+
+//==============================================================================
+const Eigen::Vector3d& RigidBody::getAngularVelocity() const
+{
+  return getWorld()->getRegistry().get<comps::Velocity>(getEntity()).angular;
+}
+
+//==============================================================================
+void RigidBody::setAngularVelocity(const Eigen::Vector3d& velocity)
+{
+  getWorld()->getRegistry().get<comps::Velocity>(getEntity()).angular
+      = velocity;
+}
+
+//==============================================================================
+void RigidBody::addForce(const Eigen::Vector3d& force)
+{
+  getWorld()->getRegistry().get<comps::Force>(getEntity()).force += force;
+}
+
+//==============================================================================
+void RigidBody::addTorque(const Eigen::Vector3d& torque)
+{
+  getWorld()->getRegistry().get<comps::Force>(getEntity()).torque += torque;
+}
+
 // getEntity() and isValid() inherited from Frame
 
 } // namespace dart8
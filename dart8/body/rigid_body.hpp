@@ -37,6 +37,7 @@
 #include <dart8/body/rigid_body_options.hpp>
 #include <dart8/frame/frame.hpp>
 
+#include <Eigen/Core>
 #include <entt/entt.hpp>
 
 #include <string>
@@ -53,12 +54,10 @@ namespace dart8 {
 /// frame-related operations such as transform queries, velocity/acceleration
 /// computations (future), and can be used as a reference frame.
 ///
-/// PLACEHOLDER: This is a minimal implementation to demonstrate World's
-/// ability to manage multiple object types (Multibody and RigidBody).
+/// World::step() integrates the velocity and pose of a RigidBody from the
+/// forces and torques applied since the previous step and gravity.
 /// Future enhancements will add:
-/// - Physics properties (mass, inertia, collision shapes)
-/// - State access (pose, velocity)
-/// - Force application
+/// - Collision shapes
 /// - Collision detection integration
 ///
 /// @note RigidBody objects are owned by World and accessed via handles.
@@ -72,12 +71,38 @@ public:
   /// Get the name of the rigid body
   [[nodiscard]] std::string getName() const;
 
+  /// Get the mass in kilograms
+  [[nodiscard]] double getMass() const;
+
+  /// Get the rotational inertia about the center of mass in the body frame
+  [[nodiscard]] const Eigen::Matrix3d& getInertia() const;
+
+  /// Get the linear velocity in the world frame
+  [[nodiscard]] const Eigen::Vector3d& getLinearVelocity() const;
+
+  /// Set the linear velocity in the world frame
+  void setLinearVelocity(const Eigen::Vector3d& velocity);
+
+  /// Get the angular velocity in the world frame
+  [[nodiscard]] const Eigen::Vector3d& getAngularVelocity() const;
+
+  /// Set the angular velocity in the world frame
+  void setAngularVelocity(const Eigen::Vector3d& velocity);
+
+  /// Add a force in the world frame acting at the center of mass
+  ///
+  /// Forces are accumulated until the next World::step(), which clears them.
+  void addForce(const Eigen::Vector3d& force);
+
+  /// Add a torque in the world frame
+  ///
+  /// Torques are accumulated until the next World::step(), which clears them.
+  void addTorque(const Eigen::Vector3d& torque);
+
   // Note: getEntity(), getWorld(), isValid() inherited from Frame
 
   // TODO: Add methods for:
-  // - Getting/setting pose
-  // - Getting/setting velocity
-  // - Applying forces/torques
+  // - Setting pose
   // - Accessing collision shapes
   // - Enabling/disabling physics
 };
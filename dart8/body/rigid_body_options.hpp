@@ -32,6 +32,9 @@
 
 #pragma once
 
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
 namespace dart8 {
 
 /// Options for creating a RigidBody
@@ -41,9 +44,25 @@ namespace dart8 {
 /// a RigidBody is a single solid object with 6 DOFs (position and orientation).
 struct RigidBodyOptions
 {
-  // TODO: Add physics properties (mass, inertia, shape, etc.)
-  // TODO: Add initial pose (position, orientation)
-  // TODO: Add initial velocity (linear, angular)
+  /// Mass in kilograms (must be positive)
+  double mass = 1.0;
+
+  /// Rotational inertia about the center of mass in the body frame
+  Eigen::Matrix3d inertia = Eigen::Matrix3d::Identity();
+
+  /// Initial position of the center of mass in the world frame
+  Eigen::Vector3d position = Eigen::Vector3d::Zero();
+
+  /// Initial orientation in the world frame
+  Eigen::Quaterniond orientation = Eigen::Quaterniond::Identity();
+
+  /// Initial linear velocity in the world frame
+  Eigen::Vector3d linearVelocity = Eigen::Vector3d::Zero();
+
+  /// Initial angular velocity in the world frame
+  Eigen::Vector3d angularVelocity = Eigen::Vector3d::Zero();
+
+  // TODO: Add shapes
 };
 
 } // namespace dart8
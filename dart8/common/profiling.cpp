@@ -33,95 +33,668 @@
 #include "dart8/common/profiling.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <deque>
 #include <iomanip>
 #include <iostream>
 #include <limits>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
-#include <vector>
+#include <utility>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__)                \
+    || defined(_M_IX86)
+  #if defined(_MSC_VER)
+    #include <intrin.h>
+  #else
+    #include <x86intrin.h>
+  #endif
+  #define DART8_PROFILE_HAS_TSC 1
+#endif
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/// Reads the time-stamp counter, or the steady clock in nanoseconds where no
+/// counter is available
+std::uint64_t readTicks()
+{
+#ifdef DART8_PROFILE_HAS_TSC
+  return __rdtsc();
+#else
+  return static_cast<std::uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          Clock::now().time_since_epoch())
+          .count());
+#endif
+}
+
+/// Node of a per-thread call tree. Node 0 is the root, which is not a zone.
+struct CallNode
+{
+  std::uint32_t zone{0};
+  std::int32_t parent{-1};
+  std::int32_t firstChild{-1};
+  std::int32_t nextSibling{-1};
+  std::uint64_t count{0};
+  std::uint64_t totalTicks{0};
+  std::uint64_t minTicks{std::numeric_limits<std::uint64_t>::max()};
+  std::uint64_t maxTicks{0};
+};
+
+struct OpenZone
+{
+  std::int32_t node;
+  std::uint64_t startTicks;
+};
+
+struct TraceEvent
+{
+  std::uint32_t zone;
+  std::uint32_t depth;
+  std::uint64_t startTicks;
+  std::uint64_t endTicks;
+};
+
+/// Profiling buffer of a single thread
+///
+/// The recording thread locks the buffer for every zone it enters or leaves,
+/// which is uncontended unless the results are being read at the same time.
+struct ThreadProfile
+{
+  explicit ThreadProfile(std::size_t threadIndex) : index(threadIndex)
+  {
+    clear();
+  }
+
+  void clear()
+  {
+    nodes.assign(1, CallNode{});
+    current = 0;
+    stack.clear();
+    events.clear();
+    droppedEvents = 0;
+  }
+
+  /// Protects everything below except the index, which is only accessed
+  /// under Profiler::mutex
+  std::mutex mutex;
+
+  std::size_t index;
+  std::vector<CallNode> nodes;
+  std::int32_t current{0};
+  std::vector<OpenZone> stack;
+  std::vector<TraceEvent> events;
+  std::size_t droppedEvents{0};
+};
+
+/// Process-wide profiler state
+struct Profiler
+{
+  Profiler() : startTicks(readTicks()), startTime(Clock::now()) {}
+
+  /// Protects the zone names, the list of thread buffers, their indices, and
+  /// the results of exited threads. Locked before the mutex of a buffer.
+  std::mutex mutex;
+
+  /// Deque so that the names never move once interned
+  std::deque<std::string> zoneNames;
+  std::unordered_map<std::string, std::uint32_t> zoneIds;
+
+  /// Buffers of the live threads and cleared buffers of exited threads
+  std::vector<std::unique_ptr<ThreadProfile>> threads;
+
+  /// Cleared buffers of exited threads, which the next new threads record
+  /// into
+  std::vector<ThreadProfile*> freeThreads;
+
+  /// Index of the next thread that starts recording
+  std::size_t nextThreadIndex{0};
+
+  /// Call trees of the exited threads merged into one
+  ThreadProfile exitedThreads{dart8::common::ProfileStats::exitedThreadIndex};
+
+  /// Trace events of the exited threads with the index of their thread
+  std::vector<std::pair<std::size_t, TraceEvent>> exitedEvents;
+
+  std::atomic<bool> traceEnabled{false};
+  std::atomic<std::size_t> traceCapacity{std::size_t{1} << 20};
+
+  /// Reference point for converting ticks to nanoseconds
+  std::uint64_t startTicks;
+  Clock::time_point startTime;
+};
+
+Profiler& getProfiler()
+{
+  static Profiler profiler;
+  return profiler;
+}
+
+/// Returns the child of a node for a zone, adding it if needed
+std::int32_t getOrAddChild(
+    ThreadProfile& profile, std::int32_t parent, std::uint32_t zoneId)
+{
+  auto& nodes = profile.nodes;
+  std::int32_t child = nodes[parent].firstChild;
+  while (child >= 0 && nodes[child].zone != zoneId) {
+    child = nodes[child].nextSibling;
+  }
+
+  if (child < 0) {
+    CallNode node;
+    node.zone = zoneId;
+    node.parent = parent;
+    node.nextSibling = nodes[parent].firstChild;
+    child = static_cast<std::int32_t>(nodes.size());
+    nodes.push_back(node);
+    nodes[parent].firstChild = child;
+  }
+
+  return child;
+}
+
+/// Returns the children of a node in the order they were first entered
+std::vector<std::int32_t> getChildren(
+    const ThreadProfile& profile, std::int32_t index)
+{
+  std::vector<std::int32_t> children;
+  for (auto child = profile.nodes[index].firstChild; child >= 0;
+       child = profile.nodes[child].nextSibling) {
+    children.push_back(child);
+  }
+  std::reverse(children.begin(), children.end());
+  return children;
+}
+
+/// Adds the subtree below a node of source to the matching node of target
+void mergeCallTree(
+    ThreadProfile& target,
+    std::int32_t targetIndex,
+    const ThreadProfile& source,
+    std::int32_t sourceIndex)
+{
+  for (const auto child : getChildren(source, sourceIndex)) {
+    const auto& node = source.nodes[child];
+    const auto merged = getOrAddChild(target, targetIndex, node.zone);
+    auto& mergedNode = target.nodes[merged];
+    mergedNode.count += node.count;
+    mergedNode.totalTicks += node.totalTicks;
+    mergedNode.minTicks = std::min(mergedNode.minTicks, node.minTicks);
+    mergedNode.maxTicks = std::max(mergedNode.maxTicks, node.maxTicks);
+    mergeCallTree(target, merged, source, child);
+  }
+}
+
+/// Binds a buffer to the calling thread and releases it when the thread
+/// exits, so that the number of buffers is bounded by the number of threads
+/// alive at the same time
+class ThreadProfileHandle
+{
+public:
+  ThreadProfileHandle()
+  {
+    auto& profiler = getProfiler();
+    std::lock_guard<std::mutex> lock(profiler.mutex);
+    const std::size_t index = profiler.nextThreadIndex++;
+    if (profiler.freeThreads.empty()) {
+      profiler.threads.push_back(std::make_unique<ThreadProfile>(index));
+      m_profile = profiler.threads.back().get();
+    } else {
+      m_profile = profiler.freeThreads.back();
+      profiler.freeThreads.pop_back();
+      m_profile->index = index;
+    }
+  }
+
+  ~ThreadProfileHandle()
+  {
+    // Move the results into the ones of the exited threads, so that the
+    // buffer starts empty for the next thread
+    auto& profiler = getProfiler();
+    std::lock_guard<std::mutex> lock(profiler.mutex);
+    {
+      std::lock_guard<std::mutex> profileLock(m_profile->mutex);
+      mergeCallTree(profiler.exitedThreads, 0, *m_profile, 0);
+
+      // The events of the exited threads share one capacity
+      const std::size_t capacity
+          = profiler.traceCapacity.load(std::memory_order_relaxed);
+      for (const auto& event : m_profile->events) {
+        if (profiler.exitedEvents.size() < capacity) {
+          profiler.exitedEvents.emplace_back(m_profile->index, event);
+        } else {
+          ++profiler.exitedThreads.droppedEvents;
+        }
+      }
+      profiler.exitedThreads.droppedEvents += m_profile->droppedEvents;
+
+      m_profile->clear();
+    }
+    profiler.freeThreads.push_back(m_profile);
+  }
+
+  ThreadProfileHandle(const ThreadProfileHandle&) = delete;
+  ThreadProfileHandle& operator=(const ThreadProfileHandle&) = delete;
+
+  ThreadProfile& get() const
+  {
+    return *m_profile;
+  }
+
+private:
+  ThreadProfile* m_profile;
+};
+
+ThreadProfile& getThreadProfile()
+{
+  thread_local ThreadProfileHandle handle;
+  return handle.get();
+}
+
+/// Returns the duration of one tick in nanoseconds
+double getNanosecondsPerTick(const Profiler& profiler)
+{
+#ifdef DART8_PROFILE_HAS_TSC
+  // Calibrate against the steady clock over at least 10 ms since the
+  // reference point
+  auto now = Clock::now();
+  auto ticks = readTicks();
+  while (now - profiler.startTime < std::chrono::milliseconds(10)) {
+    now = Clock::now();
+    ticks = readTicks();
+  }
+
+  const auto nanoseconds
+      = std::chrono::duration<double, std::nano>(now - profiler.startTime);
+  return nanoseconds.count() / static_cast<double>(ticks - profiler.startTicks);
+#else
+  (void)profiler;
+  return 1.0;
+#endif
+}
+
+/// Returns the time of a node excluding its children in ticks
+std::uint64_t getSelfTicks(const ThreadProfile& profile, std::int32_t index)
+{
+  const auto& node = profile.nodes[index];
+  std::uint64_t childTicks = 0;
+  for (auto child = node.firstChild; child >= 0;
+       child = profile.nodes[child].nextSibling) {
+    childTicks += profile.nodes[child].totalTicks;
+  }
+  return node.totalTicks > childTicks ? node.totalTicks - childTicks : 0;
+}
+
+void writeJsonString(std::ostream& output, std::string_view text)
+{
+  output << '"';
+  for (const char c : text) {
+    switch (c) {
+      case '"':
+        output << "\\\"";
+        break;
+      case '\\':
+        output << "\\\\";
+        break;
+      case '\n':
+        output << "\\n";
+        break;
+      case '\t':
+        output << "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          output << ' ';
+        } else {
+          output << c;
+        }
+    }
+  }
+  output << '"';
+}
+
+} // namespace
 
 namespace dart8::common {
 
-void ScopedTimer::reportDuration(std::string_view name, long long microseconds)
+//==============================================================================
+ProfileZone::ProfileZone(std::string_view name)
+{
+  auto& profiler = getProfiler();
+  std::lock_guard<std::mutex> lock(profiler.mutex);
+
+  const auto [it, inserted] = profiler.zoneIds.try_emplace(
+      std::string(name),
+      static_cast<std::uint32_t>(profiler.zoneNames.size()));
+  if (inserted) {
+    profiler.zoneNames.emplace_back(name);
+  }
+  m_id = it->second;
+}
+
+//==============================================================================
+std::string_view ProfileZone::getName() const
 {
-  ProfileStats::record(name, microseconds);
+  auto& profiler = getProfiler();
+  std::lock_guard<std::mutex> lock(profiler.mutex);
+  return profiler.zoneNames[m_id];
+}
+
+//==============================================================================
+void ProfileStats::beginZone(std::uint32_t zoneId)
+{
+  auto& profile = getThreadProfile();
+  std::lock_guard<std::mutex> lock(profile.mutex);
+
+  const std::int32_t child = getOrAddChild(profile, profile.current, zoneId);
+  profile.current = child;
+  profile.stack.push_back({child, readTicks()});
+}
+
+//==============================================================================
+void ProfileStats::endZone()
+{
+  const std::uint64_t endTicks = readTicks();
+  auto& profile = getThreadProfile();
+  std::lock_guard<std::mutex> lock(profile.mutex);
+
+  // Zones that were open during reset() are ignored
+  if (profile.stack.empty()) {
+    return;
+  }
+
+  const OpenZone open = profile.stack.back();
+  profile.stack.pop_back();
+
+  auto& node = profile.nodes[open.node];
+  const std::uint64_t ticks = endTicks - open.startTicks;
+  ++node.count;
+  node.totalTicks += ticks;
+  node.minTicks = std::min(node.minTicks, ticks);
+  node.maxTicks = std::max(node.maxTicks, ticks);
+  profile.current = node.parent;
+
+  auto& profiler = getProfiler();
+  if (profiler.traceEnabled.load(std::memory_order_relaxed)) {
+    if (profile.events.size()
+        < profiler.traceCapacity.load(std::memory_order_relaxed)) {
+      profile.events.push_back(
+          {node.zone,
+           static_cast<std::uint32_t>(profile.stack.size()),
+           open.startTicks,
+           endTicks});
+    } else {
+      ++profile.droppedEvents;
+    }
+  }
 }
 
-void ProfileStats::record(std::string_view name, long long microseconds)
+//==============================================================================
+std::vector<ProfileStats::Entry> ProfileStats::summary()
 {
-  auto& entries = entriesInternal();
-  auto& entry = entries[std::string(name)];
+  auto& profiler = getProfiler();
+  const double nanosecondsPerTick = getNanosecondsPerTick(profiler);
+  std::lock_guard<std::mutex> lock(profiler.mutex);
+
+  std::vector<Entry> entries;
+  std::vector<int> entryIndices(profiler.zoneNames.size(), -1);
+
+  const auto addProfile = [&](const ThreadProfile& profile) {
+    for (std::size_t i = 1; i < profile.nodes.size(); ++i) {
+      const auto& node = profile.nodes[i];
+      if (node.count == 0) {
+        continue;
+      }
+
+      int& entryIndex = entryIndices[node.zone];
+      if (entryIndex < 0) {
+        entryIndex = static_cast<int>(entries.size());
+        Entry entry;
+        entry.name = profiler.zoneNames[node.zone];
+        entry.minNanoseconds = std::numeric_limits<double>::max();
+        entries.push_back(std::move(entry));
+      }
 
-  if (entry.name.empty()) {
-    entry.name = name;
+      auto& entry = entries[entryIndex];
+      const auto selfTicks
+          = getSelfTicks(profile, static_cast<std::int32_t>(i));
+      entry.count += static_cast<long long>(node.count);
+      entry.totalNanoseconds += node.totalTicks * nanosecondsPerTick;
+      entry.selfNanoseconds += selfTicks * nanosecondsPerTick;
+      entry.minNanoseconds
+          = std::min(entry.minNanoseconds, node.minTicks * nanosecondsPerTick);
+      entry.maxNanoseconds
+          = std::max(entry.maxNanoseconds, node.maxTicks * nanosecondsPerTick);
+    }
+  };
+
+  for (const auto& profile : profiler.threads) {
+    std::lock_guard<std::mutex> profileLock(profile->mutex);
+    addProfile(*profile);
   }
+  addProfile(profiler.exitedThreads);
+
+  std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+    return a.totalNanoseconds > b.totalNanoseconds;
+  });
 
-  entry.totalMicroseconds += microseconds;
-  entry.count++;
-  entry.minMicroseconds = std::min(entry.minMicroseconds, microseconds);
-  entry.maxMicroseconds = std::max(entry.maxMicroseconds, microseconds);
+  return entries;
 }
 
-const std::unordered_map<std::string, ProfileStats::Entry>&
-ProfileStats::entries()
+//==============================================================================
+std::vector<ProfileStats::CallTreeNode> ProfileStats::callTree()
 {
-  return entriesInternal();
+  auto& profiler = getProfiler();
+  const double nanosecondsPerTick = getNanosecondsPerTick(profiler);
+  std::lock_guard<std::mutex> lock(profiler.mutex);
+
+  std::vector<CallTreeNode> result;
+  const auto addProfile = [&](const ThreadProfile& profile) {
+    // Depth-first traversal with an explicit stack of (node, depth)
+    std::vector<std::pair<std::int32_t, std::size_t>> stack;
+    auto roots = getChildren(profile, 0);
+    for (auto it = roots.rbegin(); it != roots.rend(); ++it) {
+      stack.emplace_back(*it, 0);
+    }
+
+    while (!stack.empty()) {
+      const auto [index, depth] = stack.back();
+      stack.pop_back();
+
+      const auto& node = profile.nodes[index];
+      CallTreeNode treeNode;
+      treeNode.name = profiler.zoneNames[node.zone];
+      treeNode.threadIndex = profile.index;
+      treeNode.depth = depth;
+      treeNode.count = static_cast<long long>(node.count);
+      treeNode.totalNanoseconds = node.totalTicks * nanosecondsPerTick;
+      treeNode.selfNanoseconds
+          = getSelfTicks(profile, index) * nanosecondsPerTick;
+      result.push_back(std::move(treeNode));
+
+      auto children = getChildren(profile, index);
+      for (auto it = children.rbegin(); it != children.rend(); ++it) {
+        stack.emplace_back(*it, depth + 1);
+      }
+    }
+  };
+
+  for (const auto& profile : profiler.threads) {
+    std::lock_guard<std::mutex> profileLock(profile->mutex);
+    addProfile(*profile);
+  }
+  addProfile(profiler.exitedThreads);
+
+  return result;
 }
 
+//==============================================================================
+void ProfileStats::setTraceEnabled(bool enabled)
+{
+  getProfiler().traceEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+//==============================================================================
+bool ProfileStats::isTraceEnabled()
+{
+  return getProfiler().traceEnabled.load(std::memory_order_relaxed);
+}
+
+//==============================================================================
+void ProfileStats::setTraceCapacity(std::size_t eventsPerThread)
+{
+  getProfiler().traceCapacity.store(
+      eventsPerThread, std::memory_order_relaxed);
+}
+
+//==============================================================================
+void ProfileStats::writeChromeTrace(std::ostream& output)
+{
+  auto& profiler = getProfiler();
+  const double nanosecondsPerTick = getNanosecondsPerTick(profiler);
+  std::lock_guard<std::mutex> lock(profiler.mutex);
+
+  // Timestamps are in microseconds relative to the profiler start
+  auto toMicroseconds = [&](std::uint64_t ticks) {
+    const double relativeTicks = static_cast<double>(ticks)
+                                 - static_cast<double>(profiler.startTicks);
+    return relativeTicks * nanosecondsPerTick * 1e-3;
+  };
+
+  const auto flags = output.flags();
+  const auto precision = output.precision();
+  output << std::fixed << std::setprecision(3);
+
+  bool first = true;
+  const auto writeThreadName = [&](std::size_t thread) {
+    output << (first ? "\n" : ",\n");
+    first = false;
+    output << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":"
+           << thread << ",\"args\":{\"name\":\"Thread " << thread << "\"}}";
+  };
+  const auto writeEvent = [&](std::size_t thread, const TraceEvent& event) {
+    output << ",\n{\"name\":";
+    writeJsonString(output, profiler.zoneNames[event.zone]);
+    output << ",\"cat\":\"dart8\",\"ph\":\"X\",\"pid\":0,\"tid\":" << thread
+           << ",\"ts\":" << toMicroseconds(event.startTicks) << ",\"dur\":"
+           << (event.endTicks - event.startTicks) * nanosecondsPerTick * 1e-3
+           << ",\"args\":{\"depth\":" << event.depth << "}}";
+  };
+
+  output << "{\"traceEvents\":[";
+  for (const auto& profile : profiler.threads) {
+    std::lock_guard<std::mutex> profileLock(profile->mutex);
+    if (profile->events.empty() && profile->nodes.size() == 1) {
+      continue;
+    }
+
+    writeThreadName(profile->index);
+    for (const auto& event : profile->events) {
+      writeEvent(profile->index, event);
+    }
+  }
+
+  // The events of an exited thread are contiguous
+  for (std::size_t i = 0; i < profiler.exitedEvents.size(); ++i) {
+    const auto& [thread, event] = profiler.exitedEvents[i];
+    if (i == 0 || profiler.exitedEvents[i - 1].first != thread) {
+      writeThreadName(thread);
+    }
+    writeEvent(thread, event);
+  }
+  output << "\n],\"displayTimeUnit\":\"ns\"}\n";
+
+  output.flags(flags);
+  output.precision(precision);
+}
+
+//==============================================================================
 void ProfileStats::reset()
 {
-  entriesInternal().clear();
+  auto& profiler = getProfiler();
+  std::lock_guard<std::mutex> lock(profiler.mutex);
+  for (auto& profile : profiler.threads) {
+    std::lock_guard<std::mutex> profileLock(profile->mutex);
+    profile->clear();
+  }
+  profiler.exitedThreads.clear();
+  profiler.exitedEvents.clear();
 }
 
+//==============================================================================
 void ProfileStats::printSummary()
 {
-  const auto& entries = entriesInternal();
+  printSummary(std::cout);
+}
+
+//==============================================================================
+void ProfileStats::printSummary(std::ostream& output)
+{
+  const auto entries = summary();
 
   if (entries.empty()) {
-    std::cout << "No profiling data collected.\n";
+    output << "No profiling data collected.\n";
     return;
   }
 
-  // Convert to vector for sorting
-  std::vector<Entry> sortedEntries;
-  sortedEntries.reserve(entries.size());
-  for (const auto& [_, entry] : entries) {
-    sortedEntries.push_back(entry);
-  }
-
-  // Sort by total time (descending)
-  std::sort(
-      sortedEntries.begin(),
-      sortedEntries.end(),
-      [](const Entry& a, const Entry& b) {
-        return a.totalMicroseconds > b.totalMicroseconds;
-      });
+  const auto flags = output.flags();
+  const auto precision = output.precision();
 
   // Print header
-  std::cout << "\n=== Profiling Summary ===\n\n";
-  std::cout << std::left << std::setw(40) << "Name" << std::right
-            << std::setw(12) << "Calls" << std::setw(15) << "Total (ms)"
-            << std::setw(15) << "Avg (ms)" << std::setw(15) << "Min (ms)"
-            << std::setw(15) << "Max (ms)" << '\n';
-  std::cout << std::string(112, '-') << '\n';
+  output << "\n=== Profiling Summary ===\n\n";
+  output << std::left << std::setw(40) << "Name" << std::right << std::setw(12)
+         << "Calls" << std::setw(15) << "Total (ms)" << std::setw(15)
+         << "Self (ms)" << std::setw(15) << "Avg (us)" << std::setw(15)
+         << "Min (us)" << std::setw(15) << "Max (us)" << '\n';
+  output << std::string(127, '-') << '\n';
 
   // Print entries
-  for (const auto& entry : sortedEntries) {
-    std::cout << std::left << std::setw(40) << entry.name << std::right
-              << std::setw(12) << entry.count << std::setw(15) << std::fixed
-              << std::setprecision(3) << (entry.totalMicroseconds / 1000.0)
-              << std::setw(15) << (entry.averageMicroseconds() / 1000.0)
-              << std::setw(15) << (entry.minMicroseconds / 1000.0)
-              << std::setw(15) << (entry.maxMicroseconds / 1000.0) << '\n';
+  for (const auto& entry : entries) {
+    output << std::left << std::setw(40) << entry.name << std::right
+           << std::setw(12) << entry.count << std::setw(15) << std::fixed
+           << std::setprecision(3) << (entry.totalNanoseconds * 1e-6)
+           << std::setw(15) << (entry.selfNanoseconds * 1e-6) << std::setw(15)
+           << (entry.averageNanoseconds() * 1e-3) << std::setw(15)
+           << (entry.minNanoseconds * 1e-3) << std::setw(15)
+           << (entry.maxNanoseconds * 1e-3) << '\n';
   }
 
-  std::cout << '\n';
+  output << '\n';
+  output.flags(flags);
+  output.precision(precision);
 }
 
-std::unordered_map<std::string, ProfileStats::Entry>&
-ProfileStats::entriesInternal()
+//==============================================================================
+void ProfileStats::printCallTree(std::ostream& output)
 {
-  static std::unordered_map<std::string, Entry> s_entries;
-  return s_entries;
+  const auto nodes = callTree();
+
+  if (nodes.empty()) {
+    output << "No profiling data collected.\n";
+    return;
+  }
+
+  const auto flags = output.flags();
+  const auto precision = output.precision();
+  output << std::fixed << std::setprecision(3);
+
+  std::size_t thread = std::numeric_limits<std::size_t>::max();
+  for (const auto& node : nodes) {
+    if (node.threadIndex != thread) {
+      thread = node.threadIndex;
+      output << "Thread " << thread << '\n';
+    }
+
+    output << std::string(2 * (node.depth + 1), ' ') << node.name << "  "
+           << node.count << " calls, " << (node.totalNanoseconds * 1e-6)
+           << " ms total, " << (node.selfNanoseconds * 1e-6) << " ms self\n";
+  }
+
+  output.flags(flags);
+  output.precision(precision);
 }
 
 } // namespace dart8::common
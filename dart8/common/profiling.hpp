@@ -35,30 +35,185 @@
 #include <dart8/export.hpp>
 
 #include <chrono>
+#include <iosfwd>
 #include <limits>
 #include <string>
 #include <string_view>
-#include <unordered_map>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
 
 namespace dart8::common {
 
+/// Interned profiling zone
+///
+/// Maps a zone name to a small integer ID once, so that entering the zone
+/// never touches the name again. The profiling macros create one static
+/// ProfileZone per call site. Zones with the same name share their ID.
+class DART8_API ProfileZone
+{
+public:
+  /// Interns the name, which is thread-safe
+  explicit ProfileZone(std::string_view name);
+
+  /// Get the interned ID
+  [[nodiscard]] std::uint32_t getId() const
+  {
+    return m_id;
+  }
+
+  /// Get the zone name
+  [[nodiscard]] std::string_view getName() const;
+
+private:
+  std::uint32_t m_id;
+};
+
+/// Hierarchical profiler with per-thread call trees
+///
+/// Every thread records into its own buffer, so zones can be entered
+/// concurrently without contention. Nested zones form a call tree per thread
+/// whose nodes accumulate the call count and the inclusive time. Timestamps
+/// come from the CPU time-stamp counter where available and are converted to
+/// nanoseconds only when the results are read.
+///
+/// Optionally, every zone is also recorded as a trace event that can be
+/// exported to the Chrome trace format (chrome://tracing, Perfetto).
+///
+/// The results can be read and reset while other threads record: each buffer
+/// is locked while it is read, so the results of a thread are consistent, but
+/// zones that are still open are not included. When a thread exits, its call
+/// tree is merged into the one of all the exited threads and its buffer is
+/// cleared for the next new thread.
+class DART8_API ProfileStats
+{
+public:
+  /// Flat statistics of one zone merged over all call paths and threads
+  struct Entry
+  {
+    std::string name;
+    long long count{0};
+
+    /// Time spent in the zone including nested zones
+    double totalNanoseconds{0.0};
+
+    /// Time spent in the zone excluding nested zones
+    double selfNanoseconds{0.0};
+
+    double minNanoseconds{0.0};
+    double maxNanoseconds{0.0};
+
+    [[nodiscard]] double averageNanoseconds() const
+    {
+      return count > 0 ? totalNanoseconds / count : 0.0;
+    }
+  };
+
+  /// Thread index of the merged call tree of the exited threads
+  static constexpr std::size_t exitedThreadIndex
+      = std::numeric_limits<std::size_t>::max();
+
+  /// Node of a per-thread call tree
+  struct CallTreeNode
+  {
+    std::string name;
+
+    /// Index of the recording thread, which is unique for the lifetime of
+    /// the process, or exitedThreadIndex for the merged tree of the threads
+    /// that have exited
+    std::size_t threadIndex{0};
+
+    /// Nesting depth, which is 0 for outermost zones
+    std::size_t depth{0};
+
+    long long count{0};
+    double totalNanoseconds{0.0};
+    double selfNanoseconds{0.0};
+  };
+
+  /// Enters a zone on the calling thread
+  static void beginZone(std::uint32_t zoneId);
+
+  /// Leaves the innermost zone of the calling thread
+  static void endZone();
+
+  /// Get the flat statistics of all zones sorted by total time (descending)
+  [[nodiscard]] static std::vector<Entry> summary();
+
+  /// Get the call trees of all threads in depth-first order
+  [[nodiscard]] static std::vector<CallTreeNode> callTree();
+
+  /// Enables or disables recording trace events for writeChromeTrace()
+  static void setTraceEnabled(bool enabled);
+
+  /// Returns whether trace events are recorded
+  [[nodiscard]] static bool isTraceEnabled();
+
+  /// Sets the maximum number of trace events kept per live thread and for all
+  /// the exited threads together. Later events are dropped.
+  static void setTraceCapacity(std::size_t eventsPerThread);
+
+  /// Writes the recorded trace events in the Chrome trace JSON format
+  static void writeChromeTrace(std::ostream& output);
+
+  /// Reset all statistics and trace events
+  static void reset();
+
+  /// Print the flat summary to stdout
+  static void printSummary();
+
+  /// Print the flat summary
+  static void printSummary(std::ostream& output);
+
+  /// Print the call trees with indentation by nesting depth
+  static void printCallTree(std::ostream& output);
+};
+
+/// RAII guard that enters a zone for its lifetime
+class ProfileScope
+{
+public:
+  explicit ProfileScope(const ProfileZone& zone)
+  {
+    ProfileStats::beginZone(zone.getId());
+  }
+
+  ~ProfileScope()
+  {
+    ProfileStats::endZone();
+  }
+
+  ProfileScope(const ProfileScope&) = delete;
+  ProfileScope& operator=(const ProfileScope&) = delete;
+};
+
 /// Simple RAII timer for profiling
+///
+/// Records a zone like DART8_PROFILE_SCOPE. Constructing it from a name
+/// interns the name every time, so hot code should pass a static ProfileZone
+/// instead.
 class DART8_API ScopedTimer
 {
 public:
-  explicit ScopedTimer(std::string_view name)
-    : m_name(name), m_start(std::chrono::high_resolution_clock::now())
+  explicit ScopedTimer(const ProfileZone& zone)
+    : m_start(std::chrono::high_resolution_clock::now())
+  {
+    ProfileStats::beginZone(zone.getId());
+  }
+
+  explicit ScopedTimer(std::string_view name) : ScopedTimer(ProfileZone(name))
   {
   }
 
   ~ScopedTimer()
   {
-    auto end = std::chrono::high_resolution_clock::now();
-    auto duration
-        = std::chrono::duration_cast<std::chrono::microseconds>(end - m_start);
-    reportDuration(m_name, duration.count());
+    ProfileStats::endZone();
   }
 
+  ScopedTimer(const ScopedTimer&) = delete;
+  ScopedTimer& operator=(const ScopedTimer&) = delete;
+
   /// Get elapsed time in microseconds
   [[nodiscard]] long long elapsed() const
   {
@@ -68,9 +223,6 @@ public:
   }
 
 private:
-  static void reportDuration(std::string_view name, long long microseconds);
-
-  std::string m_name;
   std::chrono::high_resolution_clock::time_point m_start;
 };
 
@@ -128,40 +280,6 @@ private:
   std::chrono::high_resolution_clock::time_point m_start;
 };
 
-/// Profile statistics aggregator
-class DART8_API ProfileStats
-{
-public:
-  struct Entry
-  {
-    std::string name;
-    long long totalMicroseconds{0};
-    long long count{0};
-    long long minMicroseconds{std::numeric_limits<long long>::max()};
-    long long maxMicroseconds{0};
-
-    [[nodiscard]] double averageMicroseconds() const
-    {
-      return count > 0 ? static_cast<double>(totalMicroseconds) / count : 0.0;
-    }
-  };
-
-  /// Record a timing measurement
-  static void record(std::string_view name, long long microseconds);
-
-  /// Get all profile entries
-  static const std::unordered_map<std::string, Entry>& entries();
-
-  /// Reset all statistics
-  static void reset();
-
-  /// Print summary to stdout
-  static void printSummary();
-
-private:
-  static std::unordered_map<std::string, Entry>& entriesInternal();
-};
-
 } // namespace dart8::common
 
 //===============================================================================
@@ -182,26 +300,28 @@ private:
 
 // Profiling macros
 
+#define DART8_PROFILE_CONCAT_IMPL(a, b) a##b
+#define DART8_PROFILE_CONCAT(a, b) DART8_PROFILE_CONCAT_IMPL(a, b)
+
 #if defined(DART8_ENABLE_PROFILING) && !defined(TRACY_ENABLE)
 // Built-in profiling only
 
   #define DART8_PROFILE_SCOPE(name)                                            \
-    ::dart8::common::ScopedTimer _dart_profile_timer##__LINE__(name)
+    static const ::dart8::common::ProfileZone DART8_PROFILE_CONCAT(            \
+        _dart_profile_zone, __LINE__)(name);                                   \
+    const ::dart8::common::ProfileScope DART8_PROFILE_CONCAT(                  \
+        _dart_profile_scope, __LINE__)(                                        \
+        DART8_PROFILE_CONCAT(_dart_profile_zone, __LINE__))
 
   #define DART8_PROFILE_FUNCTION() DART8_PROFILE_SCOPE(__PRETTY_FUNCTION__)
 
+  // Manual zones must be properly nested with other zones
   #define DART8_PROFILE_BEGIN(name)                                            \
-    auto _dart_profile_start_##name = std::chrono::high_resolution_clock::now()
-
-  #define DART8_PROFILE_END(name)                                              \
-    do {                                                                       \
-      auto _dart_profile_end = std::chrono::high_resolution_clock::now();      \
-      auto _dart_profile_duration                                              \
-          = std::chrono::duration_cast<std::chrono::microseconds>(             \
-              _dart_profile_end - _dart_profile_start_##name);                 \
-      ::dart8::common::ProfileStats::record(                                   \
-          #name, _dart_profile_duration.count());                              \
-    } while (false)
+    static const ::dart8::common::ProfileZone _dart_profile_zone_##name(       \
+        #name);                                                                \
+    ::dart8::common::ProfileStats::beginZone(_dart_profile_zone_##name.getId())
+
+  #define DART8_PROFILE_END(name) ::dart8::common::ProfileStats::endZone()
 
   #define DART8_PROFILE_FRAME() ((void)0)
 
@@ -223,7 +343,11 @@ private:
   #ifdef DART8_ENABLE_PROFILING
     #define DART8_PROFILE_SCOPE_DUAL(name)                                     \
       ZoneScopedN(name);                                                       \
-      ::dart8::common::ScopedTimer _dart_profile_timer##__LINE__(name)
+      static const ::dart8::common::ProfileZone DART8_PROFILE_CONCAT(          \
+          _dart_profile_zone, __LINE__)(name);                                 \
+      const ::dart8::common::ScopedTimer DART8_PROFILE_CONCAT(                 \
+          _dart_profile_timer, __LINE__)(                                      \
+          DART8_PROFILE_CONCAT(_dart_profile_zone, __LINE__))
   #else
     #define DART8_PROFILE_SCOPE_DUAL(name) DART8_PROFILE_SCOPE(name)
   #endif
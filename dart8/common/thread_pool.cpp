@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "dart8/common/thread_pool.hpp"
+
+#include <algorithm>
+
+namespace {
+
+/// The pool whose task the current thread is running, if any
+thread_local const dart8::common::ThreadPool* currentPool = nullptr;
+
+/// The worker index of the current thread in currentPool
+thread_local std::size_t currentWorkerIndex = 0;
+
+} // namespace
+
+namespace dart8::common {
+
+//==============================================================================
+ThreadPool::ThreadPool(std::size_t numThreads)
+{
+  if (numThreads == 0) {
+    numThreads = getDefaultNumThreads();
+  }
+
+  m_threads.reserve(numThreads - 1);
+  for (std::size_t i = 1; i < numThreads; ++i) {
+    m_threads.emplace_back(&ThreadPool::workerLoop, this, i);
+  }
+}
+
+//==============================================================================
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_workCondition.notify_all();
+
+  for (auto& thread : m_threads) {
+    thread.join();
+  }
+}
+
+//==============================================================================
+std::size_t ThreadPool::getNumThreads() const
+{
+  return m_threads.size() + 1;
+}
+
+//==============================================================================
+void ThreadPool::parallelFor(
+    std::size_t count,
+    const std::function<void(std::size_t index, std::size_t workerIndex)>& func)
+{
+  if (count == 0) {
+    return;
+  }
+
+  // Run serially when there is nothing to share or when called from one of
+  // this pool's own tasks, which would otherwise deadlock
+  if (m_threads.empty() || count == 1 || currentPool == this) {
+    const auto workerIndex = (currentPool == this) ? currentWorkerIndex : 0;
+    for (std::size_t i = 0; i < count; ++i) {
+      func(i, workerIndex);
+    }
+    return;
+  }
+
+  std::lock_guard<std::mutex> callLock(m_callMutex);
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_task = &func;
+    m_taskCount = count;
+    m_nextIndex.store(0, std::memory_order_relaxed);
+    m_numActiveWorkers = m_threads.size();
+    m_exception = nullptr;
+    ++m_generation;
+  }
+  m_workCondition.notify_all();
+
+  // The calling thread works as worker 0
+  runTasks(0);
+
+  std::exception_ptr exception;
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_doneCondition.wait(lock, [this] { return m_numActiveWorkers == 0; });
+    m_task = nullptr;
+    exception = m_exception;
+    m_exception = nullptr;
+  }
+
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
+}
+
+//==============================================================================
+std::size_t ThreadPool::getDefaultNumThreads()
+{
+  return std::max(1u, std::thread::hardware_concurrency());
+}
+
+//==============================================================================
+void ThreadPool::workerLoop(std::size_t workerIndex)
+{
+  std::uint64_t lastGeneration = 0;
+
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_workCondition.wait(
+          lock, [&] { return m_stop || m_generation != lastGeneration; });
+
+      if (m_stop) {
+        return;
+      }
+
+      lastGeneration = m_generation;
+    }
+
+    runTasks(workerIndex);
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (--m_numActiveWorkers == 0) {
+        m_doneCondition.notify_one();
+      }
+    }
+  }
+}
+
+//==============================================================================
+void ThreadPool::runTasks(std::size_t workerIndex)
+{
+  const auto* previousPool = currentPool;
+  const auto previousWorkerIndex = currentWorkerIndex;
+  currentPool = this;
+  currentWorkerIndex = workerIndex;
+
+  while (true) {
+    const auto index = m_nextIndex.fetch_add(1, std::memory_order_relaxed);
+    if (index >= m_taskCount) {
+      break;
+    }
+
+    try {
+      (*m_task)(index, workerIndex);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (!m_exception) {
+        m_exception = std::current_exception();
+      }
+
+      // Skip the remaining indices
+      m_nextIndex.store(m_taskCount, std::memory_order_relaxed);
+    }
+  }
+
+  currentPool = previousPool;
+  currentWorkerIndex = previousWorkerIndex;
+}
+
+} // namespace dart8::common
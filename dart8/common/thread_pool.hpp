@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <dart8/export.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace dart8::common {
+
+/// Fixed-size pool of worker threads for data-parallel loops
+///
+/// The thread that calls parallelFor() participates as worker 0, so a pool of
+/// N threads owns N - 1 background threads. Loop indices are claimed
+/// dynamically from a shared counter so that tasks of uneven cost are
+/// balanced across the workers.
+///
+/// Example usage:
+/// @code
+/// ThreadPool pool(4);
+/// pool.parallelFor(items.size(), [&](std::size_t i, std::size_t worker) {
+///   process(items[i], scratch[worker]);
+/// });
+/// @endcode
+class DART8_API ThreadPool
+{
+public:
+  /// Constructor
+  ///
+  /// @param numThreads Number of threads including the calling thread. Pass 0
+  /// to use the number of hardware threads.
+  explicit ThreadPool(std::size_t numThreads = 0);
+
+  /// Destructor. Joins all the background threads.
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  /// Get the number of threads including the calling thread
+  [[nodiscard]] std::size_t getNumThreads() const;
+
+  /// Calls func(index, workerIndex) for every index in [0, count) and blocks
+  /// until all the calls return
+  ///
+  /// workerIndex is in [0, getNumThreads()) and identifies the thread running
+  /// the call. No two concurrent calls share a worker index. Calling this
+  /// function from inside a task of the same pool runs the loop serially. If
+  /// any call throws, the remaining indices are skipped and the first
+  /// exception is rethrown to the caller.
+  void parallelFor(
+      std::size_t count,
+      const std::function<void(std::size_t index, std::size_t workerIndex)>&
+          func);
+
+  /// Get the number of hardware threads, or 1 if it cannot be detected
+  [[nodiscard]] static std::size_t getDefaultNumThreads();
+
+private:
+  /// Main loop of the background threads
+  void workerLoop(std::size_t workerIndex);
+
+  /// Claims and runs loop indices until none is left
+  void runTasks(std::size_t workerIndex);
+
+  std::vector<std::thread> m_threads;
+
+  /// Serializes concurrent calls of parallelFor() from different threads
+  std::mutex m_callMutex;
+
+  /// Protects the task state below
+  std::mutex m_mutex;
+  std::condition_variable m_workCondition;
+  std::condition_variable m_doneCondition;
+
+  const std::function<void(std::size_t, std::size_t)>* m_task{nullptr};
+  std::size_t m_taskCount{0};
+  std::atomic<std::size_t> m_nextIndex{0};
+  std::size_t m_numActiveWorkers{0};
+  std::uint64_t m_generation{0};
+  bool m_stop{false};
+  std::exception_ptr m_exception;
+};
+
+} // namespace dart8::common
@@ -32,6 +32,7 @@
 
 #pragma once
 
+#include <dart8/comps/articulated_body.hpp>
 #include <dart8/comps/dynamics.hpp>
 #include <dart8/comps/frame_types.hpp>
 #include <dart8/comps/joint.hpp>
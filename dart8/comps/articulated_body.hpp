@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <dart8/comps/component_category.hpp>
+#include <dart8/comps/joint.hpp>
+
+#include <Eigen/Dense>
+#include <Eigen/Geometry>
+#include <entt/entt.hpp>
+
+#include <vector>
+
+namespace dart8::comps {
+
+/// Packed articulated-body data of a MultiBody
+///
+/// Flattens the link tree of a MultiBody into arrays indexed by body in
+/// topological (parent-before-child) order, so the forward dynamics passes
+/// iterate contiguous memory instead of chasing entity references. Each body
+/// is a link together with its parent joint; root links have no joint and are
+/// fixed to the world.
+///
+/// Built when the world first needs it in simulation mode, where the
+/// structure can no longer change, and reused by every step afterwards, so
+/// stepping does not allocate. Spatial vectors are ordered [angular; linear]
+/// and expressed in the body's link frame.
+///
+/// **Internal Implementation Detail** - Not exposed in public API
+struct ArticulatedBodyCache
+{
+  DART8_CACHE_COMPONENT(ArticulatedBodyCache);
+
+  using Vector6d = Eigen::Matrix<double, 6, 1>;
+  using Matrix6d = Eigen::Matrix<double, 6, 6>;
+
+  //--------------------------------------------------------------------------
+  // Topology and constant properties
+  //--------------------------------------------------------------------------
+
+  /// Link entities
+  std::vector<entt::entity> links;
+
+  /// Parent joint entities (entt::null for root links)
+  std::vector<entt::entity> joints;
+
+  /// Parent body indices (-1 for root links)
+  std::vector<int> parents;
+
+  /// Parent joint types (JointType::Fixed for root links)
+  std::vector<JointType> jointTypes;
+
+  /// Parent joint axes in the joint frame
+  std::vector<Eigen::Vector3d> axes;
+
+  /// Parent joint screw pitches
+  std::vector<double> pitches;
+
+  /// Transforms from the parent joint frame to the link frame. For root
+  /// links, the pose of the link in the world.
+  std::vector<Eigen::Isometry3d> jointToLink;
+
+  /// Joint motion subspaces (zero for fixed joints and root links)
+  std::vector<Vector6d> motionSubspaces;
+
+  /// Spatial inertias about the link origin
+  std::vector<Matrix6d> spatialInertias;
+
+  //--------------------------------------------------------------------------
+  // Joint state gathered from and scattered back to the Joint components
+  //--------------------------------------------------------------------------
+
+  std::vector<double> positions;
+  std::vector<double> velocities;
+  std::vector<double> accelerations;
+  std::vector<double> torques;
+
+  //--------------------------------------------------------------------------
+  // Workspace of the articulated-body algorithm
+  //--------------------------------------------------------------------------
+
+  /// Motion transforms from the parent link frame to the link frame
+  std::vector<Matrix6d> parentToLink;
+
+  std::vector<Eigen::Isometry3d> worldTransforms;
+  std::vector<Vector6d> spatialVelocities;
+  std::vector<Vector6d> spatialAccelerations;
+  std::vector<Vector6d> biasAccelerations;
+  std::vector<Matrix6d> articulatedInertias;
+  std::vector<Vector6d> biasForces;
+  std::vector<Vector6d> inertiaTimesSubspaces;
+  std::vector<double> invDiagonals;
+  std::vector<double> residualTorques;
+};
+
+} // namespace dart8::comps
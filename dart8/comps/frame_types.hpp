@@ -98,6 +98,10 @@ struct FrameCache
 
   /// Dirty flag for lazy evaluation (true = needs recompute)
   bool needTransformUpdate = true;
+
+  /// Set when the local transform or the parent changed since the last
+  /// World::updateKinematics(), which then also recomputes the descendants
+  bool localTransformChanged = true;
 };
 
 /// FixedFrameProperties component
@@ -0,0 +1,493 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "dart8/dynamics/forward_dynamics.hpp"
+
+#include "dart8/common/exceptions.hpp"
+#include "dart8/comps/all.hpp"
+
+#include <Eigen/Geometry>
+
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+using dart8::comps::ArticulatedBodyCache;
+using dart8::comps::JointType;
+using Vector6d = ArticulatedBodyCache::Vector6d;
+using Matrix6d = ArticulatedBodyCache::Matrix6d;
+
+//==============================================================================
+Eigen::Matrix3d skew(const Eigen::Vector3d& v)
+{
+  Eigen::Matrix3d m;
+  m << 0.0, -v.z(), v.y(), v.z(), 0.0, -v.x(), -v.y(), v.x(), 0.0;
+  return m;
+}
+
+//==============================================================================
+/// Returns the motion transform from frame A to frame B given the pose of B
+/// in A
+Matrix6d motionTransform(const Eigen::Isometry3d& pose)
+{
+  const Eigen::Matrix3d rotationT = pose.linear().transpose();
+  Matrix6d transform;
+  transform.topLeftCorner<3, 3>() = rotationT;
+  transform.topRightCorner<3, 3>().setZero();
+  transform.bottomLeftCorner<3, 3>() = -rotationT * skew(pose.translation());
+  transform.bottomRightCorner<3, 3>() = rotationT;
+  return transform;
+}
+
+//==============================================================================
+/// Returns the spatial cross product v x m of two motion vectors
+Vector6d crossMotion(const Vector6d& v, const Vector6d& m)
+{
+  Vector6d result;
+  result.head<3>() = v.head<3>().cross(m.head<3>());
+  result.tail<3>()
+      = v.head<3>().cross(m.tail<3>()) + v.tail<3>().cross(m.head<3>());
+  return result;
+}
+
+//==============================================================================
+/// Returns the spatial cross product v x* f of a motion and a force vector
+Vector6d crossForce(const Vector6d& v, const Vector6d& f)
+{
+  Vector6d result;
+  result.head<3>()
+      = v.head<3>().cross(f.head<3>()) + v.tail<3>().cross(f.tail<3>());
+  result.tail<3>() = v.head<3>().cross(f.tail<3>());
+  return result;
+}
+
+//==============================================================================
+bool isSupportedJointType(JointType type)
+{
+  return type == JointType::Fixed || type == JointType::Revolute
+         || type == JointType::Prismatic || type == JointType::Screw;
+}
+
+//==============================================================================
+/// Returns the pose of body i in its parent link frame (in the world for root
+/// links) at the current joint position
+Eigen::Isometry3d computeJointTransform(
+    const ArticulatedBodyCache& cache, std::size_t i)
+{
+  Eigen::Isometry3d joint = Eigen::Isometry3d::Identity();
+  const double q = cache.positions[i];
+
+  switch (cache.jointTypes[i]) {
+    case JointType::Revolute:
+      joint.linear() = Eigen::AngleAxisd(q, cache.axes[i]).toRotationMatrix();
+      break;
+    case JointType::Prismatic:
+      joint.translation() = q * cache.axes[i];
+      break;
+    case JointType::Screw:
+      joint.linear() = Eigen::AngleAxisd(q, cache.axes[i]).toRotationMatrix();
+      joint.translation() = cache.pitches[i] * q * cache.axes[i];
+      break;
+    default:
+      break;
+  }
+
+  return joint * cache.jointToLink[i];
+}
+
+//==============================================================================
+/// Returns the motion subspace of a joint expressed in the child link frame
+Vector6d computeMotionSubspace(
+    JointType type,
+    const Eigen::Vector3d& axis,
+    double pitch,
+    const Eigen::Isometry3d& jointToLink)
+{
+  // Twist of the joint frame about its origin, expressed in the joint frame
+  Vector6d twist = Vector6d::Zero();
+  switch (type) {
+    case JointType::Revolute:
+      twist.head<3>() = axis;
+      break;
+    case JointType::Prismatic:
+      twist.tail<3>() = axis;
+      break;
+    case JointType::Screw:
+      twist.head<3>() = axis;
+      twist.tail<3>() = pitch * axis;
+      break;
+    default:
+      return twist;
+  }
+
+  return motionTransform(jointToLink) * twist;
+}
+
+//==============================================================================
+void buildArticulatedBody(
+    const entt::registry& registry,
+    const dart8::comps::MultiBodyStructure& structure,
+    ArticulatedBodyCache& cache)
+{
+  // Order the bodies breadth-first from the root links so that every parent
+  // precedes its children
+  std::vector<entt::entity> order;
+  order.reserve(structure.links.size());
+  for (const auto linkEntity : structure.links) {
+    if (registry.get<dart8::comps::Link>(linkEntity).parentJoint
+        == entt::null) {
+      order.push_back(linkEntity);
+    }
+  }
+  for (std::size_t k = 0; k < order.size(); ++k) {
+    const auto& link = registry.get<dart8::comps::Link>(order[k]);
+    for (const auto jointEntity : link.childJoints) {
+      order.push_back(
+          registry.get<dart8::comps::Joint>(jointEntity).childLink);
+    }
+  }
+
+  const std::size_t numBodies = order.size();
+  std::unordered_map<entt::entity, int> indices;
+  indices.reserve(numBodies);
+  for (std::size_t i = 0; i < numBodies; ++i) {
+    indices[order[i]] = static_cast<int>(i);
+  }
+
+  cache.links = order;
+  cache.joints.assign(numBodies, entt::null);
+  cache.parents.assign(numBodies, -1);
+  cache.jointTypes.assign(numBodies, JointType::Fixed);
+  cache.axes.assign(numBodies, Eigen::Vector3d::Zero());
+  cache.pitches.assign(numBodies, 0.0);
+  cache.jointToLink.assign(numBodies, Eigen::Isometry3d::Identity());
+  cache.motionSubspaces.assign(numBodies, Vector6d::Zero());
+  cache.spatialInertias.assign(numBodies, Matrix6d::Zero());
+
+  for (std::size_t i = 0; i < numBodies; ++i) {
+    const auto& link = registry.get<dart8::comps::Link>(order[i]);
+
+    auto& inertia = cache.spatialInertias[i];
+    inertia.topLeftCorner<3, 3>() = link.mass.inertia;
+    inertia.bottomRightCorner<3, 3>()
+        = link.mass.mass * Eigen::Matrix3d::Identity();
+
+    cache.jointToLink[i] = link.transformFromParentJoint;
+    if (link.parentJoint == entt::null) {
+      continue;
+    }
+
+    const auto& joint = registry.get<dart8::comps::Joint>(link.parentJoint);
+    DART8_THROW_T_IF(
+        !isSupportedJointType(joint.type),
+        dart8::NotImplementedException,
+        "Joint '{}' has a type that the forward dynamics does not support "
+        "yet. Supported types are Fixed, Revolute, Prismatic, and Screw.",
+        joint.name);
+
+    cache.joints[i] = link.parentJoint;
+    cache.parents[i] = indices.at(joint.parentLink);
+    cache.jointTypes[i] = joint.type;
+    cache.axes[i] = joint.axis;
+    cache.pitches[i] = joint.pitch;
+    cache.motionSubspaces[i] = computeMotionSubspace(
+        joint.type, joint.axis, joint.pitch, link.transformFromParentJoint);
+  }
+
+  cache.positions.assign(numBodies, 0.0);
+  cache.velocities.assign(numBodies, 0.0);
+  cache.accelerations.assign(numBodies, 0.0);
+  cache.torques.assign(numBodies, 0.0);
+
+  cache.parentToLink.assign(numBodies, Matrix6d::Identity());
+  cache.worldTransforms.assign(numBodies, Eigen::Isometry3d::Identity());
+  cache.spatialVelocities.assign(numBodies, Vector6d::Zero());
+  cache.spatialAccelerations.assign(numBodies, Vector6d::Zero());
+  cache.biasAccelerations.assign(numBodies, Vector6d::Zero());
+  cache.articulatedInertias.assign(numBodies, Matrix6d::Zero());
+  cache.biasForces.assign(numBodies, Vector6d::Zero());
+  cache.inertiaTimesSubspaces.assign(numBodies, Vector6d::Zero());
+  cache.invDiagonals.assign(numBodies, 0.0);
+  cache.residualTorques.assign(numBodies, 0.0);
+}
+
+//==============================================================================
+/// Copies the joint state from the Joint components into the packed arrays
+void gatherJointState(
+    const entt::registry& registry,
+    ArticulatedBodyCache& cache,
+    bool includeDynamics)
+{
+  for (std::size_t i = 0; i < cache.joints.size(); ++i) {
+    if (cache.jointTypes[i] == JointType::Fixed) {
+      continue;
+    }
+
+    const auto& joint = registry.get<dart8::comps::Joint>(cache.joints[i]);
+    cache.positions[i] = joint.position[0];
+    if (includeDynamics) {
+      cache.velocities[i] = joint.velocity[0];
+      cache.torques[i] = joint.torque[0];
+    }
+  }
+}
+
+//==============================================================================
+/// Computes the world transforms of the bodies from the packed positions
+void computeWorldTransforms(ArticulatedBodyCache& cache)
+{
+  for (std::size_t i = 0; i < cache.links.size(); ++i) {
+    const int parent = cache.parents[i];
+    const Eigen::Isometry3d pose = computeJointTransform(cache, i);
+    cache.worldTransforms[i]
+        = (parent < 0) ? pose : cache.worldTransforms[parent] * pose;
+  }
+}
+
+//==============================================================================
+/// Computes the joint accelerations with the articulated-body algorithm
+void computeAccelerations(
+    ArticulatedBodyCache& cache, const Eigen::Vector3d& gravity)
+{
+  const std::size_t numBodies = cache.links.size();
+
+  // Pass 1: Velocities and velocity-product terms from the roots outwards.
+  // Gravity enters as an upward acceleration of the fixed root links.
+  for (std::size_t i = 0; i < numBodies; ++i) {
+    const Eigen::Isometry3d pose = computeJointTransform(cache, i);
+    const int parent = cache.parents[i];
+
+    if (parent < 0) {
+      cache.spatialVelocities[i].setZero();
+      cache.spatialAccelerations[i].head<3>().setZero();
+      cache.spatialAccelerations[i].tail<3>()
+          = -(pose.linear().transpose() * gravity);
+      continue;
+    }
+
+    const Matrix6d& transform = cache.parentToLink[i] = motionTransform(pose);
+    const Vector6d jointVelocity
+        = cache.motionSubspaces[i] * cache.velocities[i];
+    const Vector6d& velocity = cache.spatialVelocities[i]
+        = transform * cache.spatialVelocities[parent] + jointVelocity;
+    const Matrix6d& inertia = cache.spatialInertias[i];
+
+    cache.biasAccelerations[i] = crossMotion(velocity, jointVelocity);
+    cache.articulatedInertias[i] = inertia;
+    cache.biasForces[i] = crossForce(velocity, inertia * velocity);
+  }
+
+  // Pass 2: Articulated inertias and bias forces from the leaves inwards
+  for (std::size_t k = numBodies; k-- > 0;) {
+    const int parent = cache.parents[k];
+    if (parent < 0) {
+      continue;
+    }
+
+    const Matrix6d& inertiaA = cache.articulatedInertias[k];
+    const Vector6d& biasForce = cache.biasForces[k];
+    Matrix6d inertiaP = inertiaA;
+    Vector6d biasForceP = biasForce;
+
+    if (cache.jointTypes[k] != JointType::Fixed) {
+      const Vector6d& subspace = cache.motionSubspaces[k];
+      const Vector6d& inertiaSubspace = cache.inertiaTimesSubspaces[k]
+          = inertiaA * subspace;
+      const double invD = cache.invDiagonals[k]
+          = 1.0 / subspace.dot(inertiaSubspace);
+      const double residual = cache.residualTorques[k]
+          = cache.torques[k] - subspace.dot(biasForce);
+
+      inertiaP.noalias()
+          -= invD * inertiaSubspace * inertiaSubspace.transpose();
+      biasForceP.noalias() += inertiaP * cache.biasAccelerations[k];
+      biasForceP += (residual * invD) * inertiaSubspace;
+    }
+
+    // The root links are fixed, so nothing propagates into them
+    if (cache.parents[parent] < 0) {
+      continue;
+    }
+
+    const Matrix6d& transform = cache.parentToLink[k];
+    cache.articulatedInertias[parent].noalias()
+        += transform.transpose() * inertiaP * transform;
+    cache.biasForces[parent].noalias() += transform.transpose() * biasForceP;
+  }
+
+  // Pass 3: Accelerations from the roots outwards
+  for (std::size_t i = 0; i < numBodies; ++i) {
+    const int parent = cache.parents[i];
+    if (parent < 0) {
+      continue;
+    }
+
+    Vector6d& acceleration = cache.spatialAccelerations[i];
+    acceleration.noalias()
+        = cache.parentToLink[i] * cache.spatialAccelerations[parent];
+    acceleration += cache.biasAccelerations[i];
+
+    if (cache.jointTypes[i] == JointType::Fixed) {
+      cache.accelerations[i] = 0.0;
+      continue;
+    }
+
+    const double qdd = cache.invDiagonals[i]
+                       * (cache.residualTorques[i]
+                          - cache.inertiaTimesSubspaces[i].dot(acceleration));
+    cache.accelerations[i] = qdd;
+    acceleration += cache.motionSubspaces[i] * qdd;
+  }
+}
+
+} // namespace
+
+namespace dart8::dynamics {
+
+//==============================================================================
+void buildArticulatedBodies(entt::registry& registry)
+{
+  auto view = registry.view<comps::MultiBodyStructure>();
+  for (auto entity : view) {
+    if (registry.all_of<comps::ArticulatedBodyCache>(entity)) {
+      continue;
+    }
+
+    comps::ArticulatedBodyCache cache;
+    buildArticulatedBody(
+        registry, view.get<comps::MultiBodyStructure>(entity), cache);
+    registry.emplace<comps::ArticulatedBodyCache>(entity, std::move(cache));
+  }
+}
+
+//==============================================================================
+void updateMultiBodyKinematics(entt::registry& registry)
+{
+  buildArticulatedBodies(registry);
+
+  auto view = registry.view<comps::ArticulatedBodyCache>();
+  for (auto entity : view) {
+    auto& cache = view.get<comps::ArticulatedBodyCache>(entity);
+    gatherJointState(registry, cache, false);
+    computeWorldTransforms(cache);
+
+    for (std::size_t i = 0; i < cache.links.size(); ++i) {
+      const Eigen::Isometry3d& transform = cache.worldTransforms[i];
+      registry.get<comps::Link>(cache.links[i]).worldTransform = transform;
+
+      auto& frameCache = registry.get<comps::FrameCache>(cache.links[i]);
+      frameCache.worldTransform = transform;
+      frameCache.needTransformUpdate = false;
+      frameCache.localTransformChanged = true;
+    }
+  }
+}
+
+//==============================================================================
+void stepMultiBodies(
+    entt::registry& registry, const Eigen::Vector3d& gravity, double timeStep)
+{
+  buildArticulatedBodies(registry);
+
+  auto view = registry.view<comps::ArticulatedBodyCache>();
+  for (auto entity : view) {
+    auto& cache = view.get<comps::ArticulatedBodyCache>(entity);
+    gatherJointState(registry, cache, true);
+    computeAccelerations(cache, gravity);
+
+    for (std::size_t i = 0; i < cache.joints.size(); ++i) {
+      if (cache.jointTypes[i] == JointType::Fixed) {
+        continue;
+      }
+
+      // Semi-implicit Euler
+      cache.velocities[i] += timeStep * cache.accelerations[i];
+      cache.positions[i] += timeStep * cache.velocities[i];
+
+      auto& joint = registry.get<comps::Joint>(cache.joints[i]);
+      joint.acceleration[0] = cache.accelerations[i];
+      joint.velocity[0] = cache.velocities[i];
+      joint.position[0] = cache.positions[i];
+    }
+  }
+}
+
+//==============================================================================
+void stepRigidBodies(
+    entt::registry& registry, const Eigen::Vector3d& gravity, double timeStep)
+{
+  auto view = registry.view<
+      comps::RigidBodyTag,
+      comps::FreeFrameProperties,
+      comps::Velocity,
+      comps::MassProperties,
+      comps::Force,
+      comps::FrameCache>();
+
+  for (auto entity : view) {
+    auto& pose = view.get<comps::FreeFrameProperties>(entity).localTransform;
+    auto& velocity = view.get<comps::Velocity>(entity);
+    const auto& massProperties = view.get<comps::MassProperties>(entity);
+    auto& force = view.get<comps::Force>(entity);
+
+    // Velocities are expressed in the world frame and the inertia about the
+    // center of mass in the body frame
+    const Eigen::Matrix3d rotation = pose.linear();
+    const Eigen::Matrix3d inertia
+        = rotation * massProperties.inertia * rotation.transpose();
+    const Eigen::Vector3d gyroscopic
+        = velocity.angular.cross(inertia * velocity.angular);
+
+    velocity.linear += timeStep * (force.force / massProperties.mass + gravity);
+    velocity.angular
+        += timeStep * inertia.ldlt().solve(force.torque - gyroscopic);
+
+    pose.translation() += timeStep * velocity.linear;
+    const double angle = timeStep * velocity.angular.norm();
+    if (angle > 0.0) {
+      Eigen::Quaterniond orientation(rotation);
+      orientation = Eigen::AngleAxisd(angle, velocity.angular.normalized())
+                    * orientation;
+      pose.linear() = orientation.normalized().toRotationMatrix();
+    }
+
+    force.force.setZero();
+    force.torque.setZero();
+
+    auto& frameCache = view.get<comps::FrameCache>(entity);
+    frameCache.needTransformUpdate = true;
+    frameCache.localTransformChanged = true;
+  }
+}
+
+} // namespace dart8::dynamics
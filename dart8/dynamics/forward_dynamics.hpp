@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <Eigen/Core>
+#include <entt/entt.hpp>
+
+namespace dart8::dynamics {
+
+/// Data-oriented forward dynamics systems over the World registry
+///
+/// MultiBody links are posed from their joint positions and advanced with the
+/// articulated-body algorithm (ABA) over the packed
+/// comps::ArticulatedBodyCache of each MultiBody. Standalone RigidBody
+/// entities are advanced with semi-implicit Euler integration. Both use
+/// semi-implicit Euler: velocities are updated first and the new velocities
+/// integrate the positions.
+///
+/// **Internal Implementation Detail** - Not exposed in public API
+
+/// Builds the comps::ArticulatedBodyCache of every MultiBody that has none
+///
+/// @throws NotImplementedException if a joint type is not supported yet
+void buildArticulatedBodies(entt::registry& registry);
+
+/// Computes the world transforms of all MultiBody links from their joint
+/// positions and writes them to the Link and FrameCache components
+void updateMultiBodyKinematics(entt::registry& registry);
+
+/// Computes the joint accelerations of all MultiBodies with the
+/// articulated-body algorithm and integrates the joint state by one time step
+void stepMultiBodies(
+    entt::registry& registry, const Eigen::Vector3d& gravity, double timeStep);
+
+/// Integrates the state of all RigidBodies by one time step and clears their
+/// force accumulators
+void stepRigidBodies(
+    entt::registry& registry, const Eigen::Vector3d& gravity, double timeStep);
+
+} // namespace dart8::dynamics
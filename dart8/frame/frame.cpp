@@ -33,6 +33,7 @@
 #include "dart8/frame/frame.hpp"
 
 #include "dart8/common/exceptions.hpp"
+#include "dart8/frame/frame_hierarchy.hpp"
 #include "dart8/frame/free_frame.hpp"
 #include "dart8/world.hpp"
 
@@ -203,6 +204,7 @@ void Frame::setParentFrame(const Frame& parent)
 
   if (m_world) {
     markSubtreeCacheDirty(m_world->getRegistry(), m_entity);
+    m_world->m_frameHierarchy->invalidate();
   }
 }
 
@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "dart8/frame/frame_hierarchy.hpp"
+
+#include "dart8/common/exceptions.hpp"
+#include "dart8/common/thread_pool.hpp"
+#include "dart8/comps/all.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <unordered_map>
+
+namespace {
+
+/// Minimum number of frames per parallel task. Narrower levels are updated
+/// serially because the transforms are too cheap to amortize the dispatch.
+constexpr std::size_t kParallelGrainSize = 512;
+
+} // namespace
+
+namespace dart8 {
+
+//==============================================================================
+void FrameHierarchy::invalidate()
+{
+  m_valid = false;
+}
+
+//==============================================================================
+void FrameHierarchy::update(
+    entt::registry& registry, common::ThreadPool* threadPool)
+{
+  // Every frame is recomputed after a rebuild because the previous world
+  // transforms may belong to a different topology
+  const bool forceAll = !m_valid;
+  if (!m_valid) {
+    rebuild(registry);
+    m_valid = true;
+  }
+
+  const std::size_t numThreads
+      = threadPool ? threadPool->getNumThreads() : std::size_t{1};
+
+  m_updatedFrameCount = 0;
+  for (std::size_t level = 0; level + 1 < m_levelOffsets.size(); ++level) {
+    const std::size_t begin = m_levelOffsets[level];
+    const std::size_t end = m_levelOffsets[level + 1];
+    const std::size_t width = end - begin;
+
+    if (numThreads < 2 || width < 2 * kParallelGrainSize) {
+      m_updatedFrameCount += updateRange(begin, end, forceAll);
+      continue;
+    }
+
+    // Frames of a level only read the world transforms of the previous
+    // level, so the chunks are independent
+    const std::size_t numChunks
+        = std::min(width / kParallelGrainSize, 4 * numThreads);
+    const std::size_t chunkSize = (width + numChunks - 1) / numChunks;
+    std::atomic<std::size_t> updatedCount{0};
+    threadPool->parallelFor(numChunks, [&](std::size_t chunk, std::size_t) {
+      const std::size_t chunkBegin = begin + chunk * chunkSize;
+      const std::size_t chunkEnd = std::min(end, chunkBegin + chunkSize);
+      updatedCount.fetch_add(
+          updateRange(chunkBegin, chunkEnd, forceAll),
+          std::memory_order_relaxed);
+    });
+    m_updatedFrameCount += updatedCount.load(std::memory_order_relaxed);
+  }
+}
+
+//==============================================================================
+std::size_t FrameHierarchy::getFrameCount() const
+{
+  return m_entities.size();
+}
+
+//==============================================================================
+std::size_t FrameHierarchy::getLevelCount() const
+{
+  return m_levelOffsets.empty() ? 0 : m_levelOffsets.size() - 1;
+}
+
+//==============================================================================
+std::size_t FrameHierarchy::getUpdatedFrameCount() const
+{
+  return m_updatedFrameCount;
+}
+
+//==============================================================================
+void FrameHierarchy::rebuild(entt::registry& registry)
+{
+  auto view
+      = registry.view<comps::FrameTag, comps::FrameState, comps::FrameCache>();
+
+  std::vector<entt::entity> frames;
+  std::unordered_map<entt::entity, std::size_t> indices;
+  for (auto entity : view) {
+    indices.emplace(entity, frames.size());
+    frames.push_back(entity);
+  }
+
+  const std::size_t numFrames = frames.size();
+
+  // Resolve the depth of every frame, memoizing along the walk to the root so
+  // that each frame is visited once
+  std::vector<int> depths(numFrames, -1);
+  std::vector<int> parentIndices(numFrames, -1);
+  std::vector<std::size_t> chain;
+  for (std::size_t i = 0; i < numFrames; ++i) {
+    int depth = -1;
+    std::size_t current = i;
+    chain.clear();
+    while (depths[current] < 0) {
+      DART8_THROW_T_IF(
+          chain.size() > numFrames,
+          InvalidOperationException,
+          "Cyclic frame hierarchy detected");
+      chain.push_back(current);
+
+      const auto parent
+          = view.get<comps::FrameState>(frames[current]).parentFrame;
+      const auto it = indices.find(parent);
+      if (it == indices.end()) {
+        break;
+      }
+
+      parentIndices[current] = static_cast<int>(it->second);
+      current = it->second;
+    }
+    if (depths[current] >= 0) {
+      depth = depths[current];
+    }
+
+    for (auto k = chain.rbegin(); k != chain.rend(); ++k) {
+      depths[*k] = ++depth;
+    }
+  }
+
+  // Counting sort by depth keeps the storage order within each level
+  const int maxDepth
+      = numFrames ? *std::max_element(depths.begin(), depths.end()) : -1;
+  m_levelOffsets.assign(static_cast<std::size_t>(maxDepth + 2), 0);
+  for (const int depth : depths) {
+    ++m_levelOffsets[static_cast<std::size_t>(depth) + 1];
+  }
+  for (std::size_t level = 1; level < m_levelOffsets.size(); ++level) {
+    m_levelOffsets[level] += m_levelOffsets[level - 1];
+  }
+
+  std::vector<std::size_t> positions(numFrames);
+  std::vector<std::size_t> cursors(
+      m_levelOffsets.begin(), m_levelOffsets.end());
+  for (std::size_t i = 0; i < numFrames; ++i) {
+    positions[i] = cursors[static_cast<std::size_t>(depths[i])]++;
+  }
+
+  m_entities.resize(numFrames);
+  m_parents.resize(numFrames);
+  m_localTransforms.resize(numFrames);
+  m_caches.resize(numFrames);
+  m_dirty.assign(numFrames, 0);
+
+  for (std::size_t i = 0; i < numFrames; ++i) {
+    const std::size_t k = positions[i];
+    const auto entity = frames[i];
+
+    m_entities[k] = entity;
+    m_parents[k] = (parentIndices[i] < 0)
+                       ? -1
+                       : static_cast<int>(positions[parentIndices[i]]);
+    m_caches[k] = &view.get<comps::FrameCache>(entity);
+
+    if (registry.all_of<comps::Link>(entity)) {
+      m_localTransforms[k] = nullptr;
+    } else if (
+        auto* fixed = registry.try_get<comps::FixedFrameProperties>(entity)) {
+      m_localTransforms[k] = &fixed->localTransform;
+    } else if (
+        auto* free = registry.try_get<comps::FreeFrameProperties>(entity)) {
+      m_localTransforms[k] = &free->localTransform;
+    } else {
+      m_localTransforms[k] = nullptr;
+    }
+  }
+}
+
+//==============================================================================
+std::size_t FrameHierarchy::updateRange(
+    std::size_t begin, std::size_t end, bool forceAll)
+{
+  std::size_t updatedCount = 0;
+  for (std::size_t i = begin; i < end; ++i) {
+    auto& cache = *m_caches[i];
+    const int parent = m_parents[i];
+
+    const bool dirty = forceAll || cache.localTransformChanged
+                       || cache.needTransformUpdate
+                       || (parent >= 0 && m_dirty[parent]);
+    m_dirty[i] = dirty;
+    if (!dirty) {
+      continue;
+    }
+
+    if (const auto* local = m_localTransforms[i]) {
+      cache.worldTransform = (parent < 0)
+                                 ? *local
+                                 : m_caches[parent]->worldTransform * *local;
+      ++updatedCount;
+    }
+    cache.needTransformUpdate = false;
+    cache.localTransformChanged = false;
+  }
+
+  return updatedCount;
+}
+
+} // namespace dart8
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <dart8/comps/frame_types.hpp>
+
+#include <Eigen/Geometry>
+#include <entt/entt.hpp>
+
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace dart8::common {
+class ThreadPool;
+} // namespace dart8::common
+
+namespace dart8 {
+
+/// Flattened, depth-sorted view of the frame tree
+///
+/// Stores the frames of a registry sorted by their depth in the frame tree,
+/// together with the index of each parent and pointers to the local transform
+/// and FrameCache components. World::updateKinematics() uses it to compute
+/// world transforms level by level: every frame of a level only depends on
+/// frames of the previous level, so wide levels are split across threads.
+/// Only frames whose local transform changed and their descendants are
+/// recomputed.
+///
+/// The arrays are rebuilt lazily after invalidate(), which must be called
+/// whenever frames are created, destroyed, or reparented.
+///
+/// **Internal Implementation Detail** - Not exposed in public API
+class FrameHierarchy
+{
+public:
+  /// Marks the arrays stale so that the next update() rebuilds them
+  void invalidate();
+
+  /// Recomputes the world transforms of the frames whose local transform
+  /// changed and of their descendants
+  ///
+  /// Links are posed by their joints, so their world transforms must be
+  /// up-to-date before this call. They are only used as parents here.
+  ///
+  /// @param registry Registry that stores the frame components
+  /// @param threadPool Pool used for wide levels, or nullptr to run serially
+  void update(entt::registry& registry, common::ThreadPool* threadPool);
+
+  /// Get the number of frames in the hierarchy
+  [[nodiscard]] std::size_t getFrameCount() const;
+
+  /// Get the number of depth levels in the hierarchy
+  [[nodiscard]] std::size_t getLevelCount() const;
+
+  /// Get the number of frames recomputed by the last update()
+  [[nodiscard]] std::size_t getUpdatedFrameCount() const;
+
+private:
+  /// Sorts the frames by depth and resolves their parent indices
+  void rebuild(entt::registry& registry);
+
+  /// Updates the frames in [begin, end) of a single level
+  std::size_t updateRange(std::size_t begin, std::size_t end, bool forceAll);
+
+  /// Frame entities sorted by depth
+  std::vector<entt::entity> m_entities;
+
+  /// Index of the parent of each frame, or -1 for children of the world
+  std::vector<int> m_parents;
+
+  /// Level l spans [m_levelOffsets[l], m_levelOffsets[l + 1])
+  std::vector<std::size_t> m_levelOffsets;
+
+  /// Local transform of each frame, or nullptr for Links
+  std::vector<const Eigen::Isometry3d*> m_localTransforms;
+
+  std::vector<comps::FrameCache*> m_caches;
+
+  /// Whether each frame was recomputed by the current update()
+  std::vector<std::uint8_t> m_dirty;
+
+  std::size_t m_updatedFrameCount{0};
+  bool m_valid{false};
+};
+
+} // namespace dart8
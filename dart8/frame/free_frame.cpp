@@ -67,6 +67,7 @@ void FreeFrame::setLocalTransform(const Eigen::Isometry3d& transform)
   // Invalidate cache
   auto& cache = registry.get<comps::FrameCache>(m_entity);
   cache.needTransformUpdate = true;
+  cache.localTransformChanged = true;
 }
 
 //==============================================================================
@@ -39,6 +39,10 @@
 
 #include <iostream>
 #include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cstring>
 
 namespace dart8::io {
 
@@ -336,4 +340,138 @@ requires(!comps::HasComponentCategory<T>) void autoDeserialize(
   });
 }
 
+//==============================================================================
+// Packed Records for Columnar Snapshots
+//
+// A component is packable when every field has a fixed size: arithmetic and
+// enum values, fixed-size Eigen matrices, quaternions and transforms, and
+// (for StateComponents) entity references. Packable components are stored
+// as dense fixed-size records so a snapshot can write a whole component
+// column with a single bulk write.
+//==============================================================================
+
+namespace detail {
+
+template <typename T>
+struct IsFixedSizeEigen : std::false_type
+{
+};
+
+template <typename S, int R, int C, int O, int MR, int MC>
+struct IsFixedSizeEigen<Eigen::Matrix<S, R, C, O, MR, MC>>
+  : std::bool_constant<R != Eigen::Dynamic && C != Eigen::Dynamic>
+{
+};
+
+template <typename S, int O>
+struct IsFixedSizeEigen<Eigen::Quaternion<S, O>> : std::true_type
+{
+};
+
+template <typename S, int D, int M, int O>
+struct IsFixedSizeEigen<Eigen::Transform<S, D, M, O>> : std::true_type
+{
+};
+
+template <typename F>
+inline constexpr bool kIsPackableField
+    = std::is_arithmetic_v<F> || std::is_enum_v<F>
+      || IsFixedSizeEigen<F>::value;
+
+template <typename T, std::size_t... I>
+constexpr bool allFieldsPackable(std::index_sequence<I...>)
+{
+  return (kIsPackableField<boost::pfr::tuple_element_t<I, T>> && ...);
+}
+
+template <typename T, std::size_t... I>
+constexpr std::size_t sumFieldSizes(std::index_sequence<I...>)
+{
+  return (sizeof(boost::pfr::tuple_element_t<I, T>) + ... + 0);
+}
+
+template <typename T>
+using FieldIndices = std::make_index_sequence<boost::pfr::tuple_size_v<T>>;
+
+} // namespace detail
+
+/// Check if a component can be stored as a fixed-size packed record
+template <typename T>
+concept IsPackableComponent
+    = comps::IsTagComponent<T>
+      || ((comps::IsPropertyComponent<T> || comps::IsStateComponent<T>)
+          && detail::allFieldsPackable<T>(detail::FieldIndices<T>{}));
+
+/// Size in bytes of the packed record of a packable component
+template <IsPackableComponent T>
+constexpr std::size_t packedRecordSize()
+{
+  if constexpr (std::is_empty_v<T>) {
+    return 0;
+  } else {
+    return detail::sumFieldSizes<T>(detail::FieldIndices<T>{});
+  }
+}
+
+/// Write @p component as a packed record at @p out, mapping entity
+/// references to saved IDs through @p entityMap
+template <IsPackableComponent T>
+void packRecord(char* out, const T& component, const EntityMap& entityMap)
+{
+  if constexpr (!std::is_empty_v<T>) {
+    boost::pfr::for_each_field(component, [&](const auto& field) {
+      using FieldType = std::remove_cvref_t<decltype(field)>;
+
+      if constexpr (std::is_same_v<FieldType, entt::entity>) {
+        const entt::entity mapped
+            = (field != entt::null) ? entityMap.at(field) : field;
+        std::memcpy(out, &mapped, sizeof(FieldType));
+      } else {
+        std::memcpy(out, &field, sizeof(FieldType));
+      }
+      out += sizeof(FieldType);
+    });
+  }
+}
+
+/// Read @p component from a packed record at @p in. Entity references are
+/// left as saved IDs; see remapEntityFields().
+template <IsPackableComponent T>
+void unpackRecord(const char* in, T& component)
+{
+  if constexpr (!std::is_empty_v<T>) {
+    boost::pfr::for_each_field(component, [&](auto& field) {
+      using FieldType = std::remove_cvref_t<decltype(field)>;
+      std::memcpy(&field, in, sizeof(FieldType));
+      in += sizeof(FieldType);
+    });
+  }
+}
+
+/// Replace saved entity IDs in the top-level entity fields of a
+/// StateComponent with the live entities in @p entityMap
+template <typename T>
+void remapEntityFields(T& component, const EntityMap& entityMap)
+{
+  if constexpr (comps::IsStateComponent<T>) {
+    boost::pfr::for_each_field(component, [&](auto& field) {
+      using FieldType = std::remove_cvref_t<decltype(field)>;
+
+      if constexpr (std::is_same_v<FieldType, entt::entity>) {
+        if (field != entt::null) {
+          field = entityMap.at(field);
+        }
+      } else if constexpr (std::is_same_v<
+                               FieldType,
+                               std::vector<entt::entity>>) {
+        for (auto& entity : field) {
+          if (entity != entt::null) {
+            entity = entityMap.at(entity);
+          }
+        }
+      }
+    });
+  }
+}
+
 } // namespace dart8::io
@@ -166,16 +166,17 @@ void readMatrixXd(std::istream& in, Eigen::MatrixXd& mat)
 // Format Header I/O
 //==============================================================================
 
-void writeFormatHeader(std::ostream& out)
+void writeFormatHeader(std::ostream& out, StreamKind kind)
 {
   // Magic number: "DRT7" (0x44525437)
   constexpr std::uint32_t kMagicNumber = 0x44525437;
   writePOD(out, kMagicNumber);
   writePOD(out, kBinaryFormatVersion);
+  writePOD(out, kind);
 }
 
 //==============================================================================
-std::uint32_t readFormatHeader(std::istream& in)
+std::uint32_t readFormatHeader(std::istream& in, StreamKind expected)
 {
   // Read and validate magic number
   constexpr std::uint32_t kMagicNumber = 0x44525437;
@@ -198,6 +199,19 @@ std::uint32_t readFormatHeader(std::istream& in)
         + std::to_string(kBinaryFormatVersion));
   }
 
+  // Read stream kind, which version 1 streams don't have
+  StreamKind kind = StreamKind::Binary;
+  if (version >= 2) {
+    readPOD(in, kind);
+  }
+
+  if (kind != expected) {
+    throw std::runtime_error(
+        "Invalid DART8 binary format: stream kind "
+        + std::to_string(static_cast<int>(kind)) + " does not match expected "
+        + std::to_string(static_cast<int>(expected)));
+  }
+
   return version;
 }
 
@@ -60,7 +60,17 @@ using EntityMap = std::unordered_map<entt::entity, entt::entity>;
 // Increment this when making breaking changes to the binary format
 // Version history:
 //   1: Initial implementation
-constexpr std::uint32_t kBinaryFormatVersion = 1;
+//   2: Stream kind tag after the version; columnar snapshot and delta
+//      streams (World::saveSnapshot/saveDelta)
+constexpr std::uint32_t kBinaryFormatVersion = 2;
+
+// Kind of the stream following the format header
+// Version 1 streams have no tag and are always Binary.
+enum class StreamKind : std::uint8_t
+{
+  Binary = 0,   // World::saveBinary
+  Snapshot = 1, // World::saveSnapshot and World::saveDelta
+};
 
 //==============================================================================
 // Low-level Binary I/O for POD types
@@ -162,13 +172,16 @@ void readVector(std::istream& in, std::vector<T>& vec)
 // Format Header I/O
 //==============================================================================
 
-// Write format header with version and magic number
+// Write format header with magic number, version, and stream kind
 // Magic number: "DRT7" (0x44525437)
-void DART8_API writeFormatHeader(std::ostream& out);
+void DART8_API
+writeFormatHeader(std::ostream& out, StreamKind kind = StreamKind::Binary);
 
 // Read and validate format header
 // Returns the format version number
-// Throws std::runtime_error if magic number is invalid or version incompatible
-std::uint32_t DART8_API readFormatHeader(std::istream& in);
+// Throws std::runtime_error if magic number is invalid, version incompatible,
+// or the stream is not of the expected kind
+std::uint32_t DART8_API readFormatHeader(
+    std::istream& in, StreamKind expected = StreamKind::Binary);
 
 } // namespace dart8::io
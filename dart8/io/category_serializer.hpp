@@ -70,6 +70,70 @@ public:
     return T::getTypeName();
   }
 
+  //============================================================================
+  // Columnar snapshot support
+  //============================================================================
+
+  [[nodiscard]] std::size_t getPackedSize() const override
+  {
+    if constexpr (IsPackableComponent<T>) {
+      return packedRecordSize<T>();
+    } else {
+      return ComponentSerializer::kVariableSize;
+    }
+  }
+
+  void pack(
+      std::span<const entt::entity> entities,
+      const entt::registry& registry,
+      const EntityMap& entityMap,
+      char* out) const override
+  {
+    if constexpr (IsPackableComponent<T>) {
+      if constexpr (!std::is_empty_v<T>) {
+        for (const auto entity : entities) {
+          packRecord(out, registry.get<T>(entity), entityMap);
+          out += packedRecordSize<T>();
+        }
+      }
+    } else {
+      ComponentSerializer::pack(entities, registry, entityMap, out);
+    }
+  }
+
+  void unpack(
+      std::span<const entt::entity> entities,
+      const char* in,
+      entt::registry& registry) const override
+  {
+    if constexpr (IsPackableComponent<T>) {
+      for (const auto entity : entities) {
+        if constexpr (std::is_empty_v<T>) {
+          registry.emplace_or_replace<T>(entity);
+        } else {
+          T component;
+          unpackRecord(in, component);
+          registry.emplace_or_replace<T>(entity, std::move(component));
+          in += packedRecordSize<T>();
+        }
+      }
+    } else {
+      ComponentSerializer::unpack(entities, in, registry);
+    }
+  }
+
+  void remapEntities(
+      std::span<const entt::entity> entities,
+      entt::registry& registry,
+      const EntityMap& entityMap) const override
+  {
+    if constexpr (comps::IsStateComponent<T>) {
+      for (const auto entity : entities) {
+        remapEntityFields(registry.get<T>(entity), entityMap);
+      }
+    }
+  }
+
   //============================================================================
   // TypedComponentSerializer protected interface
   //============================================================================
@@ -38,12 +38,49 @@
 
 #include <algorithm>
 #include <format>
+#include <span>
+#include <sstream>
 #include <stdexcept>
 #include <unordered_map>
 #include <vector>
 
+#include <cstring>
+
 namespace dart8::io {
 
+//==============================================================================
+// ComponentSerializer
+//==============================================================================
+
+void ComponentSerializer::pack(
+    std::span<const entt::entity> /*entities*/,
+    const entt::registry& /*registry*/,
+    const EntityMap& /*entityMap*/,
+    char* /*out*/) const
+{
+  throw std::logic_error(std::format(
+      "Component type '{}' has no packed record layout", getTypeName()));
+}
+
+//==============================================================================
+void ComponentSerializer::unpack(
+    std::span<const entt::entity> /*entities*/,
+    const char* /*in*/,
+    entt::registry& /*registry*/) const
+{
+  throw std::logic_error(std::format(
+      "Component type '{}' has no packed record layout", getTypeName()));
+}
+
+//==============================================================================
+void ComponentSerializer::remapEntities(
+    std::span<const entt::entity> /*entities*/,
+    entt::registry& /*registry*/,
+    const EntityMap& /*entityMap*/) const
+{
+  // No entity references by default
+}
+
 //==============================================================================
 // SerializerRegistry
 //==============================================================================
@@ -92,6 +129,235 @@ void registerBuiltInSerializers(SerializerRegistry& registry)
   registerComponentIfNeeded<comps::Force>(registry);
 }
 
+// Leading byte of a snapshot stream
+enum class SnapshotKind : std::uint8_t
+{
+  Full = 0,
+  Delta = 1,
+};
+
+using Column = SnapshotBaseline::Column;
+
+// Entities in a deterministic order; the index is the saved ID
+std::vector<entt::entity> collectEntities(const entt::registry& registry)
+{
+  std::vector<entt::entity> entities;
+  auto viewAll = registry.view<comps::Name>();
+  for (auto entity : viewAll) {
+    entities.push_back(entity);
+  }
+
+  std::sort(
+      entities.begin(), entities.end(), [](entt::entity lhs, entt::entity rhs) {
+        return static_cast<std::uint32_t>(lhs)
+               < static_cast<std::uint32_t>(rhs);
+      });
+
+  return entities;
+}
+
+EntityMap makeEntityMap(const std::vector<entt::entity>& entities)
+{
+  EntityMap entityMap;
+  entityMap.reserve(entities.size());
+  for (std::size_t i = 0; i < entities.size(); ++i) {
+    entityMap[entities[i]] = static_cast<entt::entity>(i);
+  }
+  return entityMap;
+}
+
+// One column per component type present in the registry, sorted by type name
+std::vector<Column> buildColumns(
+    const SerializerRegistry& serializers,
+    const entt::registry& registry,
+    const std::vector<entt::entity>& entities,
+    const EntityMap& entityMap)
+{
+  std::vector<const ComponentSerializer*> sorted;
+  for (const auto& [typeName, serializer] : serializers.getSerializers()) {
+    sorted.push_back(serializer.get());
+  }
+  std::sort(
+      sorted.begin(),
+      sorted.end(),
+      [](const ComponentSerializer* lhs, const ComponentSerializer* rhs) {
+        return lhs->getTypeName() < rhs->getTypeName();
+      });
+
+  std::vector<Column> columns;
+  std::vector<entt::entity> members;
+  for (const auto* serializer : sorted) {
+    Column column;
+    members.clear();
+    for (std::size_t i = 0; i < entities.size(); ++i) {
+      if (serializer->hasComponent(entities[i], registry)) {
+        members.push_back(entities[i]);
+        column.ids.push_back(static_cast<std::uint32_t>(i));
+      }
+    }
+    if (members.empty()) {
+      continue;
+    }
+
+    column.typeName = serializer->getTypeName();
+    column.packedSize = serializer->getPackedSize();
+    if (column.packedSize != ComponentSerializer::kVariableSize) {
+      column.data.resize(members.size() * column.packedSize);
+      serializer->pack(members, registry, entityMap, column.data.data());
+    } else {
+      std::ostringstream buffer;
+      for (auto entity : members) {
+        serializer->save(buffer, entity, registry, entityMap);
+      }
+      column.data = std::move(buffer).str();
+    }
+
+    columns.push_back(std::move(column));
+  }
+
+  return columns;
+}
+
+// Section layout: type name, entity count, saved IDs, record size (or
+// kVariableSize), payload size, payload
+void writeColumn(
+    std::ostream& output,
+    std::string_view typeName,
+    std::size_t packedSize,
+    std::span<const std::uint32_t> ids,
+    std::string_view data)
+{
+  writeString(output, typeName);
+  writePOD(output, ids.size());
+  output.write(
+      reinterpret_cast<const char*>(ids.data()),
+      static_cast<std::streamsize>(ids.size_bytes()));
+  writePOD(output, packedSize);
+  writePOD(output, data.size());
+  output.write(data.data(), static_cast<std::streamsize>(data.size()));
+}
+
+void writeFullSnapshot(
+    std::ostream& output,
+    std::size_t entityCount,
+    const std::vector<Column>& columns)
+{
+  writePOD(output, SnapshotKind::Full);
+  writePOD(output, entityCount);
+  writePOD(output, columns.size());
+  for (const auto& column : columns) {
+    writeColumn(
+        output, column.typeName, column.packedSize, column.ids, column.data);
+  }
+}
+
+// Whether the same entities hold the same component types as in baseline
+bool hasSameLayout(
+    const SnapshotBaseline& baseline,
+    const std::vector<entt::entity>& entities,
+    const std::vector<Column>& columns)
+{
+  if (!baseline.valid || baseline.entities != entities
+      || baseline.columns.size() != columns.size()) {
+    return false;
+  }
+
+  for (std::size_t i = 0; i < columns.size(); ++i) {
+    const auto& previous = baseline.columns[i];
+    if (previous.typeName != columns[i].typeName
+        || previous.packedSize != columns[i].packedSize
+        || previous.ids != columns[i].ids) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void readColumns(
+    std::istream& input,
+    const SerializerRegistry& serializers,
+    entt::registry& registry,
+    const EntityMap& entityMap)
+{
+  std::size_t columnCount;
+  readPOD(input, columnCount);
+
+  std::string typeName;
+  std::vector<std::uint32_t> ids;
+  std::vector<entt::entity> entities;
+  std::string data;
+  for (std::size_t i = 0; i < columnCount; ++i) {
+    readString(input, typeName);
+
+    std::size_t count;
+    readPOD(input, count);
+    ids.resize(count);
+    input.read(
+        reinterpret_cast<char*>(ids.data()),
+        static_cast<std::streamsize>(count * sizeof(std::uint32_t)));
+
+    std::size_t packedSize;
+    std::size_t dataSize;
+    readPOD(input, packedSize);
+    readPOD(input, dataSize);
+    if (!input) {
+      throw std::runtime_error("Truncated snapshot stream");
+    }
+
+    // Unknown component types can be skipped since sections are sized
+    const auto* serializer = serializers.getSerializer(typeName);
+    if (serializer == nullptr) {
+      input.ignore(static_cast<std::streamsize>(dataSize));
+      continue;
+    }
+
+    entities.resize(count);
+    for (std::size_t j = 0; j < count; ++j) {
+      entities[j] = entityMap.at(static_cast<entt::entity>(ids[j]));
+    }
+
+    if (packedSize == ComponentSerializer::kVariableSize) {
+      for (auto entity : entities) {
+        serializer->load(input, entity, registry);
+      }
+    } else {
+      if (packedSize != serializer->getPackedSize()
+          || dataSize != count * packedSize) {
+        throw std::runtime_error(std::format(
+            "Packed record size mismatch for component type: {}", typeName));
+      }
+      data.resize(dataSize);
+      input.read(data.data(), static_cast<std::streamsize>(dataSize));
+      if (!input) {
+        throw std::runtime_error("Truncated snapshot stream");
+      }
+      serializer->unpack(entities, data.data(), registry);
+    }
+
+    serializer->remapEntities(entities, registry, entityMap);
+  }
+}
+
+void readFullSnapshot(
+    std::istream& input,
+    const SerializerRegistry& serializers,
+    entt::registry& registry,
+    EntityMap& entityMap)
+{
+  std::size_t entityCount;
+  readPOD(input, entityCount);
+
+  // Create every entity up front so references resolve in any column
+  entityMap.clear();
+  entityMap.reserve(entityCount);
+  for (std::size_t i = 0; i < entityCount; ++i) {
+    entityMap[static_cast<entt::entity>(i)] = registry.create();
+  }
+
+  readColumns(input, serializers, registry, entityMap);
+}
+
 } // namespace
 
 //==============================================================================
@@ -148,17 +414,7 @@ void SerializerRegistry::saveAllEntities(
     EntityMap& entityMap) const
 {
   // Collect entities in a deterministic order
-  std::vector<entt::entity> entities;
-  auto viewAll = registry.view<comps::Name>();
-  for (auto entity : viewAll) {
-    entities.push_back(entity);
-  }
-
-  std::sort(
-      entities.begin(), entities.end(), [](entt::entity lhs, entt::entity rhs) {
-        return static_cast<std::uint32_t>(lhs)
-               < static_cast<std::uint32_t>(rhs);
-      });
+  const auto entities = collectEntities(registry);
 
   // Write entity count
   writePOD(output, entities.size());
@@ -293,6 +549,133 @@ void SerializerRegistry::loadAllEntities(
   }
 }
 
+//==============================================================================
+void SerializerRegistry::saveSnapshot(
+    std::ostream& output,
+    const entt::registry& registry,
+    EntityMap& entityMap,
+    SnapshotBaseline* baseline) const
+{
+  auto entities = collectEntities(registry);
+  entityMap = makeEntityMap(entities);
+  auto columns = buildColumns(*this, registry, entities, entityMap);
+
+  writeFullSnapshot(output, entities.size(), columns);
+
+  if (baseline != nullptr) {
+    baseline->valid = true;
+    baseline->entities = std::move(entities);
+    baseline->columns = std::move(columns);
+  }
+}
+
+//==============================================================================
+void SerializerRegistry::loadSnapshot(
+    std::istream& input, entt::registry& registry, EntityMap& entityMap) const
+{
+  SnapshotKind kind;
+  readPOD(input, kind);
+  if (kind != SnapshotKind::Full) {
+    throw std::runtime_error("Expected a full snapshot in the input stream");
+  }
+
+  readFullSnapshot(input, *this, registry, entityMap);
+}
+
+//==============================================================================
+void SerializerRegistry::saveDelta(
+    std::ostream& output,
+    const entt::registry& registry,
+    SnapshotBaseline& baseline) const
+{
+  auto entities = collectEntities(registry);
+  const EntityMap entityMap = makeEntityMap(entities);
+  auto columns = buildColumns(*this, registry, entities, entityMap);
+
+  if (!hasSameLayout(baseline, entities, columns)) {
+    writeFullSnapshot(output, entities.size(), columns);
+    baseline.valid = true;
+    baseline.entities = std::move(entities);
+    baseline.columns = std::move(columns);
+    return;
+  }
+
+  // Changed records of packed columns; variable columns are sent whole
+  struct Patch
+  {
+    const Column* column;
+    std::vector<std::uint32_t> ids;
+    std::string data;
+  };
+  std::vector<Patch> patches;
+
+  for (std::size_t i = 0; i < columns.size(); ++i) {
+    const auto& current = columns[i];
+    const auto& previous = baseline.columns[i];
+    if (current.data == previous.data) {
+      continue;
+    }
+
+    Patch& patch = patches.emplace_back();
+    patch.column = &current;
+    if (current.packedSize == ComponentSerializer::kVariableSize) {
+      continue;
+    }
+
+    const std::size_t size = current.packedSize;
+    for (std::size_t j = 0; j < current.ids.size(); ++j) {
+      const char* record = current.data.data() + j * size;
+      if (std::memcmp(record, previous.data.data() + j * size, size) != 0) {
+        patch.ids.push_back(current.ids[j]);
+        patch.data.append(record, size);
+      }
+    }
+  }
+
+  writePOD(output, SnapshotKind::Delta);
+  writePOD(output, entities.size());
+  writePOD(output, patches.size());
+  for (const auto& patch : patches) {
+    const auto& column = *patch.column;
+    if (column.packedSize == ComponentSerializer::kVariableSize) {
+      writeColumn(
+          output, column.typeName, column.packedSize, column.ids, column.data);
+    } else {
+      writeColumn(
+          output, column.typeName, column.packedSize, patch.ids, patch.data);
+    }
+  }
+
+  baseline.columns = std::move(columns);
+}
+
+//==============================================================================
+void SerializerRegistry::applyDelta(
+    std::istream& input, entt::registry& registry, EntityMap& entityMap) const
+{
+  SnapshotKind kind;
+  readPOD(input, kind);
+  if (kind == SnapshotKind::Full) {
+    registry.clear();
+    readFullSnapshot(input, *this, registry, entityMap);
+    return;
+  }
+  if (kind != SnapshotKind::Delta) {
+    throw std::runtime_error("Invalid snapshot stream");
+  }
+
+  std::size_t entityCount;
+  readPOD(input, entityCount);
+  if (entityCount != entityMap.size()) {
+    throw std::runtime_error(std::format(
+        "Delta expects {} entities but the baseline has {}",
+        entityCount,
+        entityMap.size()));
+  }
+
+  readColumns(input, *this, registry, entityMap);
+}
+
 //==============================================================================
 void SerializerRegistry::clear()
 {
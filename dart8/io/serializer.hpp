@@ -39,10 +39,15 @@
 #include <entt/entity/registry.hpp>
 
 #include <iostream>
+#include <limits>
 #include <memory>
+#include <span>
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <vector>
+
+#include <cstdint>
 
 namespace dart8::io {
 
@@ -73,6 +78,8 @@ public:
 
   // Read component data from binary stream and attach to entity
   // Note: The type name has already been read by the registry
+  // An existing component must be replaced, since deltas are applied to
+  // entities that already hold the component
   virtual void load(
       std::istream& in,
       entt::entity entity,
@@ -81,6 +88,65 @@ public:
   // Check if an entity has this component type
   virtual bool hasComponent(
       entt::entity entity, const entt::registry& registry) const = 0;
+
+  // Returned by getPackedSize() for components without a fixed-size record
+  static constexpr std::size_t kVariableSize
+      = std::numeric_limits<std::size_t>::max();
+
+  // Size in bytes of one packed record, or kVariableSize if the component
+  // must go through save()/load()
+  // Snapshots write packed components as one contiguous array per type
+  virtual std::size_t getPackedSize() const
+  {
+    return kVariableSize;
+  }
+
+  // Write getPackedSize() bytes per entity to out, in entity order
+  // Only called when getPackedSize() != kVariableSize
+  virtual void pack(
+      std::span<const entt::entity> entities,
+      const entt::registry& registry,
+      const EntityMap& entityMap,
+      char* out) const;
+
+  // Read one packed record per entity from in and attach (or replace) the
+  // component
+  // Only called when getPackedSize() != kVariableSize
+  virtual void unpack(
+      std::span<const entt::entity> entities,
+      const char* in,
+      entt::registry& registry) const;
+
+  // Map saved entity IDs stored in the components of entities back to the
+  // live entities in entityMap. The default does nothing.
+  virtual void remapEntities(
+      std::span<const entt::entity> entities,
+      entt::registry& registry,
+      const EntityMap& entityMap) const;
+};
+
+//==============================================================================
+// Columnar Snapshots
+//==============================================================================
+
+// Reference state for delta encoding
+//
+// Filled by SerializerRegistry::saveSnapshot() and advanced by every
+// SerializerRegistry::saveDelta(), so successive deltas chain off each other.
+struct SnapshotBaseline
+{
+  // One component type as last written
+  struct Column
+  {
+    std::string typeName;
+    std::size_t packedSize = ComponentSerializer::kVariableSize;
+    std::vector<std::uint32_t> ids; // Saved entity IDs, ascending
+    std::string data;               // Packed records or serialized bytes
+  };
+
+  bool valid = false;
+  std::vector<entt::entity> entities; // Live entities in saved-ID order
+  std::vector<Column> columns;        // Sorted by type name
 };
 
 //==============================================================================
@@ -128,6 +194,47 @@ public:
       entt::registry& registry,
       EntityMap& entityMap) const;
 
+  // Save all entities as a columnar snapshot: one section per component
+  // type holding the saved entity IDs and the component data. Packed
+  // components are written as a single contiguous array.
+  // @param entityMap Output mapping from old entity IDs to sequential save IDs
+  // @param baseline Optional output used as the reference for saveDelta()
+  void saveSnapshot(
+      std::ostream& output,
+      const entt::registry& registry,
+      EntityMap& entityMap,
+      SnapshotBaseline* baseline = nullptr) const;
+
+  // Load a snapshot written by saveSnapshot() into registry
+  // Sections for unregistered component types are skipped
+  // @param entityMap Output mapping from saved IDs to new entity IDs
+  void loadSnapshot(
+      std::istream& input,
+      entt::registry& registry,
+      EntityMap& entityMap) const;
+
+  // Write only the components that changed since baseline, then advance
+  // baseline to the current state
+  // Packed components are diffed per entity; other components are rewritten
+  // per type when any of their bytes changed. If the entity set or the set
+  // of components per entity changed, a full snapshot is written instead.
+  // Changes are not tracked: every column is rebuilt and compared against
+  // baseline, so the cost is that of saveSnapshot() plus the comparison.
+  void saveDelta(
+      std::ostream& output,
+      const entt::registry& registry,
+      SnapshotBaseline& baseline) const;
+
+  // Apply a stream written by saveDelta() to a registry holding the
+  // baseline state
+  // If the stream holds a full snapshot, registry is cleared and reloaded.
+  // @param entityMap Mapping from saved IDs to entity IDs, as produced by
+  //   loadSnapshot(); updated when a full snapshot is applied
+  void applyDelta(
+      std::istream& input,
+      entt::registry& registry,
+      EntityMap& entityMap) const;
+
   // Clear all registered serializers (primarily for testing)
   void clear();
 
@@ -227,7 +334,7 @@ public:
   {
     ComponentT component;
     loadComponent(in, component);
-    registry.emplace<ComponentT>(entity, std::move(component));
+    registry.emplace_or_replace<ComponentT>(entity, std::move(component));
   }
 
   bool hasComponent(
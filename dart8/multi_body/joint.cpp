@@ -117,6 +117,84 @@ Link Joint::getChildLink() const
   return Link(jointComp.childLink, m_world);
 }
 
+//==============================================================================
+std::size_t Joint::getDOFCount() const
+{
+  return m_world->getRegistry().get<comps::Joint>(m_entity).getDOF();
+}
+
+//==============================================================================
+const Eigen::VectorXd& Joint::getPosition() const
+{
+  return m_world->getRegistry().get<comps::Joint>(m_entity).position;
+}
+
+//==============================================================================
+void Joint::setPosition(const Eigen::VectorXd& position)
+{
+  auto& jointComp = m_world->getRegistry().get<comps::Joint>(m_entity);
+
+  DART8_THROW_T_IF(
+      static_cast<std::size_t>(position.size()) != jointComp.getDOF(),
+      InvalidArgumentException,
+      "Joint '{}' has {} DOFs but {} positions were given",
+      jointComp.name,
+      jointComp.getDOF(),
+      position.size());
+
+  jointComp.position = position;
+}
+
+//==============================================================================
+const Eigen::VectorXd& Joint::getVelocity() const
+{
+  return m_world->getRegistry().get<comps::Joint>(m_entity).velocity;
+}
+
+//==============================================================================
+void Joint::setVelocity(const Eigen::VectorXd& velocity)
+{
+  auto& jointComp = m_world->getRegistry().get<comps::Joint>(m_entity);
+
+  DART8_THROW_T_IF(
+      static_cast<std::size_t>(velocity.size()) != jointComp.getDOF(),
+      InvalidArgumentException,
+      "Joint '{}' has {} DOFs but {} velocities were given",
+      jointComp.name,
+      jointComp.getDOF(),
+      velocity.size());
+
+  jointComp.velocity = velocity;
+}
+
+//==============================================================================
+const Eigen::VectorXd& Joint::getAcceleration() const
+{
+  return m_world->getRegistry().get<comps::Joint>(m_entity).acceleration;
+}
+
+//==============================================================================
+const Eigen::VectorXd& Joint::getTorque() const
+{
+  return m_world->getRegistry().get<comps::Joint>(m_entity).torque;
+}
+
+//==============================================================================
+void Joint::setTorque(const Eigen::VectorXd& torque)
+{
+  auto& jointComp = m_world->getRegistry().get<comps::Joint>(m_entity);
+
+  DART8_THROW_T_IF(
+      static_cast<std::size_t>(torque.size()) != jointComp.getDOF(),
+      InvalidArgumentException,
+      "Joint '{}' has {} DOFs but {} torques were given",
+      jointComp.name,
+      jointComp.getDOF(),
+      torque.size());
+
+  jointComp.torque = torque;
+}
+
 //==============================================================================
 entt::entity Joint::getEntity() const
 {
@@ -42,6 +42,8 @@
 #include <string>
 #include <string_view>
 
+#include <cstddef>
+
 namespace dart8 {
 
 /// Generic Joint handle class
@@ -139,8 +141,38 @@ public:
   /// @return True if the entity is valid
   [[nodiscard]] bool isValid() const;
 
+  /// Get the number of degrees of freedom
+  [[nodiscard]] std::size_t getDOFCount() const;
+
+  /// Get the joint positions
+  [[nodiscard]] const Eigen::VectorXd& getPosition() const;
+
+  /// Set the joint positions
+  ///
+  /// @throws InvalidArgumentException if the size does not match the DOFs
+  void setPosition(const Eigen::VectorXd& position);
+
+  /// Get the joint velocities
+  [[nodiscard]] const Eigen::VectorXd& getVelocity() const;
+
+  /// Set the joint velocities
+  ///
+  /// @throws InvalidArgumentException if the size does not match the DOFs
+  void setVelocity(const Eigen::VectorXd& velocity);
+
+  /// Get the joint accelerations computed by the last World::step()
+  [[nodiscard]] const Eigen::VectorXd& getAcceleration() const;
+
+  /// Get the joint torques (forces for prismatic joints)
+  [[nodiscard]] const Eigen::VectorXd& getTorque() const;
+
+  /// Set the joint torques (forces for prismatic joints), which are applied
+  /// by every World::step() until changed
+  ///
+  /// @throws InvalidArgumentException if the size does not match the DOFs
+  void setTorque(const Eigen::VectorXd& torque);
+
   // TODO: Add methods for:
-  // - Getting/setting position, velocity, acceleration
   // - Getting/setting joint limits
   // - Getting/setting effort limits
   // - Computing joint transforms
@@ -57,6 +57,22 @@ Joint Link::getParentJoint() const
   return Joint(linkComp.parentJoint, getWorld());
 }
 
+//==============================================================================
+double Link::getMass() const
+{
+  const auto& linkComp
+      = getWorld()->getRegistry().get<comps::Link>(getEntity());
+  return linkComp.mass.mass;
+}
+
+//==============================================================================
+const Eigen::Matrix3d& Link::getInertia() const
+{
+  const auto& linkComp
+      = getWorld()->getRegistry().get<comps::Link>(getEntity());
+  return linkComp.mass.inertia;
+}
+
 //==============================================================================
 const Eigen::Isometry3d& Link::getLocalTransform() const
 {
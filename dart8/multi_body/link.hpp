@@ -119,8 +119,13 @@ public:
   /// @return World-frame transformation (updated by forward kinematics)
   [[nodiscard]] const Eigen::Isometry3d& getWorldTransform() const;
 
+  /// Get the mass of the link in kilograms
+  [[nodiscard]] double getMass() const;
+
+  /// Get the rotational inertia about the link origin in the link frame
+  [[nodiscard]] const Eigen::Matrix3d& getInertia() const;
+
   // TODO: Add methods for:
-  // - Accessing mass properties
   // - Getting child joints
   // - Accessing collision shapes
 
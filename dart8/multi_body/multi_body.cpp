@@ -236,6 +236,9 @@ Link MultiBody::addLink(std::string_view name, const LinkOptions& options)
   // Add link component
   auto& linkComp = registry.emplace<comps::Link>(linkEntity);
   linkComp.name = std::move(actualLinkName);
+  linkComp.transformFromParentJoint = options.transformFromParentJoint;
+  linkComp.mass.mass = options.mass;
+  linkComp.mass.inertia = options.inertia;
 
   // Create joint entity
   auto jointEntity = registry.create();
@@ -254,6 +257,7 @@ Link MultiBody::addLink(std::string_view name, const LinkOptions& options)
       InvalidArgumentException,
       "Joint axis must be non-zero");
   jointComp.axis = options.axis / axisNorm;
+  jointComp.pitch = options.pitch;
   jointComp.parentLink = parentEntity;
   jointComp.childLink = linkEntity;
 
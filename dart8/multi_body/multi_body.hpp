@@ -38,6 +38,7 @@
 #include <dart8/multi_body/link.hpp> // Need complete type for LinkOptions
 
 #include <Eigen/Core>
+#include <Eigen/Geometry>
 #include <entt/entt.hpp>
 
 #include <optional>
@@ -80,10 +81,21 @@ struct LinkOptions
   comps::JointType jointType = comps::JointType::Revolute; ///< Type of joint
   Eigen::Vector3d axis
       = Eigen::Vector3d::UnitZ(); ///< Joint axis (rotation or translation)
+  double pitch = 0.0; ///< Translation per radian of rotation (Screw only)
+
+  /// Transform from the parent joint frame to the link frame. The joint frame
+  /// is located at the parent link frame and moves with the joint position.
+  Eigen::Isometry3d transformFromParentJoint = Eigen::Isometry3d::Identity();
+
+  /// Mass of the link in kilograms
+  double mass = 1.0;
+
+  /// Rotational inertia about the link origin, which is also the center of
+  /// mass, in the link frame
+  Eigen::Matrix3d inertia = Eigen::Matrix3d::Identity();
 
   // Future: Add more joint-specific parameters
   // Eigen::Vector3d axis2;  // For Universal, Planar
-  // double pitch;           // For Screw
 };
 
 /// MultiBody represents an articulated rigid body system
@@ -198,6 +198,63 @@ constexpr size_t getFieldDimension()
   }
 }
 
+/// Append the copies of a field to a compiled VectorMapper plan
+///
+/// Follows the order of extractFieldToVector(), merging fields that are
+/// adjacent both in the component and in the flat vector into one copy.
+/// @param field Field of a default constructed Component
+/// @param component Start of the component that holds the field
+/// @param recordOffset Index of the field in the record, advanced past it
+/// @param copies Output list of copies
+/// @return False if the field needs a conversion, e.g., an integer, a
+/// quaternion, or a transform
+template <typename Component, typename Field>
+bool appendFieldCopies(
+    const Field& field,
+    const std::byte* component,
+    size_t& recordOffset,
+    std::vector<ComponentCopy>& copies)
+{
+  using FieldType = std::remove_cvref_t<Field>;
+
+  if constexpr (
+      std::is_same_v<FieldType, double>
+      || std::is_same_v<FieldType, Eigen::Vector2d>
+      || std::is_same_v<FieldType, Eigen::Vector3d>) {
+    const auto fieldOffset = static_cast<size_t>(
+        reinterpret_cast<const std::byte*>(&field) - component);
+    constexpr size_t count = IsContiguousDoubles<FieldType>::count;
+
+    if (!copies.empty()) {
+      ComponentCopy& last = copies.back();
+      if (last.fieldOffset + last.count * sizeof(double) == fieldOffset
+          && last.offset + last.count == recordOffset) {
+        last.count += count;
+        recordOffset += count;
+        return true;
+      }
+    }
+
+    copies.push_back(
+        makeComponentCopy<Component>(fieldOffset, count, recordOffset));
+    recordOffset += count;
+    return true;
+  } else if constexpr (
+      std::is_arithmetic_v<FieldType> || std::is_enum_v<FieldType>
+      || !std::is_aggregate_v<FieldType>) {
+    return false;
+  } else {
+    // Nested struct - recursively append all fields
+    bool compiled = true;
+    boost::pfr::for_each_field(field, [&](const auto& nestedField) {
+      compiled = compiled
+                 && appendFieldCopies<Component>(
+                     nestedField, component, recordOffset, copies);
+    });
+    return compiled;
+  }
+}
+
 //==============================================================================
 // Automatic Component Mapper for PropertyComponents
 //==============================================================================
@@ -257,6 +314,24 @@ public:
     });
     return total;
   }
+
+  bool compile(std::vector<ComponentCopy>& copies) const override
+  {
+    if constexpr (!detail::HasPackedStorage<Component>) {
+      return false;
+    }
+
+    const Component probe{};
+    const auto* component = reinterpret_cast<const std::byte*>(&probe);
+    size_t recordOffset = 0;
+    bool compiled = true;
+    boost::pfr::for_each_field(probe, [&](const auto& field) {
+      compiled = compiled
+                 && appendFieldCopies<Component>(
+                     field, component, recordOffset, copies);
+    });
+    return compiled;
+  }
 };
 
 //==============================================================================
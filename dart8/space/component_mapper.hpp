@@ -35,11 +35,136 @@
 #include <Eigen/Core>
 #include <entt/entt.hpp>
 
+#include <algorithm>
 #include <functional>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#include <cstddef>
+
 namespace dart8 {
 
+/// One strided copy of a compiled VectorMapper plan
+///
+/// Copies `count` doubles located `fieldOffset` bytes into every component of
+/// a packed component storage, in view iteration order. The doubles of the
+/// n-th component go to `offset + n * stride` in the flat vector, so the
+/// copies of several fields of the same component interleave into records.
+struct ComponentCopy
+{
+  /// Returns the number of components in the storage
+  size_t (*size)(const entt::registry& registry){nullptr};
+
+  /// Copies the field of every component into the flat vector
+  void (*gather)(
+      const ComponentCopy& copy,
+      const entt::registry& registry,
+      double* output){nullptr};
+
+  /// Copies the flat vector into the field of every component
+  void (*scatter)(
+      const ComponentCopy& copy,
+      entt::registry& registry,
+      const double* input){nullptr};
+
+  size_t fieldOffset{0}; // Byte offset of the field in the component
+  size_t count{0};       // Doubles copied per component
+  size_t offset{0};      // Index of the first double in the first record
+  size_t stride{0};      // Doubles per record
+};
+
+namespace detail {
+
+/// Whether the storage of Component walks in the same order as
+/// registry.view<Component>()
+///
+/// Both iterate the packed array from back to front, but a storage with
+/// in-place deletion keeps tombstones that only the view skips.
+template <typename Component>
+inline constexpr bool HasPackedStorage
+    = !entt::component_traits<Component>::in_place_delete;
+
+template <typename Component>
+size_t componentStorageSize(const entt::registry& registry)
+{
+  const auto* storage = registry.template storage<Component>();
+  return storage ? storage->size() : 0;
+}
+
+template <typename Component>
+void gatherComponents(
+    const ComponentCopy& copy, const entt::registry& registry, double* output)
+{
+  const auto* storage = registry.template storage<Component>();
+  if (!storage) {
+    return;
+  }
+
+  output += copy.offset;
+  for (const Component& component : *storage) {
+    const auto* field = reinterpret_cast<const double*>(
+        reinterpret_cast<const std::byte*>(&component) + copy.fieldOffset);
+    std::copy_n(field, copy.count, output);
+    output += copy.stride;
+  }
+}
+
+template <typename Component>
+void scatterComponents(
+    const ComponentCopy& copy, entt::registry& registry, const double* input)
+{
+  // Avoid creating the storage of a component type nobody has
+  if (!std::as_const(registry).template storage<Component>()) {
+    return;
+  }
+
+  input += copy.offset;
+  for (Component& component : registry.template storage<Component>()) {
+    auto* field = reinterpret_cast<double*>(
+        reinterpret_cast<std::byte*>(&component) + copy.fieldOffset);
+    std::copy_n(input, copy.count, field);
+    input += copy.stride;
+  }
+}
+
+} // namespace detail
+
+/// Creates a copy of `count` doubles at `fieldOffset` bytes into Component
+/// @param fieldOffset Byte offset of the field in the component
+/// @param count Number of doubles per component
+/// @param offset Index of the field in a record of the flat vector
+template <typename Component>
+ComponentCopy makeComponentCopy(size_t fieldOffset, size_t count, size_t offset)
+{
+  ComponentCopy copy;
+  copy.size = &detail::componentStorageSize<Component>;
+  copy.gather = &detail::gatherComponents<Component>;
+  copy.scatter = &detail::scatterComponents<Component>;
+  copy.fieldOffset = fieldOffset;
+  copy.count = count;
+  copy.offset = offset;
+  return copy;
+}
+
+/// True for fields stored as contiguous doubles in the order the mappers
+/// flatten them: double and fixed-size Eigen vectors of doubles
+template <typename Field>
+struct IsContiguousDoubles : std::is_same<Field, double>
+{
+  static constexpr size_t count = 1;
+};
+
+template <int Rows, int Cols, int Options, int MaxRows, int MaxCols>
+struct IsContiguousDoubles<
+    Eigen::Matrix<double, Rows, Cols, Options, MaxRows, MaxCols>>
+  : std::bool_constant<
+        (Rows == 1 || Cols == 1) && Rows != Eigen::Dynamic
+        && Cols != Eigen::Dynamic>
+{
+  static constexpr size_t count = static_cast<size_t>(Rows * Cols);
+};
+
 /// Abstract interface for extracting component data to/from flat vectors
 ///
 /// ComponentMapper knows how to convert between ECS component data and
@@ -91,6 +216,21 @@ public:
 
   /// Get dimension (number of scalars) this mapper handles
   [[nodiscard]] virtual size_t getDimension() const = 0;
+
+  /// Describe this mapper as strided copies over packed component storage
+  ///
+  /// VectorMapper runs the copies of compiled mappers directly instead of
+  /// calling toVector() and fromVector(). Mappers that read or write anything
+  /// other than double fields of a single component type keep the default,
+  /// which leaves them to the virtual calls.
+  /// @param copies Output list to append the copies of one record to, with
+  /// their offset relative to the start of the record
+  /// @return True if the appended copies replace toVector() and fromVector()
+  virtual bool compile(std::vector<ComponentCopy>& copies) const
+  {
+    (void)copies;
+    return false;
+  }
 };
 
 /// Mapper for a single scalar variable
@@ -217,6 +357,25 @@ public:
     return 0;
   }
 
+  bool compile(std::vector<ComponentCopy>& copies) const override
+  {
+    if constexpr (
+        IsContiguousDoubles<Field>::value
+        && std::is_default_constructible_v<Component>
+        && detail::HasPackedStorage<Component>) {
+      const Component probe{};
+      const auto fieldOffset = static_cast<size_t>(
+          reinterpret_cast<const std::byte*>(&(probe.*m_fieldPtr))
+          - reinterpret_cast<const std::byte*>(&probe));
+      copies.push_back(makeComponentCopy<Component>(
+          fieldOffset, IsContiguousDoubles<Field>::count, 0));
+      return true;
+    } else {
+      (void)copies;
+      return false;
+    }
+  }
+
 private:
   Field Component::*m_fieldPtr;
 };
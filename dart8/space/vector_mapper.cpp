@@ -34,15 +34,39 @@
 
 #include "dart8/common/exceptions.hpp"
 
+#include <algorithm>
 #include <format>
 #include <stdexcept>
 
 namespace dart8 {
 
+namespace {
+
+void checkRange(
+    const StateSpace& space,
+    size_t variable,
+    size_t offset,
+    size_t count,
+    size_t size)
+{
+  if (offset + count > size) {
+    throw std::out_of_range(std::format(
+        "Variable '{}' needs {} scalars at offset {}, but the vector size is "
+        "{}",
+        space.getVariables()[variable].name,
+        count,
+        offset,
+        size));
+  }
+}
+
+} // namespace
+
 VectorMapper::VectorMapper(StateSpace space) : m_space(std::move(space))
 {
   // Reserve space for mappers based on number of variables
   m_mappers.reserve(m_space.getNumVariables());
+  compile();
 }
 
 VectorMapper::~VectorMapper() = default;
@@ -71,39 +95,46 @@ void VectorMapper::toVector(
         m_space.getDimension()));
   }
 
-  size_t offset = 0;
-  const auto& variables = m_space.getVariables();
-
-  for (size_t i = 0; i < m_mappers.size(); ++i) {
-    if (m_mappers[i]) {
-      size_t written = m_mappers[i]->toVector(registry, output, offset);
-      offset += written;
-    } else {
-      // No mapper for this variable, fill with zeros
-      for (size_t j = 0; j < variables[i].dimension; ++j) {
-        output[offset++] = 0.0;
-      }
-    }
-  }
+  gather(registry, output, &output);
 }
 
 void VectorMapper::toEigen(
-    const entt::registry& registry, Eigen::VectorXd& output) const
+    const entt::registry& registry, Eigen::Ref<Eigen::VectorXd> output) const
+{
+  toVector(
+      registry,
+      std::span<double>(output.data(), static_cast<size_t>(output.size())));
+}
+
+void VectorMapper::toVector(
+    const entt::registry& registry, std::span<double> output) const
 {
-  if (static_cast<size_t>(output.size()) < m_space.getDimension()) {
+  if (output.size() < m_space.getDimension()) {
     throw std::invalid_argument(std::format(
         "Output vector size ({}) < required dimension ({})",
         output.size(),
         m_space.getDimension()));
   }
 
-  // Use temporary std::vector for conversion
-  std::vector<double> temp(m_space.getDimension());
-  toVector(registry, temp);
+  gather(registry, output, nullptr);
+}
 
-  // Copy to Eigen vector
-  for (size_t i = 0; i < temp.size(); ++i) {
-    output[i] = temp[i];
+void VectorMapper::toMatrix(
+    std::span<const entt::registry* const> registries,
+    Eigen::Ref<Eigen::MatrixXd> output) const
+{
+  if (static_cast<size_t>(output.cols()) != registries.size()) {
+    throw std::invalid_argument(std::format(
+        "Output matrix columns ({}) != number of registries ({})",
+        output.cols(),
+        registries.size()));
+  }
+
+  for (size_t i = 0; i < registries.size(); ++i) {
+    toVector(
+        *registries[i],
+        std::span<double>(
+            output.col(i).data(), static_cast<size_t>(output.rows())));
   }
 }
 
@@ -117,37 +148,47 @@ void VectorMapper::fromVector(
         m_space.getDimension()));
   }
 
-  size_t offset = 0;
-  const auto& variables = m_space.getVariables();
-
-  for (size_t i = 0; i < m_mappers.size(); ++i) {
-    if (m_mappers[i]) {
-      size_t read = m_mappers[i]->fromVector(registry, vec, offset);
-      offset += read;
-    } else {
-      // No mapper for this variable, skip
-      offset += variables[i].dimension;
-    }
-  }
+  scatter(registry, vec, &vec);
 }
 
-void VectorMapper::fromEigen(
-    entt::registry& registry, const Eigen::VectorXd& vec)
+void VectorMapper::fromVector(
+    entt::registry& registry, std::span<const double> vec)
 {
-  if (static_cast<size_t>(vec.size()) < m_space.getDimension()) {
+  if (vec.size() < m_space.getDimension()) {
     throw std::invalid_argument(std::format(
         "Input vector size ({}) < required dimension ({})",
         vec.size(),
         m_space.getDimension()));
   }
 
-  // Convert Eigen to std::vector
-  std::vector<double> temp(vec.size());
-  for (Eigen::Index i = 0; i < vec.size(); ++i) {
-    temp[i] = vec[i];
+  scatter(registry, vec, nullptr);
+}
+
+void VectorMapper::fromEigen(
+    entt::registry& registry, const Eigen::Ref<const Eigen::VectorXd>& vec)
+{
+  fromVector(
+      registry,
+      std::span<const double>(vec.data(), static_cast<size_t>(vec.size())));
+}
+
+void VectorMapper::fromMatrix(
+    std::span<entt::registry* const> registries,
+    const Eigen::Ref<const Eigen::MatrixXd>& input)
+{
+  if (static_cast<size_t>(input.cols()) != registries.size()) {
+    throw std::invalid_argument(std::format(
+        "Input matrix columns ({}) != number of registries ({})",
+        input.cols(),
+        registries.size()));
   }
 
-  fromVector(registry, temp);
+  for (size_t i = 0; i < registries.size(); ++i) {
+    fromVector(
+        *registries[i],
+        std::span<const double>(
+            input.col(i).data(), static_cast<size_t>(input.rows())));
+  }
 }
 
 void VectorMapper::addMapper(
@@ -165,6 +206,121 @@ void VectorMapper::addMapper(
   }
 
   m_mappers[*varIdx] = std::move(mapper);
+  compile();
+}
+
+bool VectorMapper::isCompiled() const
+{
+  for (const auto& step : m_plan) {
+    if (step.mapper) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void VectorMapper::compile()
+{
+  m_plan.clear();
+  m_copies.clear();
+
+  std::vector<ComponentCopy> copies;
+  for (size_t i = 0; i < m_space.getNumVariables(); ++i) {
+    PlanStep step;
+    step.variable = i;
+
+    ComponentMapper* mapper
+        = i < m_mappers.size() ? m_mappers[i].get() : nullptr;
+    if (mapper) {
+      copies.clear();
+      if (mapper->compile(copies) && !copies.empty()) {
+        step.firstCopy = m_copies.size();
+        step.numCopies = copies.size();
+        for (const auto& copy : copies) {
+          step.stride = std::max(step.stride, copy.offset + copy.count);
+        }
+        for (auto& copy : copies) {
+          copy.stride = step.stride;
+          m_copies.push_back(copy);
+        }
+      } else {
+        step.mapper = mapper;
+      }
+    }
+
+    m_plan.push_back(step);
+  }
+}
+
+void VectorMapper::gather(
+    const entt::registry& registry,
+    std::span<double> output,
+    std::vector<double>* vectorOutput) const
+{
+  const auto& variables = m_space.getVariables();
+  std::vector<double> scratch;
+  size_t offset = 0;
+
+  for (const auto& step : m_plan) {
+    if (step.numCopies > 0) {
+      const ComponentCopy* copies = m_copies.data() + step.firstCopy;
+      const size_t count = copies[0].size(registry) * step.stride;
+      checkRange(m_space, step.variable, offset, count, output.size());
+      for (size_t i = 0; i < step.numCopies; ++i) {
+        copies[i].gather(copies[i], registry, output.data() + offset);
+      }
+      offset += count;
+    } else if (step.mapper && vectorOutput) {
+      offset += step.mapper->toVector(registry, *vectorOutput, offset);
+    } else if (step.mapper) {
+      // Mappers that did not compile need a std::vector to write into
+      if (scratch.empty()) {
+        scratch.resize(output.size());
+      }
+      const size_t count = step.mapper->toVector(registry, scratch, offset);
+      checkRange(m_space, step.variable, offset, count, output.size());
+      std::copy_n(scratch.begin() + offset, count, output.begin() + offset);
+      offset += count;
+    } else {
+      // No mapper for this variable, fill with zeros
+      const size_t count = variables[step.variable].dimension;
+      checkRange(m_space, step.variable, offset, count, output.size());
+      std::fill_n(output.begin() + offset, count, 0.0);
+      offset += count;
+    }
+  }
+}
+
+void VectorMapper::scatter(
+    entt::registry& registry,
+    std::span<const double> input,
+    const std::vector<double>* vectorInput)
+{
+  const auto& variables = m_space.getVariables();
+  std::vector<double> scratch;
+  size_t offset = 0;
+
+  for (const auto& step : m_plan) {
+    if (step.numCopies > 0) {
+      const ComponentCopy* copies = m_copies.data() + step.firstCopy;
+      const size_t count = copies[0].size(registry) * step.stride;
+      checkRange(m_space, step.variable, offset, count, input.size());
+      for (size_t i = 0; i < step.numCopies; ++i) {
+        copies[i].scatter(copies[i], registry, input.data() + offset);
+      }
+      offset += count;
+    } else if (step.mapper) {
+      // Mappers that did not compile need a std::vector to read from
+      if (!vectorInput) {
+        scratch.assign(input.begin(), input.end());
+        vectorInput = &scratch;
+      }
+      offset += step.mapper->fromVector(registry, *vectorInput, offset);
+    } else {
+      // No mapper for this variable, skip
+      offset += variables[step.variable].dimension;
+    }
+  }
 }
 
 } // namespace dart8
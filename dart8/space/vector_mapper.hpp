@@ -40,6 +40,8 @@
 #include <entt/entt.hpp>
 
 #include <memory>
+#include <span>
+#include <string>
 #include <vector>
 
 namespace dart8 {
@@ -53,7 +55,15 @@ namespace dart8 {
 /// Key features:
 /// - Pre-allocates buffers for efficiency
 /// - Reusable across multiple conversions
-/// - Supports both std::vector and Eigen::VectorXd
+/// - Supports std::vector, std::span, and Eigen vectors and maps
+/// - Batched conversion of many registries into the columns of a matrix
+///
+/// Mappers that describe themselves as copies over packed component storage
+/// (see ComponentMapper::compile()), such as FieldMapper of double fields and
+/// AutoPropertyMapper of double and Eigen::Vector3d fields, are compiled into
+/// a flat plan as they are added. Converting then runs one strided copy loop
+/// per field without virtual calls or temporaries; the other mappers keep
+/// going through ComponentMapper::toVector() and fromVector().
 ///
 /// Example usage:
 /// ```cpp
@@ -108,18 +118,46 @@ public:
 
   /// Extract ECS state into pre-allocated Eigen vector (in-place)
   /// @param registry ECS registry containing state
-  /// @param output Output vector (must be size >= getDimension())
-  void toEigen(const entt::registry& registry, Eigen::VectorXd& output) const;
+  /// @param output Output vector or map (must be size >= getDimension())
+  void toEigen(
+      const entt::registry& registry, Eigen::Ref<Eigen::VectorXd> output) const;
+
+  /// Extract ECS state into pre-allocated memory (in-place)
+  /// @param registry ECS registry containing state
+  /// @param output Output buffer (must be size >= getDimension())
+  void toVector(const entt::registry& registry, std::span<double> output) const;
+
+  /// Extract the ECS state of many registries into the columns of a matrix
+  /// @param registries Registries containing state, one per column
+  /// @param output Output matrix (must have rows >= getDimension() and one
+  /// column per registry)
+  void toMatrix(
+      std::span<const entt::registry* const> registries,
+      Eigen::Ref<Eigen::MatrixXd> output) const;
 
   /// Write vector to ECS state
   /// @param registry ECS registry to modify
   /// @param vec Input vector
   void fromVector(entt::registry& registry, const std::vector<double>& vec);
 
+  /// Write memory to ECS state
+  /// @param registry ECS registry to modify
+  /// @param vec Input buffer
+  void fromVector(entt::registry& registry, std::span<const double> vec);
+
   /// Write Eigen vector to ECS state
   /// @param registry ECS registry to modify
-  /// @param vec Input Eigen vector
-  void fromEigen(entt::registry& registry, const Eigen::VectorXd& vec);
+  /// @param vec Input Eigen vector or map
+  void fromEigen(
+      entt::registry& registry, const Eigen::Ref<const Eigen::VectorXd>& vec);
+
+  /// Write the columns of a matrix to the ECS state of many registries
+  /// @param registries Registries to modify, one per column
+  /// @param input Input matrix (must have rows >= getDimension() and one
+  /// column per registry)
+  void fromMatrix(
+      std::span<entt::registry* const> registries,
+      const Eigen::Ref<const Eigen::MatrixXd>& input);
 
   /// Get total dimension
   [[nodiscard]] size_t getDimension() const
@@ -140,9 +178,39 @@ public:
   void addMapper(
       const std::string& variableName, std::unique_ptr<ComponentMapper> mapper);
 
+  /// Check if every mapper has been compiled into strided copies
+  [[nodiscard]] bool isCompiled() const;
+
 private:
+  /// One variable of the compiled plan
+  struct PlanStep
+  {
+    size_t variable{0};               // Index of the StateSpace variable
+    size_t firstCopy{0};              // First copy in m_copies
+    size_t numCopies{0};              // Zero unless the mapper compiled
+    size_t stride{0};                 // Doubles per record of the copies
+    ComponentMapper* mapper{nullptr}; // Mapper that did not compile
+  };
+
+  /// Rebuild the plan from the StateSpace and the mappers
+  void compile();
+
+  /// Run the plan, passing the vector that owns output to fallback mappers
+  void gather(
+      const entt::registry& registry,
+      std::span<double> output,
+      std::vector<double>* vectorOutput) const;
+
+  /// Run the plan, passing the vector that owns input to fallback mappers
+  void scatter(
+      entt::registry& registry,
+      std::span<const double> input,
+      const std::vector<double>* vectorInput);
+
   StateSpace m_space;
   std::vector<std::unique_ptr<ComponentMapper>> m_mappers;
+  std::vector<PlanStep> m_plan;
+  std::vector<ComponentCopy> m_copies;
 };
 
 } // namespace dart8
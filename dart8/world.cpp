@@ -35,9 +35,12 @@
 #include "dart8/body/rigid_body.hpp"
 #include "dart8/common/ecs_utils.hpp"
 #include "dart8/common/exceptions.hpp"
+#include "dart8/common/thread_pool.hpp"
 #include "dart8/comps/all.hpp"
+#include "dart8/dynamics/forward_dynamics.hpp"
 #include "dart8/frame/fixed_frame.hpp"
 #include "dart8/frame/frame.hpp"
+#include "dart8/frame/frame_hierarchy.hpp"
 #include "dart8/frame/free_frame.hpp"
 #include "dart8/io/binary_io.hpp"
 #include "dart8/io/serializer.hpp"
@@ -81,7 +84,10 @@ bool hasEntityWithName(const entt::registry& registry, std::string_view name)
 
 namespace dart8 {
 
-World::World() = default;
+World::World() : m_frameHierarchy(std::make_unique<FrameHierarchy>()) {}
+
+//==============================================================================
+World::~World() = default;
 
 //==============================================================================
 entt::registry& World::getRegistry()
@@ -99,7 +105,10 @@ const entt::registry& World::getRegistry() const
 void World::clear()
 {
   m_registry.clear();
+  m_snapshotEntities.clear();
+  m_frameHierarchy->invalidate();
   m_simulationMode = false;
+  m_time = 0.0;
   m_freeFrameCounter = 0;
   m_fixedFrameCounter = 0;
   m_multiBodyCounter = 0;
@@ -299,9 +308,14 @@ std::size_t World::getMultiBodyCount() const
 RigidBody World::addRigidBody(
     std::string_view name, const RigidBodyOptions& options)
 {
-  (void)options; // Placeholder for future use
   ensureDesignMode();
 
+  DART8_THROW_T_IF(
+      !(options.mass > 0.0),
+      InvalidArgumentException,
+      "RigidBody mass must be positive, got {}",
+      options.mass);
+
   std::string candidateName
       = name.empty() ? std::format("rigid_body_{:03d}", m_rigidBodyCounter + 1)
                      : std::string(name);
@@ -325,6 +339,22 @@ RigidBody World::addRigidBody(
       actualName);
 
   m_registry.emplace<comps::RigidBodyTag>(entity);
+
+  auto& pose = m_registry.get<comps::FreeFrameProperties>(entity);
+  pose.localTransform.linear()
+      = options.orientation.normalized().toRotationMatrix();
+  pose.localTransform.translation() = options.position;
+
+  auto& velocity = m_registry.emplace<comps::Velocity>(entity);
+  velocity.linear = options.linearVelocity;
+  velocity.angular = options.angularVelocity;
+
+  auto& massProperties = m_registry.emplace<comps::MassProperties>(entity);
+  massProperties.mass = options.mass;
+  massProperties.inertia = options.inertia;
+
+  m_registry.emplace<comps::Force>(entity);
+
   return RigidBody(entity, this);
 }
 
@@ -349,6 +379,7 @@ void World::enterSimulationMode()
       "World is already in simulation mode");
 
   m_simulationMode = true;
+  m_frameHierarchy->invalidate();
 
   // Initial bake so that cached transforms are up-to-date.
   updateKinematics();
@@ -362,19 +393,84 @@ void World::updateKinematics()
       InvalidArgumentException,
       "updateKinematics() requires simulation mode");
 
-  auto cacheView = m_registry.view<comps::FrameTag, comps::FrameCache>();
+  // Links are posed by their joints, so the multibody kinematics computes
+  // their transforms before the other frames are propagated from them
+  dynamics::updateMultiBodyKinematics(m_registry);
 
-  // Mark caches dirty
-  for (auto entity : cacheView) {
-    auto& cache = cacheView.get<comps::FrameCache>(entity);
-    cache.needTransformUpdate = true;
+  m_frameHierarchy->update(m_registry, m_threadPool.get());
+}
+
+//==============================================================================
+void World::setNumThreads(std::size_t numThreads)
+{
+  if (numThreads == 0) {
+    numThreads = common::ThreadPool::getDefaultNumThreads();
   }
 
-  // Recompute world transforms
-  for (auto entity : cacheView) {
-    Frame frame(entity, this);
-    (void)frame.getTransform();
+  if (numThreads == getNumThreads()) {
+    return;
   }
+
+  m_threadPool = (numThreads > 1)
+                     ? std::make_unique<common::ThreadPool>(numThreads)
+                     : nullptr;
+}
+
+//==============================================================================
+std::size_t World::getNumThreads() const
+{
+  return m_threadPool ? m_threadPool->getNumThreads() : 1;
+}
+
+//==============================================================================
+void World::step()
+{
+  DART8_THROW_T_IF(
+      !m_simulationMode,
+      InvalidArgumentException,
+      "step() requires simulation mode");
+
+  dynamics::stepMultiBodies(m_registry, m_gravity, m_timeStep);
+  dynamics::stepRigidBodies(m_registry, m_gravity, m_timeStep);
+  updateKinematics();
+
+  m_time += m_timeStep;
+}
+
+//==============================================================================
+void World::setTimeStep(double timeStep)
+{
+  DART8_THROW_T_IF(
+      !(timeStep > 0.0),
+      InvalidArgumentException,
+      "Time step must be positive, got {}",
+      timeStep);
+
+  m_timeStep = timeStep;
+}
+
+//==============================================================================
+double World::getTimeStep() const
+{
+  return m_timeStep;
+}
+
+//==============================================================================
+double World::getTime() const
+{
+  return m_time;
+}
+
+//==============================================================================
+void World::setGravity(const Eigen::Vector3d& gravity)
+{
+  m_gravity = gravity;
+}
+
+//==============================================================================
+const Eigen::Vector3d& World::getGravity() const
+{
+  return m_gravity;
 }
 
 //==============================================================================
@@ -386,14 +482,7 @@ void World::saveBinary(std::ostream& output) const
   io::SerializerRegistry::instance().saveAllEntities(
       output, m_registry, entityMap);
 
-  const std::uint8_t simulationFlag = m_simulationMode ? 1 : 0;
-  io::writePOD(output, simulationFlag);
-  io::writePOD(output, m_freeFrameCounter);
-  io::writePOD(output, m_fixedFrameCounter);
-  io::writePOD(output, m_multiBodyCounter);
-  io::writePOD(output, m_rigidBodyCounter);
-  io::writePOD(output, m_linkCounter);
-  io::writePOD(output, m_jointCounter);
+  writeMetadata(output);
 }
 
 //==============================================================================
@@ -407,6 +496,77 @@ void World::loadBinary(std::istream& input)
   io::SerializerRegistry::instance().loadAllEntities(
       input, m_registry, entityMap);
 
+  readMetadata(input);
+  finishLoading();
+}
+
+//==============================================================================
+void World::saveSnapshot(
+    std::ostream& output, io::SnapshotBaseline* baseline) const
+{
+  io::writeFormatHeader(output, io::StreamKind::Snapshot);
+
+  io::EntityMap entityMap;
+  io::SerializerRegistry::instance().saveSnapshot(
+      output, m_registry, entityMap, baseline);
+
+  writeMetadata(output);
+}
+
+//==============================================================================
+void World::saveDelta(
+    std::ostream& output, io::SnapshotBaseline& baseline) const
+{
+  io::writeFormatHeader(output, io::StreamKind::Snapshot);
+  io::SerializerRegistry::instance().saveDelta(output, m_registry, baseline);
+  writeMetadata(output);
+}
+
+//==============================================================================
+void World::loadSnapshot(std::istream& input)
+{
+  clear();
+
+  io::readFormatHeader(input, io::StreamKind::Snapshot);
+
+  io::SerializerRegistry::instance().loadSnapshot(
+      input, m_registry, m_snapshotEntities);
+
+  readMetadata(input);
+  finishLoading();
+}
+
+//==============================================================================
+void World::applyDelta(std::istream& input)
+{
+  io::readFormatHeader(input, io::StreamKind::Snapshot);
+
+  io::SerializerRegistry::instance().applyDelta(
+      input, m_registry, m_snapshotEntities);
+
+  // Deltas may reparent frames
+  m_frameHierarchy->invalidate();
+
+  readMetadata(input);
+  finishLoading();
+}
+
+//==============================================================================
+void World::writeMetadata(std::ostream& output) const
+{
+  const std::uint8_t simulationFlag = m_simulationMode ? 1 : 0;
+  io::writePOD(output, simulationFlag);
+  io::writePOD(output, m_freeFrameCounter);
+  io::writePOD(output, m_fixedFrameCounter);
+  io::writePOD(output, m_multiBodyCounter);
+  io::writePOD(output, m_rigidBodyCounter);
+  io::writePOD(output, m_linkCounter);
+  io::writePOD(output, m_jointCounter);
+}
+
+//==============================================================================
+void World::readMetadata(std::istream& input)
+{
   // World metadata (optional for forward-compatibility)
   if (input.peek() != std::char_traits<char>::eof()) {
     std::uint8_t simulationFlag = 0;
@@ -420,7 +580,11 @@ void World::loadBinary(std::istream& input)
     io::readPOD(input, m_linkCounter);
     io::readPOD(input, m_jointCounter);
   }
+}
 
+//==============================================================================
+void World::finishLoading()
+{
   // Ensure all frame entities have cache components (not serialized)
   auto frameView = m_registry.view<comps::FrameTag>();
   for (auto entity : frameView) {
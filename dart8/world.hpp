@@ -40,19 +40,31 @@
 #include <entt/entt.hpp>
 
 #include <iosfwd>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 
 #include <cstddef>
 
+namespace dart8::common {
+class ThreadPool;
+} // namespace dart8::common
+
+namespace dart8::io {
+struct SnapshotBaseline;
+} // namespace dart8::io
+
 namespace dart8 {
 
+class FrameHierarchy;
+
 class DART8_API World
 {
 public:
   World();
-  ~World() = default;
+  ~World();
 
   World(const World&) = delete;
   World& operator=(const World&) = delete;
@@ -97,8 +109,54 @@ public:
   }
 
   void enterSimulationMode();
+
+  /// Recomputes the world transforms of all frames
+  ///
+  /// Links are posed from their joint positions. The other frames are
+  /// updated level by level over a depth-sorted copy of the frame tree, and
+  /// only the frames whose local transform changed and their descendants are
+  /// recomputed. Levels wider than a few hundred frames are split across the
+  /// threads set by setNumThreads().
+  ///
+  /// @throws InvalidArgumentException if not in simulation mode
   void updateKinematics();
 
+  /// Sets the number of threads used by updateKinematics(), including the
+  /// calling thread. Pass 0 to use the number of hardware threads.
+  void setNumThreads(std::size_t numThreads);
+
+  /// Returns the number of threads used by updateKinematics()
+  [[nodiscard]] std::size_t getNumThreads() const;
+
+  /// Advances the world by one time step
+  ///
+  /// Computes the joint accelerations of every MultiBody with the
+  /// articulated-body algorithm, integrates MultiBodies and RigidBodies with
+  /// semi-implicit Euler, and updates the kinematics. Root links of
+  /// MultiBodies are fixed to the world.
+  ///
+  /// @throws InvalidArgumentException if not in simulation mode
+  /// @throws NotImplementedException if a MultiBody has a joint type that the
+  /// forward dynamics does not support yet
+  void step();
+
+  /// Sets the time step in seconds
+  ///
+  /// @throws InvalidArgumentException if the time step is not positive
+  void setTimeStep(double timeStep);
+
+  /// Returns the time step in seconds
+  [[nodiscard]] double getTimeStep() const;
+
+  /// Returns the simulated time in seconds since entering simulation mode
+  [[nodiscard]] double getTime() const;
+
+  /// Sets the gravitational acceleration in the world frame
+  void setGravity(const Eigen::Vector3d& gravity);
+
+  /// Returns the gravitational acceleration in the world frame
+  [[nodiscard]] const Eigen::Vector3d& getGravity() const;
+
   //--------------------------------------------------------------------------
   // Registry access
   //--------------------------------------------------------------------------
@@ -111,6 +169,25 @@ public:
   void saveBinary(std::ostream& output) const;
   void loadBinary(std::istream& input);
 
+  /// Writes a columnar snapshot, one packed section per component type.
+  /// If @p baseline is given it is set to the saved state for saveDelta().
+  void saveSnapshot(
+      std::ostream& output, io::SnapshotBaseline* baseline = nullptr) const;
+
+  /// Writes only the components changed since @p baseline, then advances
+  /// @p baseline. Falls back to a full snapshot when entities or their
+  /// component sets changed. Every component is still packed and compared
+  /// on each call, so the cost scales with the size of the world rather than
+  /// with the number of changes.
+  void saveDelta(std::ostream& output, io::SnapshotBaseline& baseline) const;
+
+  /// Replaces the world with a snapshot written by saveSnapshot()
+  void loadSnapshot(std::istream& input);
+
+  /// Applies a stream written by saveDelta() on top of the state restored by
+  /// the last loadSnapshot() or applyDelta()
+  void applyDelta(std::istream& input);
+
   //--------------------------------------------------------------------------
   // Utilities
   //--------------------------------------------------------------------------
@@ -137,10 +214,26 @@ private:
 
   void ensureDesignMode() const;
   void resetCountersFromRegistry();
+  void writeMetadata(std::ostream& output) const;
+  void readMetadata(std::istream& input);
+  void finishLoading();
 
   entt::registry m_registry;
   bool m_simulationMode{false};
 
+  /// Saved ID to entity mapping of the last snapshot, used by applyDelta()
+  std::unordered_map<entt::entity, entt::entity> m_snapshotEntities;
+
+  /// Depth-sorted frame tree used by updateKinematics()
+  std::unique_ptr<FrameHierarchy> m_frameHierarchy;
+
+  /// Pool for updateKinematics(), or nullptr when running serially
+  std::unique_ptr<common::ThreadPool> m_threadPool;
+
+  double m_timeStep{0.001};
+  double m_time{0.0};
+  Eigen::Vector3d m_gravity{0.0, 0.0, -9.81};
+
   std::size_t m_freeFrameCounter{0};
   std::size_t m_fixedFrameCounter{0};
   std::size_t m_multiBodyCounter{0};
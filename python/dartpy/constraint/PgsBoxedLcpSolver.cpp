@@ -83,7 +83,10 @@ void PgsBoxedLcpSolver(py::module& m)
       .def_readwrite(
           "mRandomizeConstraintOrder",
           &dart::constraint::PgsBoxedLcpSolver::Option::
-              mRandomizeConstraintOrder);
+              mRandomizeConstraintOrder)
+      .def_readwrite(
+          "mRandomSeed",
+          &dart::constraint::PgsBoxedLcpSolver::Option::mRandomSeed);
 
   ::py::class_<
       dart::constraint::PgsBoxedLcpSolver,
@@ -126,6 +129,12 @@ void PgsBoxedLcpSolver(py::module& m)
             self->setOption(option);
           },
           ::py::arg("option"))
+      .def(
+          "setRandomSeed",
+          +[](dart::constraint::PgsBoxedLcpSolver* self, unsigned long seed) {
+            self->setRandomSeed(seed);
+          },
+          ::py::arg("seed"))
       .def_static(
           "getStaticType",
           +[]() -> const std::string& {
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <dart/All.hpp>
+
+#include <pybind11/eigen.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <string>
+#include <vector>
+
+namespace py = pybind11;
+
+namespace dart {
+namespace python {
+
+namespace {
+
+/// Row-major matrix with one row per skeleton and one column per DOF
+using StateMatrix
+    = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+using MetaSkeletons = std::vector<dart::dynamics::MetaSkeletonPtr>;
+
+//==============================================================================
+void checkShape(
+    const MetaSkeletons& skeletons,
+    Eigen::Index rows,
+    Eigen::Index cols,
+    const char* fname)
+{
+  if (static_cast<std::size_t>(rows) != skeletons.size()) {
+    throw ::py::value_error(
+        std::string(fname) + ": expected " + std::to_string(skeletons.size())
+        + " rows, one per skeleton, but got " + std::to_string(rows));
+  }
+
+  for (const auto& skeleton : skeletons) {
+    if (!skeleton) {
+      throw ::py::value_error(std::string(fname) + ": skeleton is None");
+    }
+
+    if (skeleton->getNumDofs() != static_cast<std::size_t>(cols)) {
+      throw ::py::value_error(
+          std::string(fname) + ": skeleton '" + skeleton->getName()
+          + "' has " + std::to_string(skeleton->getNumDofs())
+          + " DOFs but the array has " + std::to_string(cols) + " columns");
+    }
+  }
+}
+
+//==============================================================================
+template <double (dart::dynamics::DegreeOfFreedom::*getValue)() const>
+void getValues(
+    const MetaSkeletons& skeletons,
+    Eigen::Ref<StateMatrix> out,
+    const char* fname)
+{
+  checkShape(skeletons, out.rows(), out.cols(), fname);
+
+  for (std::size_t i = 0u; i < skeletons.size(); ++i) {
+    const dart::dynamics::MetaSkeleton* skeleton = skeletons[i].get();
+    for (std::size_t j = 0u; j < skeleton->getNumDofs(); ++j)
+      out(i, j) = (skeleton->getDof(j)->*getValue)();
+  }
+}
+
+//==============================================================================
+template <void (dart::dynamics::DegreeOfFreedom::*setValue)(double)>
+void setValues(
+    const MetaSkeletons& skeletons,
+    const Eigen::Ref<const StateMatrix>& values,
+    const char* fname)
+{
+  checkShape(skeletons, values.rows(), values.cols(), fname);
+
+  // Setting the values through the DOFs notifies the joints, so the
+  // skeletons' dirty flags are updated as with MetaSkeleton::setPositions().
+  for (std::size_t i = 0u; i < skeletons.size(); ++i) {
+    dart::dynamics::MetaSkeleton* skeleton = skeletons[i].get();
+    for (std::size_t j = 0u; j < skeleton->getNumDofs(); ++j)
+      (skeleton->getDof(j)->*setValue)(values(i, j));
+  }
+}
+
+} // namespace
+
+void BatchedState(py::module& m)
+{
+  // Batched state accessors for many skeletons with the same number of DOFs,
+  // e.g., the agents of a reinforcement-learning environment. The getters
+  // fill a caller-provided, C-contiguous float64 array of shape
+  // (len(skeletons), dofs) in place, so no array is allocated per call, and
+  // all the skeletons are visited in a single call into C++.
+  m.def(
+      "getPositions",
+      +[](const MetaSkeletons& skeletons, Eigen::Ref<StateMatrix> out) {
+        getValues<&dart::dynamics::DegreeOfFreedom::getPosition>(
+            skeletons, out, "getPositions");
+      },
+      ::py::arg("skeletons"),
+      ::py::arg("out").noconvert());
+
+  m.def(
+      "setPositions",
+      +[](const MetaSkeletons& skeletons,
+          const Eigen::Ref<const StateMatrix>& positions) {
+        setValues<&dart::dynamics::DegreeOfFreedom::setPosition>(
+            skeletons, positions, "setPositions");
+      },
+      ::py::arg("skeletons"),
+      ::py::arg("positions"));
+
+  m.def(
+      "getVelocities",
+      +[](const MetaSkeletons& skeletons, Eigen::Ref<StateMatrix> out) {
+        getValues<&dart::dynamics::DegreeOfFreedom::getVelocity>(
+            skeletons, out, "getVelocities");
+      },
+      ::py::arg("skeletons"),
+      ::py::arg("out").noconvert());
+
+  m.def(
+      "setVelocities",
+      +[](const MetaSkeletons& skeletons,
+          const Eigen::Ref<const StateMatrix>& velocities) {
+        setValues<&dart::dynamics::DegreeOfFreedom::setVelocity>(
+            skeletons, velocities, "setVelocities");
+      },
+      ::py::arg("skeletons"),
+      ::py::arg("velocities"));
+
+  m.def(
+      "getForces",
+      +[](const MetaSkeletons& skeletons, Eigen::Ref<StateMatrix> out) {
+        getValues<&dart::dynamics::DegreeOfFreedom::getForce>(
+            skeletons, out, "getForces");
+      },
+      ::py::arg("skeletons"),
+      ::py::arg("out").noconvert());
+
+  m.def(
+      "setForces",
+      +[](const MetaSkeletons& skeletons,
+          const Eigen::Ref<const StateMatrix>& forces) {
+        setValues<&dart::dynamics::DegreeOfFreedom::setForce>(
+            skeletons, forces, "setForces");
+      },
+      ::py::arg("skeletons"),
+      ::py::arg("forces"));
+}
+
+} // namespace python
+} // namespace dart
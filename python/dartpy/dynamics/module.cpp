@@ -74,6 +74,7 @@ void ReferentialSkeleton(py::module& sm);
 void Linkage(py::module& sm);
 void Chain(py::module& sm);
 void Skeleton(py::module& sm);
+void BatchedState(py::module& sm);
 
 void InverseKinematics(py::module& sm);
 void Inertia(py::module& sm);
@@ -119,6 +120,7 @@ void dart_dynamics(py::module& m)
   Linkage(sm);
   Chain(sm);
   Skeleton(sm);
+  BatchedState(sm);
 
   InverseKinematics(sm);
 
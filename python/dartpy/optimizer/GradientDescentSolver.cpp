@@ -279,6 +279,11 @@ void GradientDescentSolver(py::module& m)
           +[](const dart::math::GradientDescentSolver* self) -> std::size_t {
             return self->getLastNumIterations();
           })
+      .def(
+          "setRandomSeed",
+          +[](dart::math::GradientDescentSolver* self,
+              std::uint_fast32_t seed) { self->setRandomSeed(seed); },
+          ::py::arg("seed"))
       .def_readonly_static("Type", &dart::math::GradientDescentSolver::Type);
 }
 
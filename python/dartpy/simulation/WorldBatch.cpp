@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <dart/simulation/WorldBatch.hpp>
+
+#include <dart/All.hpp>
+
+#include <pybind11/eigen.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+namespace dart {
+namespace python {
+
+void WorldBatch(py::module& m)
+{
+  using StateMatrix = dart::simulation::WorldBatch::StateMatrix;
+
+  // The state getters return writable NumPy views of the matrices owned by
+  // the batch rather than copies, so a training loop can read observations
+  // and write actions without allocating. Rows written from Python are pushed
+  // into the worlds, and hence their skeletons' dirty flags, by step().
+  ::py::class_<dart::simulation::WorldBatch>(m, "WorldBatch")
+      .def(
+          ::py::init<
+              const dart::simulation::WorldPtr&,
+              std::size_t,
+              std::size_t>(),
+          ::py::arg("world"),
+          ::py::arg("numWorlds"),
+          ::py::arg("numThreads") = 0u)
+      .def(
+          "getNumWorlds",
+          +[](const dart::simulation::WorldBatch* self) -> std::size_t {
+            return self->getNumWorlds();
+          })
+      .def(
+          "getNumDofs",
+          +[](const dart::simulation::WorldBatch* self) -> std::size_t {
+            return self->getNumDofs();
+          })
+      .def(
+          "getWorld",
+          +[](const dart::simulation::WorldBatch* self, std::size_t index)
+              -> dart::simulation::WorldPtr { return self->getWorld(index); },
+          ::py::arg("index"))
+      .def(
+          "setNumThreads",
+          +[](dart::simulation::WorldBatch* self, std::size_t numThreads) {
+            self->setNumThreads(numThreads);
+          },
+          ::py::arg("numThreads"))
+      .def(
+          "getNumThreads",
+          +[](const dart::simulation::WorldBatch* self) -> std::size_t {
+            return self->getNumThreads();
+          })
+      .def(
+          "getPositions",
+          +[](dart::simulation::WorldBatch* self) -> StateMatrix& {
+            return self->getPositions();
+          },
+          ::py::return_value_policy::reference_internal)
+      .def(
+          "getVelocities",
+          +[](dart::simulation::WorldBatch* self) -> StateMatrix& {
+            return self->getVelocities();
+          },
+          ::py::return_value_policy::reference_internal)
+      .def(
+          "getForces",
+          +[](dart::simulation::WorldBatch* self) -> StateMatrix& {
+            return self->getForces();
+          },
+          ::py::return_value_policy::reference_internal)
+      .def(
+          "step",
+          +[](dart::simulation::WorldBatch* self, std::size_t numSteps) {
+            self->step(numSteps);
+          },
+          ::py::arg("numSteps") = 1u,
+          ::py::call_guard<::py::gil_scoped_release>())
+      .def(
+          "reset",
+          +[](dart::simulation::WorldBatch* self) { self->reset(); },
+          ::py::call_guard<::py::gil_scoped_release>())
+      .def(
+          "reset",
+          +[](dart::simulation::WorldBatch* self,
+              const std::vector<std::size_t>& indices) {
+            self->reset(indices);
+          },
+          ::py::arg("indices"),
+          ::py::call_guard<::py::gil_scoped_release>());
+}
+
+} // namespace python
+} // namespace dart
@@ -38,12 +38,14 @@ namespace dart {
 namespace python {
 
 void World(py::module& sm);
+void WorldBatch(py::module& sm);
 
 void dart_simulation(py::module& m)
 {
   auto sm = m.def_submodule("simulation");
 
   World(sm);
+  WorldBatch(sm);
 }
 
 } // namespace python
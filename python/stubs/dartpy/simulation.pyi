@@ -4,7 +4,9 @@ import dartpy.constraint
 import dartpy.dynamics
 import numpy
 import typing
-__all__: list[str] = ['CollisionDetectorType', 'World']
+__all__: list[str] = ['CollisionDetectorType', 'World', 'WorldBatch']
+M = typing.TypeVar("M", bound=int)
+N = typing.TypeVar("N", bound=int)
 class CollisionDetectorType:
     """
     Members:
@@ -151,3 +153,30 @@ class World:
     @property
     def onNameChanged(self) -> ...:
         ...
+class WorldBatch:
+    def __init__(self, world: World, numWorlds: int, numThreads: int = 0) -> None:
+        ...
+    def getForces(self) -> numpy.ndarray[tuple[M, N], numpy.dtype[numpy.float64]]:
+        ...
+    def getNumDofs(self) -> int:
+        ...
+    def getNumThreads(self) -> int:
+        ...
+    def getNumWorlds(self) -> int:
+        ...
+    def getPositions(self) -> numpy.ndarray[tuple[M, N], numpy.dtype[numpy.float64]]:
+        ...
+    def getVelocities(self) -> numpy.ndarray[tuple[M, N], numpy.dtype[numpy.float64]]:
+        ...
+    def getWorld(self, index: int) -> World:
+        ...
+    @typing.overload
+    def reset(self) -> None:
+        ...
+    @typing.overload
+    def reset(self, indices: list[int]) -> None:
+        ...
+    def setNumThreads(self, numThreads: int) -> None:
+        ...
+    def step(self, numSteps: int = 1) -> None:
+        ...
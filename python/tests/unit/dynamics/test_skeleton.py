@@ -19,5 +19,44 @@ def test_basic():
     assert skel.getBodyNode(0).getName() == body1.getName()
 
 
+def test_batched_state():
+    skels = []
+    for i in range(3):
+        skel = dart.dynamics.Skeleton("skel%d" % i)
+        skel.createFreeJointAndBodyNodePair()
+        skels.append(skel)
+
+    positions = np.random.rand(3, 6)
+    dart.dynamics.setPositions(skels, positions)
+    dart.dynamics.setVelocities(skels, 2 * positions)
+    dart.dynamics.setForces(skels, 3 * positions)
+
+    out = np.zeros((3, 6))
+    dart.dynamics.getPositions(skels, out)
+    assert np.allclose(out, positions)
+    for skel, row in zip(skels, positions):
+        assert np.allclose(skel.getPositions(), row)
+
+    dart.dynamics.getVelocities(skels, out)
+    assert np.allclose(out, 2 * positions)
+    dart.dynamics.getForces(skels, out)
+    assert np.allclose(out, 3 * positions)
+
+    # Writing the positions dirties the kinematics
+    translations = np.zeros((3, 6))
+    translations[:, 3:] = [1.0, 2.0, 3.0]
+    dart.dynamics.setPositions(skels, translations)
+    for skel in skels:
+        tf = skel.getBodyNode(0).getWorldTransform()
+        assert np.allclose(tf.translation(), [1.0, 2.0, 3.0])
+
+    with pytest.raises(ValueError):
+        dart.dynamics.getPositions(skels, np.zeros((2, 6)))
+    with pytest.raises(ValueError):
+        dart.dynamics.setPositions(skels, np.zeros((3, 5)))
+    with pytest.raises(TypeError):
+        dart.dynamics.getPositions(skels, np.zeros((3, 6), dtype=np.float32))
+
+
 if __name__ == "__main__":
     pytest.main()
@@ -0,0 +1,54 @@
+import dartpy as dart
+import numpy as np
+import pytest
+
+
+def create_world():
+    world = dart.simulation.World("world")
+    world.setGravity([0.0, 0.0, -9.81])
+
+    skel = dart.dynamics.Skeleton("pendulum")
+    [joint, body] = skel.createRevoluteJointAndBodyNodePair()
+    world.addSkeleton(skel)
+    return world
+
+
+def test_views_are_zero_copy():
+    batch = dart.simulation.WorldBatch(create_world(), 4, 1)
+    assert batch.getNumWorlds() == 4
+    assert batch.getNumDofs() == 1
+
+    positions = batch.getPositions()
+    assert positions.shape == (4, 1)
+    assert positions.flags.writeable
+
+    # Writing through the view writes the batch-owned buffer
+    positions[2, 0] = 0.5
+    assert batch.getPositions()[2, 0] == 0.5
+
+    batch.step()
+    world = batch.getWorld(2)
+    assert world.getSkeleton(0).getPosition(0) == pytest.approx(
+        positions[2, 0], abs=1e-3
+    )
+
+
+def test_forces_drive_the_worlds():
+    batch = dart.simulation.WorldBatch(create_world(), 2, 1)
+    forces = batch.getForces()
+    forces[0, 0] = 1.0
+    forces[1, 0] = -1.0
+
+    batch.step(10)
+    velocities = batch.getVelocities()
+    assert velocities[0, 0] > 0.0
+    assert velocities[1, 0] < 0.0
+
+    batch.reset([0])
+    assert velocities[0, 0] == 0.0
+    assert forces[0, 0] == 0.0
+    assert forces[1, 0] == -1.0
+
+
+if __name__ == "__main__":
+    pytest.main()
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <dart/collision/dart/DARTCollisionDetector.hpp>
+
+#include <dart/dynamics/All.hpp>
+
+#include <dart/math/Random.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <vector>
+
+using namespace dart;
+
+namespace {
+
+/// Creates \c numObjects spheres and boxes on a jittered 2 m grid so that no
+/// two of them overlap and every query has to find a positive distance
+[[nodiscard]] std::vector<dynamics::SimpleFramePtr> createFrames(
+    int numObjects)
+{
+  math::Random::setSeed(0u);
+
+  std::vector<dynamics::SimpleFramePtr> frames;
+  for (auto i = 0; i < numObjects; ++i) {
+    auto frame = dynamics::SimpleFrame::createShared(dynamics::Frame::World());
+    if (i % 2 == 0) {
+      frame->setShape(std::make_shared<dynamics::SphereShape>(0.3));
+    } else {
+      frame->setShape(std::make_shared<dynamics::BoxShape>(
+          Eigen::Vector3d(0.6, 0.4, 0.2)));
+    }
+
+    Eigen::Isometry3d tf = Eigen::Isometry3d::Identity();
+    const Eigen::Vector3d cell(i % 6, (i / 6) % 6, i / 36);
+    tf.translation() = 2.0 * cell
+                       + math::Random::uniform<Eigen::Vector3d>(-0.5, 0.5);
+    tf.linear() = math::expMapRot(
+        math::Random::uniform<Eigen::Vector3d>(-math::pi, math::pi));
+    frame->setTransform(tf);
+    frames.push_back(frame);
+  }
+
+  return frames;
+}
+
+} // namespace
+
+/// Minimum distance over all pairs of one group, pruned by the AABB bounds
+static void BM_DARTGroupDistance(benchmark::State& state)
+{
+  const auto frames = createFrames(static_cast<int>(state.range(0)));
+  auto cd = collision::DARTCollisionDetector::create();
+  auto group = cd->createCollisionGroup();
+  for (const auto& frame : frames)
+    group->addShapeFrame(frame.get());
+
+  collision::DistanceOption option;
+  collision::DistanceResult result;
+
+  for (auto _ : state)
+    benchmark::DoNotOptimize(group->distance(option, &result));
+}
+
+/// Minimum distance over all pairs queried one pair at a time, which runs
+/// GJK on every pair
+static void BM_DARTPairwiseDistance(benchmark::State& state)
+{
+  const auto frames = createFrames(static_cast<int>(state.range(0)));
+  auto cd = collision::DARTCollisionDetector::create();
+  std::vector<std::unique_ptr<collision::CollisionGroup>> groups;
+  for (const auto& frame : frames)
+    groups.push_back(cd->createCollisionGroup(frame.get()));
+
+  collision::DistanceOption option;
+  collision::DistanceResult result;
+
+  for (auto _ : state) {
+    double minDistance = std::numeric_limits<double>::infinity();
+    for (std::size_t i = 0; i < groups.size(); ++i) {
+      for (std::size_t j = i + 1; j < groups.size(); ++j) {
+        minDistance = std::min(
+            minDistance,
+            cd->distance(groups[i].get(), groups[j].get(), option, &result));
+      }
+    }
+    benchmark::DoNotOptimize(minDistance);
+  }
+}
+
+BENCHMARK(BM_DARTGroupDistance)
+    ->Arg(50)
+    ->Arg(200)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_DARTPairwiseDistance)
+    ->Arg(50)
+    ->Arg(200)
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <dart/dynamics/All.hpp>
+
+#include <benchmark/benchmark.h>
+
+using namespace dart;
+
+namespace {
+
+/// Creates a serial chain of revolute joints with damping, springs and gravity
+[[nodiscard]] dynamics::SkeletonPtr createChain(std::size_t numDofs)
+{
+  auto skel = dynamics::Skeleton::create();
+  dynamics::BodyNode* bn = nullptr;
+  for (std::size_t i = 0; i < numDofs; ++i) {
+    dynamics::RevoluteJoint::Properties properties;
+    properties.mAxis
+        = i % 2 == 0 ? Eigen::Vector3d::UnitZ() : Eigen::Vector3d::UnitY();
+    properties.mT_ParentBodyToJoint.translation()
+        = Eigen::Vector3d(i == 0 ? 0.0 : 0.3, 0.0, 0.0);
+    properties.mDampingCoefficients[0] = 0.1;
+    properties.mSpringStiffnesses[0] = 1.0;
+    bn = skel->createJointAndBodyNodePair<dynamics::RevoluteJoint>(
+                 bn, properties)
+             .second;
+    bn->setInertia(dynamics::Inertia(
+        1.0,
+        Eigen::Vector3d(0.15, 0.0, 0.0),
+        0.01 * Eigen::Matrix3d::Identity()));
+  }
+  skel->setPositions(Eigen::VectorXd::LinSpaced(numDofs, 0.1, 0.7));
+  skel->setVelocities(Eigen::VectorXd::LinSpaced(numDofs, -0.5, 0.5));
+  skel->setForces(Eigen::VectorXd::LinSpaced(numDofs, -1.0, 1.0));
+  return skel;
+}
+
+/// The forward dynamics derivatives as they have to be computed without the
+/// analytical derivatives: 2n + 1 forward dynamics evaluations and a
+/// factorization of the mass matrix for the derivative with respect to forces
+void computeFiniteDifferences(
+    dynamics::Skeleton& skel,
+    Eigen::MatrixXd& wrtPositions,
+    Eigen::MatrixXd& wrtVelocities,
+    Eigen::MatrixXd& wrtForces)
+{
+  constexpr double step = 1e-6;
+  const std::size_t n = skel.getNumDofs();
+  const Eigen::VectorXd q = skel.getPositions();
+  const Eigen::VectorXd dq = skel.getVelocities();
+
+  skel.computeForwardDynamics();
+  const Eigen::VectorXd ddq = skel.getAccelerations();
+  for (std::size_t k = 0; k < n; ++k) {
+    skel.setPosition(k, q[k] + step);
+    skel.computeForwardDynamics();
+    wrtPositions.col(k) = (skel.getAccelerations() - ddq) / step;
+    skel.setPosition(k, q[k]);
+
+    skel.setVelocity(k, dq[k] + step);
+    skel.computeForwardDynamics();
+    wrtVelocities.col(k) = (skel.getAccelerations() - ddq) / step;
+    skel.setVelocity(k, dq[k]);
+  }
+  wrtForces = skel.getInvAugMassMatrix();
+}
+
+void BM_FiniteDifferences(benchmark::State& state)
+{
+  auto skel = createChain(static_cast<std::size_t>(state.range(0)));
+  const auto n = static_cast<Eigen::Index>(skel->getNumDofs());
+  Eigen::MatrixXd wrtPositions(n, n);
+  Eigen::MatrixXd wrtVelocities(n, n);
+  Eigen::MatrixXd wrtForces(n, n);
+  for (auto _ : state) {
+    computeFiniteDifferences(*skel, wrtPositions, wrtVelocities, wrtForces);
+    benchmark::DoNotOptimize(wrtPositions.data());
+    benchmark::DoNotOptimize(wrtForces.data());
+  }
+}
+
+void BM_Analytical(benchmark::State& state)
+{
+  auto skel = createChain(static_cast<std::size_t>(state.range(0)));
+  const auto n = static_cast<Eigen::Index>(skel->getNumDofs());
+  Eigen::MatrixXd wrtPositions(n, n);
+  Eigen::MatrixXd wrtVelocities(n, n);
+  Eigen::MatrixXd wrtForces(n, n);
+  for (auto _ : state) {
+    // Invalidate the cached mass matrix as a new state would
+    skel->setPositions(skel->getPositions());
+    skel->computeForwardDynamicsDerivatives(
+        wrtPositions, wrtVelocities, wrtForces);
+    benchmark::DoNotOptimize(wrtPositions.data());
+    benchmark::DoNotOptimize(wrtForces.data());
+  }
+}
+
+} // namespace
+
+BENCHMARK(BM_FiniteDifferences)->Arg(7)->Arg(30);
+BENCHMARK(BM_Analytical)->Arg(7)->Arg(30);
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <dart/dynamics/All.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+using namespace dart;
+using dynamics::InverseKinematics;
+
+namespace {
+
+/// The JacobianDLS gradient as it was computed before it used a preallocated
+/// workspace: an explicit inverse of a freshly allocated damped system
+class InverseJacobianDLS : public InverseKinematics::GradientMethod
+{
+public:
+  explicit InverseJacobianDLS(InverseKinematics* ik)
+    : GradientMethod(ik, "InverseJacobianDLS", Properties())
+  {
+    // Do nothing
+  }
+
+  std::unique_ptr<GradientMethod> clone(
+      InverseKinematics* newIK) const override
+  {
+    return std::make_unique<InverseJacobianDLS>(newIK);
+  }
+
+  void computeGradient(
+      const Eigen::Vector6d& error, Eigen::VectorXd& grad) override
+  {
+    const math::Jacobian& J = mIK->computeJacobian();
+
+    const double damping = dynamics::DefaultIKDLSCoefficient;
+    int rows = J.rows(), cols = J.cols();
+    if (rows <= cols) {
+      grad = J.transpose()
+             * (std::pow(damping, 2) * Eigen::MatrixXd::Identity(rows, rows)
+                + J * J.transpose())
+                   .inverse()
+             * error;
+    } else {
+      grad = (std::pow(damping, 2) * Eigen::MatrixXd::Identity(cols, cols)
+              + J.transpose() * J)
+                 .inverse()
+             * J.transpose() * error;
+    }
+
+    convertJacobianMethodOutputToGradient(grad, mIK->getDofs());
+    applyWeights(grad);
+    clampGradient(grad);
+  }
+};
+
+/// Creates a serial chain of revolute joints and returns its IK module
+[[nodiscard]] std::shared_ptr<InverseKinematics> createChain(
+    dynamics::SkeletonPtr& skel, std::size_t numDofs)
+{
+  skel = dynamics::Skeleton::create();
+  dynamics::BodyNode* bn = nullptr;
+  for (std::size_t i = 0; i < numDofs; ++i) {
+    dynamics::RevoluteJoint::Properties properties;
+    properties.mAxis
+        = i % 2 == 0 ? Eigen::Vector3d::UnitZ() : Eigen::Vector3d::UnitY();
+    properties.mT_ParentBodyToJoint.translation()
+        = Eigen::Vector3d(i == 0 ? 0.0 : 0.3, 0.0, 0.0);
+    bn = skel->createJointAndBodyNodePair<dynamics::RevoluteJoint>(
+                 bn, properties)
+             .second;
+  }
+  skel->setPositions(Eigen::VectorXd::LinSpaced(numDofs, 0.1, 0.7));
+
+  return bn->getIK(true);
+}
+
+template <typename Setup>
+void runGradient(benchmark::State& state, Setup setup)
+{
+  dynamics::SkeletonPtr skel;
+  auto ik = createChain(skel, static_cast<std::size_t>(state.range(0)));
+  setup(*ik);
+
+  Eigen::Vector6d error;
+  error << 0.01, -0.02, 0.015, 0.02, 0.01, -0.01;
+  Eigen::VectorXd grad(skel->getNumDofs());
+
+  // Every IK iteration evaluates the gradient at new positions, so change the
+  // positions to invalidate the Jacobian as the solver would
+  const Eigen::VectorXd q = skel->getPositions();
+  double offset = 0.0;
+  for (auto _ : state) {
+    offset = offset > 0.1 ? 0.0 : offset + 1e-3;
+    skel->setPositions((q.array() + offset).matrix());
+    ik->getGradientMethod().computeGradient(error, grad);
+    benchmark::DoNotOptimize(grad.data());
+  }
+}
+
+} // namespace
+
+static void BM_DlsInverse(benchmark::State& state)
+{
+  runGradient(state, [](InverseKinematics& ik) {
+    ik.setGradientMethod<InverseJacobianDLS>();
+  });
+}
+
+static void BM_DlsLdlt(benchmark::State& state)
+{
+  runGradient(state, [](InverseKinematics& ik) {
+    ik.setGradientMethod<InverseKinematics::JacobianDLS>().setDecomposition(
+        InverseKinematics::JacobianDLS::Decomposition::Ldlt);
+  });
+}
+
+static void BM_DlsSvd(benchmark::State& state)
+{
+  runGradient(state, [](InverseKinematics& ik) {
+    ik.setGradientMethod<InverseKinematics::JacobianDLS>().setDecomposition(
+        InverseKinematics::JacobianDLS::Decomposition::Svd);
+  });
+}
+
+BENCHMARK(BM_DlsInverse)->Arg(3)->Arg(7)->Arg(30);
+BENCHMARK(BM_DlsLdlt)->Arg(3)->Arg(7)->Arg(30);
+BENCHMARK(BM_DlsSvd)->Arg(3)->Arg(7)->Arg(30);
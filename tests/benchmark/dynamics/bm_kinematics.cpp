@@ -186,3 +186,51 @@ static void BM_Dynamics(benchmark::State& state)
 }
 
 BENCHMARK(BM_Dynamics)->Arg(1)->Arg(10)->Arg(100)->Arg(1000)->Arg(10000);
+
+void testMassMatrixSpeed(
+    dart::dynamics::SkeletonPtr skel, bool inverse, std::size_t numTests)
+{
+  if (nullptr == skel)
+    return;
+
+  for (std::size_t i = 0; i < numTests; ++i) {
+    // Changing the positions invalidates the cached mass matrices
+    for (std::size_t j = 0; j < skel->getNumDofs(); ++j) {
+      dart::dynamics::DegreeOfFreedom* dof = skel->getDof(j);
+      dof->setPosition(dart::math::Random::uniform(
+          std::max(dof->getPositionLowerLimit(), -1.0),
+          std::min(dof->getPositionUpperLimit(), 1.0)));
+    }
+
+    if (inverse)
+      benchmark::DoNotOptimize(skel->getInvMassMatrix());
+    else
+      benchmark::DoNotOptimize(skel->getMassMatrix());
+  }
+}
+
+static void BM_MassMatrix(benchmark::State& state)
+{
+  std::vector<dart::simulation::WorldPtr> worlds = getWorlds();
+  int n = state.range(0);
+
+  for (auto _ : state) {
+    for (const auto& world : worlds)
+      testMassMatrixSpeed(world->getSkeleton(0), false, n);
+  }
+}
+
+BENCHMARK(BM_MassMatrix)->Arg(1)->Arg(10)->Arg(100);
+
+static void BM_InvMassMatrix(benchmark::State& state)
+{
+  std::vector<dart::simulation::WorldPtr> worlds = getWorlds();
+  int n = state.range(0);
+
+  for (auto _ : state) {
+    for (const auto& world : worlds)
+      testMassMatrixSpeed(world->getSkeleton(0), true, n);
+  }
+}
+
+BENCHMARK(BM_InvMassMatrix)->Arg(1)->Arg(10)->Arg(100);
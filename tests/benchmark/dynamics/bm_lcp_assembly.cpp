@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <dart/simulation/All.hpp>
+
+#include <dart/constraint/All.hpp>
+
+#include <dart/dynamics/All.hpp>
+
+#include <benchmark/benchmark.h>
+
+using namespace dart;
+
+namespace {
+
+using MatrixAssembly = constraint::BoxedLcpConstraintSolver::MatrixAssembly;
+using dynamics::CollisionAspect;
+using dynamics::DynamicsAspect;
+
+[[nodiscard]] dynamics::SkeletonPtr createBox(
+    const Eigen::Vector3d& position, double size)
+{
+  auto box = dynamics::Skeleton::create();
+  auto body = box->createJointAndBodyNodePair<dynamics::FreeJoint>().second;
+  body->createShapeNodeWith<CollisionAspect, DynamicsAspect>(
+      std::make_shared<dynamics::BoxShape>(Eigen::Vector3d::Constant(size)));
+
+  Eigen::Isometry3d tf = Eigen::Isometry3d::Identity();
+  tf.translation() = position;
+  body->getParentJoint()->setPositions(
+      dynamics::FreeJoint::convertToPositions(tf));
+
+  return box;
+}
+
+/// Creates a single pile of dim x dim x dim boxes resting on the ground, which
+/// forms one large constrained group
+[[nodiscard]] simulation::WorldPtr createPile(
+    std::size_t dim, MatrixAssembly assembly)
+{
+  auto world = simulation::World::create();
+
+  auto solver = std::make_unique<constraint::BoxedLcpConstraintSolver>();
+  solver->setMatrixAssembly(assembly);
+  world->setConstraintSolver(std::move(solver));
+
+  auto ground = dynamics::Skeleton::create("ground");
+  auto groundBody
+      = ground->createJointAndBodyNodePair<dynamics::WeldJoint>().second;
+  groundBody->createShapeNodeWith<CollisionAspect, DynamicsAspect>(
+      std::make_shared<dynamics::BoxShape>(Eigen::Vector3d(10.0, 10.0, 0.1)));
+  Eigen::Isometry3d tf = Eigen::Isometry3d::Identity();
+  tf.translation().z() = -0.05;
+  groundBody->getParentJoint()->setTransformFromParentBodyNode(tf);
+  world->addSkeleton(ground);
+
+  const double size = 0.2;
+  for (auto i = 0u; i < dim; ++i) {
+    for (auto j = 0u; j < dim; ++j) {
+      for (auto k = 0u; k < dim; ++k) {
+        world->addSkeleton(createBox(
+            Eigen::Vector3d(
+                (i - 0.5 * dim) * size,
+                (j - 0.5 * dim) * size,
+                (k + 0.5) * size * 1.01),
+            size));
+      }
+    }
+  }
+
+  // Let the pile settle so that every step solves a contact-rich LCP
+  for (auto i = 0; i < 50; ++i)
+    world->step();
+
+  return world;
+}
+
+void runPile(benchmark::State& state, MatrixAssembly assembly)
+{
+  auto world = createPile(static_cast<std::size_t>(state.range(0)), assembly);
+  for (auto _ : state)
+    world->step();
+}
+
+} // namespace
+
+static void BM_PileImpulseTests(benchmark::State& state)
+{
+  runPile(state, MatrixAssembly::ImpulseTests);
+}
+
+static void BM_PileAnalytic(benchmark::State& state)
+{
+  runPile(state, MatrixAssembly::Analytic);
+}
+
+BENCHMARK(BM_PileImpulseTests)->Arg(2)->Arg(3)->Arg(4);
+BENCHMARK(BM_PileAnalytic)->Arg(2)->Arg(3)->Arg(4);
@@ -195,3 +195,7 @@ REGISTER_BENCHMARK_TRIPLE(6D, dart::test::LCPTestProblems::getProblem6D());
 REGISTER_BENCHMARK_TRIPLE(12D, dart::test::LCPTestProblems::getProblem12D());
 REGISTER_BENCHMARK_TRIPLE(24D, dart::test::LCPTestProblems::getProblem24D());
 REGISTER_BENCHMARK_TRIPLE(48D, dart::test::LCPTestProblems::getProblem48D());
+
+// Contact-heavy problems where the blocked LDLT kernels take over
+REGISTER_BENCHMARK_TRIPLE(96D, dart::test::LCPTestProblems::getProblem96D());
+REGISTER_BENCHMARK_TRIPLE(192D, dart::test::LCPTestProblems::getProblem192D());
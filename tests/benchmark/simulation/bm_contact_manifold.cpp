@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <dart/utils/DartResourceRetriever.hpp>
+
+#include <dart/simulation/All.hpp>
+
+#include <dart/constraint/BoxedLcpConstraintSolver.hpp>
+#include <dart/constraint/ConstraintSolver.hpp>
+#include <dart/constraint/DantzigBoxedLcpSolver.hpp>
+
+#include <dart/collision/dart/DARTCollisionDetector.hpp>
+
+#include <dart/dynamics/All.hpp>
+#include <dart/dynamics/MeshCache.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+#include <cstddef>
+
+using namespace dart;
+
+namespace {
+
+using dynamics::CollisionAspect;
+using dynamics::DynamicsAspect;
+
+/// Dantzig solver that counts the LCP rows it solves
+class CountingLcpSolver : public constraint::DantzigBoxedLcpSolver
+{
+public:
+  bool solve(
+      int n,
+      double* A,
+      double* x,
+      double* b,
+      int nub,
+      double* lo,
+      double* hi,
+      int* findex,
+      bool earlyTermination) override
+  {
+    mNumRows += static_cast<std::size_t>(n);
+    return DantzigBoxedLcpSolver::solve(
+        n, A, x, b, nub, lo, hi, findex, earlyTermination);
+  }
+
+  std::size_t mNumRows = 0u;
+};
+
+/// Shape of the boxes
+enum BoxType : int
+{
+  /// BoxShape, which the FCL collision detector of the constraint solver
+  /// collides as a mesh
+  PRIMITIVE_BOX = 0,
+
+  /// MeshShape of a triangulated box, which only FCL collides
+  MESH_BOX = 1,
+};
+
+/// Collision detector of the constraint solver
+enum DetectorType : int
+{
+  /// Default FCL detector
+  FCL_DETECTOR = 0,
+
+  /// DART detector, which reports at most four contacts per box pair
+  DART_DETECTOR = 1,
+};
+
+/// Creates the shape of a box with 0.2 long edges
+[[nodiscard]] dynamics::ShapePtr createBoxShape(BoxType boxType)
+{
+  if (boxType == PRIMITIVE_BOX)
+    return std::make_shared<dynamics::BoxShape>(Eigen::Vector3d::Constant(0.2));
+
+  // The mesh is a cube with 0.04 long edges
+  const std::string uri = "dart://sample/obj/BoxSmall.obj";
+  auto mesh = dynamics::MeshCache::GetDefault().load(
+      uri, utils::DartResourceRetriever::create());
+  return std::make_shared<dynamics::MeshShape>(
+      Eigen::Vector3d::Constant(5.0), std::move(mesh), uri);
+}
+
+/// Creates a world with \c numBoxes boxes resting on the ground
+[[nodiscard]] simulation::WorldPtr createBoxesWorld(
+    int numBoxes,
+    std::size_t maxNumContactsPerPair,
+    BoxType boxType,
+    DetectorType detectorType,
+    const std::shared_ptr<CountingLcpSolver>& lcpSolver)
+{
+  auto world = simulation::World::create();
+  world->setConstraintSolver(
+      std::make_unique<constraint::BoxedLcpConstraintSolver>(
+          lcpSolver, nullptr));
+  if (detectorType == DART_DETECTOR) {
+    world->getConstraintSolver()->setCollisionDetector(
+        collision::DARTCollisionDetector::create());
+  }
+  world->getConstraintSolver()->setMaxNumContactsPerPair(
+      maxNumContactsPerPair);
+
+  auto ground = dynamics::Skeleton::create("ground");
+  auto groundBody
+      = ground->createJointAndBodyNodePair<dynamics::WeldJoint>().second;
+  groundBody->createShapeNodeWith<CollisionAspect, DynamicsAspect>(
+      std::make_shared<dynamics::BoxShape>(Eigen::Vector3d(100.0, 100.0, 0.1)));
+  Eigen::Isometry3d tf = Eigen::Isometry3d::Identity();
+  tf.translation().z() = -0.05;
+  groundBody->getParentJoint()->setTransformFromParentBodyNode(tf);
+  world->addSkeleton(ground);
+
+  for (auto i = 0; i < numBoxes; ++i) {
+    auto box = dynamics::Skeleton::create("box");
+    auto body = box->createJointAndBodyNodePair<dynamics::FreeJoint>().second;
+    body->createShapeNodeWith<CollisionAspect, DynamicsAspect>(
+        createBoxShape(boxType));
+    Eigen::Isometry3d boxTf = Eigen::Isometry3d::Identity();
+    boxTf.translation() = Eigen::Vector3d(0.5 * (i % 8), 0.5 * (i / 8), 0.1);
+    box->getJoint(0)->setPositions(
+        dynamics::FreeJoint::convertToPositions(boxTf));
+    world->addSkeleton(box);
+  }
+
+  // Settle the boxes so that every step below has resting contacts
+  for (auto i = 0; i < 50; ++i)
+    world->step();
+
+  return world;
+}
+
+//==============================================================================
+void runStep(benchmark::State& state)
+{
+  const auto numBoxes = static_cast<int>(state.range(0));
+  const auto maxNumContactsPerPair = static_cast<std::size_t>(state.range(1));
+  const auto boxType = static_cast<BoxType>(state.range(2));
+  const auto detectorType = static_cast<DetectorType>(state.range(3));
+  auto lcpSolver = std::make_shared<CountingLcpSolver>();
+  auto world = createBoxesWorld(
+      numBoxes, maxNumContactsPerPair, boxType, detectorType, lcpSolver);
+
+  lcpSolver->mNumRows = 0u;
+  std::size_t numContacts = 0u;
+  for (auto _ : state) {
+    world->step();
+    numContacts += world->getLastCollisionResult().getNumContacts();
+  }
+
+  const auto numSteps = static_cast<double>(state.iterations());
+  state.counters["contacts"] = static_cast<double>(numContacts) / numSteps;
+  state.counters["lcp_rows"]
+      = static_cast<double>(lcpSolver->mNumRows) / numSteps;
+}
+
+} // namespace
+
+//==============================================================================
+// Every contact of the collision result becomes a contact constraint
+static void BM_StepAllContacts(benchmark::State& state)
+{
+  runStep(state);
+}
+BENCHMARK(BM_StepAllContacts)
+    ->ArgNames({"boxes", "max_contacts", "mesh", "dart_detector"})
+    ->Args({16, 0, PRIMITIVE_BOX, FCL_DETECTOR})
+    ->Args({64, 0, PRIMITIVE_BOX, FCL_DETECTOR})
+    ->Args({16, 0, MESH_BOX, FCL_DETECTOR})
+    ->Args({64, 0, MESH_BOX, FCL_DETECTOR})
+    ->Args({16, 0, PRIMITIVE_BOX, DART_DETECTOR})
+    ->Args({64, 0, PRIMITIVE_BOX, DART_DETECTOR})
+    ->Unit(benchmark::kMicrosecond);
+
+//==============================================================================
+// At most four contacts per box-ground pair for FCL, and three for the DART
+// detector, which reports four
+static void BM_StepReducedContacts(benchmark::State& state)
+{
+  runStep(state);
+}
+BENCHMARK(BM_StepReducedContacts)
+    ->ArgNames({"boxes", "max_contacts", "mesh", "dart_detector"})
+    ->Args({16, 4, PRIMITIVE_BOX, FCL_DETECTOR})
+    ->Args({64, 4, PRIMITIVE_BOX, FCL_DETECTOR})
+    ->Args({16, 4, MESH_BOX, FCL_DETECTOR})
+    ->Args({64, 4, MESH_BOX, FCL_DETECTOR})
+    ->Args({16, 3, PRIMITIVE_BOX, DART_DETECTOR})
+    ->Args({64, 3, PRIMITIVE_BOX, DART_DETECTOR})
+    ->Unit(benchmark::kMicrosecond);
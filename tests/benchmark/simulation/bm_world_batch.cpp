@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <dart/simulation/All.hpp>
+
+#include <dart/dynamics/All.hpp>
+
+#include <benchmark/benchmark.h>
+
+using namespace dart;
+
+namespace {
+
+using dynamics::CollisionAspect;
+using dynamics::DynamicsAspect;
+
+/// Creates a world with a 6-DOF arm standing on the ground
+[[nodiscard]] simulation::WorldPtr createArmWorld()
+{
+  auto world = simulation::World::create();
+
+  auto ground = dynamics::Skeleton::create("ground");
+  auto groundBody
+      = ground->createJointAndBodyNodePair<dynamics::WeldJoint>().second;
+  groundBody->createShapeNodeWith<CollisionAspect, DynamicsAspect>(
+      std::make_shared<dynamics::BoxShape>(Eigen::Vector3d(10.0, 10.0, 0.1)));
+  Eigen::Isometry3d tf = Eigen::Isometry3d::Identity();
+  tf.translation().z() = -0.05;
+  groundBody->getParentJoint()->setTransformFromParentBodyNode(tf);
+  world->addSkeleton(ground);
+
+  auto arm = dynamics::Skeleton::create("arm");
+  arm->disableSelfCollisionCheck();
+  dynamics::BodyNode* parent = nullptr;
+  for (auto i = 0; i < 6; ++i) {
+    dynamics::RevoluteJoint::Properties joint;
+    joint.mAxis = (i % 2 == 0) ? Eigen::Vector3d::UnitZ()
+                               : Eigen::Vector3d::UnitY();
+    joint.mT_ParentBodyToJoint.translation().z() = parent ? 0.3 : 0.05;
+    auto body = arm->createJointAndBodyNodePair<dynamics::RevoluteJoint>(
+                       parent, joint)
+                    .second;
+    body->createShapeNodeWith<CollisionAspect, DynamicsAspect>(
+        std::make_shared<dynamics::BoxShape>(Eigen::Vector3d(0.1, 0.1, 0.3)));
+    parent = body;
+  }
+  world->addSkeleton(arm);
+
+  return world;
+}
+
+} // namespace
+
+/// Steps 256 worlds with an increasing number of threads
+static void BM_WorldBatchStep(benchmark::State& state)
+{
+  const auto numThreads = static_cast<std::size_t>(state.range(0));
+  simulation::WorldBatch batch(createArmWorld(), 256u, numThreads);
+  batch.getForces().setConstant(1.0);
+
+  for (auto _ : state)
+    batch.step();
+
+  state.SetItemsProcessed(
+      state.iterations() * static_cast<int64_t>(batch.getNumWorlds()));
+}
+
+BENCHMARK(BM_WorldBatchStep)
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Arg(8)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
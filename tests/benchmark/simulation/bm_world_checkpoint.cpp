@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <dart/simulation/All.hpp>
+
+#include <dart/constraint/ConstraintSolver.hpp>
+
+#include <dart/dynamics/All.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include <cstddef>
+
+using namespace dart;
+
+namespace {
+
+using dynamics::CollisionAspect;
+using dynamics::DynamicsAspect;
+
+/// Creates a world with \c numArms 6-DOF arms and as many boxes resting on
+/// the ground, stepped until the boxes have contacts to warm start
+[[nodiscard]] simulation::WorldPtr createArmsWorld(int numArms)
+{
+  auto world = simulation::World::create();
+  world->getConstraintSolver()->setContactWarmStarting(true);
+
+  auto ground = dynamics::Skeleton::create("ground");
+  auto groundBody
+      = ground->createJointAndBodyNodePair<dynamics::WeldJoint>().second;
+  groundBody->createShapeNodeWith<CollisionAspect, DynamicsAspect>(
+      std::make_shared<dynamics::BoxShape>(Eigen::Vector3d(100.0, 100.0, 0.1)));
+  Eigen::Isometry3d tf = Eigen::Isometry3d::Identity();
+  tf.translation().z() = -0.05;
+  groundBody->getParentJoint()->setTransformFromParentBodyNode(tf);
+  world->addSkeleton(ground);
+
+  for (auto i = 0; i < numArms; ++i) {
+    auto arm = dynamics::Skeleton::create("arm");
+    arm->disableSelfCollisionCheck();
+    dynamics::BodyNode* parent = nullptr;
+    for (auto j = 0; j < 6; ++j) {
+      dynamics::RevoluteJoint::Properties joint;
+      joint.mAxis = (j % 2 == 0) ? Eigen::Vector3d::UnitZ()
+                                 : Eigen::Vector3d::UnitY();
+      joint.mT_ParentBodyToJoint.translation()
+          = parent ? Eigen::Vector3d(0.0, 0.0, 0.3)
+                   : Eigen::Vector3d(1.0 * i, 0.0, 0.05);
+      auto body = arm->createJointAndBodyNodePair<dynamics::RevoluteJoint>(
+                         parent, joint)
+                      .second;
+      body->createShapeNodeWith<CollisionAspect, DynamicsAspect>(
+          std::make_shared<dynamics::BoxShape>(
+              Eigen::Vector3d(0.1, 0.1, 0.3)));
+      parent = body;
+    }
+    world->addSkeleton(arm);
+
+    auto box = dynamics::Skeleton::create("box");
+    auto boxBody
+        = box->createJointAndBodyNodePair<dynamics::FreeJoint>().second;
+    boxBody->createShapeNodeWith<CollisionAspect, DynamicsAspect>(
+        std::make_shared<dynamics::BoxShape>(Eigen::Vector3d::Constant(0.2)));
+    tf.translation() = Eigen::Vector3d(1.0 * i, 1.0, 0.1);
+    dynamics::FreeJoint::setTransformOf(boxBody, tf);
+    world->addSkeleton(box);
+  }
+
+  for (auto i = 0; i < 10; ++i)
+    world->step();
+
+  return world;
+}
+
+} // namespace
+
+/// Saves and restores a flat checkpoint of the world
+static void BM_WorldCheckpoint(benchmark::State& state)
+{
+  auto world = createArmsWorld(static_cast<int>(state.range(0)));
+  std::vector<std::byte> checkpoint(world->getCheckpointSize());
+
+  for (auto _ : state) {
+    world->saveCheckpoint(checkpoint);
+    world->restoreCheckpoint(checkpoint);
+  }
+
+  state.SetBytesProcessed(
+      state.iterations() * static_cast<int64_t>(checkpoint.size()));
+}
+
+/// Saves and restores the composite states of the skeletons and the time
+static void BM_SkeletonStates(benchmark::State& state)
+{
+  auto world = createArmsWorld(static_cast<int>(state.range(0)));
+  std::vector<dynamics::Skeleton::State> states(world->getNumSkeletons());
+
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < world->getNumSkeletons(); ++i)
+      states[i] = world->getSkeleton(i)->getState();
+    const double time = world->getTime();
+
+    for (std::size_t i = 0; i < world->getNumSkeletons(); ++i)
+      world->getSkeleton(i)->setState(states[i]);
+    world->setTime(time);
+  }
+}
+
+/// Clones the world, which is the other way to keep a state to return to
+static void BM_WorldClone(benchmark::State& state)
+{
+  auto world = createArmsWorld(static_cast<int>(state.range(0)));
+
+  for (auto _ : state)
+    benchmark::DoNotOptimize(world->clone());
+}
+
+BENCHMARK(BM_WorldCheckpoint)->Arg(1)->Arg(8)->Arg(32);
+BENCHMARK(BM_SkeletonStates)->Arg(1)->Arg(8)->Arg(32);
+BENCHMARK(BM_WorldClone)->Arg(1)->Arg(8)->Arg(32);
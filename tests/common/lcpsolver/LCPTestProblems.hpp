@@ -257,6 +257,18 @@ public:
     return problem;
   }
 
+  /// 96D test problem (eight coupled 12D blocks, contact-heavy scene)
+  static LCPProblem getProblem96D()
+  {
+    return getCoupledBlockProblem(8, "96D");
+  }
+
+  /// 192D test problem (sixteen coupled 12D blocks, contact-heavy scene)
+  static LCPProblem getProblem192D()
+  {
+    return getCoupledBlockProblem(16, "192D");
+  }
+
   /// Get all well-formed test problems (suitable for solver testing)
   static std::vector<LCPProblem> getWellFormedProblems()
   {
@@ -267,7 +279,9 @@ public:
         getProblem6D(),
         getProblem12D(),
         getProblem24D(),
-        getProblem48D()};
+        getProblem48D(),
+        getProblem96D(),
+        getProblem192D()};
   }
 
   /// Get all ill-formed test problems (for robustness testing)
@@ -382,6 +396,40 @@ public:
 
     return problems;
   }
+
+private:
+  /// Chain of 12D diagonally dominant blocks where each block is weakly
+  /// coupled to its neighbors, mimicking a stack of touching bodies. Every
+  /// third row has a separating right-hand side so the solution mixes active
+  /// and inactive constraints.
+  static LCPProblem getCoupledBlockProblem(
+      int numBlocks, const std::string& name)
+  {
+    constexpr int blockSize = 12;
+    const int dim = numBlocks * blockSize;
+    LCPProblem problem(dim, name);
+
+    const auto problem12 = getProblem12D();
+    problem.A.setZero();
+    for (int i = 0; i < numBlocks; ++i) {
+      problem.A.block(i * blockSize, i * blockSize, blockSize, blockSize)
+          = problem12.A;
+      if (i + 1 < numBlocks) {
+        problem.A
+            .block(i * blockSize, (i + 1) * blockSize, blockSize, blockSize)
+            .setConstant(0.05);
+        problem.A
+            .block((i + 1) * blockSize, i * blockSize, blockSize, blockSize)
+            .setConstant(0.05);
+      }
+    }
+
+    for (int i = 0; i < dim; ++i) {
+      problem.b(i) = (i % 3 == 2) ? 0.002 : -0.01;
+    }
+
+    return problem;
+  }
 };
 
 } // namespace test
@@ -1580,6 +1580,155 @@ TEST_F(Collision, CreateCollisionGroupFromVariousObject)
   testCreateCollisionGroups(dart);
 }
 
+//==============================================================================
+TEST_F(Collision, DARTBroadPhaseMatchesAllPairs)
+{
+  auto dart = DARTCollisionDetector::create();
+
+  const auto numSpheres = 200u;
+  const auto radius = 0.1;
+
+  std::vector<SimpleFramePtr> frames;
+  auto group = dart->createCollisionGroup();
+  auto subgroup1 = dart->createCollisionGroup();
+  auto subgroup2 = dart->createCollisionGroup();
+  for (auto i = 0u; i < numSpheres; ++i) {
+    auto frame = SimpleFrame::createShared(Frame::World());
+    frame->setShape(std::make_shared<SphereShape>(radius));
+    frames.push_back(frame);
+    group->addShapeFrame(frame.get());
+    if (i % 2u == 0u)
+      subgroup1->addShapeFrame(frame.get());
+    else
+      subgroup2->addShapeFrame(frame.get());
+  }
+
+  collision::CollisionOption option;
+  option.maxNumContacts = numSpheres * numSpheres;
+
+  // Move the spheres around to exercise the incremental re-sorting of the
+  // broad-phase between queries
+  for (auto iteration = 0u; iteration < 5u; ++iteration) {
+    for (auto& frame : frames) {
+      frame->setTranslation(Random::uniform<Eigen::Vector3d>(-1.0, 1.0));
+    }
+
+    auto expectedAll = 0u;
+    auto expectedBetween = 0u;
+    for (auto i = 0u; i < numSpheres; ++i) {
+      for (auto j = i + 1u; j < numSpheres; ++j) {
+        const auto dist = (frames[i]->getWorldTransform().translation()
+                           - frames[j]->getWorldTransform().translation())
+                              .norm();
+        if (dist < 2.0 * radius) {
+          ++expectedAll;
+          if ((i + j) % 2u == 1u)
+            ++expectedBetween;
+        }
+      }
+    }
+
+    collision::CollisionResult result;
+    EXPECT_EQ(group->collide(option, &result), expectedAll > 0u);
+    EXPECT_EQ(result.getNumContacts(), expectedAll);
+
+    result.clear();
+    EXPECT_EQ(
+        subgroup1->collide(subgroup2.get(), option, &result),
+        expectedBetween > 0u);
+    EXPECT_EQ(result.getNumContacts(), expectedBetween);
+  }
+
+  // Removing objects keeps the broad-phase consistent
+  for (auto i = 0u; i < numSpheres; i += 3u)
+    group->removeShapeFrame(frames[i].get());
+
+  auto expected = 0u;
+  for (auto i = 0u; i < numSpheres; ++i) {
+    for (auto j = i + 1u; j < numSpheres; ++j) {
+      if (i % 3u == 0u || j % 3u == 0u)
+        continue;
+
+      const auto dist = (frames[i]->getWorldTransform().translation()
+                         - frames[j]->getWorldTransform().translation())
+                            .norm();
+      if (dist < 2.0 * radius)
+        ++expected;
+    }
+  }
+
+  collision::CollisionResult result;
+  group->collide(option, &result);
+  EXPECT_EQ(result.getNumContacts(), expected);
+}
+
+//==============================================================================
+TEST_F(Collision, DARTCollideReturnsWhetherAnyPairCollides)
+{
+  auto dart = DARTCollisionDetector::create();
+
+  // Only the first pair of the all-pairs order collides
+  std::vector<SimpleFramePtr> frames;
+  for (const double x : {0.0, 0.15, 5.0}) {
+    auto frame = SimpleFrame::createShared(Frame::World());
+    frame->setShape(std::make_shared<SphereShape>(0.1));
+    frame->setTranslation(Eigen::Vector3d(x, 0.0, 0.0));
+    frames.push_back(frame);
+  }
+
+  auto group = dart->createCollisionGroup(
+      frames[0].get(), frames[1].get(), frames[2].get());
+  auto group1 = dart->createCollisionGroup(frames[0].get());
+  auto group2 = dart->createCollisionGroup(frames[1].get(), frames[2].get());
+
+  collision::CollisionOption option;
+  option.maxNumContacts = 100u;
+
+  collision::CollisionResult result;
+  EXPECT_TRUE(group->collide(option, &result));
+  EXPECT_TRUE(result.isCollision());
+
+  result.clear();
+  EXPECT_TRUE(group1->collide(group2.get(), option, &result));
+  EXPECT_TRUE(result.isCollision());
+
+  // Stopping at the contact limit or at the first contact without a result
+  option.maxNumContacts = 1u;
+  result.clear();
+  EXPECT_TRUE(group->collide(option, &result));
+  EXPECT_EQ(result.getNumContacts(), 1u);
+  EXPECT_TRUE(group->collide(option, nullptr));
+  EXPECT_TRUE(group1->collide(group2.get(), option, nullptr));
+
+  // No collision once the colliding pair is filtered out
+  class IgnoreFirstFrameFilter : public CollisionFilter
+  {
+  public:
+    explicit IgnoreFirstFrameFilter(const dynamics::ShapeFrame* frame)
+      : mFrame(frame)
+    {
+      // Do nothing
+    }
+
+    bool ignoresCollision(
+        const CollisionObject* object1,
+        const CollisionObject* object2) const override
+    {
+      return object1->getShapeFrame() == mFrame
+             || object2->getShapeFrame() == mFrame;
+    }
+
+  private:
+    const dynamics::ShapeFrame* mFrame;
+  };
+  option.maxNumContacts = 100u;
+  option.collisionFilter
+      = std::make_shared<IgnoreFirstFrameFilter>(frames[0].get());
+  result.clear();
+  EXPECT_FALSE(group->collide(option, &result));
+  EXPECT_FALSE(result.isCollision());
+}
+
 //==============================================================================
 TEST_F(Collision, CollisionOfPrescribedJoints)
 {
@@ -1701,6 +1701,14 @@ void DynamicsTest::compareEquationsOfMotion(const common::Uri& uri)
         cout << "InvAugM_AugM:" << endl << InvAugM_AugM << endl << endl;
       }
 
+      // Check products with the inverses computed from the factorizations
+      VectorXd x = VectorXd::Random(dof);
+      VectorXd InvM_x = InvM * x;
+      VectorXd InvAugM_x = InvAugM * x;
+      EXPECT_TRUE(equals(skel->multiplyByInvMassMatrix(x), InvM_x, 1e-6));
+      EXPECT_TRUE(
+          equals(skel->multiplyByInvAugMassMatrix(x), InvAugM_x, 1e-6));
+
       //------- Coriolis Force Vector and Combined Force Vector Tests --------
       // Get C1, Coriolis force vector using recursive method
       VectorXd C = skel->getCoriolisForces();
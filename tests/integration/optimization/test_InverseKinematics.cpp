@@ -35,6 +35,8 @@
 #include "dart/config.hpp"
 #include "dart/dynamics/All.hpp"
 #include "dart/math/Helpers.hpp"
+#include "dart/math/Random.hpp"
+#include "dart/math/optimization/GradientDescentSolver.hpp"
 
 #include <gtest/gtest.h>
 
@@ -140,3 +142,241 @@ TEST(InverseKinematics, DoNotApplySolutionOnFailure)
   EXPECT_FALSE(
       equals(skel->getPositions(), Eigen::VectorXd::Zero(dofs).eval()));
 }
+
+//==============================================================================
+TEST(InverseKinematics, MultiSeedFindSolution)
+{
+  SkeletonPtr skel = Skeleton::create();
+  BodyNode* bn = nullptr;
+  for (std::size_t i = 0; i < 3; ++i) {
+    RevoluteJoint::Properties properties;
+    properties.mAxis = Eigen::Vector3d::UnitZ();
+    properties.mT_ParentBodyToJoint.translation()
+        = Eigen::Vector3d(i == 0 ? 0.0 : 1.0, 0.0, 0.0);
+    bn = skel->createJointAndBodyNodePair<RevoluteJoint>(bn, properties)
+             .second;
+  }
+
+  const std::shared_ptr<InverseKinematics> ik = bn->getIK(true);
+  ik->setOffset(Eigen::Vector3d::UnitX());
+  ik->getErrorMethod().setLinearBounds(
+      Eigen::Vector3d::Constant(-1e-8), Eigen::Vector3d::Constant(1e-8));
+  ik->getErrorMethod().setAngularBounds(
+      Eigen::Vector3d::Constant(-math::inf),
+      Eigen::Vector3d::Constant(math::inf));
+  ik->getSolver()->setNumMaxIterations(200);
+
+  Eigen::Isometry3d tf = Eigen::Isometry3d::Identity();
+  tf.translation() = Eigen::Vector3d(-1.5, 1.0, 0.0);
+  ik->getTarget()->setTransform(tf);
+
+  InverseKinematics::MultiSeedOptions options;
+  options.mSeeds.push_back(Eigen::VectorXd::Zero(2)); // Wrong size; ignored
+  options.mSeeds.push_back(Eigen::Vector3d(1.0, 1.0, 1.0));
+  options.mNumRandomSeeds = 16;
+
+  const Eigen::VectorXd original = skel->getPositions();
+
+  Eigen::VectorXd serial;
+  math::Random::setSeed(0);
+  const bool serialSolved = ik->findSolution(options, serial);
+  EXPECT_TRUE(serialSolved);
+  EXPECT_EQ(skel->getPositions(), original);
+
+  // The result does not depend on the number of threads
+  ik->setNumThreads(4);
+  EXPECT_EQ(ik->getNumThreads(), 4u);
+  Eigen::VectorXd parallel;
+  math::Random::setSeed(0);
+  EXPECT_EQ(ik->findSolution(options, parallel), serialSolved);
+  EXPECT_TRUE(equals(serial, parallel));
+  EXPECT_EQ(skel->getPositions(), original);
+
+  skel->setPositions(parallel);
+  EXPECT_TRUE(equals(
+      tf.translation(),
+      bn->getWorldTransform() * Eigen::Vector3d::UnitX(),
+      1e-6));
+  skel->setPositions(original);
+
+  // Solving every seed returns a converged solution as well
+  options.mStopAtFirstSolution = false;
+  Eigen::VectorXd best;
+  EXPECT_TRUE(ik->findSolution(options, best));
+  skel->setPositions(best);
+  EXPECT_TRUE(equals(
+      tf.translation(),
+      bn->getWorldTransform() * Eigen::Vector3d::UnitX(),
+      1e-6));
+
+  ik->setNumThreads(1);
+  EXPECT_EQ(ik->getNumThreads(), 1u);
+}
+
+//==============================================================================
+TEST(InverseKinematics, MultiSeedRandomizedSolverAndClonedState)
+{
+  SkeletonPtr skel = Skeleton::create();
+  BodyNode* bn = nullptr;
+  for (std::size_t i = 0; i < 3; ++i) {
+    RevoluteJoint::Properties properties;
+    properties.mAxis = Eigen::Vector3d::UnitZ();
+    properties.mT_ParentBodyToJoint.translation()
+        = Eigen::Vector3d(i == 0 ? 0.0 : 1.0, 0.0, 0.0);
+    bn = skel->createJointAndBodyNodePair<RevoluteJoint>(bn, properties)
+             .second;
+  }
+
+  const std::shared_ptr<InverseKinematics> ik = bn->getIK(true);
+  ik->setOffset(Eigen::Vector3d::UnitX());
+  ik->getErrorMethod().setLinearBounds(
+      Eigen::Vector3d::Constant(-1e-8), Eigen::Vector3d::Constant(1e-8));
+  ik->getErrorMethod().setAngularBounds(
+      Eigen::Vector3d::Constant(-math::inf),
+      Eigen::Vector3d::Constant(math::inf));
+
+  // The target is out of reach, so every attempt after the first one starts
+  // from a random configuration and every seed perturbs its configuration
+  auto solver
+      = std::dynamic_pointer_cast<math::GradientDescentSolver>(ik->getSolver());
+  ASSERT_NE(solver, nullptr);
+  solver->setNumMaxIterations(20);
+  solver->setMaxAttempts(3);
+  solver->setPerturbationStep(5);
+
+  Eigen::Isometry3d tf = Eigen::Isometry3d::Identity();
+  tf.translation() = Eigen::Vector3d(4.0, 1.0, 0.0);
+  ik->getTarget()->setTransform(tf);
+
+  InverseKinematics::MultiSeedOptions options;
+  options.mNumRandomSeeds = 7;
+  options.mStopAtFirstSolution = false;
+
+  // The serial path leaves the random number generator of the solver alone
+  const auto reference = std::static_pointer_cast<math::GradientDescentSolver>(
+      solver->clone());
+  reference->setRandomSeed(42u);
+  solver->setRandomSeed(42u);
+
+  Eigen::VectorXd serial;
+  math::Random::setSeed(0);
+  EXPECT_FALSE(ik->findSolution(options, serial));
+  EXPECT_EQ(ik->getSolver(), solver);
+
+  Eigen::VectorXd expected = Eigen::VectorXd::Zero(3);
+  Eigen::VectorXd actual = Eigen::VectorXd::Zero(3);
+  reference->randomizeConfiguration(expected);
+  solver->randomizeConfiguration(actual);
+  EXPECT_EQ(expected, actual);
+
+  // The result does not depend on the number of threads or on the seeds a
+  // worker solved before, including on a second call that reuses the clones
+  ik->setNumThreads(3);
+  for (auto i = 0; i < 2; ++i) {
+    Eigen::VectorXd parallel;
+    math::Random::setSeed(0);
+    EXPECT_FALSE(ik->findSolution(options, parallel));
+    EXPECT_EQ(serial, parallel);
+  }
+
+  // Settings changed in place reach the reused clones: with loose bounds the
+  // current positions are already a solution
+  ik->getErrorMethod().setLinearBounds(
+      Eigen::Vector3d::Constant(-10.0), Eigen::Vector3d::Constant(10.0));
+  skel->setPositions(Eigen::Vector3d(0.1, 0.2, 0.3));
+  Eigen::VectorXd loose;
+  EXPECT_TRUE(ik->findSolution(options, loose));
+  EXPECT_TRUE(equals(loose, skel->getPositions()));
+
+  // So do changes of the Skeleton, which clone it again
+  ik->getErrorMethod().setLinearBounds(
+      Eigen::Vector3d::Constant(-1e-8), Eigen::Vector3d::Constant(1e-8));
+  solver->setNumMaxIterations(200);
+  solver->setMaxAttempts(1);
+  solver->setPerturbationStep(0);
+  Eigen::Isometry3d jointTf = Eigen::Isometry3d::Identity();
+  jointTf.translation() = Eigen::Vector3d(0.8, 0.0, 0.0);
+  skel->getJoint(2)->setTransformFromParentBodyNode(jointTf);
+  tf.translation() = Eigen::Vector3d(-1.5, 1.0, 0.0);
+  ik->getTarget()->setTransform(tf);
+  options.mStopAtFirstSolution = true;
+
+  Eigen::VectorXd reached;
+  EXPECT_TRUE(ik->findSolution(options, reached));
+  skel->setPositions(reached);
+  EXPECT_TRUE(equals(
+      tf.translation(),
+      bn->getWorldTransform() * Eigen::Vector3d::UnitX(),
+      1e-6));
+}
+
+//==============================================================================
+TEST(InverseKinematics, JacobianDLSDecompositions)
+{
+  using Decomposition = InverseKinematics::JacobianDLS::Decomposition;
+
+  for (const std::size_t numDofs : {3u, 7u}) {
+    SkeletonPtr skel = Skeleton::create();
+    BodyNode* bn = nullptr;
+    for (std::size_t i = 0; i < numDofs; ++i) {
+      RevoluteJoint::Properties properties;
+      properties.mAxis = i % 2 == 0 ? Eigen::Vector3d::UnitZ()
+                                    : Eigen::Vector3d::UnitY();
+      properties.mT_ParentBodyToJoint.translation()
+          = Eigen::Vector3d(i == 0 ? 0.0 : 0.3, 0.0, 0.0);
+      bn = skel->createJointAndBodyNodePair<RevoluteJoint>(bn, properties)
+               .second;
+    }
+    skel->setPositions(Eigen::VectorXd::LinSpaced(numDofs, 0.1, 0.7));
+
+    const std::shared_ptr<InverseKinematics> ik = bn->getIK(true);
+    auto& dls = ik->setGradientMethod<InverseKinematics::JacobianDLS>();
+    EXPECT_EQ(dls.getDecomposition(), Decomposition::Ldlt);
+
+    Eigen::Vector6d error;
+    error << 0.01, -0.02, 0.015, 0.02, 0.01, -0.01;
+
+    // Reference computed with an explicit inverse
+    const math::Jacobian J = ik->computeJacobian();
+    const double damping2 = std::pow(dls.getDampingCoefficient(), 2);
+    Eigen::VectorXd expected;
+    if (J.rows() <= J.cols()) {
+      expected = J.transpose()
+                 * (damping2 * Eigen::MatrixXd::Identity(6, 6)
+                    + J * J.transpose())
+                       .inverse()
+                 * error;
+    } else {
+      expected = (damping2 * Eigen::MatrixXd::Identity(J.cols(), J.cols())
+                  + J.transpose() * J)
+                     .inverse()
+                 * J.transpose() * error;
+    }
+
+    // Computing the gradient integrates the positions of the Skeleton, so
+    // they are restored before every evaluation
+    const Eigen::VectorXd q = skel->getPositions();
+
+    Eigen::VectorXd grad;
+    dls.computeGradient(error, grad);
+    EXPECT_TRUE(equals(grad, expected, 1e-10));
+
+    skel->setPositions(q);
+    dls.setDecomposition(Decomposition::Svd);
+    dls.computeGradient(error, grad);
+    EXPECT_TRUE(equals(grad, expected, 1e-10));
+
+    // The decomposition is reused while the Jacobian does not change
+    skel->setPositions(q);
+    dls.computeGradient(error, grad);
+    EXPECT_TRUE(equals(grad, expected, 1e-10));
+
+    // Clones keep the decomposition
+    auto clone = ik->clone(bn);
+    EXPECT_EQ(
+        dynamic_cast<InverseKinematics::JacobianDLS&>(
+            clone->getGradientMethod())
+            .getDecomposition(),
+        Decomposition::Svd);
+  }
+}
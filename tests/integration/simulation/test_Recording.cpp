@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "helpers/GTestUtils.hpp"
+#include "helpers/dynamics_helpers.hpp"
+
+#include "dart/simulation/Recording.hpp"
+#include "dart/simulation/World.hpp"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+#include <cstdint>
+#include <cstring>
+
+using namespace dart;
+using namespace dart::simulation;
+
+//==============================================================================
+WorldPtr createWorldWithFallingBoxes()
+{
+  auto world = World::create();
+  world->addSkeleton(createGround(
+      Eigen::Vector3d(10.0, 10.0, 0.1), Eigen::Vector3d(0.0, 0.0, -0.05)));
+  for (auto i = 0; i < 3; ++i) {
+    world->addSkeleton(createBox(
+        Eigen::Vector3d::Constant(0.2),
+        Eigen::Vector3d(0.5 * i, 0.0, 0.2 + 0.1 * i),
+        Eigen::Vector3d(0.1 * i, 0.2, 0.0)));
+  }
+  return world;
+}
+
+//==============================================================================
+void expectSameFrames(const Recording& expected, const Recording& actual)
+{
+  ASSERT_EQ(expected.getNumFrames(), actual.getNumFrames());
+  ASSERT_EQ(expected.getNumSkeletons(), actual.getNumSkeletons());
+
+  for (auto i = 0; i < expected.getNumFrames(); ++i) {
+    for (auto j = 0; j < expected.getNumSkeletons(); ++j) {
+      EXPECT_EQ(expected.getConfig(i, j), actual.getConfig(i, j));
+      for (auto k = 0; k < expected.getNumDofs(j); ++k)
+        EXPECT_EQ(expected.getGenCoord(i, j, k), actual.getGenCoord(i, j, k));
+    }
+
+    ASSERT_EQ(expected.getNumContacts(i), actual.getNumContacts(i));
+    for (auto j = 0; j < expected.getNumContacts(i); ++j) {
+      EXPECT_EQ(expected.getContactPoint(i, j), actual.getContactPoint(i, j));
+      EXPECT_EQ(expected.getContactForce(i, j), actual.getContactForce(i, j));
+    }
+  }
+}
+
+//==============================================================================
+TEST(Recording, StreamToFile)
+{
+  const auto filename
+      = (std::filesystem::temp_directory_path() / "dart_test_recording.bin")
+            .string();
+
+  auto memoryWorld = createWorldWithFallingBoxes();
+  auto fileWorld = createWorldWithFallingBoxes();
+
+  // Frames recorded before opening the file are moved to the file
+  memoryWorld->step();
+  memoryWorld->bake();
+  fileWorld->step();
+  fileWorld->bake();
+
+  ASSERT_TRUE(fileWorld->getRecording()->openFile(filename));
+  EXPECT_TRUE(fileWorld->getRecording()->isFileOpen());
+
+  bool hasContacts = false;
+  for (auto i = 0; i < 200; ++i) {
+    memoryWorld->step();
+    memoryWorld->bake();
+    fileWorld->step();
+    fileWorld->bake();
+
+    // Read the frames back while they are being written
+    if (i % 50 == 0) {
+      expectSameFrames(
+          *memoryWorld->getRecording(), *fileWorld->getRecording());
+    }
+
+    hasContacts = hasContacts
+                  || memoryWorld->getRecording()->getNumContacts(i + 1) > 0;
+  }
+  EXPECT_TRUE(hasContacts);
+  expectSameFrames(*memoryWorld->getRecording(), *fileWorld->getRecording());
+
+  // The written frames remain accessible after closing the file
+  ASSERT_TRUE(fileWorld->getRecording()->closeFile());
+  EXPECT_FALSE(fileWorld->getRecording()->isFileOpen());
+  expectSameFrames(*memoryWorld->getRecording(), *fileWorld->getRecording());
+
+  // Random access to the written frames
+  auto loaded = Recording::loadFile(filename);
+  ASSERT_NE(loaded, nullptr);
+  expectSameFrames(*memoryWorld->getRecording(), *loaded);
+  loaded.reset();
+
+  // Frames added after closing the file are kept in memory
+  memoryWorld->step();
+  memoryWorld->bake();
+  fileWorld->step();
+  fileWorld->bake();
+  expectSameFrames(*memoryWorld->getRecording(), *fileWorld->getRecording());
+
+  // Reopening the same file keeps every frame
+  ASSERT_TRUE(fileWorld->getRecording()->openFile(filename));
+  expectSameFrames(*memoryWorld->getRecording(), *fileWorld->getRecording());
+  ASSERT_TRUE(fileWorld->getRecording()->closeFile());
+
+  loaded = Recording::loadFile(filename);
+  ASSERT_NE(loaded, nullptr);
+  expectSameFrames(*memoryWorld->getRecording(), *loaded);
+
+  loaded.reset();
+  fileWorld.reset();
+  std::filesystem::remove(filename);
+}
+
+//==============================================================================
+TEST(Recording, LoadInvalidFile)
+{
+  const auto filename
+      = (std::filesystem::temp_directory_path() / "dart_test_invalid.bin")
+            .string();
+
+  {
+    // A file that is not closed has no index
+    Recording recording(std::vector<int>{6});
+    ASSERT_TRUE(recording.openFile(filename));
+    recording.addState(Eigen::VectorXd::Zero(6));
+    auto loaded = Recording::loadFile(filename);
+    EXPECT_EQ(loaded, nullptr);
+  }
+
+  EXPECT_EQ(Recording::loadFile(filename + ".missing"), nullptr);
+  std::filesystem::remove(filename);
+}
+
+//==============================================================================
+TEST(Recording, LoadCorruptFile)
+{
+  const auto filename
+      = (std::filesystem::temp_directory_path() / "dart_test_corrupt.bin")
+            .string();
+
+  // Two frames of 6 DOFs, the second one with a contact. The frames begin at
+  // bytes 16 and 72, and the index at byte 176.
+  {
+    Recording recording(std::vector<int>{6});
+    ASSERT_TRUE(recording.openFile(filename));
+    recording.addState(Eigen::VectorXd::Zero(6));
+    recording.addState(Eigen::VectorXd::Ones(12));
+    ASSERT_TRUE(recording.closeFile());
+  }
+
+  std::ifstream input(filename, std::ios::binary);
+  const std::string bytes(
+      (std::istreambuf_iterator<char>(input)),
+      std::istreambuf_iterator<char>());
+  input.close();
+  ASSERT_EQ(bytes.size(), 232u);
+
+  auto loaded = Recording::loadFile(filename);
+  ASSERT_NE(loaded, nullptr);
+  EXPECT_EQ(loaded->getNumFrames(), 2);
+  EXPECT_EQ(loaded->getNumContacts(0), 0);
+  EXPECT_EQ(loaded->getNumContacts(1), 1);
+  loaded.reset();
+
+  // Overwrites one word of the file and expects loading to fail
+  const auto expectLoadFailure = [&](std::size_t offset, std::uint64_t word) {
+    std::string corrupt = bytes;
+    std::memcpy(corrupt.data() + offset, &word, sizeof(word));
+    std::ofstream(filename, std::ios::binary) << corrupt;
+    EXPECT_EQ(Recording::loadFile(filename), nullptr) << "offset " << offset;
+  };
+
+  expectLoadFailure(72u, std::uint64_t(1) << 40);   // number of contacts
+  expectLoadFailure(72u, 0u);                       // number of contacts
+  expectLoadFailure(176u, ~std::uint64_t(0));       // number of skeletons
+  expectLoadFailure(184u, std::uint64_t(1) << 62);  // number of DOFs
+  expectLoadFailure(192u, ~std::uint64_t(0) / 8u);  // number of frames
+  expectLoadFailure(200u, std::uint64_t(1) << 60);  // frame offset
+  expectLoadFailure(208u, 12u);                     // frame offset
+  expectLoadFailure(216u, ~std::uint64_t(0) - 7u);  // index offset
+
+  std::filesystem::remove(filename);
+}
+
+//==============================================================================
+TEST(Recording, InvalidAccessReturnsDefaults)
+{
+  const auto filename
+      = (std::filesystem::temp_directory_path() / "dart_test_unreadable.bin")
+            .string();
+
+  Recording recording(std::vector<int>{6});
+  recording.addState(Eigen::VectorXd::Ones(12));
+  ASSERT_EQ(recording.getNumContacts(0), 1);
+
+  // Indices out of range
+  EXPECT_EQ(recording.getNumContacts(1), 0);
+  EXPECT_EQ(recording.getNumContacts(-1), 0);
+  EXPECT_EQ(recording.getConfig(1, 0), Eigen::VectorXd::Zero(6));
+  EXPECT_EQ(recording.getConfig(0, 1).size(), 0);
+  EXPECT_EQ(recording.getGenCoord(0, 0, 6), 0.0);
+  EXPECT_EQ(recording.getGenCoord(0, 1, 0), 0.0);
+  EXPECT_EQ(recording.getContactPoint(0, 1), Eigen::Vector3d::Zero());
+  EXPECT_EQ(recording.getContactForce(0, -1), Eigen::Vector3d::Zero());
+
+  // Frames that can no longer be read from their file
+  ASSERT_TRUE(recording.openFile(filename));
+  recording.addState(Eigen::VectorXd::Ones(12));
+  std::filesystem::remove(filename);
+  ASSERT_EQ(recording.getNumFrames(), 2);
+
+  EXPECT_EQ(recording.getNumContacts(1), 0);
+  EXPECT_EQ(recording.getConfig(1, 0), Eigen::VectorXd::Zero(6));
+  EXPECT_EQ(recording.getGenCoord(1, 0, 0), 0.0);
+  EXPECT_EQ(recording.getContactPoint(1, 0), Eigen::Vector3d::Zero());
+  EXPECT_EQ(recording.getContactForce(1, 0), Eigen::Vector3d::Zero());
+}
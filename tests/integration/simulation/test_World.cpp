@@ -590,3 +590,305 @@ TEST(World, SetNewConstraintSolver)
   EXPECT_TRUE(world->getConstraintSolver()->getSkeletons().size() == 1);
   EXPECT_TRUE(world->getConstraintSolver()->getNumConstraints() == 1);
 }
+
+//==============================================================================
+TEST(World, ParallelSkeletonProcessing)
+{
+  // Free falling boxes and swinging pendulums that don't collide, so the
+  // results don't depend on the order of the contacts
+  auto serialWorld = World::create();
+  for (int i = 0; i < 4; ++i) {
+    auto box = createBox(
+        Eigen::Vector3d::Constant(0.2), Eigen::Vector3d(0.5 * i, 0.0, 0.0));
+    box->setVelocities(Eigen::Vector6d::Constant(0.1 * i));
+    serialWorld->addSkeleton(box);
+
+    auto robot
+        = createNLinkRobot(3, Eigen::Vector3d(0.1, 0.1, 0.3), DOF_ROLL);
+    robot->getRootJoint()->setTransformFromParentBodyNode(
+        Eigen::Isometry3d(Eigen::Translation3d(0.5 * i, 2.0, 2.0)));
+    robot->setPositions(Eigen::VectorXd::Constant(3, 0.1 * (i + 1)));
+    serialWorld->addSkeleton(robot);
+  }
+
+  auto parallelWorld = serialWorld->clone();
+  EXPECT_EQ(parallelWorld->getNumThreads(), 1u);
+  parallelWorld->setNumThreads(4);
+  EXPECT_EQ(parallelWorld->getNumThreads(), 4u);
+
+  for (int i = 0; i < 200; ++i) {
+    serialWorld->step();
+    parallelWorld->step();
+  }
+
+  // Each skeleton is processed the same way on any thread, so the results are
+  // identical to the serial ones
+  for (std::size_t i = 0; i < serialWorld->getNumSkeletons(); ++i) {
+    const auto serialSkel = serialWorld->getSkeleton(i);
+    const auto parallelSkel = parallelWorld->getSkeleton(i);
+    EXPECT_TRUE(serialSkel->getPositions() == parallelSkel->getPositions());
+    EXPECT_TRUE(serialSkel->getVelocities() == parallelSkel->getVelocities());
+  }
+
+  // Clones keep the number of threads, like the constraint solver does
+  EXPECT_EQ(parallelWorld->clone()->getNumThreads(), 4u);
+
+  parallelWorld->setNumThreads(1);
+  EXPECT_EQ(parallelWorld->getNumThreads(), 1u);
+  parallelWorld->setNumThreads(0);
+  EXPECT_EQ(
+      parallelWorld->getNumThreads(),
+      common::ThreadPool::getDefaultNumThreads());
+}
+
+//==============================================================================
+TEST(World, CloneKeepsConstraintSolverSettings)
+{
+  auto world = World::create();
+  auto box = createBox(
+      Eigen::Vector3d::Constant(0.2), Eigen::Vector3d(0.0, 0.0, 0.2));
+  world->addSkeleton(box);
+  world->setNumThreads(2);
+
+  auto* solver = static_cast<constraint::BoxedLcpConstraintSolver*>(
+      world->getConstraintSolver());
+  solver->setNumThreads(3);
+  solver->setContactWarmStarting(true);
+  solver->setMaxNumContactsPerPair(4);
+  solver->setMatrixAssembly(
+      constraint::BoxedLcpConstraintSolver::MatrixAssembly::Analytic);
+  solver->addConstraint(std::make_shared<constraint::BallJointConstraint>(
+      box->getBodyNode(0), Eigen::Vector3d::Zero()));
+
+  auto clone = world->clone();
+  EXPECT_EQ(clone->getNumThreads(), 2u);
+
+  const auto* cloneSolver
+      = dynamic_cast<const constraint::BoxedLcpConstraintSolver*>(
+          clone->getConstraintSolver());
+  ASSERT_NE(cloneSolver, nullptr);
+  EXPECT_EQ(cloneSolver->getNumThreads(), 3u);
+  EXPECT_TRUE(cloneSolver->isContactWarmStartingEnabled());
+  EXPECT_EQ(cloneSolver->getMaxNumContactsPerPair(), 4u);
+  EXPECT_EQ(
+      cloneSolver->getMatrixAssembly(),
+      constraint::BoxedLcpConstraintSolver::MatrixAssembly::Analytic);
+
+  // The solver of the clone only holds the skeletons of the clone
+  ASSERT_EQ(cloneSolver->getSkeletons().size(), 1u);
+  EXPECT_EQ(cloneSolver->getSkeletons()[0], clone->getSkeleton(0));
+  EXPECT_EQ(cloneSolver->getNumConstraints(), 0u);
+  EXPECT_EQ(solver->getSkeletons().size(), 1u);
+  EXPECT_EQ(solver->getNumConstraints(), 1u);
+}
+
+//==============================================================================
+TEST(World, SleepingSkeletons)
+{
+  auto world = World::create();
+  EXPECT_FALSE(world->isSleepingEnabled());
+  world->setSleepingEnabled(true);
+  world->setSleepStepCount(20u);
+  EXPECT_EQ(world->getSleepStepCount(), 20u);
+  EXPECT_DOUBLE_EQ(world->getSleepEnergyThreshold(), 1e-4);
+
+  auto ground = createGround(
+      Eigen::Vector3d(10.0, 10.0, 0.1), Eigen::Vector3d(0.0, 0.0, -0.05));
+  world->addSkeleton(ground);
+
+  // Two boxes resting on the ground far apart and a stack of two boxes
+  auto box1 = createBox(
+      Eigen::Vector3d::Constant(0.2), Eigen::Vector3d(-1.0, 0.0, 0.1));
+  auto box2 = createBox(
+      Eigen::Vector3d::Constant(0.2), Eigen::Vector3d(1.0, 0.0, 0.1));
+  auto bottom = createBox(
+      Eigen::Vector3d::Constant(0.2), Eigen::Vector3d(0.0, 1.0, 0.1));
+  auto top = createBox(
+      Eigen::Vector3d::Constant(0.2), Eigen::Vector3d(0.0, 1.0, 0.3));
+  for (const auto& box : {box1, box2, bottom, top})
+    world->addSkeleton(box);
+
+  for (int i = 0; i < 300; ++i)
+    world->step();
+
+  EXPECT_FALSE(ground->isSleeping());
+  for (const auto& box : {box1, box2, bottom, top}) {
+    EXPECT_TRUE(box->isSleeping()) << box->getName();
+    EXPECT_TRUE(box->getVelocities().isZero());
+  }
+
+  // Sleeping skeletons don't move
+  const Eigen::VectorXd restingPositions = box1->getPositions();
+  for (int i = 0; i < 10; ++i)
+    world->step();
+  EXPECT_TRUE(box1->getPositions() == restingPositions);
+
+  // Applying an external force wakes up only the pushed box
+  box1->getBodyNode(0)->addExtForce(Eigen::Vector3d(20.0, 0.0, 0.0));
+  world->step();
+  EXPECT_FALSE(box1->isSleeping());
+  EXPECT_TRUE(box2->isSleeping());
+  EXPECT_GT(box1->getVelocity(3), 0.0);
+
+  // Setting positions wakes up a box
+  Eigen::VectorXd positions = box2->getPositions();
+  positions[5] += 0.2;
+  box2->setPositions(positions);
+  world->step();
+  EXPECT_FALSE(box2->isSleeping());
+
+  // Both boxes come to rest again
+  for (int i = 0; i < 500; ++i)
+    world->step();
+  EXPECT_TRUE(box1->isSleeping());
+  EXPECT_TRUE(box2->isSleeping());
+
+  // A box dropped on the stack wakes up its island
+  auto dropped = createBox(
+      Eigen::Vector3d::Constant(0.2), Eigen::Vector3d(0.0, 1.0, 0.45));
+  world->addSkeleton(dropped);
+  bool stackWokeUp = false;
+  for (int i = 0; i < 100 && !stackWokeUp; ++i) {
+    world->step();
+    stackWokeUp = !top->isSleeping();
+  }
+  EXPECT_TRUE(stackWokeUp);
+
+  // Disabling sleeping wakes up every skeleton
+  world->setSleepingEnabled(false);
+  for (const auto& box : {box1, box2, bottom, top, dropped})
+    EXPECT_FALSE(box->isSleeping());
+
+  // Removing a sleeping skeleton wakes it up
+  world->setSleepingEnabled(true);
+  for (int i = 0; i < 500; ++i)
+    world->step();
+  ASSERT_TRUE(box1->isSleeping());
+  world->removeSkeleton(box1);
+  EXPECT_FALSE(box1->isSleeping());
+}
+
+//==============================================================================
+TEST(World, Checkpoint)
+{
+  // The DART detector reports the contacts of a state in the same order
+  // regardless of the previous states
+  auto world = World::create();
+  world->setCollisionDetector(CollisionDetectorType::Dart);
+  world->getConstraintSolver()->setContactWarmStarting(true);
+  world->addSkeleton(createGround(
+      Eigen::Vector3d(10.0, 10.0, 0.1), Eigen::Vector3d(0.0, 0.0, -0.05)));
+  auto robot = createNLinkRobot(3, Eigen::Vector3d(0.1, 0.1, 0.3), DOF_ROLL);
+  world->addSkeleton(robot);
+  auto box = createBox(
+      Eigen::Vector3d::Constant(0.2), Eigen::Vector3d(1.0, 0.0, 0.2));
+  world->addSkeleton(box);
+
+  // The joint limit constraints are rebuilt every step, so they keep no warm
+  // start state that the checkpoint would have to hold
+  for (std::size_t i = 0; i < robot->getNumJoints(); ++i) {
+    dynamics::Joint* joint = robot->getJoint(i);
+    joint->setLimitEnforcement(true);
+    joint->setPositionLowerLimit(0, -0.2);
+    joint->setPositionUpperLimit(0, 0.2);
+  }
+
+  // Let the box land so that the checkpoint holds cached contact impulses
+  for (int i = 0; i < 100; ++i)
+    world->step();
+
+  const std::size_t size = world->getCheckpointSize();
+  std::vector<std::byte> checkpoint(size);
+  EXPECT_EQ(world->saveCheckpoint(checkpoint), size);
+  EXPECT_GT(
+      world->getConstraintSolver()->getContactWarmStartDataSize(), 0u);
+
+  const double time = world->getTime();
+  const int frame = world->getSimFrames();
+  const Eigen::VectorXd robotPositions = robot->getPositions();
+  const Eigen::VectorXd boxVelocities = box->getVelocities();
+
+  // Rolls out a control sequence that keeps the forces across steps
+  const auto rollout = [&](double torque) {
+    for (int i = 0; i < 200; ++i) {
+      robot->setCommands(Eigen::Vector3d::Constant(torque));
+      box->getBodyNode(0)->addExtForce(Eigen::Vector3d(0.1, 0.0, 0.0));
+      world->step(false);
+    }
+    Eigen::VectorXd state(18);
+    state << robot->getPositions(), robot->getVelocities(),
+        box->getPositions(), box->getVelocities();
+    return state;
+  };
+
+  const Eigen::VectorXd first = rollout(1.0);
+
+  ASSERT_TRUE(world->restoreCheckpoint(checkpoint));
+  EXPECT_DOUBLE_EQ(world->getTime(), time);
+  EXPECT_EQ(world->getSimFrames(), frame);
+  EXPECT_TRUE(robot->getPositions() == robotPositions);
+  EXPECT_TRUE(box->getVelocities() == boxVelocities);
+  EXPECT_TRUE(box->getBodyNode(0)->getExternalForceLocal().isZero());
+
+  // Another control sequence from the same state diverges
+  const Eigen::VectorXd second = rollout(-1.0);
+  EXPECT_FALSE(second.isApprox(first));
+
+  // Repeating the first control sequence reproduces its result
+  ASSERT_TRUE(world->restoreCheckpoint(checkpoint));
+  EXPECT_TRUE(rollout(1.0) == first);
+
+  // A checkpoint saved into a larger buffer restores from the whole buffer
+  std::vector<std::byte> large(2u * size);
+  ASSERT_TRUE(world->restoreCheckpoint(checkpoint));
+  EXPECT_EQ(world->saveCheckpoint(large), size);
+  EXPECT_TRUE(rollout(-1.0) == second);
+  ASSERT_TRUE(world->restoreCheckpoint(large));
+  EXPECT_TRUE(rollout(1.0) == first);
+
+  // Buffers that are too small or don't match the skeletons are rejected
+  std::vector<std::byte> small(size - 1u);
+  EXPECT_EQ(world->saveCheckpoint(small), 0u);
+  EXPECT_FALSE(world->restoreCheckpoint(small));
+  EXPECT_TRUE(world->getTime() != time);
+
+  world->addSkeleton(createBox(
+      Eigen::Vector3d::Constant(0.2), Eigen::Vector3d(-1.0, 0.0, 0.2)));
+  EXPECT_FALSE(world->restoreCheckpoint(checkpoint));
+  EXPECT_TRUE(world->getTime() != time);
+}
+
+//==============================================================================
+TEST(World, CheckpointSleepingSkeletons)
+{
+  auto world = World::create();
+  world->setSleepingEnabled(true);
+  world->setSleepStepCount(20u);
+  world->addSkeleton(createGround(
+      Eigen::Vector3d(10.0, 10.0, 0.1), Eigen::Vector3d(0.0, 0.0, -0.05)));
+  auto box = createBox(
+      Eigen::Vector3d::Constant(0.2), Eigen::Vector3d(0.0, 0.0, 0.1));
+  world->addSkeleton(box);
+
+  for (int i = 0; i < 300; ++i)
+    world->step();
+  ASSERT_TRUE(box->isSleeping());
+
+  std::vector<std::byte> checkpoint(world->getCheckpointSize());
+  ASSERT_GT(world->saveCheckpoint(checkpoint), 0u);
+  const Eigen::VectorXd restingPositions = box->getPositions();
+
+  // Pushing the box wakes it up
+  box->getBodyNode(0)->addExtForce(Eigen::Vector3d(20.0, 0.0, 0.0));
+  for (int i = 0; i < 10; ++i)
+    world->step();
+  EXPECT_FALSE(box->isSleeping());
+
+  // The restored box sleeps again and is not woken up by its restored state
+  ASSERT_TRUE(world->restoreCheckpoint(checkpoint));
+  EXPECT_TRUE(box->isSleeping());
+  for (int i = 0; i < 10; ++i)
+    world->step();
+  EXPECT_TRUE(box->isSleeping());
+  EXPECT_TRUE(box->getPositions() == restingPositions);
+}
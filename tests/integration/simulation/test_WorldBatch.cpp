@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "helpers/GTestUtils.hpp"
+#include "helpers/dynamics_helpers.hpp"
+
+#include "dart/constraint/ConstraintSolver.hpp"
+#include "dart/simulation/World.hpp"
+#include "dart/simulation/WorldBatch.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace dart;
+using namespace dart::simulation;
+
+//==============================================================================
+WorldPtr createWorldWithRobotAndBox()
+{
+  auto world = World::create();
+  world->addSkeleton(createGround(
+      Eigen::Vector3d(10.0, 10.0, 0.1), Eigen::Vector3d(0.0, 0.0, -0.05)));
+  world->addSkeleton(
+      createNLinkRobot(3, Eigen::Vector3d(0.1, 0.1, 0.3), DOF_ROLL));
+  world->addSkeleton(createBox(
+      Eigen::Vector3d::Constant(0.2), Eigen::Vector3d(1.0, 0.0, 0.3)));
+  return world;
+}
+
+//==============================================================================
+TEST(WorldBatch, MatchesSerialStepping)
+{
+  auto world = createWorldWithRobotAndBox();
+  world->setNumThreads(2u);
+  world->getConstraintSolver()->setNumThreads(2u);
+  const std::size_t numWorlds = 6u;
+  WorldBatch batch(world, numWorlds, 3u);
+  EXPECT_EQ(batch.getNumWorlds(), numWorlds);
+  EXPECT_EQ(batch.getNumDofs(), 9u);
+  EXPECT_EQ(batch.getNumThreads(), 3u);
+  EXPECT_EQ(batch.getPositions().rows(), 6);
+  EXPECT_EQ(batch.getPositions().cols(), 9);
+
+  // Only the batch runs threads; the batched worlds step serially
+  for (std::size_t i = 0; i < numWorlds; ++i) {
+    EXPECT_EQ(batch.getWorld(i)->getNumThreads(), 1u);
+    EXPECT_EQ(batch.getWorld(i)->getConstraintSolver()->getNumThreads(), 1u);
+  }
+
+  // Reference worlds stepped one by one
+  std::vector<WorldPtr> references;
+  for (std::size_t i = 0; i < numWorlds; ++i)
+    references.push_back(world->clone());
+
+  // Drive every robot with different joint forces
+  for (std::size_t i = 0; i < numWorlds; ++i)
+    batch.getForces().row(i).head(3).setConstant(0.5 * i);
+
+  for (auto step = 0; step < 50; ++step) {
+    batch.step(2u);
+    for (std::size_t i = 0; i < numWorlds; ++i) {
+      for (auto j = 0; j < 2; ++j) {
+        references[i]->getSkeleton(1)->setForces(
+            Eigen::Vector3d::Constant(0.5 * i));
+        references[i]->step();
+      }
+    }
+  }
+
+  for (std::size_t i = 0; i < numWorlds; ++i) {
+    Eigen::VectorXd positions(9);
+    Eigen::VectorXd velocities(9);
+    positions << references[i]->getSkeleton(1)->getPositions(),
+        references[i]->getSkeleton(2)->getPositions();
+    velocities << references[i]->getSkeleton(1)->getVelocities(),
+        references[i]->getSkeleton(2)->getVelocities();
+
+    EXPECT_VECTOR_NEAR(
+        Eigen::VectorXd(batch.getPositions().row(i).transpose()),
+        positions,
+        1e-10);
+    EXPECT_VECTOR_NEAR(
+        Eigen::VectorXd(batch.getVelocities().row(i).transpose()),
+        velocities,
+        1e-10);
+    EXPECT_DOUBLE_EQ(batch.getWorld(i)->getTime(), references[i]->getTime());
+  }
+
+  // The robots were driven differently
+  EXPECT_FALSE(
+      batch.getPositions().row(0).isApprox(batch.getPositions().row(5)));
+}
+
+//==============================================================================
+TEST(WorldBatch, Reset)
+{
+  auto world = createWorldWithRobotAndBox();
+  WorldBatch batch(world, 4u, 2u);
+  const WorldBatch::StateMatrix initialPositions = batch.getPositions();
+
+  batch.getForces().setConstant(1.0);
+  batch.step(20u);
+  EXPECT_FALSE(batch.getPositions().isApprox(initialPositions));
+
+  // Reset a subset of the worlds
+  batch.reset({1u, 3u});
+  EXPECT_TRUE(batch.getPositions().row(1).isApprox(initialPositions.row(1)));
+  EXPECT_TRUE(batch.getPositions().row(3).isApprox(initialPositions.row(3)));
+  EXPECT_FALSE(batch.getPositions().row(0).isApprox(initialPositions.row(0)));
+  EXPECT_TRUE(batch.getForces().row(1).isZero());
+  EXPECT_DOUBLE_EQ(batch.getWorld(1)->getTime(), world->getTime());
+  EXPECT_GT(batch.getWorld(0)->getTime(), world->getTime());
+
+  // Reset all the worlds
+  batch.reset();
+  EXPECT_TRUE(batch.getPositions().isApprox(initialPositions));
+  EXPECT_TRUE(batch.getVelocities().isZero());
+  EXPECT_TRUE(batch.getForces().isZero());
+}
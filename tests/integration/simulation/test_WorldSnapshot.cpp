@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "helpers/GTestUtils.hpp"
+#include "helpers/dynamics_helpers.hpp"
+
+#include "dart/dynamics/BoxShape.hpp"
+#include "dart/dynamics/SimpleFrame.hpp"
+#include "dart/dynamics/SphereShape.hpp"
+#include "dart/simulation/World.hpp"
+#include "dart/simulation/WorldSnapshot.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <unordered_map>
+
+using namespace dart;
+using namespace dart::simulation;
+using namespace dart::test;
+
+//==============================================================================
+/// Creates a world with two skeletons and a SimpleFrame with a child. The child
+/// is returned through \c child because parent frames do not own children.
+WorldPtr createWorldWithFrames(dynamics::SimpleFramePtr& child)
+{
+  auto world = World::create();
+  world->addSkeleton(createGround(
+      Eigen::Vector3d(10.0, 10.0, 0.1), Eigen::Vector3d(0.0, 0.0, -0.05)));
+  world->addSkeleton(createBox(
+      Eigen::Vector3d::Constant(0.2), Eigen::Vector3d(0.0, 0.0, 0.5)));
+
+  // A SimpleFrame with a child SimpleFrame, both with shapes
+  auto frame = dynamics::SimpleFrame::createShared(
+      dynamics::Frame::World(), "frame");
+  frame->setShape(std::make_shared<dynamics::SphereShape>(0.1));
+  frame->setTranslation(Eigen::Vector3d(1.0, 0.0, 0.0));
+  child = frame->spawnChildSimpleFrame("child");
+  child->setShape(
+      std::make_shared<dynamics::BoxShape>(Eigen::Vector3d::Ones()));
+  child->setRelativeTranslation(Eigen::Vector3d(0.0, 1.0, 0.0));
+  world->addSimpleFrame(frame);
+
+  return world;
+}
+
+//==============================================================================
+TEST(WorldSnapshot, Capture)
+{
+  dynamics::SimpleFramePtr child;
+  auto world = createWorldWithFrames(child);
+  for (auto i = 0; i < 10; ++i)
+    world->step();
+
+  WorldSnapshot snapshot;
+  snapshot.capture(*world);
+  EXPECT_EQ(snapshot.getTime(), world->getTime());
+  EXPECT_EQ(snapshot.getSimFrames(), world->getSimFrames());
+
+  // One shape node per skeleton, plus the two simple frames
+  const auto& frames = snapshot.getShapeFrames();
+  ASSERT_EQ(frames.size(), 4u);
+
+  std::unordered_map<std::string, const ShapeFrameSnapshot*> byName;
+  for (const auto& frame : frames) {
+    EXPECT_TRUE(equals(
+        frame.mWorldTransform.matrix(),
+        frame.mShapeFrame->getWorldTransform().matrix()));
+    EXPECT_EQ(frame.mVersion, frame.mShapeFrame->getVersion());
+    byName[frame.mShapeFrame->getName()] = &frame;
+  }
+  ASSERT_EQ(byName.count("child"), 1u);
+  EXPECT_TRUE(equals(
+      byName["child"]->mWorldTransform.translation(),
+      Eigen::Vector3d(1.0, 1.0, 0.0)));
+
+  // Capturing again reflects new transforms and versions
+  const std::size_t version = byName["child"]->mVersion;
+  auto* childFrame = byName["child"]->mShapeFrame;
+  childFrame->setShape(std::make_shared<dynamics::SphereShape>(0.5));
+  snapshot.capture(*world);
+  for (const auto& frame : snapshot.getShapeFrames()) {
+    if (frame.mShapeFrame == childFrame)
+      EXPECT_NE(frame.mVersion, version);
+  }
+}
+
+//==============================================================================
+TEST(WorldSnapshotBuffer, PublishAndFetch)
+{
+  dynamics::SimpleFramePtr child;
+  auto world = createWorldWithFrames(child);
+  WorldSnapshotBuffer buffer;
+  EXPECT_FALSE(buffer.hasNewSnapshot());
+  EXPECT_EQ(buffer.fetchLatest(), nullptr);
+
+  buffer.getWriteSnapshot().capture(*world);
+  buffer.publish();
+  EXPECT_TRUE(buffer.hasNewSnapshot());
+
+  const WorldSnapshot* first = buffer.fetchLatest();
+  ASSERT_NE(first, nullptr);
+  EXPECT_FALSE(buffer.hasNewSnapshot());
+  EXPECT_EQ(first->getSimFrames(), 0);
+
+  // Fetching without a new publication returns the same snapshot
+  EXPECT_EQ(buffer.fetchLatest(), first);
+
+  // Only the latest of several publications is fetched
+  for (auto i = 0; i < 3; ++i) {
+    world->step();
+    buffer.getWriteSnapshot().capture(*world);
+    buffer.publish();
+  }
+  const WorldSnapshot* latest = buffer.fetchLatest();
+  ASSERT_NE(latest, nullptr);
+  EXPECT_EQ(latest->getSimFrames(), 3);
+
+  buffer.reset();
+  EXPECT_FALSE(buffer.hasNewSnapshot());
+  EXPECT_EQ(buffer.fetchLatest(), nullptr);
+}
+
+//==============================================================================
+TEST(WorldSnapshotBuffer, ConcurrentProducer)
+{
+  dynamics::SimpleFramePtr child;
+  auto world = createWorldWithFrames(child);
+  WorldSnapshotBuffer buffer;
+
+  const int numSteps = 500;
+  const double timeStep = world->getTimeStep();
+  std::thread producer([&] {
+    for (auto i = 0; i < numSteps; ++i) {
+      world->step();
+      buffer.getWriteSnapshot().capture(*world);
+      buffer.publish();
+    }
+  });
+
+  // The consumer only reads snapshots, never the World
+  int lastSimFrames = -1;
+  while (lastSimFrames < numSteps) {
+    const WorldSnapshot* snapshot = buffer.fetchLatest();
+    if (!snapshot)
+      continue;
+
+    EXPECT_GE(snapshot->getSimFrames(), lastSimFrames);
+    lastSimFrames = snapshot->getSimFrames();
+    EXPECT_NEAR(snapshot->getTime(), lastSimFrames * timeStep, 1e-9);
+    EXPECT_EQ(snapshot->getShapeFrames().size(), 4u);
+  }
+
+  producer.join();
+  EXPECT_EQ(lastSimFrames, numSteps);
+}
@@ -48,7 +48,8 @@ using namespace dynamics;
 void testBasicInterface(
     const std::shared_ptr<CollisionDetector>& cd, double tol = 1e-12)
 {
-  if (cd->getType() != collision::FCLCollisionDetector::getStaticType()) {
+  if (cd->getType() != collision::FCLCollisionDetector::getStaticType()
+      && cd->getType() != collision::DARTCollisionDetector::getStaticType()) {
     DART_WARN(
         "Aborting test: distance check is not supported by {}.", cd->getType());
     return;
@@ -150,7 +151,8 @@ TEST(Distance, testBasicInterface)
 void testOptions(
     const std::shared_ptr<CollisionDetector>& cd, double tol = 1e-12)
 {
-  if (cd->getType() != collision::FCLCollisionDetector::getStaticType()) {
+  if (cd->getType() != collision::FCLCollisionDetector::getStaticType()
+      && cd->getType() != collision::DARTCollisionDetector::getStaticType()) {
     DART_WARN(
         "Aborting test: distance check is not supported by {}.", cd->getType());
     return;
@@ -253,7 +255,8 @@ TEST(Distance, Options)
 void testSphereSphere(
     const std::shared_ptr<CollisionDetector>& cd, double tol = 1e-12)
 {
-  if (cd->getType() != collision::FCLCollisionDetector::getStaticType()) {
+  if (cd->getType() != collision::FCLCollisionDetector::getStaticType()
+      && cd->getType() != collision::DARTCollisionDetector::getStaticType()) {
     DART_WARN(
         "Aborting test: distance check is not supported by {}.", cd->getType());
     return;
@@ -307,3 +310,212 @@ TEST(Distance, SphereSphere)
   auto dart = DARTCollisionDetector::create();
   testSphereSphere(dart);
 }
+
+//==============================================================================
+TEST(Distance, DARTPrimitives)
+{
+  auto cd = DARTCollisionDetector::create();
+
+  auto simpleFrame1 = SimpleFrame::createShared(Frame::World());
+  auto simpleFrame2 = SimpleFrame::createShared(Frame::World());
+  simpleFrame1->setShape(std::make_shared<BoxShape>(Eigen::Vector3d::Ones()));
+  simpleFrame2->setShape(std::make_shared<BoxShape>(Eigen::Vector3d::Ones()));
+
+  auto group1 = cd->createCollisionGroup(simpleFrame1.get());
+  auto group2 = cd->createCollisionGroup(simpleFrame2.get());
+
+  collision::DistanceOption option;
+  option.enableNearestPoints = true;
+  option.distanceLowerBound = -std::numeric_limits<double>::infinity();
+  collision::DistanceResult result;
+
+  const double tol = 1e-6;
+
+  // Box-box, separated along the x-axis with a rotated second box
+  Eigen::Isometry3d tf = Eigen::Isometry3d::Identity();
+  tf.translation() = Eigen::Vector3d(2.0, 0.0, 0.0);
+  tf.linear() = Eigen::AngleAxisd(math::pi / 4.0, Eigen::Vector3d::UnitZ())
+                    .toRotationMatrix();
+  simpleFrame2->setTransform(tf);
+  cd->distance(group1.get(), group2.get(), option, &result);
+  EXPECT_NEAR(result.minDistance, 1.5 - 0.5 * std::sqrt(2.0), tol);
+  EXPECT_NEAR(result.nearestPoint1.x(), 0.5, tol);
+  EXPECT_NEAR(result.nearestPoint2.x(), 2.0 - 0.5 * std::sqrt(2.0), tol);
+
+  // Box-box, penetrating by 0.2 along the z-axis
+  tf.setIdentity();
+  tf.translation() = Eigen::Vector3d(0.1, 0.2, 0.8);
+  simpleFrame2->setTransform(tf);
+  cd->distance(group1.get(), group2.get(), option, &result);
+  EXPECT_NEAR(result.minDistance, -0.2, tol);
+  EXPECT_NEAR(result.unclampedMinDistance, -0.2, tol);
+  EXPECT_NEAR(result.nearestPoint1.z(), 0.5, tol);
+  EXPECT_NEAR(result.nearestPoint2.z(), 0.3, tol);
+
+  // Capsule-sphere, closest to the cylindrical part of the capsule
+  simpleFrame1->setShape(std::make_shared<CapsuleShape>(0.2, 1.0));
+  simpleFrame2->setShape(std::make_shared<SphereShape>(0.3));
+  tf.setIdentity();
+  tf.translation() = Eigen::Vector3d(1.0, 0.0, 0.25);
+  simpleFrame2->setTransform(tf);
+  cd->distance(group1.get(), group2.get(), option, &result);
+  EXPECT_NEAR(result.minDistance, 0.5, tol);
+  EXPECT_TRUE(
+      result.nearestPoint1.isApprox(Eigen::Vector3d(0.2, 0.0, 0.25), tol));
+  EXPECT_TRUE(
+      result.nearestPoint2.isApprox(Eigen::Vector3d(0.7, 0.0, 0.25), tol));
+
+  // Capsule-sphere, closest to the spherical cap of the capsule
+  tf.translation() = Eigen::Vector3d(0.0, 0.0, 1.5);
+  simpleFrame2->setTransform(tf);
+  cd->distance(group1.get(), group2.get(), option, &result);
+  EXPECT_NEAR(result.minDistance, 0.5, tol);
+
+  // Cylinder-sphere, penetrating the top face of the cylinder
+  simpleFrame1->setShape(std::make_shared<CylinderShape>(0.5, 1.0));
+  tf.translation() = Eigen::Vector3d(0.0, 0.0, 0.7);
+  simpleFrame2->setTransform(tf);
+  cd->distance(group1.get(), group2.get(), option, &result);
+  EXPECT_NEAR(result.minDistance, -0.1, tol);
+  EXPECT_NEAR(result.nearestPoint1.z(), 0.5, tol);
+  EXPECT_NEAR(result.nearestPoint2.z(), 0.4, tol);
+
+  // Plane-sphere in both orders
+  simpleFrame1->setShape(
+      std::make_shared<PlaneShape>(Eigen::Vector3d::UnitZ(), 0.0));
+  tf.translation() = Eigen::Vector3d(1.0, 2.0, 1.0);
+  simpleFrame2->setTransform(tf);
+  cd->distance(group1.get(), group2.get(), option, &result);
+  EXPECT_NEAR(result.minDistance, 0.7, tol);
+  EXPECT_TRUE(result.nearestPoint1.isApprox(Eigen::Vector3d(1.0, 2.0, 0.0)));
+  EXPECT_TRUE(result.nearestPoint2.isApprox(Eigen::Vector3d(1.0, 2.0, 0.7)));
+  cd->distance(group2.get(), group1.get(), option, &result);
+  EXPECT_NEAR(result.minDistance, 0.7, tol);
+  EXPECT_TRUE(result.nearestPoint1.isApprox(Eigen::Vector3d(1.0, 2.0, 0.7)));
+  EXPECT_TRUE(result.nearestPoint2.isApprox(Eigen::Vector3d(1.0, 2.0, 0.0)));
+
+  // The default lower bound clamps the penetration depth
+  tf.translation() = Eigen::Vector3d(0.0, 0.0, 0.1);
+  simpleFrame2->setTransform(tf);
+  cd->distance(
+      group1.get(), group2.get(), collision::DistanceOption(), &result);
+  EXPECT_DOUBLE_EQ(result.minDistance, 0.0);
+  EXPECT_NEAR(result.unclampedMinDistance, -0.2, tol);
+}
+
+//==============================================================================
+TEST(Distance, DARTMeshPrimitive)
+{
+  auto cd = DARTCollisionDetector::create();
+
+  // Unit cube given only by its vertices, scaled into a 2 x 2 x 2 box
+  auto scene = std::make_shared<aiScene>();
+  scene->mNumMeshes = 1u;
+  scene->mMeshes = new aiMesh*[1];
+  scene->mMeshes[0] = new aiMesh();
+  aiMesh* cube = scene->mMeshes[0];
+  cube->mNumVertices = 8u;
+  cube->mVertices = new aiVector3D[8];
+  for (auto i = 0u; i < 8u; ++i) {
+    cube->mVertices[i] = aiVector3D(
+        i & 1u ? 0.5 : -0.5, i & 2u ? 0.5 : -0.5, i & 4u ? 0.5 : -0.5);
+  }
+
+  auto simpleFrame1 = SimpleFrame::createShared(Frame::World());
+  auto simpleFrame2 = SimpleFrame::createShared(Frame::World());
+  simpleFrame1->setShape(
+      std::make_shared<MeshShape>(Eigen::Vector3d::Constant(2.0), scene));
+  simpleFrame2->setShape(std::make_shared<SphereShape>(0.5));
+
+  auto group1 = cd->createCollisionGroup(simpleFrame1.get());
+  auto group2 = cd->createCollisionGroup(simpleFrame2.get());
+
+  collision::DistanceOption option;
+  option.enableNearestPoints = true;
+  option.distanceLowerBound = -std::numeric_limits<double>::infinity();
+  collision::DistanceResult result;
+
+  const double tol = 1e-6;
+
+  // Mesh-sphere, closest to a face of the mesh
+  simpleFrame2->setTranslation(Eigen::Vector3d(3.0, 0.2, -0.3));
+  cd->distance(group1.get(), group2.get(), option, &result);
+  EXPECT_NEAR(result.minDistance, 1.5, tol);
+  EXPECT_TRUE(
+      result.nearestPoint1.isApprox(Eigen::Vector3d(1.0, 0.2, -0.3), tol));
+  EXPECT_TRUE(
+      result.nearestPoint2.isApprox(Eigen::Vector3d(2.5, 0.2, -0.3), tol));
+
+  // Mesh-sphere, closest to an edge of the mesh
+  simpleFrame2->setTranslation(Eigen::Vector3d(2.0, 2.0, 0.0));
+  cd->distance(group1.get(), group2.get(), option, &result);
+  EXPECT_NEAR(result.minDistance, std::sqrt(2.0) - 0.5, tol);
+  EXPECT_TRUE(
+      result.nearestPoint1.isApprox(Eigen::Vector3d(1.0, 1.0, 0.0), tol));
+
+  // Mesh-sphere, penetrating a face of the mesh by 0.1
+  simpleFrame2->setTranslation(Eigen::Vector3d(0.0, 0.0, 1.4));
+  cd->distance(group1.get(), group2.get(), option, &result);
+  EXPECT_NEAR(result.minDistance, -0.1, tol);
+  EXPECT_NEAR(result.nearestPoint1.z(), 1.0, tol);
+  EXPECT_NEAR(result.nearestPoint2.z(), 0.9, tol);
+
+  // Mesh-box, separated along the y-axis with a rotated box
+  simpleFrame2->setShape(std::make_shared<BoxShape>(Eigen::Vector3d::Ones()));
+  Eigen::Isometry3d tf = Eigen::Isometry3d::Identity();
+  tf.translation() = Eigen::Vector3d(0.0, 3.0, 0.0);
+  tf.linear() = Eigen::AngleAxisd(math::pi / 4.0, Eigen::Vector3d::UnitZ())
+                    .toRotationMatrix();
+  simpleFrame2->setTransform(tf);
+  cd->distance(group1.get(), group2.get(), option, &result);
+  EXPECT_NEAR(result.minDistance, 2.0 - 0.5 * std::sqrt(2.0), tol);
+  EXPECT_NEAR(result.nearestPoint1.y(), 1.0, tol);
+  EXPECT_NEAR(result.nearestPoint2.y(), 3.0 - 0.5 * std::sqrt(2.0), tol);
+}
+
+//==============================================================================
+TEST(Distance, DARTGroup)
+{
+  auto cd = DARTCollisionDetector::create();
+  auto group = cd->createCollisionGroup();
+
+  // A row of unit spheres two meters apart except for the last pair
+  std::vector<SimpleFramePtr> frames;
+  for (auto i = 0; i < 10; ++i) {
+    auto frame = SimpleFrame::createShared(Frame::World());
+    frame->setShape(std::make_shared<SphereShape>(0.5));
+    const double x = i < 9 ? 2.0 * i : 2.0 * i - 0.5;
+    frame->setTranslation(Eigen::Vector3d(x, 0.0, 0.0));
+    group->addShapeFrame(frame.get());
+    frames.push_back(frame);
+  }
+
+  collision::DistanceOption option;
+  collision::DistanceResult result;
+  const double distance = group->distance(option, &result);
+  EXPECT_NEAR(distance, 0.5, 1e-12);
+  EXPECT_NEAR(result.minDistance, 0.5, 1e-12);
+  EXPECT_TRUE(
+      (result.shapeFrame1 == frames[8].get()
+       && result.shapeFrame2 == frames[9].get())
+      || (result.shapeFrame1 == frames[9].get()
+          && result.shapeFrame2 == frames[8].get()));
+
+  // The filter excludes the closest pair
+  struct Filter : collision::DistanceFilter
+  {
+    bool needDistance(
+        const CollisionObject* object1,
+        const CollisionObject* object2) const override
+    {
+      return object1->getShapeFrame() != ignored
+             && object2->getShapeFrame() != ignored;
+    }
+
+    const ShapeFrame* ignored;
+  };
+  auto filter = std::make_shared<Filter>();
+  filter->ignored = frames[9].get();
+  option.distanceFilter = filter;
+  EXPECT_NEAR(group->distance(option, &result), 1.0, 1e-12);
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <dart/common/ThreadPool.hpp>
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <vector>
+
+using namespace dart;
+using namespace common;
+
+//==============================================================================
+TEST(ThreadPoolTest, VisitsEveryIndexOnce)
+{
+  ThreadPool pool(4);
+  EXPECT_EQ(pool.getNumThreads(), 4u);
+
+  for (auto repeat = 0; repeat < 100; ++repeat) {
+    std::vector<int> counts(257, 0);
+    std::vector<std::size_t> workers(counts.size(), 0u);
+    pool.parallelFor(counts.size(), [&](std::size_t i, std::size_t worker) {
+      workers[i] = worker;
+      ++counts[i];
+    });
+
+    for (const auto count : counts)
+      EXPECT_EQ(count, 1);
+    for (const auto worker : workers)
+      EXPECT_LT(worker, pool.getNumThreads());
+  }
+}
+
+//==============================================================================
+TEST(ThreadPoolTest, SingleThreadRunsOnCaller)
+{
+  ThreadPool pool(1);
+  EXPECT_EQ(pool.getNumThreads(), 1u);
+
+  const auto caller = std::this_thread::get_id();
+  std::vector<std::thread::id> threads(10u);
+  std::vector<std::size_t> workers(10u, 1u);
+  pool.parallelFor(10u, [&](std::size_t i, std::size_t worker) {
+    threads[i] = std::this_thread::get_id();
+    workers[i] = worker;
+  });
+
+  for (auto i = 0u; i < 10u; ++i) {
+    EXPECT_EQ(threads[i], caller);
+    EXPECT_EQ(workers[i], 0u);
+  }
+}
+
+//==============================================================================
+TEST(ThreadPoolTest, NestedCallsRunSerially)
+{
+  ThreadPool pool(3);
+
+  std::vector<std::vector<int>> counts(3, std::vector<int>(5, 0));
+  pool.parallelFor(counts.size(), [&](std::size_t i, std::size_t) {
+    pool.parallelFor(
+        counts[i].size(), [&](std::size_t j, std::size_t) { ++counts[i][j]; });
+  });
+
+  for (const auto& inner : counts) {
+    for (const auto count : inner)
+      EXPECT_EQ(count, 1);
+  }
+}
+
+//==============================================================================
+TEST(ThreadPoolTest, RethrowsExceptions)
+{
+  ThreadPool pool(2);
+
+  EXPECT_THROW(
+      pool.parallelFor(
+          10u,
+          [](std::size_t i, std::size_t) {
+            if (i == 5u)
+              throw std::runtime_error("failure");
+          }),
+      std::runtime_error);
+
+  // The pool stays usable after an exception
+  std::vector<int> counts(10, 0);
+  pool.parallelFor(counts.size(), [&](std::size_t i, std::size_t) {
+    ++counts[i];
+  });
+  for (const auto count : counts)
+    EXPECT_EQ(count, 1);
+}
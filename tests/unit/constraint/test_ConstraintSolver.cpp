@@ -31,13 +31,23 @@
  */
 
 #include "helpers/GTestUtils.hpp"
+#include "helpers/dynamics_helpers.hpp"
 
+#include "dart/collision/dart/DARTCollisionDetector.hpp"
+#include "dart/constraint/BoxedLcpConstraintSolver.hpp"
+#include "dart/constraint/ConstrainedGroup.hpp"
 #include "dart/constraint/ConstraintSolver.hpp"
 #include "dart/constraint/ContactSurface.hpp"
+#include "dart/constraint/DantzigBoxedLcpSolver.hpp"
+#include "dart/constraint/PgsBoxedLcpSolver.hpp"
+#include "dart/math/lcp/Dantzig/Common.hpp"
 #include "dart/simulation/World.hpp"
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <vector>
+
 using namespace dart;
 using namespace dart::simulation;
 using namespace dart::test;
@@ -257,3 +267,412 @@ TEST(ConstraintSolver, ConstactSurfaceHandlerIgnoreParent)
   EXPECT_TRUE(customHandler2->mCalled);
   EXPECT_EQ(2, params.mPrimaryFrictionCoeff);
 }
+
+//==============================================================================
+std::shared_ptr<World> createWorldWithPiles(std::size_t numThreads)
+{
+  auto world = createWorld();
+  world->getConstraintSolver()->setNumThreads(numThreads);
+
+  world->addSkeleton(createGround(
+      Eigen::Vector3d(20.0, 20.0, 0.1), Eigen::Vector3d(0.0, 0.0, -0.05)));
+
+  // Separate piles of boxes, each of which forms its own constrained group
+  for (auto i = 0; i < 6; ++i) {
+    for (auto j = 0; j < 3; ++j) {
+      world->addSkeleton(createBox(
+          Eigen::Vector3d::Constant(0.2),
+          Eigen::Vector3d(2.0 * i - 5.0, 0.01 * j, 0.1 + 0.21 * j),
+          Eigen::Vector3d(0.0, 0.0, 0.1 * i * j)));
+    }
+  }
+
+  return world;
+}
+
+//==============================================================================
+TEST(ConstraintSolver, ParallelConstrainedGroupsAreDeterministic)
+{
+  auto serialWorld = createWorldWithPiles(1u);
+  auto parallelWorld = createWorldWithPiles(4u);
+  EXPECT_EQ(serialWorld->getConstraintSolver()->getNumThreads(), 1u);
+  EXPECT_EQ(parallelWorld->getConstraintSolver()->getNumThreads(), 4u);
+
+  for (auto i = 0; i < 200; ++i) {
+    serialWorld->step();
+    parallelWorld->step();
+  }
+
+  ASSERT_EQ(serialWorld->getNumSkeletons(), parallelWorld->getNumSkeletons());
+  for (auto i = 0u; i < serialWorld->getNumSkeletons(); ++i) {
+    const auto serialSkel = serialWorld->getSkeleton(i);
+    const auto parallelSkel = parallelWorld->getSkeleton(i);
+    EXPECT_EQ(serialSkel->getPositions(), parallelSkel->getPositions());
+    EXPECT_EQ(serialSkel->getVelocities(), parallelSkel->getVelocities());
+  }
+}
+
+//==============================================================================
+TEST(ConstraintSolver, RandomizedPgsIsSeededOnce)
+{
+  // Diagonally dominant LCP with coupled variables, stored with the row
+  // padding of the Dantzig matrix routines
+  constexpr int n = 12;
+  const int nskip = math::padding(n);
+  std::vector<double> A(n * nskip, 0.0);
+  std::vector<double> b(n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j)
+      A[nskip * i + j] = (i == j) ? 4.0 : 1.0 / (1.0 + (i * 7 + j * 3) % 5);
+    b[i] = (i % 3 == 0) ? -1.0 : 0.5 * i;
+  }
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < i; ++j)
+      A[nskip * i + j] = A[nskip * j + i];
+  }
+
+  // solve() overwrites its inputs, so every call gets fresh copies
+  auto solve = [&](constraint::PgsBoxedLcpSolver& solver) {
+    std::vector<double> ACopy = A;
+    std::vector<double> bCopy = b;
+    std::vector<double> x(n, 0.0);
+    std::vector<double> lo(n, 0.0);
+    std::vector<double> hi(n, 1.0);
+    std::vector<int> findex(n, -1);
+    solver.solve(
+        n,
+        ACopy.data(),
+        x.data(),
+        bCopy.data(),
+        0,
+        lo.data(),
+        hi.data(),
+        findex.data(),
+        false);
+    return x;
+  };
+
+  // The order is shuffled every eighth sweep, so nine sweeps leave a result
+  // that depends on the one shuffle
+  constraint::PgsBoxedLcpSolver::Option option;
+  option.mMaxIteration = 9;
+  option.mDeltaXThreshold = 0.0;
+  option.mRelativeDeltaXTolerance = 0.0;
+  option.mRandomizeConstraintOrder = true;
+  option.mRandomSeed = 7u;
+
+  constraint::PgsBoxedLcpSolver solver;
+  solver.setOption(option);
+  const auto first = solve(solver);
+  const auto second = solve(solver);
+
+  // The generator advances across solves instead of being reseeded
+  EXPECT_NE(first, second);
+
+  // Clones and reseeded solvers start from the seed
+  const auto clone = std::static_pointer_cast<constraint::PgsBoxedLcpSolver>(
+      solver.clone());
+  EXPECT_EQ(solve(*clone), first);
+
+  solver.setRandomSeed(7u);
+  EXPECT_EQ(solve(solver), first);
+  EXPECT_EQ(solve(solver), second);
+
+  constraint::PgsBoxedLcpSolver other;
+  other.setOption(option);
+  EXPECT_EQ(solve(other), first);
+}
+
+//==============================================================================
+TEST(ConstraintSolver, RandomizedPgsIsReproducible)
+{
+  auto createPgsWorld = [] {
+    auto world = createWorldWithPiles(1u);
+    auto pgs = std::make_shared<constraint::PgsBoxedLcpSolver>();
+    constraint::PgsBoxedLcpSolver::Option option;
+    option.mRandomizeConstraintOrder = true;
+    option.mRandomSeed = 7u;
+    pgs->setOption(option);
+    world->setConstraintSolver(
+        std::make_unique<constraint::BoxedLcpConstraintSolver>(pgs, nullptr));
+    return world;
+  };
+
+  auto world = createPgsWorld();
+  auto otherWorld = createPgsWorld();
+  for (auto i = 0; i < 100; ++i) {
+    world->step();
+    otherWorld->step();
+  }
+
+  for (auto i = 0u; i < world->getNumSkeletons(); ++i) {
+    const auto skel = world->getSkeleton(i);
+    const auto otherSkel = otherWorld->getSkeleton(i);
+    EXPECT_EQ(skel->getPositions(), otherSkel->getPositions());
+    EXPECT_EQ(skel->getVelocities(), otherSkel->getVelocities());
+  }
+}
+
+//==============================================================================
+TEST(ConstraintSolver, ParallelWorkersReuseSolverClones)
+{
+  class WorkerSolver : public constraint::BoxedLcpConstraintSolver
+  {
+  public:
+    using BoxedLcpConstraintSolver::BoxedLcpConstraintSolver;
+
+    const constraint::BoxedLcpSolver* getWorkerSolver() const
+    {
+      return mWorkers.empty() ? nullptr : mWorkers.front().boxedLcpSolver.get();
+    }
+  };
+
+  auto world = createWorldWithPiles(2u);
+  auto pgs = std::make_shared<constraint::PgsBoxedLcpSolver>();
+  auto solverPtr = std::make_unique<WorkerSolver>(pgs, nullptr);
+  auto* solver = solverPtr.get();
+  world->setConstraintSolver(std::move(solverPtr));
+
+  for (auto i = 0; i < 5; ++i)
+    world->step();
+  const auto* clone = solver->getWorkerSolver();
+  ASSERT_NE(clone, nullptr);
+  EXPECT_NE(clone, pgs.get());
+
+  // Clones are kept across time steps
+  world->step();
+  EXPECT_EQ(solver->getWorkerSolver(), clone);
+
+  // and refreshed when the options of the solver change
+  auto option = pgs->getOption();
+  option.mMaxIteration = 50;
+  pgs->setOption(option);
+  world->step();
+  ASSERT_NE(solver->getWorkerSolver(), nullptr);
+  EXPECT_EQ(
+      solver->getWorkerSolver()
+          ->as<constraint::PgsBoxedLcpSolver>()
+          ->getOption()
+          .mMaxIteration,
+      50);
+}
+
+//==============================================================================
+TEST(ConstraintSolver, AnalyticMatrixAssemblyMatchesImpulseTests)
+{
+  // Assembles the LCP matrix of every constrained group in both ways
+  class ComparingSolver : public constraint::BoxedLcpConstraintSolver
+  {
+  public:
+    double mMaxError = 0.0;
+    std::size_t mNumAnalyticGroups = 0;
+
+  protected:
+    void solveConstrainedGroup(constraint::ConstrainedGroup& group) override
+    {
+      const auto n = static_cast<int>(group.getTotalDimension());
+      LcpWorkspace impulseTests;
+      LcpWorkspace analytic;
+      for (auto* workspace : {&impulseTests, &analytic}) {
+        workspace->A.setZero(n, n);
+        workspace->offset.resize(group.getNumConstraints());
+        int offset = 0;
+        for (auto i = 0u; i < group.getNumConstraints(); ++i) {
+          workspace->offset[i] = offset;
+          offset += group.getConstraint(i)->getDimension();
+        }
+      }
+
+      assembleByImpulseTests(group, impulseTests);
+      if (assembleAnalytically(group, analytic)) {
+        ++mNumAnalyticGroups;
+        const Eigen::MatrixXd diff
+            = impulseTests.A.triangularView<Eigen::Upper>().toDenseMatrix()
+              - analytic.A.triangularView<Eigen::Upper>().toDenseMatrix();
+        mMaxError = std::max(mMaxError, diff.cwiseAbs().maxCoeff());
+      }
+
+      BoxedLcpConstraintSolver::solveConstrainedGroup(group);
+    }
+  };
+
+  auto world = createWorldWithPiles(1u);
+
+  // An articulated arm falling onto the first pile
+  auto arm = createNLinkRobot(3, Eigen::Vector3d(0.1, 0.1, 0.3), DOF_ROLL);
+  Eigen::Isometry3d tf = Eigen::Isometry3d::Identity();
+  tf.translation() = Eigen::Vector3d(-5.0, 0.0, 0.9);
+  arm->getJoint(0)->setTransformFromParentBodyNode(tf);
+  arm->setPosition(0, 0.5 * math::pi);
+  world->addSkeleton(arm);
+
+  auto solver = std::make_unique<ComparingSolver>();
+  auto* comparingSolver = solver.get();
+  world->setConstraintSolver(std::move(solver));
+  comparingSolver->setMatrixAssembly(
+      constraint::BoxedLcpConstraintSolver::MatrixAssembly::Analytic);
+
+  for (auto i = 0; i < 200; ++i)
+    world->step();
+
+  EXPECT_GT(comparingSolver->mNumAnalyticGroups, 0u);
+  EXPECT_LT(comparingSolver->mMaxError, 1e-8);
+}
+
+//==============================================================================
+TEST(ConstraintSolver, ContactWarmStarting)
+{
+  // Records the initial guesses passed to the LCP solver
+  class RecordingLcpSolver : public constraint::DantzigBoxedLcpSolver
+  {
+  public:
+    double mMaxGuess = 0.0;
+    double mLastGuessError = 0.0;
+
+    bool solve(
+        int n,
+        double* A,
+        double* x,
+        double* b,
+        int nub,
+        double* lo,
+        double* hi,
+        int* findex,
+        bool earlyTermination) override
+    {
+      const Eigen::VectorXd guess = Eigen::Map<const Eigen::VectorXd>(x, n);
+      const bool success = DantzigBoxedLcpSolver::solve(
+          n, A, x, b, nub, lo, hi, findex, earlyTermination);
+      const Eigen::Map<const Eigen::VectorXd> solution(x, n);
+      mMaxGuess = std::max(mMaxGuess, guess.cwiseAbs().maxCoeff());
+      mLastGuessError = (solution - guess).cwiseAbs().maxCoeff();
+      return success;
+    }
+  };
+
+  auto createRestingBoxWorld
+      = [](bool warmStarting, std::shared_ptr<RecordingLcpSolver> lcpSolver) {
+          auto world = createWorld();
+          world->addSkeleton(createGround(
+              Eigen::Vector3d(20.0, 20.0, 0.1),
+              Eigen::Vector3d(0.0, 0.0, -0.05)));
+          world->addSkeleton(createBox(
+              Eigen::Vector3d::Constant(0.2), Eigen::Vector3d(0.0, 0.0, 0.1)));
+          world->setConstraintSolver(
+              std::make_unique<constraint::BoxedLcpConstraintSolver>(
+                  std::move(lcpSolver), nullptr));
+          world->getConstraintSolver()->setContactWarmStarting(warmStarting);
+          return world;
+        };
+
+  auto coldLcpSolver = std::make_shared<RecordingLcpSolver>();
+  auto warmLcpSolver = std::make_shared<RecordingLcpSolver>();
+  auto coldWorld = createRestingBoxWorld(false, coldLcpSolver);
+  auto warmWorld = createRestingBoxWorld(true, warmLcpSolver);
+  EXPECT_FALSE(
+      coldWorld->getConstraintSolver()->isContactWarmStartingEnabled());
+  EXPECT_TRUE(
+      warmWorld->getConstraintSolver()->isContactWarmStartingEnabled());
+
+  // Only the warm started Dantzig solver tries the active set of the guess
+  EXPECT_FALSE(coldLcpSolver->getOption().mWarmStart);
+  EXPECT_TRUE(warmLcpSolver->getOption().mWarmStart);
+
+  for (auto i = 0; i < 200; ++i) {
+    coldWorld->step();
+    warmWorld->step();
+  }
+
+  // Without warm starting the LCP always starts from zero
+  EXPECT_EQ(coldLcpSolver->mMaxGuess, 0.0);
+
+  // The impulses of a resting box are carried over to the next time step
+  EXPECT_GT(warmLcpSolver->mMaxGuess, 0.0);
+  EXPECT_LT(warmLcpSolver->mLastGuessError, 1e-6);
+
+  // Warm starting doesn't change the resting state
+  const auto coldBox = coldWorld->getSkeleton(1);
+  const auto warmBox = warmWorld->getSkeleton(1);
+  EXPECT_TRUE(equals(coldBox->getPositions(), warmBox->getPositions(), 1e-6));
+  EXPECT_TRUE(
+      equals(coldBox->getVelocities(), warmBox->getVelocities(), 1e-6));
+}
+
+//==============================================================================
+TEST(ConstraintSolver, ContactManifoldReduction)
+{
+  // Records the contacts that become contact constraints
+  class RecordingHandler : public constraint::ContactSurfaceHandler
+  {
+  public:
+    constraint::ContactSurfaceParams createParams(
+        const collision::Contact& contact,
+        const size_t numContactsOnCollisionObject) const override
+    {
+      mContacts.push_back(&contact);
+      mNumContactsOnCollisionObject = numContactsOnCollisionObject;
+      return ContactSurfaceHandler::createParams(
+          contact, numContactsOnCollisionObject);
+    }
+
+    mutable std::vector<const collision::Contact*> mContacts;
+    mutable std::size_t mNumContactsOnCollisionObject{0u};
+  };
+
+  auto world = createWorld();
+  world->addSkeleton(createGround(
+      Eigen::Vector3d(20.0, 20.0, 0.1), Eigen::Vector3d(0.0, 0.0, -0.05)));
+  auto box = createBox(
+      Eigen::Vector3d::Constant(0.2), Eigen::Vector3d(0.0, 0.0, 0.1));
+  world->addSkeleton(box);
+
+  // The DART detector reports the four corners of the box, which keeps the
+  // test independent of the optional collision backends
+  auto solver = world->getConstraintSolver();
+  solver->setCollisionDetector(collision::DARTCollisionDetector::create());
+  auto handler = std::make_shared<RecordingHandler>();
+  solver->addContactSurfaceHandler(handler);
+  EXPECT_EQ(solver->getMaxNumContactsPerPair(), 0u);
+
+  for (auto i = 0; i < 10; ++i)
+    world->step();
+
+  handler->mContacts.clear();
+  world->step();
+  const auto numContacts = handler->mContacts.size();
+  ASSERT_GE(numContacts, 4u);
+
+  // Pairs within the limit are left untouched
+  solver->setMaxNumContactsPerPair(numContacts);
+  handler->mContacts.clear();
+  world->step();
+  EXPECT_EQ(handler->mContacts.size(), numContacts);
+
+  solver->setMaxNumContactsPerPair(3u);
+  handler->mContacts.clear();
+  world->step();
+  ASSERT_EQ(handler->mContacts.size(), 3u);
+  EXPECT_EQ(handler->mNumContactsOnCollisionObject, 3u);
+
+  // The collision result still holds every contact
+  const auto& result = solver->getLastCollisionResult();
+  EXPECT_EQ(result.getNumContacts(), numContacts);
+
+  // The deepest contact is kept and the kept contacts span an area
+  double maxDepth = 0.0;
+  for (const auto& contact : result.getContacts())
+    maxDepth = std::max(maxDepth, contact.penetrationDepth);
+  const auto& kept = handler->mContacts;
+  EXPECT_TRUE(std::any_of(kept.begin(), kept.end(), [&](const auto* contact) {
+    return contact->penetrationDepth == maxDepth;
+  }));
+  const Eigen::Vector3d edge1 = kept[1]->point - kept[0]->point;
+  const Eigen::Vector3d edge2 = kept[2]->point - kept[0]->point;
+  EXPECT_GT(edge1.cross(edge2).norm(), 0.01 * 0.2 * 0.2);
+
+  // Three contacts are enough to keep the box at rest
+  for (auto i = 0; i < 200; ++i)
+    world->step();
+  EXPECT_NEAR(box->getPositions()[5], 0.1, 1e-3);
+  EXPECT_LT(box->getVelocities().norm(), 1e-3);
+}
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "helpers/dynamics_helpers.hpp"
+
+#include "dart/constraint/BoxedLcpConstraintSolver.hpp"
+#include "dart/simulation/World.hpp"
+
+#include <gtest/gtest.h>
+
+#include <new>
+#include <vector>
+
+#include <cstddef>
+#include <cstdlib>
+
+using namespace dart;
+
+namespace {
+
+bool countAllocations = false;
+std::size_t numAllocations = 0;
+
+} // namespace
+
+// Count the allocations through operator new, which are the ones of the
+// standard library containers and smart pointers, while countAllocations is
+// set. Allocations through malloc, such as the ones of Eigen and of the base
+// allocator of the constraint pool, are not counted. The growth of the pool is
+// checked through its number of memory blocks instead.
+void* operator new(std::size_t size)
+{
+  if (countAllocations)
+    ++numAllocations;
+
+  if (void* pointer = std::malloc(size == 0 ? 1 : size))
+    return pointer;
+
+  throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept
+{
+  std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t /*size*/) noexcept
+{
+  std::free(pointer);
+}
+
+namespace {
+
+/// Exposes rebuilding the constraints of the last collision result
+class RebuildingConstraintSolver : public constraint::BoxedLcpConstraintSolver
+{
+public:
+  void rebuildConstraints()
+  {
+    mActiveConstraints.clear();
+    updateContactConstraints();
+    updateJointConstraints();
+    buildConstrainedGroups();
+  }
+
+  std::size_t getNumContactConstraints() const
+  {
+    return mContactConstraints.size();
+  }
+
+  std::size_t getNumJointConstraints() const
+  {
+    return mJointConstraints.size() + mJointCoulombFrictionConstraints.size();
+  }
+
+  int getNumAllocatorBlocks() const
+  {
+    return mConstraintAllocator.getNumAllocatedMemoryBlocks();
+  }
+};
+
+} // namespace
+
+//==============================================================================
+TEST(ConstraintSolverAllocation, RebuildReusesConstraintStorage)
+{
+  auto world = simulation::World::create();
+  world->addSkeleton(createGround(
+      Eigen::Vector3d(20.0, 20.0, 0.1), Eigen::Vector3d(0.0, 0.0, -0.05)));
+  for (int i = 0; i < 4; ++i) {
+    world->addSkeleton(createBox(
+        Eigen::Vector3d::Constant(0.2),
+        Eigen::Vector3d(0.5 * i, 0.0, 0.099)));
+  }
+
+  // Pendulum resting at its joint limits with joint friction
+  auto robot = createNLinkRobot(3, Eigen::Vector3d(0.1, 0.1, 0.5), DOF_ROLL);
+  robot->getRootJoint()->setTransformFromParentBodyNode(
+      Eigen::Isometry3d(Eigen::Translation3d(0.0, 2.0, 2.0)));
+  for (std::size_t i = 0; i < robot->getNumJoints(); ++i) {
+    dynamics::Joint* joint = robot->getJoint(i);
+    joint->setLimitEnforcement(true);
+    joint->setPositionLowerLimit(0, 0.0);
+    joint->setPositionUpperLimit(0, 0.0);
+    joint->setCoulombFriction(0, 0.1);
+  }
+  world->addSkeleton(robot);
+
+  auto solverPtr = std::make_unique<RebuildingConstraintSolver>();
+  auto* solver = solverPtr.get();
+  world->setConstraintSolver(std::move(solverPtr));
+  solver->setContactWarmStarting(true);
+
+  for (int i = 0; i < 10; ++i)
+    world->step();
+
+  ASSERT_GT(solver->getNumContactConstraints(), 0u);
+  ASSERT_GT(solver->getNumJointConstraints(), 0u);
+
+  // Warm up the storage that is reused across time steps
+  solver->rebuildConstraints();
+  solver->rebuildConstraints();
+  const int numBlocks = solver->getNumAllocatorBlocks();
+
+  numAllocations = 0;
+  countAllocations = true;
+  for (int i = 0; i < 100; ++i)
+    solver->rebuildConstraints();
+  countAllocations = false;
+
+  EXPECT_EQ(numAllocations, 0u);
+  EXPECT_EQ(solver->getNumAllocatorBlocks(), numBlocks);
+}
+
+//==============================================================================
+TEST(ConstraintSolverAllocation, CheckpointWithoutOperatorNew)
+{
+  auto world = simulation::World::create();
+  world->getConstraintSolver()->setContactWarmStarting(true);
+  world->addSkeleton(createGround(
+      Eigen::Vector3d(20.0, 20.0, 0.1), Eigen::Vector3d(0.0, 0.0, -0.05)));
+  for (int i = 0; i < 4; ++i) {
+    world->addSkeleton(createBox(
+        Eigen::Vector3d::Constant(0.2),
+        Eigen::Vector3d(0.5 * i, 0.0, 0.099)));
+  }
+  world->addSkeleton(
+      createNLinkRobot(3, Eigen::Vector3d(0.1, 0.1, 0.5), DOF_ROLL));
+
+  for (int i = 0; i < 10; ++i)
+    world->step();
+
+  ASSERT_GT(world->getConstraintSolver()->getContactWarmStartDataSize(), 0u);
+
+  std::vector<std::byte> checkpoint(world->getCheckpointSize());
+  ASSERT_GT(world->saveCheckpoint(checkpoint), 0u);
+
+  // The cached contact impulses are restored into their existing storage
+  numAllocations = 0;
+  countAllocations = true;
+  for (int i = 0; i < 100; ++i) {
+    world->saveCheckpoint(checkpoint);
+    world->restoreCheckpoint(checkpoint);
+  }
+  countAllocations = false;
+
+  EXPECT_EQ(numAllocations, 0u);
+}
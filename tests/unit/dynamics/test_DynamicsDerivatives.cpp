@@ -0,0 +1,347 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <dart/All.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+
+#include <cmath>
+
+using namespace dart::dynamics;
+
+namespace {
+
+constexpr double kStep = 1e-6;
+
+Eigen::Isometry3d randomTransform(std::mt19937& rng)
+{
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  Eigen::Isometry3d tf = Eigen::Isometry3d::Identity();
+  tf.linear()
+      = dart::math::expMapRot(Eigen::Vector3d(dist(rng), dist(rng), dist(rng)));
+  tf.translation() = 0.3 * Eigen::Vector3d(dist(rng), dist(rng), dist(rng));
+  return tf;
+}
+
+Inertia randomInertia(std::mt19937& rng)
+{
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  Eigen::Matrix3d M = Eigen::Matrix3d::NullaryExpr([&]() { return dist(rng); });
+  const Eigen::Matrix3d moment
+      = 0.1 * (M * M.transpose() + Eigen::Matrix3d::Identity());
+  return Inertia(
+      1.0 + 0.5 * dist(rng),
+      0.2 * Eigen::Vector3d(dist(rng), dist(rng), dist(rng)),
+      moment);
+}
+
+template <class JointType>
+BodyNode* addBody(
+    const SkeletonPtr& skel,
+    BodyNode* parent,
+    std::mt19937& rng,
+    typename JointType::Properties properties = {})
+{
+  properties.mT_ParentBodyToJoint = randomTransform(rng);
+  properties.mT_ChildBodyToJoint = randomTransform(rng);
+  BodyNode* body = skel->createJointAndBodyNodePair<JointType>(
+                           parent, properties)
+                       .second;
+  body->setInertia(randomInertia(rng));
+
+  std::uniform_real_distribution<double> dist(0.1, 1.0);
+  Joint* joint = body->getParentJoint();
+  for (std::size_t i = 0; i < joint->getNumDofs(); ++i) {
+    joint->setDampingCoefficient(i, dist(rng));
+    // Springs of joints that are not integrated additively are not
+    // differentiable along their position perturbation
+    if (joint->getNumDofs() == 1) {
+      joint->setSpringStiffness(i, 10.0 * dist(rng));
+      joint->setRestPosition(i, dist(rng));
+    }
+  }
+
+  return body;
+}
+
+SkeletonPtr createChain(std::size_t numDofs, std::mt19937& rng)
+{
+  SkeletonPtr skel = Skeleton::create("chain");
+  BodyNode* parent = nullptr;
+  for (std::size_t i = 0; i < numDofs; ++i) {
+    RevoluteJoint::Properties properties;
+    properties.mAxis = (i % 2 == 0) ? Eigen::Vector3d::UnitZ()
+                                    : Eigen::Vector3d::UnitY();
+    parent = addBody<RevoluteJoint>(skel, parent, rng, properties);
+  }
+  return skel;
+}
+
+SkeletonPtr createTree(std::mt19937& rng)
+{
+  SkeletonPtr skel = Skeleton::create("tree");
+
+  BodyNode* root = addBody<FreeJoint>(skel, nullptr, rng);
+
+  BodyNode* ball = addBody<BallJoint>(skel, root, rng);
+  UniversalJoint::Properties universal;
+  universal.mAxis[0] = Eigen::Vector3d(1.0, 0.2, 0.0).normalized();
+  universal.mAxis[1] = Eigen::Vector3d(0.0, 1.0, 0.3).normalized();
+  BodyNode* universalBody
+      = addBody<UniversalJoint>(skel, ball, rng, universal);
+  EulerJoint::Properties xyz;
+  xyz.mAxisOrder = EulerJoint::AxisOrder::XYZ;
+  addBody<EulerJoint>(skel, universalBody, rng, xyz);
+
+  EulerJoint::Properties zyx;
+  zyx.mAxisOrder = EulerJoint::AxisOrder::ZYX;
+  BodyNode* euler = addBody<EulerJoint>(skel, root, rng, zyx);
+  BodyNode* planar = addBody<PlanarJoint>(skel, euler, rng);
+  PrismaticJoint::Properties prismatic;
+  prismatic.mAxis = Eigen::Vector3d(0.3, 0.4, 1.0).normalized();
+  addBody<PrismaticJoint>(skel, planar, rng, prismatic);
+
+  ScrewJoint::Properties screw;
+  screw.mAxis = Eigen::Vector3d(1.0, 1.0, 0.0).normalized();
+  screw.mPitch = 0.2;
+  BodyNode* screwBody = addBody<ScrewJoint>(skel, root, rng, screw);
+  addBody<WeldJoint>(skel, screwBody, rng);
+  BodyNode* revolute = addBody<RevoluteJoint>(skel, screwBody, rng);
+  revolute->setGravityMode(false);
+
+  return skel;
+}
+
+void randomizeState(const SkeletonPtr& skel, std::mt19937& rng)
+{
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  const std::size_t n = skel->getNumDofs();
+  skel->setPositions(Eigen::VectorXd::NullaryExpr(n, [&]() {
+    return dist(rng);
+  }));
+  skel->setVelocities(Eigen::VectorXd::NullaryExpr(n, [&]() {
+    return dist(rng);
+  }));
+  skel->setAccelerations(Eigen::VectorXd::NullaryExpr(n, [&]() {
+    return dist(rng);
+  }));
+  skel->setForces(Eigen::VectorXd::NullaryExpr(n, [&]() {
+    return 5.0 * dist(rng);
+  }));
+  skel->setGravity(Eigen::Vector3d(0.5, -0.3, -9.81));
+  skel->setTimeStep(1e-3);
+
+  for (std::size_t i = 0; i < skel->getNumBodyNodes(); ++i) {
+    skel->getBodyNode(i)->addExtForce(
+        Eigen::Vector3d(dist(rng), dist(rng), dist(rng)),
+        0.1 * Eigen::Vector3d(dist(rng), dist(rng), dist(rng)));
+  }
+}
+
+// Perturbs the positions along the k-th DOF the same way the simulation
+// does. FreeJoint also rotates its velocities and accelerations while
+// integrating, so both are restored to keep them fixed.
+void perturbPositions(const SkeletonPtr& skel, std::size_t k, double step)
+{
+  const Eigen::VectorXd velocities = skel->getVelocities();
+  const Eigen::VectorXd accelerations = skel->getAccelerations();
+  skel->setVelocities(Eigen::VectorXd::Unit(skel->getNumDofs(), k));
+  skel->integratePositions(step);
+  skel->setVelocities(velocities);
+  skel->setAccelerations(accelerations);
+}
+
+// Central differences of f() along the positions and the velocities
+template <class Function>
+void finiteDifferences(
+    const SkeletonPtr& skel,
+    Function f,
+    Eigen::MatrixXd& wrtPositions,
+    Eigen::MatrixXd& wrtVelocities)
+{
+  const std::size_t n = skel->getNumDofs();
+  const Eigen::VectorXd positions = skel->getPositions();
+  const Eigen::VectorXd velocities = skel->getVelocities();
+  wrtPositions.resize(n, n);
+  wrtVelocities.resize(n, n);
+
+  for (std::size_t k = 0; k < n; ++k) {
+    perturbPositions(skel, k, kStep);
+    const Eigen::VectorXd plus = f();
+    skel->setPositions(positions);
+    perturbPositions(skel, k, -kStep);
+    const Eigen::VectorXd minus = f();
+    skel->setPositions(positions);
+    wrtPositions.col(k) = (plus - minus) / (2.0 * kStep);
+
+    skel->setVelocity(k, velocities[k] + kStep);
+    const Eigen::VectorXd plusV = f();
+    skel->setVelocity(k, velocities[k] - kStep);
+    const Eigen::VectorXd minusV = f();
+    skel->setVelocity(k, velocities[k]);
+    wrtVelocities.col(k) = (plusV - minusV) / (2.0 * kStep);
+  }
+}
+
+void expectMatrixNear(
+    const Eigen::MatrixXd& actual, const Eigen::MatrixXd& expected, double tol)
+{
+  ASSERT_EQ(actual.rows(), expected.rows());
+  ASSERT_EQ(actual.cols(), expected.cols());
+  for (Eigen::Index i = 0; i < actual.rows(); ++i) {
+    for (Eigen::Index j = 0; j < actual.cols(); ++j) {
+      EXPECT_NEAR(
+          actual(i, j),
+          expected(i, j),
+          tol * std::max(1.0, std::abs(expected(i, j))))
+          << "(" << i << ", " << j << ")";
+    }
+  }
+}
+
+void testInverseDynamicsDerivatives(const SkeletonPtr& skel)
+{
+  for (const bool withForces : {false, true}) {
+    SCOPED_TRACE(withForces);
+    auto inverseDynamics = [&]() -> Eigen::VectorXd {
+      skel->computeInverseDynamics(withForces, withForces, withForces);
+      return skel->getForces();
+    };
+
+    Eigen::MatrixXd expectedWrtPositions;
+    Eigen::MatrixXd expectedWrtVelocities;
+    finiteDifferences(
+        skel, inverseDynamics, expectedWrtPositions, expectedWrtVelocities);
+
+    Eigen::MatrixXd wrtPositions;
+    Eigen::MatrixXd wrtVelocities;
+    skel->computeInverseDynamicsDerivatives(
+        wrtPositions, wrtVelocities, withForces, withForces, withForces);
+
+    expectMatrixNear(wrtPositions, expectedWrtPositions, 1e-5);
+    expectMatrixNear(wrtVelocities, expectedWrtVelocities, 1e-5);
+  }
+}
+
+void testForwardDynamicsDerivatives(const SkeletonPtr& skel)
+{
+  auto forwardDynamics = [&]() -> Eigen::VectorXd {
+    skel->computeForwardDynamics();
+    return skel->getAccelerations();
+  };
+
+  Eigen::MatrixXd expectedWrtPositions;
+  Eigen::MatrixXd expectedWrtVelocities;
+  finiteDifferences(
+      skel, forwardDynamics, expectedWrtPositions, expectedWrtVelocities);
+
+  const std::size_t n = skel->getNumDofs();
+  const Eigen::VectorXd forces = skel->getForces();
+  Eigen::MatrixXd expectedWrtForces(n, n);
+  for (std::size_t k = 0; k < n; ++k) {
+    skel->setForce(k, forces[k] + kStep);
+    const Eigen::VectorXd plus = forwardDynamics();
+    skel->setForce(k, forces[k] - kStep);
+    const Eigen::VectorXd minus = forwardDynamics();
+    skel->setForce(k, forces[k]);
+    expectedWrtForces.col(k) = (plus - minus) / (2.0 * kStep);
+  }
+
+  const Eigen::VectorXd expectedAccelerations = forwardDynamics();
+
+  Eigen::MatrixXd wrtPositions;
+  Eigen::MatrixXd wrtVelocities;
+  Eigen::MatrixXd wrtForces;
+  skel->computeForwardDynamicsDerivatives(
+      wrtPositions, wrtVelocities, wrtForces);
+
+  EXPECT_TRUE(skel->getAccelerations().isApprox(expectedAccelerations));
+  expectMatrixNear(wrtPositions, expectedWrtPositions, 1e-5);
+  expectMatrixNear(wrtVelocities, expectedWrtVelocities, 1e-5);
+  expectMatrixNear(wrtForces, expectedWrtForces, 1e-5);
+}
+
+} // namespace
+
+//==============================================================================
+TEST(DynamicsDerivatives, InverseDynamicsOfChain)
+{
+  std::mt19937 rng(42u);
+  SkeletonPtr skel = createChain(7, rng);
+  for (int trial = 0; trial < 3; ++trial) {
+    randomizeState(skel, rng);
+    testInverseDynamicsDerivatives(skel);
+  }
+}
+
+//==============================================================================
+TEST(DynamicsDerivatives, InverseDynamicsOfTree)
+{
+  std::mt19937 rng(7u);
+  SkeletonPtr skel = createTree(rng);
+  for (int trial = 0; trial < 3; ++trial) {
+    randomizeState(skel, rng);
+    testInverseDynamicsDerivatives(skel);
+  }
+}
+
+//==============================================================================
+TEST(DynamicsDerivatives, ForwardDynamicsOfChain)
+{
+  std::mt19937 rng(3u);
+  SkeletonPtr skel = createChain(7, rng);
+  randomizeState(skel, rng);
+  testForwardDynamicsDerivatives(skel);
+}
+
+//==============================================================================
+TEST(DynamicsDerivatives, ForwardDynamicsOfTree)
+{
+  std::mt19937 rng(11u);
+  SkeletonPtr skel = createTree(rng);
+  randomizeState(skel, rng);
+  testForwardDynamicsDerivatives(skel);
+}
+
+//==============================================================================
+TEST(DynamicsDerivatives, EmptySkeleton)
+{
+  SkeletonPtr skel = Skeleton::create("empty");
+  Eigen::MatrixXd wrtPositions;
+  Eigen::MatrixXd wrtVelocities;
+  skel->computeInverseDynamicsDerivatives(wrtPositions, wrtVelocities);
+  EXPECT_EQ(wrtPositions.size(), 0);
+  EXPECT_EQ(wrtVelocities.size(), 0);
+}
@@ -2,6 +2,7 @@
 #include "dart/common/Uri.hpp"
 #include "dart/config.hpp"
 #include "dart/dynamics/AssimpInputResourceAdaptor.hpp"
+#include "dart/dynamics/MeshCache.hpp"
 #include "dart/dynamics/MeshShape.hpp"
 
 #include <assimp/cimport.h>
@@ -9,6 +10,7 @@
 #include <assimp/postprocess.h>
 #include <gtest/gtest.h>
 
+#include <filesystem>
 #include <fstream>
 #include <memory>
 #include <string>
@@ -195,3 +197,90 @@ TEST(MeshShapeTest, ColladaUriWithoutExtensionStillLoads)
       << "aliasExtents=" << aliasExtents.transpose()
       << ", canonicalExtents=" << canonicalExtents.transpose();
 }
+
+TEST(MeshShapeTest, MeshCacheSharesMeshes)
+{
+  const std::string filePath = dart::config::dataPath("skel/kima/l-foot.dae");
+  const common::Uri fileUri = common::Uri::createFromPath(filePath);
+  auto retriever = std::make_shared<common::LocalResourceRetriever>();
+
+  dynamics::MeshCache cache;
+  const auto mesh1 = cache.load(fileUri, retriever);
+  const auto mesh2 = cache.load(fileUri, retriever);
+  ASSERT_NE(mesh1, nullptr);
+  EXPECT_EQ(mesh1, mesh2);
+  EXPECT_EQ(cache.getNumMeshes(), 1u);
+
+  auto shape = std::make_shared<dynamics::MeshShape>(
+      Eigen::Vector3d::Ones(), mesh1, fileUri, retriever);
+  EXPECT_EQ(shape->getMesh(), mesh1.get());
+  EXPECT_EQ(shape->getMeshUri2().toString(), fileUri.toString());
+
+  // Clones share the immutable mesh
+  const auto clone
+      = std::static_pointer_cast<dynamics::MeshShape>(shape->clone());
+  EXPECT_EQ(clone->getMesh(), mesh1.get());
+
+  // The shapes keep the mesh alive after the cache forgets it
+  cache.clear();
+  EXPECT_EQ(cache.getNumMeshes(), 0u);
+  EXPECT_NE(shape->getMesh()->mNumMeshes, 0u);
+}
+
+TEST(MeshShapeTest, MeshCacheDirectory)
+{
+  const std::string filePath = dart::config::dataPath("skel/kima/l-foot.dae");
+  const common::Uri fileUri = common::Uri::createFromPath(filePath);
+  auto retriever = std::make_shared<common::LocalResourceRetriever>();
+
+  const auto directory
+      = std::filesystem::temp_directory_path() / "dart_test_mesh_cache";
+  std::filesystem::remove_all(directory);
+
+  dynamics::MeshCache cache;
+  cache.setCacheDirectory(directory.string());
+  EXPECT_EQ(cache.getCacheDirectory(), directory.string());
+
+  const auto imported = cache.load(fileUri, retriever);
+  ASSERT_NE(imported, nullptr);
+  EXPECT_FALSE(std::filesystem::is_empty(directory));
+
+  // A new cache reads the preprocessed mesh from the directory
+  dynamics::MeshCache warmCache;
+  warmCache.setCacheDirectory(directory.string());
+  const auto cached = warmCache.load(fileUri, retriever);
+  ASSERT_NE(cached, nullptr);
+  EXPECT_NE(cached, imported);
+
+  ASSERT_EQ(cached->mNumMeshes, imported->mNumMeshes);
+  ASSERT_EQ(cached->mNumMaterials, imported->mNumMaterials);
+  for (auto i = 0u; i < imported->mNumMeshes; ++i) {
+    const aiMesh* expected = imported->mMeshes[i];
+    const aiMesh* actual = cached->mMeshes[i];
+    ASSERT_EQ(actual->mNumVertices, expected->mNumVertices);
+    ASSERT_EQ(actual->mNumFaces, expected->mNumFaces);
+    EXPECT_EQ(actual->mMaterialIndex, expected->mMaterialIndex);
+    for (auto j = 0u; j < expected->mNumVertices; ++j) {
+      EXPECT_EQ(actual->mVertices[j].x, expected->mVertices[j].x);
+      EXPECT_EQ(actual->mVertices[j].y, expected->mVertices[j].y);
+      EXPECT_EQ(actual->mVertices[j].z, expected->mVertices[j].z);
+    }
+    for (auto j = 0u; j < expected->mNumFaces; ++j) {
+      ASSERT_EQ(
+          actual->mFaces[j].mNumIndices, expected->mFaces[j].mNumIndices);
+      for (auto k = 0u; k < expected->mFaces[j].mNumIndices; ++k) {
+        EXPECT_EQ(
+            actual->mFaces[j].mIndices[k], expected->mFaces[j].mIndices[k]);
+      }
+    }
+  }
+
+  const auto cachedShape = std::make_shared<dynamics::MeshShape>(
+      Eigen::Vector3d::Ones(), cached, fileUri, retriever);
+  const auto importedShape = std::make_shared<dynamics::MeshShape>(
+      Eigen::Vector3d::Ones(), imported, fileUri, retriever);
+  EXPECT_TRUE(cachedShape->getBoundingBox().computeFullExtents().isApprox(
+      importedShape->getBoundingBox().computeFullExtents()));
+
+  std::filesystem::remove_all(directory);
+}
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * Tests comparing the blocked Dantzig LDLT kernels against the unrolled ODE
+ * kernels
+ */
+
+#include "dart/math/lcp/Dantzig/Matrix.hpp"
+
+#include <Eigen/Dense>
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+using namespace dart::math;
+
+namespace {
+
+// Row-major SPD matrix of size n with row stride padding(n)
+template <typename Scalar>
+std::vector<Scalar> makeSpdMatrix(int n, unsigned int seed)
+{
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  Eigen::MatrixXd M(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      M(i, j) = dist(rng);
+    }
+  }
+  const Eigen::MatrixXd A
+      = M * M.transpose() + n * Eigen::MatrixXd::Identity(n, n);
+
+  const int nskip = padding(n);
+  std::vector<Scalar> out(nskip * n, Scalar(0));
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      out[i * nskip + j] = static_cast<Scalar>(A(i, j));
+    }
+  }
+  return out;
+}
+
+template <typename Scalar>
+std::vector<Scalar> makeVector(int n, unsigned int seed)
+{
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::vector<Scalar> out(n);
+  for (auto& value : out) {
+    value = static_cast<Scalar>(dist(rng));
+  }
+  return out;
+}
+
+template <typename Scalar>
+void expectNear(
+    const std::vector<Scalar>& a, const std::vector<Scalar>& b, double tol)
+{
+  ASSERT_EQ(a.size(), b.size());
+  for (std::size_t i = 0; i < a.size(); ++i) {
+    EXPECT_NEAR(a[i], b[i], tol) << "at index " << i;
+  }
+}
+
+template <typename Scalar>
+void testBlockedKernels(int n, double tol)
+{
+  const int nskip = padding(n);
+
+  // Factorization
+  auto A = makeSpdMatrix<Scalar>(n, 17u + n);
+  auto L = A;
+  auto Lref = A;
+  std::vector<Scalar> d(n);
+  std::vector<Scalar> dref(n);
+  lcp::_dFactorLDLTBlocked(L.data(), d.data(), n, nskip);
+  lcp::_dFactorLDLT(Lref.data(), dref.data(), n, nskip);
+  expectNear(d, dref, tol);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < i; ++j) {
+      EXPECT_NEAR(L[i * nskip + j], Lref[i * nskip + j], tol)
+          << "L(" << i << ", " << j << ")";
+    }
+  }
+
+  // Forward and backward substitution against the same factor
+  const auto b = makeVector<Scalar>(n, 31u + n);
+  auto x = b;
+  auto xref = b;
+  lcp::_dSolveL1Blocked(Lref.data(), x.data(), n, nskip);
+  lcp::_dSolveL1(Lref.data(), xref.data(), n, nskip);
+  expectNear(x, xref, tol);
+
+  x = b;
+  xref = b;
+  lcp::_dSolveL1TBlocked(Lref.data(), x.data(), n, nskip);
+  lcp::_dSolveL1T(Lref.data(), xref.data(), n, nskip);
+  expectNear(x, xref, tol);
+
+  // The dispatched solve must still reproduce A * x = b
+  x = b;
+  dSolveLDLT(L.data(), d.data(), x.data(), n, nskip);
+  for (int i = 0; i < n; ++i) {
+    double sum = 0.0;
+    for (int j = 0; j < n; ++j) {
+      const Scalar aij = (i >= j) ? A[i * nskip + j] : A[j * nskip + i];
+      sum += static_cast<double>(aij) * x[j];
+    }
+    EXPECT_NEAR(sum, b[i], tol) << "row " << i;
+  }
+}
+
+} // namespace
+
+//==============================================================================
+TEST(DantzigMatrix, BlockedKernelsMatchScalarDouble)
+{
+  for (int n : {1, 2, 5, 31, 32, 33, 64, 97, 192}) {
+    SCOPED_TRACE(n);
+    testBlockedKernels<double>(n, 1e-10);
+  }
+}
+
+//==============================================================================
+TEST(DantzigMatrix, BlockedKernelsMatchScalarFloat)
+{
+  for (int n : {3, 32, 65, 96}) {
+    SCOPED_TRACE(n);
+    testBlockedKernels<float>(n, 1e-4);
+  }
+}
+
+//==============================================================================
+TEST(DantzigMatrix, LdltRemoveMatchesRefactorization)
+{
+  for (int n : {2, 5, 40, 97}) {
+    for (int r : {0, 1, n / 2, n - 1}) {
+      SCOPED_TRACE(testing::Message() << "n = " << n << ", r = " << r);
+      const int nskip = padding(n);
+
+      auto A = makeSpdMatrix<double>(n, 43u + n);
+      auto L = A;
+      std::vector<double> d(n);
+      dFactorLDLT(L.data(), d.data(), n, nskip);
+
+      // Removes row and column r through the rank-2 update of dLDLTAddTL()
+      std::vector<double*> rows(n);
+      std::vector<int> p(n);
+      for (int i = 0; i < n; ++i) {
+        rows[i] = A.data() + i * nskip;
+        p[i] = i;
+      }
+      dLDLTRemove(rows.data(), p.data(), L.data(), d.data(), n, n, r, nskip);
+
+      const int m = n - 1;
+      const int mskip = padding(m);
+      std::vector<double> Lref(mskip * m, 0.0);
+      std::vector<double> dref(m);
+      for (int i = 0; i < m; ++i) {
+        for (int j = 0; j < m; ++j) {
+          Lref[i * mskip + j]
+              = A[(i < r ? i : i + 1) * nskip + (j < r ? j : j + 1)];
+        }
+      }
+      dFactorLDLT(Lref.data(), dref.data(), m, mskip);
+
+      for (int i = 0; i < m; ++i) {
+        EXPECT_NEAR(d[i], dref[i], 1e-10) << "d(" << i << ")";
+        for (int j = 0; j < i; ++j) {
+          EXPECT_NEAR(L[i * nskip + j], Lref[i * mskip + j], 1e-10)
+              << "L(" << i << ", " << j << ")";
+        }
+      }
+    }
+  }
+}
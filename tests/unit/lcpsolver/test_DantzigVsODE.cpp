@@ -147,6 +147,7 @@ void testDantzigVsODE(dart::test::LCPProblem problem)
   std::vector<dReal> lo_dantzig(n, 0.0); // Standard LCP: x >= 0
   std::vector<dReal> hi_dantzig(n, 1e10);
   std::vector<dReal> A_dense(n * n, 0.0);
+  std::vector<dReal> b_dense(n);
 
   // Copy data
   for (int i = 0; i < n; ++i) {
@@ -156,6 +157,7 @@ void testDantzigVsODE(dart::test::LCPProblem problem)
       A_ode[i * stride + j] = value;
       A_dantzig[i * stride + j] = value;
     }
+    b_dense[i] = problem.b(i);
     b_ode[i] = problem.b(i);
     b_dantzig[i] = problem.b(i);
   }
@@ -191,11 +193,12 @@ void testDantzigVsODE(dart::test::LCPProblem problem)
   EXPECT_TRUE(success_dantzig) << "Dantzig solver failed for " << problem.name;
 
   if (success_ode && success_dantzig) {
-    // Verify both solutions satisfy complementarity conditions
-    EXPECT_TRUE(verifyComplementarity(A_dense, x_ode, b_ode, w_ode, n))
+    // Verify both solutions satisfy complementarity conditions. The solvers
+    // permute b in place, so check against the original right-hand side.
+    EXPECT_TRUE(verifyComplementarity(A_dense, x_ode, b_dense, w_ode, n))
         << "ODE solution violates complementarity for " << problem.name;
     EXPECT_TRUE(
-        verifyComplementarity(A_dense, x_dantzig, b_dantzig, w_dantzig, n))
+        verifyComplementarity(A_dense, x_dantzig, b_dense, w_dantzig, n))
         << "Dantzig solution violates complementarity for " << problem.name;
 
     // Solutions should match (both should find the same solution)
@@ -247,3 +250,15 @@ TEST(DantzigVsODE, Problem48D)
 {
   testDantzigVsODE(dart::test::LCPTestProblems::getProblem48D());
 }
+
+//==============================================================================
+TEST(DantzigVsODE, Problem96D)
+{
+  testDantzigVsODE(dart::test::LCPTestProblems::getProblem96D());
+}
+
+//==============================================================================
+TEST(DantzigVsODE, Problem192D)
+{
+  testDantzigVsODE(dart::test::LCPTestProblems::getProblem192D());
+}
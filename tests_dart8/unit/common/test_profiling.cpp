@@ -0,0 +1,318 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// Exercise the built-in backend regardless of the build configuration
+#ifndef DART8_ENABLE_PROFILING
+  #define DART8_ENABLE_PROFILING
+#endif
+#undef TRACY_ENABLE
+
+#include <dart8/common/profiling.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace dart8::common;
+
+namespace {
+
+void innerWork()
+{
+  DART8_PROFILE_SCOPE("profiling_test_inner");
+  volatile double sum = 0.0;
+  for (int i = 0; i < 100; ++i) {
+    sum = sum + i;
+  }
+}
+
+void outerWork()
+{
+  DART8_PROFILE_SCOPE("profiling_test_outer");
+  innerWork();
+  innerWork();
+}
+
+const ProfileStats::Entry* findEntry(
+    const std::vector<ProfileStats::Entry>& entries, const std::string& name)
+{
+  const auto it
+      = std::find_if(entries.begin(), entries.end(), [&](const auto& entry) {
+          return entry.name == name;
+        });
+  return it == entries.end() ? nullptr : &*it;
+}
+
+std::size_t countOccurrences(const std::string& text, const std::string& word)
+{
+  std::size_t count = 0;
+  for (auto pos = text.find(word); pos != std::string::npos;
+       pos = text.find(word, pos + word.size())) {
+    ++count;
+  }
+  return count;
+}
+
+} // namespace
+
+//==============================================================================
+TEST(Profiling, ZonesAreInternedByName)
+{
+  const ProfileZone a("profiling_test_zone");
+  const ProfileZone b("profiling_test_zone");
+  const ProfileZone c("profiling_test_other_zone");
+
+  EXPECT_EQ(a.getId(), b.getId());
+  EXPECT_NE(a.getId(), c.getId());
+  EXPECT_EQ(a.getName(), "profiling_test_zone");
+}
+
+//==============================================================================
+TEST(Profiling, RecordsNestedZonesAsCallTree)
+{
+  ProfileStats::reset();
+  for (int i = 0; i < 10; ++i) {
+    outerWork();
+  }
+  innerWork();
+
+  const auto entries = ProfileStats::summary();
+  const auto* outer = findEntry(entries, "profiling_test_outer");
+  const auto* inner = findEntry(entries, "profiling_test_inner");
+  ASSERT_NE(outer, nullptr);
+  ASSERT_NE(inner, nullptr);
+  EXPECT_EQ(outer->count, 10);
+  EXPECT_EQ(inner->count, 21);
+  EXPECT_LE(outer->selfNanoseconds, outer->totalNanoseconds);
+  EXPECT_LE(outer->minNanoseconds, outer->maxNanoseconds);
+
+  // The inner zone appears below the outer zone and at the top level
+  std::size_t nestedCalls = 0;
+  std::size_t topLevelCalls = 0;
+  for (const auto& node : ProfileStats::callTree()) {
+    if (node.name == "profiling_test_inner") {
+      (node.depth == 1 ? nestedCalls : topLevelCalls) += node.count;
+    }
+  }
+  EXPECT_EQ(nestedCalls, 20u);
+  EXPECT_EQ(topLevelCalls, 1u);
+
+  std::ostringstream output;
+  ProfileStats::printCallTree(output);
+  EXPECT_NE(output.str().find("    profiling_test_inner"), std::string::npos);
+
+  ProfileStats::reset();
+  EXPECT_TRUE(ProfileStats::summary().empty());
+}
+
+//==============================================================================
+TEST(Profiling, ThreadsRecordIndependently)
+{
+  ProfileStats::reset();
+
+  constexpr int numThreads = 4;
+  constexpr int numCalls = 1000;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < numThreads; ++t) {
+    threads.emplace_back([] {
+      for (int i = 0; i < numCalls; ++i) {
+        outerWork();
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  const auto entries = ProfileStats::summary();
+  const auto* outer = findEntry(entries, "profiling_test_outer");
+  const auto* inner = findEntry(entries, "profiling_test_inner");
+  ASSERT_NE(outer, nullptr);
+  ASSERT_NE(inner, nullptr);
+  EXPECT_EQ(outer->count, numThreads * numCalls);
+  EXPECT_EQ(inner->count, 2 * numThreads * numCalls);
+}
+
+//==============================================================================
+TEST(Profiling, ExitedThreadsAreMerged)
+{
+  ProfileStats::reset();
+
+  // Threads that never run at the same time get distinct indices and start
+  // from an empty buffer, even though they share one
+  constexpr int numThreads = 8;
+  std::vector<std::size_t> threadIndices;
+  for (int t = 0; t < numThreads; ++t) {
+    std::thread([&] {
+      outerWork();
+      for (const auto& node : ProfileStats::callTree()) {
+        if (node.name == "profiling_test_outer"
+            && node.threadIndex != ProfileStats::exitedThreadIndex) {
+          EXPECT_EQ(node.count, 1);
+          threadIndices.push_back(node.threadIndex);
+        }
+      }
+    }).join();
+  }
+  ASSERT_EQ(threadIndices.size(), static_cast<std::size_t>(numThreads));
+  std::sort(threadIndices.begin(), threadIndices.end());
+  EXPECT_EQ(
+      std::unique(threadIndices.begin(), threadIndices.end()),
+      threadIndices.end());
+
+  // The results of the exited threads are kept in one tree
+  std::size_t numOuterNodes = 0;
+  for (const auto& node : ProfileStats::callTree()) {
+    if (node.name == "profiling_test_outer") {
+      EXPECT_EQ(node.threadIndex, ProfileStats::exitedThreadIndex);
+      EXPECT_EQ(node.count, numThreads);
+      ++numOuterNodes;
+    }
+  }
+  EXPECT_EQ(numOuterNodes, 1u);
+
+  const auto entries = ProfileStats::summary();
+  const auto* outer = findEntry(entries, "profiling_test_outer");
+  const auto* inner = findEntry(entries, "profiling_test_inner");
+  ASSERT_NE(outer, nullptr);
+  ASSERT_NE(inner, nullptr);
+  EXPECT_EQ(outer->count, numThreads);
+  EXPECT_EQ(inner->count, 2 * numThreads);
+
+  ProfileStats::reset();
+  EXPECT_TRUE(ProfileStats::summary().empty());
+}
+
+//==============================================================================
+TEST(Profiling, ReadsWhileThreadsRecord)
+{
+  ProfileStats::reset();
+  ProfileStats::setTraceEnabled(true);
+
+  constexpr int numThreads = 4;
+  constexpr int numCalls = 2000;
+  std::atomic<bool> done{false};
+  std::thread reader([&] {
+    while (!done.load()) {
+      for (const auto& entry : ProfileStats::summary()) {
+        EXPECT_GE(entry.count, 0);
+      }
+      (void)ProfileStats::callTree();
+      std::ostringstream output;
+      ProfileStats::writeChromeTrace(output);
+    }
+  });
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < numThreads; ++t) {
+    threads.emplace_back([] {
+      for (int i = 0; i < numCalls; ++i) {
+        outerWork();
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  done = true;
+  reader.join();
+
+  const auto entries = ProfileStats::summary();
+  const auto* outer = findEntry(entries, "profiling_test_outer");
+  ASSERT_NE(outer, nullptr);
+  EXPECT_EQ(outer->count, numThreads * numCalls);
+
+  ProfileStats::setTraceEnabled(false);
+  ProfileStats::reset();
+}
+
+//==============================================================================
+TEST(Profiling, ScopedTimerRecordsZone)
+{
+  static const ProfileZone zone("profiling_test_timer");
+  ProfileStats::reset();
+  {
+    const ScopedTimer timer(zone);
+    innerWork();
+  }
+  {
+    const ScopedTimer timer("profiling_test_timer");
+  }
+
+  const auto entries = ProfileStats::summary();
+  const auto* timer = findEntry(entries, "profiling_test_timer");
+  ASSERT_NE(timer, nullptr);
+  EXPECT_EQ(timer->count, 2);
+  ProfileStats::reset();
+}
+
+//==============================================================================
+TEST(Profiling, ExportsChromeTrace)
+{
+  ProfileStats::reset();
+  ProfileStats::setTraceEnabled(true);
+  EXPECT_TRUE(ProfileStats::isTraceEnabled());
+
+  outerWork();
+  {
+    DART8_PROFILE_BEGIN(profiling_test_manual);
+    innerWork();
+    DART8_PROFILE_END(profiling_test_manual);
+  }
+
+  std::ostringstream output;
+  ProfileStats::writeChromeTrace(output);
+  const std::string trace = output.str();
+
+  EXPECT_EQ(trace.rfind("{\"traceEvents\":[", 0), 0u);
+  EXPECT_EQ(countOccurrences(trace, "\"ph\":\"X\""), 5u);
+  EXPECT_EQ(countOccurrences(trace, "\"profiling_test_inner\""), 3u);
+  EXPECT_EQ(countOccurrences(trace, "\"profiling_test_manual\""), 1u);
+
+  // Events beyond the capacity are dropped
+  ProfileStats::reset();
+  ProfileStats::setTraceCapacity(2);
+  outerWork();
+  outerWork();
+  output.str("");
+  ProfileStats::writeChromeTrace(output);
+  EXPECT_EQ(countOccurrences(output.str(), "\"ph\":\"X\""), 2u);
+
+  ProfileStats::setTraceCapacity(std::size_t{1} << 20);
+  ProfileStats::setTraceEnabled(false);
+  ProfileStats::reset();
+}
@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <dart8/body/rigid_body.hpp>
+#include <dart8/common/exceptions.hpp>
+#include <dart8/multi_body/joint.hpp>
+#include <dart8/multi_body/link.hpp>
+#include <dart8/multi_body/multi_body.hpp>
+#include <dart8/world.hpp>
+
+#include <Eigen/Geometry>
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+namespace {
+
+constexpr double kGravity = 9.81;
+
+// Adds a pendulum rotating about the y-axis with its center of mass at
+// distance `length` from the pivot, initially horizontal along +x
+dart8::Joint addPendulum(
+    dart8::MultiBody& multiBody,
+    dart8::Link parent,
+    std::string_view name,
+    double length,
+    double mass)
+{
+  Eigen::Isometry3d jointToLink = Eigen::Isometry3d::Identity();
+  jointToLink.translation() << length, 0.0, 0.0;
+
+  return multiBody
+      .addLink(
+          name,
+          {
+              .parentLink = parent,
+              .jointName = std::string(name) + "_joint",
+              .jointType = dart8::comps::JointType::Revolute,
+              .axis = Eigen::Vector3d::UnitY(),
+              .transformFromParentJoint = jointToLink,
+              .mass = mass,
+              .inertia = 0.1 * Eigen::Matrix3d::Identity(),
+          })
+      .getParentJoint();
+}
+
+} // namespace
+
+//==============================================================================
+TEST(ForwardDynamics, PendulumMatchesAnalyticAcceleration)
+{
+  dart8::World world;
+  auto multiBody = world.addMultiBody("pendulum");
+  auto base = multiBody.addLink("base");
+  auto joint = addPendulum(multiBody, base, "arm", 0.5, 2.0);
+
+  world.enterSimulationMode();
+  world.step();
+
+  // (I + m l^2) qdd = m g l cos(q) for gravity along -z
+  const double expected = 2.0 * kGravity * 0.5 / (0.1 + 2.0 * 0.5 * 0.5);
+  ASSERT_EQ(joint.getAcceleration().size(), 1);
+  EXPECT_NEAR(joint.getAcceleration()[0], expected, 1e-9);
+  EXPECT_NEAR(joint.getVelocity()[0], expected * world.getTimeStep(), 1e-12);
+}
+
+//==============================================================================
+TEST(ForwardDynamics, TorqueBalancesGravity)
+{
+  dart8::World world;
+  auto multiBody = world.addMultiBody("pendulum");
+  auto base = multiBody.addLink("base");
+  auto joint = addPendulum(multiBody, base, "arm", 0.5, 2.0);
+  joint.setTorque(Eigen::VectorXd::Constant(1, -2.0 * kGravity * 0.5));
+
+  world.enterSimulationMode();
+  for (int i = 0; i < 10; ++i) {
+    world.step();
+  }
+
+  EXPECT_NEAR(joint.getAcceleration()[0], 0.0, 1e-9);
+  EXPECT_NEAR(joint.getPosition()[0], 0.0, 1e-12);
+}
+
+//==============================================================================
+TEST(ForwardDynamics, PrismaticChainFallsFreely)
+{
+  dart8::World world;
+  auto multiBody = world.addMultiBody("chain");
+  auto base = multiBody.addLink("base");
+
+  auto slider = multiBody.addLink(
+      "carriage",
+      {
+          .parentLink = base,
+          .jointName = "slider",
+          .jointType = dart8::comps::JointType::Prismatic,
+          .axis = Eigen::Vector3d::UnitZ(),
+          .mass = 3.0,
+      });
+
+  // A revolute child about the slider axis does not change the vertical
+  // dynamics
+  auto spinner = multiBody.addLink(
+      "rotor",
+      {
+          .parentLink = slider,
+          .jointName = "spinner",
+          .jointType = dart8::comps::JointType::Revolute,
+          .axis = Eigen::Vector3d::UnitZ(),
+          .mass = 1.0,
+      });
+
+  world.enterSimulationMode();
+  const int numSteps = 100;
+  for (int i = 0; i < numSteps; ++i) {
+    world.step();
+  }
+
+  const double time = numSteps * world.getTimeStep();
+  EXPECT_NEAR(world.getTime(), time, 1e-12);
+
+  auto sliderJoint = slider.getParentJoint();
+  EXPECT_NEAR(sliderJoint.getAcceleration()[0], -kGravity, 1e-9);
+  EXPECT_NEAR(sliderJoint.getVelocity()[0], -kGravity * time, 1e-9);
+  EXPECT_NEAR(spinner.getParentJoint().getAcceleration()[0], 0.0, 1e-9);
+
+  // The link poses follow the joint positions
+  const double height = sliderJoint.getPosition()[0];
+  EXPECT_LT(height, 0.0);
+  EXPECT_NEAR(slider.getTransform().translation().z(), height, 1e-12);
+  EXPECT_NEAR(spinner.getTransform().translation().z(), height, 1e-12);
+}
+
+//==============================================================================
+TEST(ForwardDynamics, DoublePendulumSwingsDown)
+{
+  dart8::World world;
+  world.setTimeStep(1e-4);
+  auto multiBody = world.addMultiBody("double_pendulum");
+  auto base = multiBody.addLink("base");
+  auto joint1 = addPendulum(multiBody, base, "upper", 0.5, 1.0);
+  auto upper = joint1.getChildLink();
+  auto joint2 = addPendulum(multiBody, upper, "lower", 0.5, 1.0);
+  auto lower = joint2.getChildLink();
+
+  // Potential energy of the two unit masses
+  auto potential = [&]() {
+    return kGravity
+           * (upper.getTransform().translation().z()
+              + lower.getTransform().translation().z());
+  };
+
+  world.enterSimulationMode();
+  const double initialHeight = potential();
+  for (int i = 0; i < 2000; ++i) {
+    world.step();
+  }
+
+  // The chain swings down from rest, so it gains kinetic energy
+  EXPECT_LT(potential(), initialHeight);
+  EXPECT_GT(joint1.getVelocity()[0], 0.0);
+}
+
+//==============================================================================
+TEST(ForwardDynamics, RigidBodyFallsFreely)
+{
+  dart8::World world;
+
+  dart8::RigidBodyOptions options;
+  options.mass = 2.0;
+  options.position = Eigen::Vector3d(0.0, 0.0, 1.0);
+  options.angularVelocity = Eigen::Vector3d(0.0, 0.0, 1.0);
+  auto body = world.addRigidBody("box", options);
+
+  world.enterSimulationMode();
+  const int numSteps = 100;
+  for (int i = 0; i < numSteps; ++i) {
+    world.step();
+  }
+
+  const double time = numSteps * world.getTimeStep();
+  EXPECT_NEAR(body.getLinearVelocity().z(), -kGravity * time, 1e-9);
+  EXPECT_TRUE(body.getAngularVelocity().isApprox(Eigen::Vector3d::UnitZ()));
+  EXPECT_LT(body.getTransform().translation().z(), 1.0);
+
+  // Forces act for a single step only
+  body.addForce(Eigen::Vector3d(0.0, 0.0, 2.0 * kGravity));
+  const Eigen::Vector3d before = body.getLinearVelocity();
+  world.step();
+  EXPECT_TRUE(body.getLinearVelocity().isApprox(before));
+  world.step();
+  EXPECT_NEAR(
+      body.getLinearVelocity().z() - before.z(),
+      -kGravity * world.getTimeStep(),
+      1e-12);
+}
+
+//==============================================================================
+TEST(ForwardDynamics, InvalidArguments)
+{
+  dart8::World world;
+  EXPECT_THROW(world.step(), dart8::InvalidArgumentException);
+  EXPECT_THROW(world.setTimeStep(0.0), dart8::InvalidArgumentException);
+
+  auto multiBody = world.addMultiBody("robot");
+  auto base = multiBody.addLink("base");
+  auto joint = addPendulum(multiBody, base, "arm", 0.5, 1.0);
+  EXPECT_THROW(
+      joint.setPosition(Eigen::VectorXd::Zero(2)),
+      dart8::InvalidArgumentException);
+  EXPECT_THROW(
+      joint.setTorque(Eigen::VectorXd::Zero(0)),
+      dart8::InvalidArgumentException);
+}
+
+//==============================================================================
+TEST(ForwardDynamics, UnsupportedJointTypeThrows)
+{
+  dart8::World world;
+  auto multiBody = world.addMultiBody("robot");
+  auto base = multiBody.addLink("base");
+
+  multiBody.addLink(
+      "arm",
+      {
+          .parentLink = base,
+          .jointName = "ball",
+          .jointType = dart8::comps::JointType::Ball,
+      });
+
+  EXPECT_THROW(world.enterSimulationMode(), dart8::NotImplementedException);
+}
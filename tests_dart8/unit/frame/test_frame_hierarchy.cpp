@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2011-2025, The DART development contributors
+ * All rights reserved.
+ *
+ * The list of contributors can be found at:
+ *   https://github.com/dartsim/dart/blob/main/LICENSE
+ *
+ * This file is provided under the following "BSD-style" License:
+ *   Redistribution and use in source and binary forms, with or
+ *   without modification, are permitted provided that the following
+ *   conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ *   CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *   INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ *   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *   DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+ *   USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *   AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *   LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *   ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <dart8/common/constants.hpp>
+#include <dart8/frame/fixed_frame.hpp>
+#include <dart8/frame/frame_hierarchy.hpp>
+#include <dart8/frame/free_frame.hpp>
+#include <dart8/multi_body/joint.hpp>
+#include <dart8/multi_body/link.hpp>
+#include <dart8/multi_body/multi_body.hpp>
+#include <dart8/world.hpp>
+
+#include <Eigen/Geometry>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using namespace dart8;
+
+namespace {
+
+Eigen::Isometry3d makeTransform(double angle, double offset)
+{
+  Eigen::Isometry3d transform = Eigen::Isometry3d::Identity();
+  transform.linear()
+      = Eigen::AngleAxisd(angle, Eigen::Vector3d(1.0, 2.0, 3.0).normalized())
+            .toRotationMatrix();
+  transform.translation() << offset, 0.5 * offset, -offset;
+  return transform;
+}
+
+struct Forest
+{
+  std::vector<FreeFrame> frames;
+
+  /// Index of the parent of each frame, or -1 for the roots
+  std::vector<int> parents;
+};
+
+// Builds `numRoots` binary trees with `depth` levels each
+Forest buildForest(World& world, int numRoots, int depth)
+{
+  Forest forest;
+  std::vector<int> level;
+  for (int i = 0; i < numRoots; ++i) {
+    auto root = world.addFreeFrame("root_" + std::to_string(i));
+    root.setLocalTransform(makeTransform(0.1 * i, 0.01 * i));
+    level.push_back(static_cast<int>(forest.frames.size()));
+    forest.frames.push_back(root);
+    forest.parents.push_back(-1);
+  }
+
+  for (int d = 1; d < depth; ++d) {
+    std::vector<int> next;
+    for (const int parent : level) {
+      for (int c = 0; c < 2; ++c) {
+        auto child = world.addFreeFrame("", forest.frames[parent]);
+        child.setLocalTransform(makeTransform(0.2 * d + c, 0.1 * c + 0.05));
+        next.push_back(static_cast<int>(forest.frames.size()));
+        forest.frames.push_back(child);
+        forest.parents.push_back(parent);
+      }
+    }
+    level = std::move(next);
+  }
+
+  return forest;
+}
+
+// Compares the cached world transforms with the composed local transforms
+void expectConsistent(const Forest& forest)
+{
+  for (std::size_t i = 0; i < forest.frames.size(); ++i) {
+    Eigen::Isometry3d expected = forest.frames[i].getLocalTransform();
+    for (int k = forest.parents[i]; k >= 0; k = forest.parents[k]) {
+      expected = forest.frames[k].getLocalTransform() * expected;
+    }
+    EXPECT_TRUE(forest.frames[i].getTransform().isApprox(expected, 1e-12))
+        << "frame " << i;
+  }
+}
+
+} // namespace
+
+//==============================================================================
+TEST(FrameHierarchy, SortsFramesByDepth)
+{
+  World world;
+  buildForest(world, 3, 4);
+
+  FrameHierarchy hierarchy;
+  hierarchy.update(world.getRegistry(), nullptr);
+
+  EXPECT_EQ(hierarchy.getFrameCount(), 3u * (1 + 2 + 4 + 8));
+  EXPECT_EQ(hierarchy.getLevelCount(), 4u);
+  EXPECT_EQ(hierarchy.getUpdatedFrameCount(), hierarchy.getFrameCount());
+}
+
+//==============================================================================
+TEST(FrameHierarchy, UpdatesOnlyChangedSubtrees)
+{
+  World world;
+  auto forest = buildForest(world, 2, 3);
+  auto& frames = forest.frames;
+  world.enterSimulationMode();
+  expectConsistent(forest);
+
+  FrameHierarchy hierarchy;
+  hierarchy.update(world.getRegistry(), nullptr);
+
+  // Nothing changed since the last update
+  hierarchy.update(world.getRegistry(), nullptr);
+  EXPECT_EQ(hierarchy.getUpdatedFrameCount(), 0u);
+
+  // A root frame with two levels of descendants
+  frames[0].setLocalTransform(makeTransform(0.7, 0.3));
+  hierarchy.update(world.getRegistry(), nullptr);
+  EXPECT_EQ(hierarchy.getUpdatedFrameCount(), 1u + 2u + 4u);
+  expectConsistent(forest);
+
+  // A leaf frame
+  frames.back().setLocalTransform(makeTransform(-0.4, 0.2));
+  hierarchy.update(world.getRegistry(), nullptr);
+  EXPECT_EQ(hierarchy.getUpdatedFrameCount(), 1u);
+  expectConsistent(forest);
+}
+
+//==============================================================================
+TEST(FrameHierarchy, ReparentingRebuilds)
+{
+  World world;
+  auto a = world.addFreeFrame("a");
+  auto b = world.addFreeFrame("b", a);
+  auto c = world.addFreeFrame("c");
+  a.setLocalTransform(makeTransform(0.3, 1.0));
+  c.setLocalTransform(makeTransform(-0.6, 2.0));
+  b.setLocalTransform(makeTransform(0.9, 0.5));
+  world.enterSimulationMode();
+
+  EXPECT_TRUE(b.getTransform().isApprox(
+      a.getLocalTransform() * b.getLocalTransform()));
+
+  // Both frames now hang below a frame that comes later in storage order
+  a.setParentFrame(c);
+  b.setParentFrame(c);
+  world.updateKinematics();
+  EXPECT_TRUE(b.getTransform().isApprox(
+      c.getLocalTransform() * b.getLocalTransform()));
+  EXPECT_TRUE(a.getTransform().isApprox(
+      c.getLocalTransform() * a.getLocalTransform()));
+}
+
+//==============================================================================
+TEST(FrameHierarchy, FramesAttachedToLinksFollowJoints)
+{
+  World world;
+  auto multiBody = world.addMultiBody("arm");
+  auto base = multiBody.addLink("base");
+  auto link = multiBody.addLink(
+      "link",
+      {
+          .parentLink = base,
+          .jointName = "joint",
+          .jointType = comps::JointType::Revolute,
+          .axis = Eigen::Vector3d::UnitZ(),
+      });
+  Eigen::Isometry3d offset = Eigen::Isometry3d::Identity();
+  offset.translation() << 1.0, 0.0, 0.0;
+  auto tool = world.addFixedFrame("tool", link, offset);
+
+  world.enterSimulationMode();
+  EXPECT_TRUE(tool.getTransform().translation().isApprox(
+      Eigen::Vector3d(1.0, 0.0, 0.0)));
+
+  link.getParentJoint().setPosition(
+      Eigen::VectorXd::Constant(1, 0.5 * pi));
+  world.updateKinematics();
+  EXPECT_TRUE(tool.getTransform().translation().isApprox(
+      Eigen::Vector3d(0.0, 1.0, 0.0)));
+}
+
+//==============================================================================
+TEST(FrameHierarchy, ParallelMatchesSerial)
+{
+  World serialWorld;
+  World parallelWorld;
+  parallelWorld.setNumThreads(4);
+  EXPECT_EQ(parallelWorld.getNumThreads(), 4u);
+
+  // 2048 frames on the widest level so that it is split across the threads
+  auto serialForest = buildForest(serialWorld, 256, 4);
+  auto parallelForest = buildForest(parallelWorld, 256, 4);
+  auto& serialFrames = serialForest.frames;
+  auto& parallelFrames = parallelForest.frames;
+  serialWorld.enterSimulationMode();
+  parallelWorld.enterSimulationMode();
+
+  for (int i = 0; i < 3; ++i) {
+    serialFrames[i * 7].setLocalTransform(makeTransform(0.1 * i, 0.2));
+    parallelFrames[i * 7].setLocalTransform(makeTransform(0.1 * i, 0.2));
+    serialWorld.updateKinematics();
+    parallelWorld.updateKinematics();
+
+    for (std::size_t k = 0; k < serialFrames.size(); ++k) {
+      ASSERT_TRUE(parallelFrames[k].getTransform().isApprox(
+          serialFrames[k].getTransform(), 0.0))
+          << "frame " << k;
+    }
+  }
+  expectConsistent(parallelForest);
+
+  parallelWorld.setNumThreads(1);
+  EXPECT_EQ(parallelWorld.getNumThreads(), 1u);
+}
@@ -413,3 +413,103 @@ TEST(AutoMapper, EigenConversion)
   EXPECT_DOUBLE_EQ(modified.angular.y(), 50.0);
   EXPECT_DOUBLE_EQ(modified.angular.z(), 60.0);
 }
+
+struct MixedData
+{
+  static constexpr ComponentCategory category = ComponentCategory::Property;
+
+  double mass{0.0};
+  int id{0};
+  Eigen::Vector3d position{Eigen::Vector3d::Zero()};
+};
+
+TEST(AutoMapper, CompiledPlanMatchesFieldExtraction)
+{
+  StateSpace space;
+  space.addVariable("nested", 6);   // 2 entities × 3 scalars each
+  space.addVariable("velocity", 12); // 2 entities × 6 scalars each
+  space.finalize();
+
+  VectorMapper mapper(std::move(space));
+  mapper.addMapper("nested", makeAutoMapper<NestedData>());
+  mapper.addMapper("velocity", makeAutoMapper<Velocity>());
+  EXPECT_TRUE(mapper.isCompiled());
+
+  entt::registry registry;
+  for (int i = 0; i < 2; ++i) {
+    auto entity = registry.create();
+    NestedData nested;
+    nested.inner.a = 1.0 + i;
+    nested.inner.b = 2.0 + i;
+    nested.outer = 3.0 + i;
+    registry.emplace<NestedData>(entity, nested);
+    Velocity vel;
+    vel.linear = Eigen::Vector3d::Constant(4.0 + i);
+    vel.angular = Eigen::Vector3d::Constant(5.0 + i);
+    registry.emplace<Velocity>(entity, vel);
+  }
+
+  // The plan must produce what the per-field extraction produces, in view
+  // iteration order
+  std::vector<double> expected(18);
+  size_t offset = 0;
+  for (auto entity : registry.view<NestedData>()) {
+    boost::pfr::for_each_field(
+        registry.get<NestedData>(entity), [&](const auto& field) {
+          offset += extractFieldToVector(field, expected, offset);
+        });
+  }
+  for (auto entity : registry.view<Velocity>()) {
+    boost::pfr::for_each_field(
+        registry.get<Velocity>(entity), [&](const auto& field) {
+          offset += extractFieldToVector(field, expected, offset);
+        });
+  }
+  ASSERT_EQ(offset, 18u);
+  EXPECT_EQ(mapper.toVector(registry), expected);
+
+  // Round trip through the plan
+  std::vector<double> scaled = expected;
+  for (auto& v : scaled) {
+    v *= 2.0;
+  }
+  mapper.fromVector(registry, scaled);
+  EXPECT_EQ(mapper.toVector(registry), scaled);
+}
+
+TEST(AutoMapper, ConvertedFieldsAreNotCompiled)
+{
+  StateSpace space;
+  space.addVariable("transform", 7);
+  space.addVariable("mixed", 5);
+  space.finalize();
+
+  VectorMapper mapper(std::move(space));
+  mapper.addMapper("transform", makeAutoMapper<Transform>());
+  mapper.addMapper("mixed", makeAutoMapper<MixedData>());
+  EXPECT_FALSE(mapper.isCompiled());
+
+  entt::registry registry;
+  auto entity = registry.create();
+  Transform tf;
+  tf.pose.translation() << 1.0, 2.0, 3.0;
+  registry.emplace<Transform>(entity, tf);
+  MixedData mixed;
+  mixed.mass = 4.0;
+  mixed.id = 5;
+  mixed.position << 6.0, 7.0, 8.0;
+  registry.emplace<MixedData>(entity, mixed);
+
+  // Fallback mappers still work through the span and Eigen overloads
+  Eigen::VectorXd vec = Eigen::VectorXd::Zero(12);
+  mapper.toEigen(registry, vec);
+  EXPECT_DOUBLE_EQ(vec[0], 1.0);
+  EXPECT_DOUBLE_EQ(vec[3], 1.0); // Quaternion w
+  EXPECT_DOUBLE_EQ(vec[7], 4.0);
+  EXPECT_DOUBLE_EQ(vec[8], 5.0);
+  EXPECT_DOUBLE_EQ(vec[11], 8.0);
+
+  vec[8] = 9.0;
+  mapper.fromEigen(registry, vec);
+  EXPECT_EQ(registry.get<MixedData>(entity).id, 9);
+}
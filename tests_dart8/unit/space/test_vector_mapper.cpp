@@ -34,9 +34,14 @@
 #include "dart8/space/state_space.hpp"
 #include "dart8/space/vector_mapper.hpp"
 
+#include <Eigen/Core>
 #include <entt/entt.hpp>
 #include <gtest/gtest.h>
 
+#include <array>
+#include <span>
+#include <vector>
+
 using namespace dart8;
 
 // Test component
@@ -355,3 +360,157 @@ TEST(VectorMapper, NoMapperFillsZeros)
   EXPECT_DOUBLE_EQ(vec[1], 0.0);
   EXPECT_DOUBLE_EQ(vec[2], 0.0);
 }
+
+// Test component whose mapped fields are not at the start of the component
+struct Body
+{
+  int id{0};
+  Eigen::Vector3d position{Eigen::Vector3d::Zero()};
+  double mass{0.0};
+};
+
+TEST(VectorMapper, CompiledFieldMappersFollowViewOrder)
+{
+  StateSpace space;
+  space.addVariable("positions", 9); // 3 entities × 3 DOF each
+  space.addVariable("masses", 3);
+  space.finalize();
+
+  VectorMapper mapper(space);
+  mapper.addMapper(
+      "positions",
+      std::make_unique<FieldMapper<Body, Eigen::Vector3d>>(&Body::position));
+  mapper.addMapper(
+      "masses", std::make_unique<FieldMapper<Body, double>>(&Body::mass));
+  EXPECT_TRUE(mapper.isCompiled());
+
+  entt::registry registry;
+  for (int i = 0; i < 3; ++i) {
+    registry.emplace<Body>(
+        registry.create(),
+        Body{i, Eigen::Vector3d(i, 10.0 + i, 20.0 + i), 100.0 + i});
+  }
+
+  std::vector<double> expected;
+  for (auto entity : registry.view<Body>()) {
+    const auto& position = registry.get<Body>(entity).position;
+    expected.insert(expected.end(), position.data(), position.data() + 3);
+  }
+  for (auto entity : registry.view<Body>()) {
+    expected.push_back(registry.get<Body>(entity).mass);
+  }
+  EXPECT_EQ(mapper.toVector(registry), expected);
+
+  // Write back through a raw buffer and an Eigen::Map
+  std::array<double, 12> buffer{};
+  mapper.toVector(registry, std::span<double>(buffer));
+  for (auto& v : buffer) {
+    v = -v;
+  }
+  mapper.fromEigen(
+      registry, Eigen::Map<const Eigen::VectorXd>(buffer.data(), 12));
+
+  for (auto entity : registry.view<Body>()) {
+    const auto& body = registry.get<Body>(entity);
+    EXPECT_DOUBLE_EQ(body.position.x(), -body.id);
+    EXPECT_DOUBLE_EQ(body.position.y(), -10.0 - body.id);
+    EXPECT_DOUBLE_EQ(body.mass, -100.0 - body.id);
+  }
+}
+
+TEST(VectorMapper, CompiledAndFallbackMappers)
+{
+  StateSpace space;
+  space.addVariable("scalar", 1);
+  space.addVariable("positions", 3);
+  space.addVariable("unmapped", 2);
+  space.finalize();
+
+  VectorMapper mapper(space);
+  double scalar = 0.0;
+  mapper.addMapper(
+      "scalar",
+      std::make_unique<ScalarMapper>(
+          [](const entt::registry&) { return 42.0; },
+          [&scalar](entt::registry&, double value) { scalar = value; }));
+  mapper.addMapper(
+      "positions",
+      std::make_unique<FieldMapper<Body, Eigen::Vector3d>>(&Body::position));
+  EXPECT_FALSE(mapper.isCompiled());
+
+  entt::registry registry;
+  auto entity = registry.create();
+  registry.emplace<Body>(entity, Body{0, Eigen::Vector3d(1.0, 2.0, 3.0), 1.0});
+
+  std::array<double, 6> buffer;
+  buffer.fill(-1.0);
+  mapper.toVector(registry, std::span<double>(buffer));
+  EXPECT_EQ(buffer, (std::array<double, 6>{42.0, 1.0, 2.0, 3.0, 0.0, 0.0}));
+
+  const std::array<double, 6> input{7.0, 4.0, 5.0, 6.0, 0.0, 0.0};
+  mapper.fromVector(registry, std::span<const double>(input));
+  EXPECT_DOUBLE_EQ(scalar, 7.0);
+  EXPECT_EQ(
+      registry.get<Body>(entity).position, Eigen::Vector3d(4.0, 5.0, 6.0));
+}
+
+TEST(VectorMapper, BatchedRegistries)
+{
+  StateSpace space;
+  space.addVariable("positions", 6); // 2 entities × 3 DOF each
+  space.finalize();
+
+  VectorMapper mapper(space);
+  mapper.addMapper(
+      "positions",
+      std::make_unique<FieldMapper<Body, Eigen::Vector3d>>(&Body::position));
+
+  std::vector<entt::registry> registries(4);
+  std::vector<entt::registry*> pointers;
+  std::vector<const entt::registry*> constPointers;
+  for (size_t i = 0; i < registries.size(); ++i) {
+    for (int j = 0; j < 2; ++j) {
+      registries[i].emplace<Body>(
+          registries[i].create(),
+          Body{j, Eigen::Vector3d::Constant(10.0 * i + j), 1.0});
+    }
+    pointers.push_back(&registries[i]);
+    constPointers.push_back(&registries[i]);
+  }
+
+  Eigen::MatrixXd states(6, 4);
+  mapper.toMatrix(constPointers, states);
+  for (size_t i = 0; i < registries.size(); ++i) {
+    EXPECT_EQ(Eigen::VectorXd(states.col(i)), mapper.toEigen(registries[i]));
+  }
+
+  states.array() += 1.0;
+  mapper.fromMatrix(pointers, states);
+  for (size_t i = 0; i < registries.size(); ++i) {
+    EXPECT_EQ(mapper.toEigen(registries[i]), Eigen::VectorXd(states.col(i)));
+  }
+
+  Eigen::MatrixXd wrongColumns(6, 3);
+  EXPECT_THROW(
+      mapper.toMatrix(constPointers, wrongColumns), std::invalid_argument);
+}
+
+TEST(VectorMapper, MoreEntitiesThanVectorSize)
+{
+  StateSpace space;
+  space.addVariable("positions", 3);
+  space.finalize();
+
+  VectorMapper mapper(space);
+  mapper.addMapper(
+      "positions",
+      std::make_unique<FieldMapper<Body, Eigen::Vector3d>>(&Body::position));
+
+  entt::registry registry;
+  registry.emplace<Body>(registry.create());
+  registry.emplace<Body>(registry.create());
+
+  std::vector<double> output(3);
+  EXPECT_THROW(mapper.toVector(registry, output), std::out_of_range);
+  EXPECT_THROW(mapper.fromVector(registry, output), std::out_of_range);
+}
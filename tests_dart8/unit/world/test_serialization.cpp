@@ -39,6 +39,8 @@
 #include <dart8/frame/fixed_frame.hpp>
 #include <dart8/frame/frame.hpp>
 #include <dart8/frame/free_frame.hpp>
+#include <dart8/io/binary_io.hpp>
+#include <dart8/io/serializer.hpp>
 #include <dart8/multi_body/joint.hpp>
 #include <dart8/multi_body/link.hpp>
 #include <dart8/multi_body/multi_body.hpp>
@@ -46,8 +48,13 @@
 
 #include <gtest/gtest.h>
 
+#include <format>
 #include <iterator>
 #include <sstream>
+#include <string_view>
+#include <vector>
+
+#include <cstdint>
 
 //==============================================================================
 // Serialization Tests - Comprehensive Coverage
@@ -848,3 +855,219 @@ TEST(Serialization, CloneResetCounters)
   auto nextMb = clone.addMultiBody("");
   EXPECT_EQ(nextMb.getName(), "multibody_002");
 }
+
+//==============================================================================
+// Columnar Snapshot and Delta Tests
+//==============================================================================
+
+namespace {
+
+Eigen::Isometry3d translation(double x, double y, double z)
+{
+  Eigen::Isometry3d T = Eigen::Isometry3d::Identity();
+  T.translate(Eigen::Vector3d(x, y, z));
+  return T;
+}
+
+const Eigen::Isometry3d* findFreeFrameTransform(
+    const dart8::World& world, std::string_view name)
+{
+  const auto& registry = world.getRegistry();
+  auto view
+      = registry.view<dart8::comps::Name, dart8::comps::FreeFrameProperties>();
+  for (auto entity : view) {
+    if (view.get<dart8::comps::Name>(entity).name == name) {
+      return &view.get<dart8::comps::FreeFrameProperties>(entity)
+                  .localTransform;
+    }
+  }
+  return nullptr;
+}
+
+} // namespace
+
+TEST(Serialization, SnapshotRoundTrip)
+{
+  dart8::World world;
+  auto mb = world.addMultiBody("robot");
+  auto base = mb.addLink("base");
+  [[maybe_unused]] auto link1 = mb.addLink(
+      "link1",
+      {.parentLink = base,
+       .jointName = "joint1",
+       .jointType = dart8::comps::JointType::Prismatic,
+       .axis = {1, 0, 0}});
+
+  auto parent = world.addFreeFrame("parent");
+  parent.setLocalTransform(translation(1, 2, 3));
+  auto child = world.addFreeFrame("child", parent);
+  child.setLocalTransform(translation(4, 5, 6));
+
+  std::stringstream ss;
+  world.saveSnapshot(ss);
+
+  dart8::World world2;
+  world2.loadSnapshot(ss);
+
+  auto robot = world2.getMultiBody("robot");
+  ASSERT_TRUE(robot.has_value());
+  EXPECT_EQ(robot->getLinkCount(), 2);
+  EXPECT_EQ(robot->getJointCount(), 1);
+  auto joint1 = robot->getJoint("joint1");
+  ASSERT_TRUE(joint1.has_value());
+  EXPECT_EQ(joint1->getType(), dart8::comps::JointType::Prismatic);
+
+  const auto* T_child = findFreeFrameTransform(world2, "child");
+  ASSERT_NE(T_child, nullptr);
+  EXPECT_TRUE(T_child->isApprox(translation(4, 5, 6)));
+
+  // Packed entity references are remapped to the new entities
+  auto& registry2 = world2.getRegistry();
+  auto view = registry2.view<dart8::comps::Name, dart8::comps::FrameState>();
+  for (auto entity : view) {
+    const auto& state = view.get<dart8::comps::FrameState>(entity);
+    if (view.get<dart8::comps::Name>(entity).name == "child") {
+      ASSERT_TRUE(registry2.valid(state.parentFrame));
+      EXPECT_EQ(
+          registry2.get<dart8::comps::Name>(state.parentFrame).name, "parent");
+    }
+  }
+}
+
+TEST(Serialization, DeltaEncodesOnlyChangedComponents)
+{
+  dart8::World world;
+  std::vector<dart8::FreeFrame> frames;
+  for (int i = 0; i < 64; ++i) {
+    frames.push_back(world.addFreeFrame(std::format("frame_{}", i)));
+  }
+
+  dart8::io::SnapshotBaseline baseline;
+  std::stringstream snapshot;
+  world.saveSnapshot(snapshot, &baseline);
+  EXPECT_TRUE(baseline.valid);
+
+  dart8::World replica;
+  replica.loadSnapshot(snapshot);
+
+  // Unchanged state yields a delta with no sections
+  std::stringstream empty;
+  world.saveDelta(empty, baseline);
+  replica.applyDelta(empty);
+
+  frames[7].setLocalTransform(translation(7, 0, 0));
+  std::stringstream delta;
+  world.saveDelta(delta, baseline);
+  EXPECT_LT(delta.str().size(), snapshot.str().size() / 10);
+  replica.applyDelta(delta);
+
+  const auto* T7 = findFreeFrameTransform(replica, "frame_7");
+  ASSERT_NE(T7, nullptr);
+  EXPECT_TRUE(T7->isApprox(translation(7, 0, 0)));
+  const auto* T8 = findFreeFrameTransform(replica, "frame_8");
+  ASSERT_NE(T8, nullptr);
+  EXPECT_TRUE(T8->isApprox(Eigen::Isometry3d::Identity()));
+
+  // Deltas chain off the advanced baseline
+  frames[8].setLocalTransform(translation(0, 8, 0));
+  std::stringstream next;
+  world.saveDelta(next, baseline);
+  replica.applyDelta(next);
+  EXPECT_TRUE(findFreeFrameTransform(replica, "frame_7")
+                  ->isApprox(translation(7, 0, 0)));
+  EXPECT_TRUE(findFreeFrameTransform(replica, "frame_8")
+                  ->isApprox(translation(0, 8, 0)));
+}
+
+TEST(Serialization, DeltaFallsBackToSnapshotOnStructuralChange)
+{
+  dart8::World world;
+  world.addFreeFrame("first");
+
+  dart8::io::SnapshotBaseline baseline;
+  std::stringstream snapshot;
+  world.saveSnapshot(snapshot, &baseline);
+
+  dart8::World replica;
+  replica.loadSnapshot(snapshot);
+
+  auto second = world.addFreeFrame("second");
+  second.setLocalTransform(translation(0, 0, 2));
+  std::stringstream delta;
+  world.saveDelta(delta, baseline);
+  replica.applyDelta(delta);
+
+  const auto* T = findFreeFrameTransform(replica, "second");
+  ASSERT_NE(T, nullptr);
+  EXPECT_TRUE(T->isApprox(translation(0, 0, 2)));
+  ASSERT_NE(findFreeFrameTransform(replica, "first"), nullptr);
+
+  // Later deltas apply against the rebuilt state
+  second.setLocalTransform(translation(0, 0, 3));
+  std::stringstream next;
+  world.saveDelta(next, baseline);
+  replica.applyDelta(next);
+  EXPECT_TRUE(findFreeFrameTransform(replica, "second")
+                  ->isApprox(translation(0, 0, 3)));
+}
+
+TEST(Serialization, LoadSnapshotRejectsDelta)
+{
+  dart8::World world;
+  world.addFreeFrame("frame");
+
+  dart8::io::SnapshotBaseline baseline;
+  std::stringstream snapshot;
+  world.saveSnapshot(snapshot, &baseline);
+
+  std::stringstream delta;
+  world.saveDelta(delta, baseline);
+
+  dart8::World replica;
+  EXPECT_THROW(replica.loadSnapshot(delta), std::runtime_error);
+}
+
+TEST(Serialization, LoadersRejectOtherStreamKinds)
+{
+  dart8::World world;
+  world.addFreeFrame("frame");
+
+  std::stringstream binary;
+  world.saveBinary(binary);
+  std::stringstream snapshot;
+  world.saveSnapshot(snapshot);
+
+  dart8::World replica;
+  EXPECT_THROW(replica.loadSnapshot(binary), std::runtime_error);
+  binary.seekg(0);
+  EXPECT_THROW(replica.applyDelta(binary), std::runtime_error);
+  EXPECT_THROW(replica.loadBinary(snapshot), std::runtime_error);
+}
+
+TEST(Serialization, LoadsVersion1BinaryStream)
+{
+  dart8::World world;
+  auto frame = world.addFreeFrame("frame");
+  frame.setLocalTransform(translation(1, 2, 3));
+
+  std::stringstream binary;
+  world.saveBinary(binary);
+
+  // Version 1 had no stream kind tag after the magic number and version
+  const std::string current = binary.str();
+  std::stringstream version1;
+  dart8::io::writePOD(version1, std::uint32_t{0x44525437});
+  dart8::io::writePOD(version1, std::uint32_t{1});
+  version1 << current.substr(
+      2 * sizeof(std::uint32_t) + sizeof(dart8::io::StreamKind));
+
+  dart8::World replica;
+  replica.loadBinary(version1);
+  const auto* T_frame = findFreeFrameTransform(replica, "frame");
+  ASSERT_NE(T_frame, nullptr);
+  EXPECT_TRUE(T_frame->isApprox(translation(1, 2, 3)));
+
+  // Version 1 streams are never snapshots
+  version1.seekg(0);
+  EXPECT_THROW(replica.loadSnapshot(version1), std::runtime_error);
+}